@@ -25,6 +25,8 @@
 #define __ADABOOST_PREDICT_IMPL_I__
 
 #include "service_micro_table.h"
+#include "service_defines.h"
+#include "boosting_blocks_impl.i"
 
 namespace daal
 {
@@ -42,6 +44,8 @@ void AdaBoostPredictKernel<method, algorithmFPType, cpu>::compute(NumericTablePt
                                                                   const Model *m, NumericTablePtr rTable,
                                                                   const Parameter *par)
 {
+    using namespace daal::algorithms::boosting::internal;
+
     const algorithmFPType zero = (algorithmFPType)0.0;
     const algorithmFPType one  = (algorithmFPType)1.0;
 
@@ -66,10 +70,18 @@ void AdaBoostPredictKernel<method, algorithmFPType, cpu>::compute(NumericTablePt
         return;
     }
 
-    for (size_t j = 0; j < nVectors; j++)
+    size_t nBlocks = getNumberOfBlocks(nVectors);
+    daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
     {
-        r[j] = ((r[j] >= zero) ? one : -one);
-    }
+        size_t nRows = getNumberOfRowsInBlock(nVectors, iBlock);
+        algorithmFPType *rBlock = r + iBlock * nRowsInBlock;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nRows; j++)
+        {
+            rBlock[j] = ((rBlock[j] >= zero) ? one : -one);
+        }
+    } );
 
     mtAlpha.release();
     if(!this->_errors->isEmpty()) { mtR.release(); return; }
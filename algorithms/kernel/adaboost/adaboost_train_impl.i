@@ -42,8 +42,10 @@
 #include "service_memory.h"
 #include "service_micro_table.h"
 #include "service_numeric_table.h"
+#include "service_defines.h"
 
 #include "weak_learner_model.h"
+#include "boosting_blocks_impl.i"
 #include "adaboost_model.h"
 
 using namespace daal::data_management;
@@ -85,6 +87,8 @@ void AdaBoostTrainKernel<method, algorithmFPType, cpu>::adaBoostFreundKernel(
     Model *boostModel, Parameter *parameter, size_t *nWeakLearnersPtr,
     algorithmFPType **alphaPtr)
 {
+    using namespace daal::algorithms::boosting::internal;
+
     services::SharedPtr<daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu> > wTable =
         services::staticPointerCast<daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>, NumericTable>
         (weakLearnerInputTables[2]);
@@ -110,15 +114,36 @@ void AdaBoostTrainKernel<method, algorithmFPType, cpu>::adaBoostFreundKernel(
 
     /* Allocate memory for storing intermediate results */
     errFlag = (algorithmFPType *) daal::services::daal_malloc(nVectors * sizeof(algorithmFPType), 64);
-    if (!errFlag) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+    if (!errFlag) { daal::services::daal_free(alpha); this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
 
-    /* Initialize weights */
-    for (size_t i = 0; i < nVectors; i++)
+    /* Partial sums computed for the blocks of observations */
+    const size_t nBlocks = getNumberOfBlocks(nVectors);
+    algorithmFPType *partialSums = daal::services::internal::service_malloc<algorithmFPType, cpu>(nBlocks);
+    size_t *partialNErr = daal::services::internal::service_malloc<size_t, cpu>(nBlocks);
+    if (!partialSums || !partialNErr)
     {
-        w[i] = invNVectors;
+        daal::services::daal_free(alpha);
+        daal::services::daal_free(errFlag);
+        daal::services::internal::service_free<algorithmFPType, cpu>(partialSums);
+        daal::services::internal::service_free<size_t, cpu>(partialNErr);
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
     }
 
-    services::SharedPtr<weak_learner::training::Batch>   learnerTrain   = parameter->weakLearnerTraining;
+    /* Initialize weights */
+    daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
+    {
+        size_t nRows = getNumberOfRowsInBlock(nVectors, iBlock);
+        algorithmFPType *wBlock = w + iBlock * nRowsInBlock;
+        for (size_t i = 0; i < nRows; i++)
+        {
+            wBlock[i] = invNVectors;
+        }
+    } );
+
+    /* The weak learner is copied for the training call, so that the data it caches between the iterations,
+       such as the bins of the binned stump, does not outlive the call */
+    services::SharedPtr<weak_learner::training::Batch>   learnerTrain   = parameter->weakLearnerTraining->clone();
     learnerTrain->getErrors()->setCanThrow(false);
     learnerTrain->input.set(classifier::training::data,    weakLearnerInputTables[0]);
     learnerTrain->input.set(classifier::training::labels,  weakLearnerInputTables[1]);
@@ -146,7 +171,14 @@ void AdaBoostTrainKernel<method, algorithmFPType, cpu>::adaBoostFreundKernel(
 
         /* Train weak learner's model */
         learnerTrain->computeNoThrow();
-        if(learnerTrain->getErrors()->size() != 0) {daal::services::daal_free(errFlag); this->_errors->add(learnerTrain->getErrors()->getErrors()); return;}
+        if(learnerTrain->getErrors()->size() != 0)
+        {
+            daal::services::daal_free(errFlag);
+            daal::services::internal::service_free<algorithmFPType, cpu>(partialSums);
+            daal::services::internal::service_free<size_t, cpu>(partialNErr);
+            this->_errors->add(learnerTrain->getErrors()->getErrors());
+            return;
+        }
 
         services::SharedPtr<classifier::training::Result> trainingRes = learnerTrain->getResult();
         services::SharedPtr<weak_learner::Model> learnerModel =
@@ -158,21 +190,38 @@ void AdaBoostTrainKernel<method, algorithmFPType, cpu>::adaBoostFreundKernel(
         /* Get weak learner's classification results */
         learnerPredict->inputBase->set(classifier::prediction::model, learnerModel);
         learnerPredict->computeNoThrow();
-        if(learnerPredict->getErrors()->size() != 0) {daal::services::daal_free(errFlag); this->_errors->add(learnerPredict->getErrors()->getErrors()); return;}
+        if(learnerPredict->getErrors()->size() != 0)
+        {
+            daal::services::daal_free(errFlag);
+            daal::services::internal::service_free<algorithmFPType, cpu>(partialSums);
+            daal::services::internal::service_free<size_t, cpu>(partialNErr);
+            this->_errors->add(learnerPredict->getErrors()->getErrors());
+            return;
+        }
 
         /* Calculate weighted error and errFlag: product of predicted * ground_truth */
-        size_t nErr = 0;
-        algorithmFPType errM = zero;
-        for (size_t i = 0; i < nVectors; i++)
+        daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
         {
-            errFlag[i] = -one;
-            if (h[i] * y[i] < zero)
+            size_t startRow = iBlock * nRowsInBlock;
+            size_t nRows = getNumberOfRowsInBlock(nVectors, iBlock);
+            size_t nErrBlock = 0;
+            algorithmFPType errMBlock = zero;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = startRow; i < startRow + nRows; i++)
             {
-                errFlag[i] = one;
-                nErr++;
-                errM += w[i];
+                const bool isError = (h[i] * y[i] < zero);
+                errFlag[i] = (isError ? one : -one);
+                nErrBlock += (size_t)isError;
+                errMBlock += (isError ? w[i] : zero);
             }
-        }
+            partialNErr[iBlock] = nErrBlock;
+            partialSums[iBlock] = errMBlock;
+        } );
+        size_t nErr = 0;
+        algorithmFPType errM = zero;
+        sumPartialResults<size_t>(nBlocks, 1, partialNErr, &nErr);
+        sumPartialResults<algorithmFPType>(nBlocks, 1, partialSums, &errM);
 
         if (nErr == 0)
         {
@@ -191,22 +240,43 @@ void AdaBoostTrainKernel<method, algorithmFPType, cpu>::adaBoostFreundKernel(
         algorithmFPType cM = 0.5 * daal::internal::Math<algorithmFPType,cpu>::sLog((one - errM) / errM);
 
         /* Update weights */
-        for (size_t i = 0; i < nVectors; i++)
+        daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
         {
-            errFlag[i] *= cM;
-        }
-        daal::internal::Math<algorithmFPType,cpu>::vExp(nVectors, errFlag, errFlag);
+            size_t startRow = iBlock * nRowsInBlock;
+            size_t nRows = getNumberOfRowsInBlock(nVectors, iBlock);
+            algorithmFPType *errFlagBlock = errFlag + startRow;
+            algorithmFPType *wBlock = w + startRow;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < nRows; i++)
+            {
+                errFlagBlock[i] *= cM;
+            }
+            daal::internal::Math<algorithmFPType,cpu>::vExp(nRows, errFlagBlock, errFlagBlock);
+            algorithmFPType wSumBlock = zero;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < nRows; i++)
+            {
+                wBlock[i] *= errFlagBlock[i];
+                wSumBlock += wBlock[i];
+            }
+            partialSums[iBlock] = wSumBlock;
+        } );
         algorithmFPType wSum = zero;
-        for (size_t i = 0; i < nVectors; i++)
-        {
-            w[i] *= errFlag[i];
-            wSum += w[i];
-        }
+        sumPartialResults<algorithmFPType>(nBlocks, 1, partialSums, &wSum);
         algorithmFPType invWSum = one / wSum;
-        for (size_t i = 0; i < nVectors; i++)
+        daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
         {
-            w[i] *= invWSum;
-        }
+            size_t nRows = getNumberOfRowsInBlock(nVectors, iBlock);
+            algorithmFPType *wBlock = w + iBlock * nRowsInBlock;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < nRows; i++)
+            {
+                wBlock[i] *= invWSum;
+            }
+        } );
         alpha[m] = cM;
 
         if (errM < accThr) { break; }
@@ -217,6 +287,8 @@ void AdaBoostTrainKernel<method, algorithmFPType, cpu>::adaBoostFreundKernel(
     *alphaPtr  = alpha;
 
     daal::services::daal_free(errFlag);
+    daal::services::internal::service_free<algorithmFPType, cpu>(partialSums);
+    daal::services::internal::service_free<size_t, cpu>(partialNErr);
     return;
 }
 
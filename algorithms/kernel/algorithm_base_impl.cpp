@@ -22,6 +22,7 @@
 */
 
 #include "algorithm_base.h"
+#include "service_trace.h"
 
 namespace daal
 {
@@ -32,6 +33,7 @@ namespace algorithms
  */
 void AlgorithmImpl<batch>::computeNoThrow()
 {
+    DAAL_TRACE_SCOPE("algorithm", "compute");
     CanThrowStatus noThrow(this->_errors.get());
     this->setParameter();
 
@@ -44,6 +46,7 @@ void AlgorithmImpl<batch>::computeNoThrow()
 
     if(this->isChecksEnabled())
     {
+        DAAL_TRACE_SCOPE("algorithm", "compute.checkInput");
         this->checkComputeParams();
         if(this->_errors->size() != 0)
         {
@@ -51,17 +54,23 @@ void AlgorithmImpl<batch>::computeNoThrow()
         }
     }
 
-    this->allocateInputMemory();
-    if(this->_errors->size() != 0)
     {
-        return;
+        DAAL_TRACE_SCOPE("algorithm", "compute.allocateInput");
+        this->allocateInputMemory();
+        if(this->_errors->size() != 0)
+        {
+            return;
+        }
     }
 
-    this->allocateResultMemory();
-    if(this->_errors->size() != 0)
     {
-        this->_errors->add(services::ErrorMemoryAllocationFailed);
-        return;
+        DAAL_TRACE_SCOPE("algorithm", "compute.allocateResult");
+        this->allocateResultMemory();
+        if(this->_errors->size() != 0)
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
     }
 
     this->_ac->setArguments(this->_in, this->_res, this->_par);
@@ -71,6 +80,7 @@ void AlgorithmImpl<batch>::computeNoThrow()
 
     if(this->isChecksEnabled())
     {
+        DAAL_TRACE_SCOPE("algorithm", "compute.checkResult");
         this->checkResult();
         if(this->_errors->size() != 0)
         {
@@ -79,7 +89,11 @@ void AlgorithmImpl<batch>::computeNoThrow()
     }
 
     setupCompute();
-    this->_ac->compute();
+    {
+        DAAL_TRACE_SCOPE("algorithm", "compute.kernel");
+        services::ScopedMemoryAllocator allocatorScope(this->getMemoryAllocator());
+        this->_ac->compute();
+    }
     if(resetFlag)
     {
         resetCompute();
@@ -88,5 +102,144 @@ void AlgorithmImpl<batch>::computeNoThrow()
     _res = this->_ac->getResult();
 }
 
+/**
+ * Computes final results of the algorithm in the %batch mode,
+ * or partial results of the algorithm in %online and %distributed modes without possibility of throwing an exception.
+ */
+template<ComputeMode mode>
+void AlgorithmImpl<mode>::computeNoThrow()
+{
+    DAAL_TRACE_SCOPE("algorithm", "compute");
+    CanThrowStatus noThrow(this->_errors.get());
+    this->setParameter();
+
+    this->_in->setErrorCollection(this->_errors);
+    if(this->_par)
+    {
+        this->_par->setErrorCollection(this->_errors);
+    }
+
+    {
+        DAAL_TRACE_SCOPE("algorithm", "compute.allocateInput");
+        this->allocateInputMemory();
+        if(this->_errors->size() != 0)
+        {
+            return;
+        }
+    }
+
+    if(this->isChecksEnabled())
+    {
+        DAAL_TRACE_SCOPE("algorithm", "compute.checkInput");
+        this->checkComputeParams();
+        if(this->_errors->size() != 0)
+        {
+            return;
+        }
+    }
+
+    {
+        DAAL_TRACE_SCOPE("algorithm", "compute.allocateResult");
+        if(!this->allocatePartialResultMemory())
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+    }
+
+    this->_ac->setArguments(this->_in,  this->_pres, this->_par);
+    this->_ac->setErrorCollection(this->_errors);
+    this->_pres->setErrorCollection(this->_errors);
+
+
+    if(this->isChecksEnabled())
+    {
+        DAAL_TRACE_SCOPE("algorithm", "compute.checkResult");
+        this->checkResult();
+        if(this->_errors->size() != 0)
+        {
+            return;
+        }
+    }
+
+    if(!this->getInitFlag())
+    {
+        this->initPartialResult();
+        this->setInitFlag(true);
+    }
+
+    setupCompute();
+    {
+        DAAL_TRACE_SCOPE("algorithm", "compute.kernel");
+        services::ScopedMemoryAllocator allocatorScope(this->getMemoryAllocator());
+        this->_ac->compute();
+    }
+    resetCompute();
+}
+
+/**
+ * Computes final results of the algorithm using partial results in %online and %distributed modes.
+ */
+template<ComputeMode mode>
+void AlgorithmImpl<mode>::finalizeComputeNoThrow()
+{
+    DAAL_TRACE_SCOPE("algorithm", "finalizeCompute");
+    CanThrowStatus noThrow(this->_errors.get());
+    if(this->isChecksEnabled())
+    {
+        DAAL_TRACE_SCOPE("algorithm", "finalizeCompute.checkInput");
+        this->checkPartialResult();
+        if(this->_errors->size() != 0)
+        {
+            return;
+        }
+    }
+
+    {
+        DAAL_TRACE_SCOPE("algorithm", "finalizeCompute.allocateResult");
+        this->allocateResultMemory();
+        if(this->_errors->size() != 0)
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+    }
+
+    this->_ac->setPartialResult(this->_pres);
+    this->_ac->setResult(this->_res);
+    this->_ac->setErrorCollection(this->_errors);
+
+    if(this->_res)
+    {
+        this->_res->setErrorCollection(this->_errors);
+    }
+
+    if(this->isChecksEnabled())
+    {
+        DAAL_TRACE_SCOPE("algorithm", "finalizeCompute.checkResult");
+        this->checkFinalizeComputeParams();
+        if(this->_errors->size() != 0)
+        {
+            return;
+        }
+    }
+
+    setupFinalizeCompute();
+    {
+        DAAL_TRACE_SCOPE("algorithm", "finalizeCompute.kernel");
+        services::ScopedMemoryAllocator allocatorScope(this->getMemoryAllocator());
+        this->_ac->finalizeCompute();
+    }
+    if(resetFinalizeFlag)
+    {
+        resetFinalizeCompute();
+    }
+}
+
+template DAAL_EXPORT void AlgorithmImpl<online>::computeNoThrow();
+template DAAL_EXPORT void AlgorithmImpl<online>::finalizeComputeNoThrow();
+template DAAL_EXPORT void AlgorithmImpl<distributed>::computeNoThrow();
+template DAAL_EXPORT void AlgorithmImpl<distributed>::finalizeComputeNoThrow();
+
 } // namespace daal
 } // namespace algorithms
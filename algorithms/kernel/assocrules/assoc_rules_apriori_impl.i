@@ -50,16 +50,11 @@ void AssociationRulesKernel<apriori, algorithmFPType, cpu>::compute(const Numeri
     const daal::algorithms::association_rules::Parameter *parameter =
             static_cast<const daal::algorithms::association_rules::Parameter *>(algParameter);
     double minSupport = parameter->minSupport;
-    size_t minItemsetSize = (parameter->minItemsetSize ? parameter->minItemsetSize : 1);
-
-    NumericTable *largeItemsetsTable        = r[0];
-    NumericTable *largeItemsetsSupportTable = r[1];
 
     /* Create association rules data set from input numeric table */
     assocrules_dataset<cpu> data(dataTable, parameter->nTransactions, parameter->nUniqueItems, minSupport);
 
     ItemSetList<cpu> *L = new ItemSetList<cpu>[data.numOfUniqueItems];
-    AssocRule<cpu> *R = NULL;
 
     /* Find "large" itemsets */
     size_t L_size = 0;
@@ -67,6 +62,25 @@ void AssociationRulesKernel<apriori, algorithmFPType, cpu>::compute(const Numeri
     findLargeItemsets((size_t)daal::internal::Math<double,cpu>::sCeil(minSupport * data.numOfTransactions), maxItemsetSize, data, L, &L_size);
     if (this->_errors->size() > 0) { return; }
 
+    writeResults(L, L_size, r, parameter);
+
+    for (size_t i = 0; i < L_size; i++)
+    {
+        L[i].remove();
+    }
+    delete[] L;
+    return;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void AssociationRulesKernel<apriori, algorithmFPType, cpu>::writeResults(ItemSetList<cpu> *L, size_t L_size, NumericTable *r[],
+                                                                         const daal::algorithms::association_rules::Parameter *parameter)
+{
+    size_t minItemsetSize = (parameter->minItemsetSize ? parameter->minItemsetSize : 1);
+
+    NumericTable *largeItemsetsTable        = r[0];
+    NumericTable *largeItemsetsSupportTable = r[1];
+
     /* Allocate memory to store "large" itemsets */
     size_t nLargeItemSets = 0;
     size_t nItemInLargeItemSets = 0;
@@ -90,14 +104,14 @@ void AssociationRulesKernel<apriori, algorithmFPType, cpu>::compute(const Numeri
             maxRulesNum += L[i].size * (exp2LSize - 1) * (exp2LSize);
         }
 
-        R = new AssocRule<cpu>[maxRulesNum];
+        AssocRule<cpu> *R = new AssocRule<cpu>[maxRulesNum];
         if (!R) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
         size_t nRules = 0;            /*<! Number of association rules */
         size_t nLeft  = 0;            /*<! Number of items in left parts of the rules */
         size_t nRight = 0;            /*<! Number of items in right parts of the rules */
         double minConfidence = parameter->minConfidence;
         generateRules(minConfidence, minItemsetSize, L_size, &L, R, &nRules, &nLeft, &nRight);
-        if(this->_errors->size() != 0) { return; }
+        if(this->_errors->size() != 0) { delete[] R; return; }
 
         NumericTable *leftItemsTable    = r[2];
         NumericTable *rightItemsTable   = r[3];
@@ -105,22 +119,15 @@ void AssociationRulesKernel<apriori, algorithmFPType, cpu>::compute(const Numeri
 
         /* Allocate memory to store association rules */
         allocateRulesTableData(leftItemsTable, rightItemsTable, confidenceTable, nLeft, nRight, nRules);
-        if (this->_errors->size() > 0) { return; }
-        if (nRules == 0) { return; }
 
         /* Write association rules into resulting tables */
-        writeRulesTableData(R, parameter->rulesOrder, leftItemsTable, rightItemsTable, confidenceTable);
-        if (this->_errors->size() > 0) { return; }
+        if (this->_errors->size() == 0 && nRules > 0)
+        {
+            writeRulesTableData(R, parameter->rulesOrder, leftItemsTable, rightItemsTable, confidenceTable);
+        }
 
         delete[] R;
     }
-
-    for (size_t i = 0; i < L_size; i++)
-    {
-        L[i].remove();
-    }
-    delete[] L;
-    return;
 }
 
 template <typename algorithmFPType, CpuType cpu>
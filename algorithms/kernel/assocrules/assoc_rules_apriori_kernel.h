@@ -50,6 +50,10 @@ public:
 protected:
     void findLargeItemsets(size_t minSupport, size_t maxItemsetSize, assocrules_dataset<cpu> &data, ItemSetList<cpu> *L, size_t *L_size);
 
+    /** Write "large" itemsets and the association rules built from them into resulting tables */
+    void writeResults(ItemSetList<cpu> *L, size_t L_size, NumericTable *r[],
+                      const daal::algorithms::association_rules::Parameter *parameter);
+
     void allocateItemsetsTableData(ItemSetList<cpu> *L, size_t L_size, size_t minItemsetSize,
                                    NumericTable *largeItemsetsTable, NumericTable *largeItemsetsSupportTable,
                                    size_t *nLargeItemSets, size_t *nItemInLargeItemSets);
@@ -191,6 +191,35 @@ int compareItemsetsBySupport(const void *a, const void *b)
     return 0;
 }
 
+template <CpuType cpu>
+int compareItemsetsByItems(const void *a, const void *b)
+{
+    const assocrules_itemset<cpu> *aa = *((assocrules_itemset<cpu> **)a);
+    const assocrules_itemset<cpu> *bb = *((assocrules_itemset<cpu> **)b);
+
+    for (size_t i = 0; i < aa->size && i < bb->size; i++)
+    {
+        if (aa->items[i] < bb->items[i]) { return -1; }
+        if (bb->items[i] < aa->items[i]) { return  1; }
+    }
+    if (aa->size < bb->size) { return -1; }
+    if (bb->size < aa->size) { return  1; }
+    return 0;
+}
+
+template <CpuType cpu>
+int compareUniqueItemsBySupport(const void *a, const void *b)
+{
+    const assocRulesUniqueItem<cpu> *aa = (const assocRulesUniqueItem<cpu> *)a;
+    const assocRulesUniqueItem<cpu> *bb = (const assocRulesUniqueItem<cpu> *)b;
+
+    if (aa->support < bb->support) { return  1; }
+    if (bb->support < aa->support) { return -1; }
+    if (aa->itemID < bb->itemID) { return -1; }
+    if (bb->itemID < aa->itemID) { return  1; }
+    return 0;
+}
+
 template <CpuType cpu>
 int compareRulesByConfidence(const void *a, const void *b)
 {
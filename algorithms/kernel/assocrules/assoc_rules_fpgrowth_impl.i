@@ -0,0 +1,374 @@
+/* file: assoc_rules_fpgrowth_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of association rules mining algorithm
+//  FP-Growth method.
+//--
+*/
+
+#ifndef __ASSOC_RULES_FPGROWTH_IMPL_I__
+#define __ASSOC_RULES_FPGROWTH_IMPL_I__
+
+#include "threading.h"
+#include "service_sort.h"
+
+#include "assoc_rules_apriori_impl.i"
+#include "assoc_rules_fpgrowth_tree.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+namespace internal
+{
+
+template <typename algorithmFPType, CpuType cpu>
+void AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::compute(const NumericTable *a, size_t nr, NumericTable *r[],
+                                                                     const daal::algorithms::Parameter *algParameter)
+{
+    NumericTable *dataTable = const_cast<NumericTable *>(a);
+    const daal::algorithms::association_rules::Parameter *parameter =
+            static_cast<const daal::algorithms::association_rules::Parameter *>(algParameter);
+    double minSupport = parameter->minSupport;
+
+    /* The first pass over the data set computes the supports of the items and
+       removes the items which support is less than minimum support from the transactions */
+    assocrules_dataset<cpu> data(dataTable, parameter->nTransactions, parameter->nUniqueItems, minSupport);
+
+    ItemSetList<cpu> *L = new ItemSetList<cpu>[data.numOfUniqueItems];
+
+    /* Find "large" itemsets */
+    size_t L_size = 0;
+    size_t maxItemsetSize = ((parameter->maxItemsetSize == 0) ? (size_t) - 1 : parameter->maxItemsetSize);
+    findLargeItemsets((size_t)daal::internal::Math<double,cpu>::sCeil(minSupport * data.numOfTransactions), maxItemsetSize, data, L, &L_size);
+
+    if (this->_errors->size() == 0)
+    {
+        this->writeResults(L, L_size, r, parameter);
+    }
+
+    for (size_t i = 0; i < L_size; i++)
+    {
+        L[i].remove();
+    }
+    delete[] L;
+}
+
+/**
+ *  \brief Find "large" itemsets
+ *
+ *  \param minSupport[in]       minimum support
+ *  \param maxItemsetSize[in]   maximum number of items in a "large" itemset
+ *  \param data[in]             input data set
+ *  \param L[out]               structure containing "large" itemsets
+ *  \param L_size_ptr[out]      size of the array L
+ */
+template <typename algorithmFPType, CpuType cpu>
+void AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::findLargeItemsets(size_t minSupport, size_t maxItemsetSize,
+                                                                               assocrules_dataset<cpu> &data,
+                                                                               ItemSetList<cpu> *L, size_t *L_size_ptr)
+{
+    size_t L_size = 0;
+
+    /* "Large" itemsets of size 1 are the unique items of the data set */
+    this->firstPass(minSupport, data, L, &L_size);
+    *L_size_ptr = L_size;
+    if (L_size == 0 || maxItemsetSize < 2) { return; }
+
+    /* The second pass over the data set builds the prefix tree */
+    FPTree<cpu> tree;
+    if (!buildTree(data, tree)) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+    /* Each item is processed by a separate task that mines the conditional tree of the item */
+    const size_t nItems = tree.nItems;
+    daal::tls<FPGrowthTask<cpu> *> tls([ = ]()-> FPGrowthTask<cpu> *
+    {
+        return new FPGrowthTask<cpu>(nItems);
+    } );
+
+    daal::threader_for(nItems, nItems, [ =, &tls, &tree](size_t itemRank)
+    {
+        FPGrowthTask<cpu> *task = tls.local();
+        if (task->memoryError) { return; }
+
+        FPTree<cpu> condTree;
+        task->prefix[0] = tree.itemId[itemRank];
+        if (!buildConditionalTree(tree, itemRank, minSupport, *task, condTree)) { task->memoryError = true; return; }
+        mineTree(condTree, minSupport, maxItemsetSize, 1, *task);
+    } );
+
+    /* Itemsets found by the threads are collected into the lists of itemsets of the same size */
+    bool memoryError = false;
+    tls.reduce([&](FPGrowthTask<cpu> *task)
+    {
+        memoryError = memoryError || task->memoryError || (task->itemsets.errors->size() > 0);
+        for (auto *current = task->itemsets.start; current != NULL; current = current->next)
+        {
+            size_t itemsetSize = current->itemSet->size;
+            L[itemsetSize - 1].insert(current->itemSet);
+            if (itemsetSize > L_size) { L_size = itemsetSize; }
+        }
+        delete task;
+    } );
+    *L_size_ptr = L_size;
+
+    for (size_t i = 1; i < L_size; i++)
+    {
+        memoryError = memoryError || (L[i].errors->size() > 0);
+    }
+    if (memoryError) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+    /* The order of the itemsets does not depend on the number of threads */
+    for (size_t i = 1; i < L_size; i++)
+    {
+        sortItemsets(L[i]);
+        if (this->_errors->size() > 0) { return; }
+    }
+}
+
+/**
+ *  \brief Build the prefix tree of the transactions
+ *
+ *  \param data[in]     input data set which transactions contain "large" items only
+ *  \param tree[out]    prefix tree
+ *
+ *  \return false if the memory allocation failed
+ */
+template <typename algorithmFPType, CpuType cpu>
+bool AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::buildTree(assocrules_dataset<cpu> &data, FPTree<cpu> &tree)
+{
+    const size_t nItems = data.numOfUniqueItems;
+    assocrules_transaction<cpu> **large_tran = data.large_tran;
+    const size_t numOfLargeTransactions = data.numOfLargeTransactions;
+
+    size_t nTreeItems = 0;
+    for (size_t i = 0; i < numOfLargeTransactions; i++)
+    {
+        nTreeItems += large_tran[i]->size;
+    }
+    if (!tree.init(nItems, nTreeItems)) { return false; }
+
+    /* Ranks of the items in the order of decreasing support */
+    assocRulesUniqueItem<cpu> *rankedItems = new assocRulesUniqueItem<cpu>[nItems];
+    if (!rankedItems) { return false; }
+    for (size_t i = 0; i < nItems; i++)
+    {
+        rankedItems[i] = data.uniq_items[i];
+    }
+    qSort<assocRulesUniqueItem<cpu>, cpu>(nItems, rankedItems, compareUniqueItemsBySupport<cpu>);
+
+    /* The unique items are sorted by their identifiers */
+    const size_t maxItemId = data.uniq_items[nItems - 1].itemID;
+    size_t *itemRank = service_malloc<size_t, cpu>(maxItemId + 1);
+    size_t *path     = service_malloc<size_t, cpu>(nItems);
+    if (!itemRank || !path)
+    {
+        service_free<size_t, cpu>(itemRank);
+        service_free<size_t, cpu>(path);
+        delete[] rankedItems;
+        return false;
+    }
+    for (size_t i = 0; i < nItems; i++)
+    {
+        tree.itemId[i] = rankedItems[i].itemID;
+        itemRank[rankedItems[i].itemID] = i;
+    }
+    delete[] rankedItems;
+
+    for (size_t i = 0; i < numOfLargeTransactions; i++)
+    {
+        const assocrules_transaction<cpu> *tran = large_tran[i];
+        for (size_t j = 0; j < tran->size; j++)
+        {
+            path[j] = itemRank[tran->items[j]];
+        }
+        qSort<size_t, cpu>(tran->size, path);
+
+        /* Repeated items of the transaction are counted once */
+        size_t pathSize = 1;
+        for (size_t j = 1; j < tran->size; j++)
+        {
+            if (path[j] != path[pathSize - 1]) { path[pathSize++] = path[j]; }
+        }
+        tree.insert(path, pathSize, 1);
+    }
+
+    service_free<size_t, cpu>(itemRank);
+    service_free<size_t, cpu>(path);
+    return true;
+}
+
+/**
+ *  \brief Build the conditional tree of the item from its conditional pattern base,
+ *         that is the set of the paths from the root to the nodes of the item.
+ *         Items of the conditional tree are the "large" items of the pattern base ranked in the same order as in the tree
+ *
+ *  \param tree[in]         prefix tree
+ *  \param itemRank[in]     rank of the item in the tree
+ *  \param minSupport[in]   minimum support
+ *  \param task[in,out]     buffers of the thread
+ *  \param condTree[out]    conditional tree, it has no items if the pattern base has no "large" items
+ *
+ *  \return false if the memory allocation failed
+ */
+template <typename algorithmFPType, CpuType cpu>
+bool AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::buildConditionalTree(const FPTree<cpu> &tree, size_t itemRank,
+                                                                                  size_t minSupport, FPGrowthTask<cpu> &task,
+                                                                                  FPTree<cpu> &condTree)
+{
+    size_t *counts  = task.counts;
+    size_t *touched = task.touched;
+    size_t nTouched = 0;
+    size_t nPathItems = 0;
+
+    /* Supports of the items in the pattern base */
+    for (size_t node = tree.head[itemRank]; node != FPTree<cpu>::noNode; node = tree.nextNode[node])
+    {
+        const size_t weight = tree.count[node];
+        for (size_t p = tree.parent[node]; p != 0; p = tree.parent[p])
+        {
+            const size_t item = tree.item[p];
+            if (counts[item] == 0) { touched[nTouched++] = item; }
+            counts[item] += weight;
+            nPathItems++;
+        }
+    }
+
+    /* Keep "large" items in the order of their ranks in the tree */
+    size_t nLarge = 0;
+    for (size_t i = 0; i < nTouched; i++)
+    {
+        if (counts[touched[i]] >= minSupport) { touched[nLarge++] = touched[i]; }
+        else { counts[touched[i]] = 0; }
+    }
+
+    bool status = true;
+    if (nLarge > 0)
+    {
+        qSort<size_t, cpu>(nLarge, touched);
+        status = condTree.init(nLarge, nPathItems);
+        if (status)
+        {
+            for (size_t i = 0; i < nLarge; i++)
+            {
+                task.localRank[touched[i]] = i;
+                condTree.itemId[i] = tree.itemId[touched[i]];
+            }
+
+            size_t *path = task.path;
+            for (size_t node = tree.head[itemRank]; node != FPTree<cpu>::noNode; node = tree.nextNode[node])
+            {
+                /* The path is collected from the node to the root, so the ranks of its items decrease */
+                size_t pathSize = 0;
+                for (size_t p = tree.parent[node]; p != 0; p = tree.parent[p])
+                {
+                    if (counts[tree.item[p]] > 0) { path[pathSize++] = task.localRank[tree.item[p]]; }
+                }
+                for (size_t i = 0; i < pathSize / 2; i++)
+                {
+                    size_t tmp = path[i];
+                    path[i] = path[pathSize - 1 - i];
+                    path[pathSize - 1 - i] = tmp;
+                }
+                if (pathSize > 0) { condTree.insert(path, pathSize, tree.count[node]); }
+            }
+        }
+    }
+
+    for (size_t i = 0; i < nLarge; i++)
+    {
+        counts[touched[i]] = 0;
+    }
+    return status;
+}
+
+/**
+ *  \brief Find "large" itemsets that consist of the prefix and the items of the conditional tree
+ *
+ *  \param tree[in]             conditional tree of the prefix
+ *  \param minSupport[in]       minimum support
+ *  \param maxItemsetSize[in]   maximum number of items in a "large" itemset
+ *  \param prefixSize[in]       number of items in the prefix
+ *  \param task[in,out]         prefix, buffers and "large" itemsets of the thread
+ */
+template <typename algorithmFPType, CpuType cpu>
+void AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::mineTree(const FPTree<cpu> &tree, size_t minSupport,
+                                                                      size_t maxItemsetSize, size_t prefixSize,
+                                                                      FPGrowthTask<cpu> &task)
+{
+    /* All the items of the conditional tree are "large" */
+    for (size_t itemRank = 0; itemRank < tree.nItems; itemRank++)
+    {
+        const size_t itemsetSize = prefixSize + 1;
+        task.prefix[prefixSize] = tree.itemId[itemRank];
+
+        for (size_t i = 0; i < itemsetSize; i++)
+        {
+            task.items[i] = task.prefix[i];
+        }
+        qSort<size_t, cpu>(itemsetSize, task.items);
+        assocrules_itemset<cpu> *iset =
+            new assocrules_itemset<cpu>(itemsetSize, task.items, task.items[itemsetSize - 1], tree.support[itemRank]);
+        if (!iset) { task.memoryError = true; return; }
+        task.itemsets.insert(iset);
+
+        if (itemsetSize >= maxItemsetSize) { continue; }
+
+        FPTree<cpu> condTree;
+        if (!buildConditionalTree(tree, itemRank, minSupport, task, condTree)) { task.memoryError = true; return; }
+        mineTree(condTree, minSupport, maxItemsetSize, itemsetSize, task);
+        if (task.memoryError) { return; }
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::sortItemsets(ItemSetList<cpu> &L_cur)
+{
+    if (L_cur.size < 2) { return; }
+
+    assocrules_itemset<cpu> **itemsetsArray = service_malloc<assocrules_itemset<cpu> *, cpu>(L_cur.size);
+    if (!itemsetsArray) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+    size_t k = 0;
+    for (auto *current = L_cur.start; current != NULL; current = current->next, k++)
+    {
+        itemsetsArray[k] = current->itemSet;
+    }
+
+    qSort<assocrules_itemset<cpu> *, cpu>(L_cur.size, itemsetsArray, compareItemsetsByItems<cpu>);
+
+    k = 0;
+    for (auto *current = L_cur.start; current != NULL; current = current->next, k++)
+    {
+        current->itemSet = itemsetsArray[k];
+    }
+    service_free<assocrules_itemset<cpu> *, cpu>(itemsetsArray);
+}
+
+} // namespace internal
+
+} // namespace association_rules
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
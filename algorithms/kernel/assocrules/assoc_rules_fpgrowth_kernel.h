@@ -0,0 +1,75 @@
+/* file: assoc_rules_fpgrowth_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template function that computes association rules results
+//  using FP-Growth method.
+//--
+*/
+
+#ifndef __ASSOC_RULES_FPGROWTH_KERNEL_H__
+#define __ASSOC_RULES_FPGROWTH_KERNEL_H__
+
+#include "assoc_rules_apriori_kernel.h"
+#include "assoc_rules_fpgrowth_tree.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+namespace internal
+{
+/**
+ *  Structure that contains kernels for FP-Growth association rules mining.
+ *  The "large" itemsets are mined from the prefix tree of the transactions,
+ *  the resulting tables and the association rules are built in the same way as in Apriori method
+ */
+template <typename algorithmFPType, CpuType cpu>
+class AssociationRulesKernel<fpGrowth, algorithmFPType, cpu> : public AssociationRulesKernel<apriori, algorithmFPType, cpu>
+{
+public:
+    /** Find "large" item sets and build association rules */
+    void compute(const NumericTable *a, size_t nr, NumericTable *r[], const daal::algorithms::Parameter *parameter);
+protected:
+    void findLargeItemsets(size_t minSupport, size_t maxItemsetSize, assocrules_dataset<cpu> &data, ItemSetList<cpu> *L, size_t *L_size);
+
+    /** Build the prefix tree of the transactions with the items ranked in the order of decreasing support */
+    bool buildTree(assocrules_dataset<cpu> &data, FPTree<cpu> &tree);
+
+    /** Build the conditional tree from the paths of the tree that end with the item of rank itemRank */
+    bool buildConditionalTree(const FPTree<cpu> &tree, size_t itemRank, size_t minSupport, FPGrowthTask<cpu> &task,
+                              FPTree<cpu> &condTree);
+
+    /** Find "large" itemsets that extend the prefix of size prefixSize by the items of the conditional tree */
+    void mineTree(const FPTree<cpu> &tree, size_t minSupport, size_t maxItemsetSize, size_t prefixSize, FPGrowthTask<cpu> &task);
+
+    /** Sort the itemsets of the list in the lexicographical order of their items */
+    void sortItemsets(ItemSetList<cpu> &L_cur);
+};
+
+} // namespace internal
+
+} // namespace association_rules
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,224 @@
+/* file: assoc_rules_fpgrowth_tree.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the prefix tree of transactions that is used in FP-Growth algorithm
+//--
+*/
+
+#ifndef __ASSOC_RULES_FPGROWTH_TREE_I__
+#define __ASSOC_RULES_FPGROWTH_TREE_I__
+
+#include "service_memory.h"
+#include "assoc_rules_apriori_itemset.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+namespace internal
+{
+
+/**
+ *  \brief Prefix tree of the transactions (FP-tree).
+ *         Items of the tree are the ranks of the "large" items of size 1 in the order of decreasing support.
+ *         Each path from the root stores the common prefix of the transactions sorted by the ranks of the items,
+ *         nodes with the same item are linked into a list that starts in the header of the tree.
+ *         The tree is allocated once for the known total number of items in the inserted transactions
+ */
+template<CpuType cpu>
+struct FPTree
+{
+    static const size_t noNode = (size_t)-1;
+
+    FPTree() : nItems(0), nNodes(0), capacity(0), item(NULL), count(NULL), parent(NULL), firstChild(NULL),
+        nextSibling(NULL), nextNode(NULL), head(NULL), rootChild(NULL), support(NULL), itemId(NULL) {}
+
+    ~FPTree() { release(); }
+
+    /**
+     *  \brief Allocates the tree
+     *
+     *  \param _nItems[in]      Number of items, the ranks of the items are in the range [0, _nItems)
+     *  \param maxNodes[in]     Maximal number of nodes of the tree except the root
+     *
+     *  \return false if the memory allocation failed
+     */
+    bool init(size_t _nItems, size_t maxNodes)
+    {
+        release();
+        nItems   = _nItems;
+        capacity = maxNodes + 1;
+        nNodes   = 1;
+
+        item        = service_malloc<size_t, cpu>(capacity);
+        count       = service_malloc<size_t, cpu>(capacity);
+        parent      = service_malloc<size_t, cpu>(capacity);
+        firstChild  = service_malloc<size_t, cpu>(capacity);
+        nextSibling = service_malloc<size_t, cpu>(capacity);
+        nextNode    = service_malloc<size_t, cpu>(capacity);
+        head        = service_malloc<size_t, cpu>(nItems + 1);
+        rootChild   = service_malloc<size_t, cpu>(nItems + 1);
+        support     = service_calloc<size_t, cpu>(nItems + 1);
+        itemId      = service_malloc<size_t, cpu>(nItems + 1);
+        if (!item || !count || !parent || !firstChild || !nextSibling || !nextNode || !head || !rootChild || !support || !itemId)
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < nItems; i++)
+        {
+            head[i]      = noNode;
+            rootChild[i] = noNode;
+        }
+
+        /* Root of the tree */
+        item[0]        = noNode;
+        count[0]       = 0;
+        parent[0]      = noNode;
+        firstChild[0]  = noNode;
+        nextSibling[0] = noNode;
+        nextNode[0]    = noNode;
+        return true;
+    }
+
+    /**
+     *  \brief Inserts the transaction into the tree
+     *
+     *  \param path[in]     Ranks of the items of the transaction in the increasing order
+     *  \param pathSize[in] Number of items in the transaction
+     *  \param weight[in]   Number of occurrences of the transaction
+     */
+    void insert(const size_t *path, size_t pathSize, size_t weight)
+    {
+        size_t node = 0;
+        for (size_t i = 0; i < pathSize; i++)
+        {
+            const size_t itemRank = path[i];
+            size_t child = (node == 0 ? rootChild[itemRank] : firstChild[node]);
+            if (node != 0)
+            {
+                while (child != noNode && item[child] != itemRank) { child = nextSibling[child]; }
+            }
+
+            if (child == noNode)
+            {
+                child = nNodes++;
+                item[child]        = itemRank;
+                count[child]       = 0;
+                parent[child]      = node;
+                firstChild[child]  = noNode;
+                nextSibling[child] = firstChild[node];
+                firstChild[node]   = child;
+                nextNode[child]    = head[itemRank];
+                head[itemRank]     = child;
+                if (node == 0) { rootChild[itemRank] = child; }
+            }
+
+            count[child]      += weight;
+            support[itemRank] += weight;
+            node = child;
+        }
+    }
+
+    void release()
+    {
+        service_free<size_t, cpu>(item);
+        service_free<size_t, cpu>(count);
+        service_free<size_t, cpu>(parent);
+        service_free<size_t, cpu>(firstChild);
+        service_free<size_t, cpu>(nextSibling);
+        service_free<size_t, cpu>(nextNode);
+        service_free<size_t, cpu>(head);
+        service_free<size_t, cpu>(rootChild);
+        service_free<size_t, cpu>(support);
+        service_free<size_t, cpu>(itemId);
+        item = count = parent = firstChild = nextSibling = nextNode = head = rootChild = support = itemId = NULL;
+        nItems = nNodes = capacity = 0;
+    }
+
+    size_t nItems;          /*<! Number of items in the header of the tree */
+    size_t nNodes;          /*<! Number of nodes including the root */
+    size_t capacity;        /*<! Maximal number of nodes including the root */
+    size_t *item;           /*<! Rank of the item of the node */
+    size_t *count;          /*<! Number of transactions that share the path from the root to the node */
+    size_t *parent;         /*<! Parent of the node */
+    size_t *firstChild;     /*<! First child of the node */
+    size_t *nextSibling;    /*<! Next child of the parent of the node */
+    size_t *nextNode;       /*<! Next node with the same item */
+    size_t *head;           /*<! First node for each item */
+    size_t *rootChild;      /*<! Child of the root for each item */
+    size_t *support;        /*<! Support of each item in the tree */
+    size_t *itemId;         /*<! Identifier of the item in the data set for each rank */
+
+private:
+    FPTree(const FPTree &) {}
+    FPTree &operator=(const FPTree &) { return *this; }
+};
+
+/**
+ *  \brief Data of the thread that mines the conditional trees of the items
+ */
+template<CpuType cpu>
+struct FPGrowthTask
+{
+    FPGrowthTask(size_t nItems) : itemsets(), memoryError(false)
+    {
+        prefix    = service_malloc<size_t, cpu>(nItems + 1);
+        items     = service_malloc<size_t, cpu>(nItems + 1);
+        path      = service_malloc<size_t, cpu>(nItems + 1);
+        touched   = service_malloc<size_t, cpu>(nItems + 1);
+        localRank = service_malloc<size_t, cpu>(nItems + 1);
+        counts    = service_calloc<size_t, cpu>(nItems + 1);
+        memoryError = (!prefix || !items || !path || !touched || !localRank || !counts);
+    }
+
+    ~FPGrowthTask()
+    {
+        service_free<size_t, cpu>(prefix);
+        service_free<size_t, cpu>(items);
+        service_free<size_t, cpu>(path);
+        service_free<size_t, cpu>(touched);
+        service_free<size_t, cpu>(localRank);
+        service_free<size_t, cpu>(counts);
+    }
+
+    size_t *prefix;                 /*<! Identifiers of the items of the itemset the conditional tree is built for */
+    size_t *items;                  /*<! Buffer to sort the items of the found itemset */
+    size_t *path;                   /*<! Buffer to store the path of the conditional tree */
+    size_t *touched;                /*<! Ranks of the items met in the paths of the conditional pattern base */
+    size_t *localRank;              /*<! Ranks of the items in the conditional tree */
+    size_t *counts;                 /*<! Supports of the items in the conditional pattern base, zero between the calls */
+    ItemSetList<cpu> itemsets;      /*<! "Large" itemsets found by the thread */
+    bool memoryError;               /*<! Flag of the memory allocation failure */
+
+private:
+    FPGrowthTask(const FPGrowthTask &) {}
+};
+
+} // namespace internal
+
+} // namespace association_rules
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,176 @@
+/* file: boosting_blocks_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Common functions for the processing of the observations by blocks
+//  in the boosting training and prediction algorithms.
+//--
+*/
+
+#ifndef __BOOSTING_BLOCKS_IMPL_I__
+#define __BOOSTING_BLOCKS_IMPL_I__
+
+#include "numeric_table.h"
+#include "weak_learner_predict.h"
+#include "threading.h"
+#include "service_memory.h"
+#include "service_numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace boosting
+{
+namespace internal
+{
+
+/* Number of observations in the block processed by one task */
+const size_t nRowsInBlock = 1024;
+
+inline size_t getNumberOfBlocks(size_t nVectors)
+{
+    size_t nBlocks = nVectors / nRowsInBlock;
+    nBlocks += (nBlocks * nRowsInBlock != nVectors);
+    return nBlocks;
+}
+
+inline size_t getNumberOfRowsInBlock(size_t nVectors, size_t iBlock)
+{
+    return ((iBlock + 1) * nRowsInBlock < nVectors ? nRowsInBlock : nVectors - iBlock * nRowsInBlock);
+}
+
+/**
+ *  \brief Sums the partial results computed for the blocks of observations.
+ *         The sum is computed in the order of the blocks, so it does not depend on the number of threads
+ *
+ *  \param nBlocks[in]  Number of blocks
+ *  \param nValues[in]  Number of partial results of one block
+ *  \param partial[in]  Partial results of size nBlocks x nValues
+ *  \param sum[out]     Sums of the partial results of size nValues
+ */
+template <typename T>
+void sumPartialResults(size_t nBlocks, size_t nValues, const T *partial, T *sum)
+{
+    for (size_t j = 0; j < nValues; j++)
+    {
+        sum[j] = (T)0;
+    }
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        for (size_t j = 0; j < nValues; j++)
+        {
+            sum[j] += partial[i * nValues + j];
+        }
+    }
+}
+
+/**
+ *  \brief Computes the predictions of the weak learners for the block of observations.
+ *         Each thread uses its own copy of the weak learner prediction algorithm
+ */
+template <typename algorithmFPType, CpuType cpu>
+class WeakLearnerBlockPredictor
+{
+public:
+    WeakLearnerBlockPredictor(const services::SharedPtr<weak_learner::prediction::Batch> &learnerPredict) :
+        _learnerPredict(learnerPredict->clone()), _xTable(NULL)
+    {
+        _prediction = daal::services::internal::service_malloc<algorithmFPType, cpu>(nRowsInBlock);
+        _memoryError = (_prediction == NULL);
+        _predictionRes = services::SharedPtr<classifier::prediction::Result>(new classifier::prediction::Result());
+    }
+
+    ~WeakLearnerBlockPredictor()
+    {
+        releaseBlock();
+        daal::services::internal::service_free<algorithmFPType, cpu>(_prediction);
+    }
+
+    /** Returns true if the memory allocation failed or the weak learner reported errors */
+    bool hasErrors() { return (_memoryError || _learnerPredict->getErrors()->size() != 0); }
+
+    /**
+     *  \brief Sets the block of observations to compute the predictions for
+     *
+     *  \param xTable[in]   Input data set
+     *  \param startRow[in] Index of the first observation in the block
+     *  \param nRows[in]    Number of observations in the block, not greater than nRowsInBlock
+     */
+    bool setBlock(NumericTable *xTable, size_t startRow, size_t nRows)
+    {
+        releaseBlock();
+
+        xTable->getBlockOfRows(startRow, nRows, readOnly, _xBlock);
+        algorithmFPType *x = _xBlock.getBlockPtr();
+        if (!x) { _memoryError = true; return false; }
+        _xTable = xTable;
+
+        NumericTablePtr xBlockTable(new daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>(
+            x, xTable->getNumberOfColumns(), nRows));
+        NumericTablePtr predictionTable(new daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>(_prediction, 1, nRows));
+
+        _learnerPredict->inputBase->set(classifier::prediction::data, xBlockTable);
+        _predictionRes->set(classifier::prediction::prediction, predictionTable);
+        _learnerPredict->setResult(_predictionRes);
+        return true;
+    }
+
+    /**
+     *  \brief Computes the predictions of the weak learner for the current block of observations
+     *
+     *  \return Array of the predictions of size nRows, NULL if the weak learner reported errors
+     */
+    const algorithmFPType *predict(const services::SharedPtr<weak_learner::Model> &learnerModel)
+    {
+        _learnerPredict->inputBase->set(classifier::prediction::model, learnerModel);
+        _learnerPredict->computeNoThrow();
+        return (_learnerPredict->getErrors()->size() == 0 ? _prediction : NULL);
+    }
+
+    void releaseBlock()
+    {
+        if (_xTable)
+        {
+            _xTable->releaseBlockOfRows(_xBlock);
+            _xTable = NULL;
+        }
+    }
+
+    /** Adds the errors of the block predictions to the error collection of the kernel */
+    void addErrors(services::KernelErrorCollection *errors)
+    {
+        if (_memoryError) { errors->add(services::ErrorMemoryAllocationFailed); }
+        if (_learnerPredict->getErrors()->size() != 0) { errors->add(_learnerPredict->getErrors()->getErrors()); }
+    }
+
+private:
+    services::SharedPtr<weak_learner::prediction::Batch> _learnerPredict;
+    services::SharedPtr<classifier::prediction::Result> _predictionRes;
+    NumericTable *_xTable;
+    BlockDescriptor<algorithmFPType> _xBlock;
+    algorithmFPType *_prediction;
+    bool _memoryError;
+};
+
+} // namespace daal::algorithms::boosting::internal
+}
+}
+} // namespace daal
+
+#endif
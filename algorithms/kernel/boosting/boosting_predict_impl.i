@@ -26,6 +26,8 @@
 
 #include "service_memory.h"
 #include "service_numeric_table.h"
+#include "service_defines.h"
+#include "boosting_blocks_impl.i"
 
 namespace daal
 {
@@ -42,46 +44,64 @@ template <typename algorithmFPType, CpuType cpu>
 void BoostingPredictKernel<algorithmFPType, cpu>::compute(NumericTablePtr xTable, const Model *m, size_t nWeakLearners,
                  const algorithmFPType *alpha, algorithmFPType *r, const Parameter *par)
 {
+    using namespace daal::algorithms::boosting::internal;
+
     size_t nVectors  = xTable->getNumberOfRows();
     Model *boostModel = const_cast<Model *>(m);
     Parameter *parameter = const_cast<Parameter *>(par);
+    NumericTable *x = xTable.get();
 
     const algorithmFPType zero = (algorithmFPType)0.0;
-    const algorithmFPType one  = (algorithmFPType)1.0;
-
-    services::SharedPtr<daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu> > rWeakTable(
-        new daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>(1, nVectors));
-    algorithmFPType *rWeak = rWeakTable->getArray();
 
     services::SharedPtr<weak_learner::prediction::Batch> learnerPredict = parameter->weakLearnerPrediction;
-    learnerPredict->inputBase->set(classifier::prediction::data, xTable);
-
-    services::SharedPtr<classifier::prediction::Result> predictionRes(new classifier::prediction::Result());
-    predictionRes->set(classifier::prediction::prediction, rWeakTable);
-    learnerPredict->setResult(predictionRes);
 
-    /* Initialize array of prediction results */
-    for (size_t j = 0; j < nVectors; j++)
+    /* Each thread computes the predictions of all weak learners for its blocks of observations */
+    daal::tls<WeakLearnerBlockPredictor<algorithmFPType, cpu> *> tlsPredictor( [ = ]()
     {
-        r[j] = zero;
-    }
+        return new WeakLearnerBlockPredictor<algorithmFPType, cpu>(learnerPredict);
+    } );
 
-    for (size_t i = 0; i < nWeakLearners; i++)
+    size_t nBlocks = getNumberOfBlocks(nVectors);
+    daal::threader_for(nBlocks, nBlocks, [ =, &tlsPredictor ](int iBlock)
     {
-        /* Get  weak learner's classification results */
-        services::SharedPtr<weak_learner::Model> learnerModel = boostModel->getWeakLearnerModel(i);
+        WeakLearnerBlockPredictor<algorithmFPType, cpu> *predictor = tlsPredictor.local();
+        if (predictor->hasErrors()) { return; }
+
+        size_t startRow = iBlock * nRowsInBlock;
+        size_t nRows = getNumberOfRowsInBlock(nVectors, iBlock);
+        algorithmFPType *rBlock = r + startRow;
+
+        if (!predictor->setBlock(x, startRow, nRows)) { return; }
 
-        learnerPredict->inputBase->set(classifier::prediction::model, learnerModel);
-        learnerPredict->computeNoThrow();
-        if(learnerPredict->getErrors()->size() != 0) {this->_errors->add(learnerPredict->getErrors()->getErrors()); return;}
+        /* Initialize array of prediction results */
+        for (size_t j = 0; j < nRows; j++)
+        {
+            rBlock[j] = zero;
+        }
 
-        /* Update boosting classification results */
-        for (size_t j = 0; j < nVectors; j++)
+        for (size_t i = 0; i < nWeakLearners; i++)
         {
-            algorithmFPType p = ((rWeak[j] > zero) ? one : -one);
-            r[j] += p * alpha[i];
+            /* Get  weak learner's classification results */
+            const algorithmFPType *rWeak = predictor->predict(boostModel->getWeakLearnerModel(i));
+            if (!rWeak) { break; }
+
+            /* Update boosting classification results */
+            const algorithmFPType alphaI = alpha[i];
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nRows; j++)
+            {
+                rBlock[j] += ((rWeak[j] > zero) ? alphaI : -alphaI);
+            }
         }
-    }
+        predictor->releaseBlock();
+    } );
+
+    tlsPredictor.reduce( [ = ](WeakLearnerBlockPredictor<algorithmFPType, cpu> *predictor)
+    {
+        predictor->addErrors(this->_errors.get());
+        delete predictor;
+    } );
 }
 
 }
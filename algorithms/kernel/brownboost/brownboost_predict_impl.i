@@ -26,6 +26,8 @@
 
 #include "service_math.h"
 #include "service_micro_table.h"
+#include "service_defines.h"
+#include "boosting_blocks_impl.i"
 
 namespace daal
 {
@@ -43,6 +45,8 @@ void BrownBoostPredictKernel<method, algorithmFPType, cpu>::compute(NumericTable
                                                                     const Model *m, NumericTablePtr rTable,
                                                                     const Parameter *par)
 {
+    using namespace daal::algorithms::boosting::internal;
+
     const algorithmFPType zero = (algorithmFPType)0.0;
     const algorithmFPType one  = (algorithmFPType)1.0;
 
@@ -69,17 +73,29 @@ void BrownBoostPredictKernel<method, algorithmFPType, cpu>::compute(NumericTable
 
     Parameter *parameter = const_cast<Parameter *>(par);
     algorithmFPType error   = parameter->accuracyThreshold;
-    algorithmFPType invSqrtC;
+    algorithmFPType invSqrtC = one;
     if (error != zero)
     {
         algorithmFPType sqrtC = daal::internal::Math<algorithmFPType,cpu>::sErfInv(one - error);
         invSqrtC = one / sqrtC;
-        for (size_t j = 0; j < nVectors; j++)
+    }
+
+    size_t nBlocks = getNumberOfBlocks(nVectors);
+    daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
+    {
+        size_t nRows = getNumberOfRowsInBlock(nVectors, iBlock);
+        algorithmFPType *rBlock = r + iBlock * nRowsInBlock;
+        if (error != zero)
         {
-            r[j] *= invSqrtC;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nRows; j++)
+            {
+                rBlock[j] *= invSqrtC;
+            }
         }
-    }
-    daal::internal::Math<algorithmFPType,cpu>::vErf(nVectors, r, r);
+        daal::internal::Math<algorithmFPType,cpu>::vErf(nRows, rBlock, rBlock);
+    } );
 
     mtAlpha.release();
     if(!this->_errors->isEmpty()) { return; }
@@ -39,8 +39,12 @@
 #include "service_memory.h"
 #include "service_micro_table.h"
 #include "service_numeric_table.h"
+#include "service_defines.h"
 
 #include "weak_learner_model.h"
+#include "boosting_blocks_impl.i"
+
+using namespace daal::algorithms::boosting::internal;
 #include "brownboost_model.h"
 
 using namespace daal::data_management;
@@ -151,10 +155,20 @@ void BrownBoostTrainKernel<method, algorithmFPType, cpu>::brownBoostFreundKernel
     if (!this->_errors->isEmpty()) { return; }
 
     /* Allocate memory for storing intermediate results */
+    const size_t nBlocks = getNumberOfBlocks(nVectors);
     r = daal::services::internal::service_calloc<algorithmFPType, cpu>(nVectors);
-    if (!r) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+    size_t *partialNCorrect = daal::services::internal::service_malloc<size_t, cpu>(nBlocks);
+    if (!r || !partialNCorrect)
+    {
+        daal::services::internal::service_free<algorithmFPType, cpu>(r);
+        daal::services::internal::service_free<size_t, cpu>(partialNCorrect);
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
 
-    services::SharedPtr<weak_learner::training::Batch>   learnerTrain   = parameter->weakLearnerTraining;
+    /* The weak learner is copied for the training call, so that the data it caches between the iterations,
+       such as the bins of the binned stump, does not outlive the call */
+    services::SharedPtr<weak_learner::training::Batch>   learnerTrain   = parameter->weakLearnerTraining->clone();
     learnerTrain->getErrors()->setCanThrow(false);
     learnerTrain->input.set(classifier::training::data,    weakLearnerInputTables[0]);
     learnerTrain->input.set(classifier::training::labels,  weakLearnerInputTables[1]);
@@ -177,18 +191,29 @@ void BrownBoostTrainKernel<method, algorithmFPType, cpu>::brownBoostFreundKernel
         nWeakLearners++;
 
         /* Update weights */
-        updateWeights(nVectors, s, nr.c, nr.invSqrtC, r, nr.nra, nr.nre2, w);
+        updateWeights(nVectors, s, nr.c, nr.invSqrtC, r, nr.nra, nr.nre2, w, nr.partialSums);
 
         /* Re-allocate array of weak learners' models and boosting coefficients */
         alpha = reallocateAlpha(nWeakLearners-1, nWeakLearners, alpha);
-        if (!this->_errors->isEmpty()) { daal::services::daal_free(r); return; }
+        if (!this->_errors->isEmpty())
+        {
+            daal::services::daal_free(r);
+            daal::services::internal::service_free<size_t, cpu>(partialNCorrect);
+            return;
+        }
 
         /* Make weak learner to allocate new memory for storing training result */
         if (iteration > 0) { learnerTrain->resetResult(); }
 
         /* Train weak learner's model */
         learnerTrain->computeNoThrow();
-        if(learnerTrain->getErrors()->size() != 0) {daal::services::daal_free(r); this->_errors->add(learnerTrain->getErrors()->getErrors()); return;}
+        if(learnerTrain->getErrors()->size() != 0)
+        {
+            daal::services::daal_free(r);
+            daal::services::internal::service_free<size_t, cpu>(partialNCorrect);
+            this->_errors->add(learnerTrain->getErrors()->getErrors());
+            return;
+        }
 
         services::SharedPtr<classifier::training::Result> trainingRes = learnerTrain->getResult();
         services::SharedPtr<weak_learner::Model> learnerModel =
@@ -198,18 +223,38 @@ void BrownBoostTrainKernel<method, algorithmFPType, cpu>::brownBoostFreundKernel
         /* Get weak learner's classification results */
         learnerPredict->inputBase->set(classifier::prediction::model, learnerModel);
         learnerPredict->computeNoThrow();
-        if(learnerPredict->getErrors()->size() != 0) {daal::services::daal_free(r); this->_errors->add(learnerPredict->getErrors()->getErrors()); return;}
+        if(learnerPredict->getErrors()->size() != 0)
+        {
+            daal::services::daal_free(r);
+            daal::services::internal::service_free<size_t, cpu>(partialNCorrect);
+            this->_errors->add(learnerPredict->getErrors()->getErrors());
+            return;
+        }
 
-        algorithmFPType gamma = zero;
+        algorithmFPType *partialGamma = nr.partialSums;
+        daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
+        {
+            size_t startRow = iBlock * nRowsInBlock;
+            size_t nRows = getNumberOfRowsInBlock(nVectors, iBlock);
+            algorithmFPType gammaBlock = zero;
+            size_t nCorrectBlock = 0;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = startRow; j < startRow + nRows; j++)
+            {
+                h[j] = ((h[j] > zero) ? one : -one);
+                algorithmFPType hy = h[j] * y[j];
+                gammaBlock += w[j] * hy;
+                nCorrectBlock += (size_t)(hy > zero);
+            }
+            partialGamma[iBlock]    = gammaBlock;
+            partialNCorrect[iBlock] = nCorrectBlock;
+        } );
 
+        algorithmFPType gamma = zero;
         size_t nCorrect = 0;
-        for (size_t j = 0; j < nVectors; j++)
-        {
-            h[j] = ((h[j] > zero) ? one : -one);
-            algorithmFPType hy = h[j] * y[j];
-            gamma += w[j] * hy;
-            nCorrect += (size_t)(hy > zero);
-        }
+        sumPartialResults<algorithmFPType>(nBlocks, 1, partialGamma, &gamma);
+        sumPartialResults<size_t>(nBlocks, 1, partialNCorrect, &nCorrect);
 
         if (nCorrect == nVectors)
         {
@@ -226,41 +271,73 @@ void BrownBoostTrainKernel<method, algorithmFPType, cpu>::brownBoostFreundKernel
         alpha[nWeakLearners - 1] = nr.nrAlpha;
 
         /* Update margin */
-        for (size_t j = 0; j < nVectors; j++)
+        const algorithmFPType nrAlpha = nr.nrAlpha;
+        const algorithmFPType *nrb = nr.nrb;
+        daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
         {
-            r[j] += nr.nrAlpha * nr.nrb[j];
-        }
+            size_t startRow = iBlock * nRowsInBlock;
+            size_t nRows = getNumberOfRowsInBlock(nVectors, iBlock);
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = startRow; j < startRow + nRows; j++)
+            {
+                r[j] += nrAlpha * nrb[j];
+            }
+        } );
     }
 
     *nWeakLearnersPtr = nWeakLearners;
     *alphaPtr  = alpha;
 
     daal::services::daal_free(r);
+    daal::services::internal::service_free<size_t, cpu>(partialNCorrect);
 }
 
 template <Method method, typename algorithmFPType, CpuType cpu>
 void BrownBoostTrainKernel<method, algorithmFPType, cpu>::updateWeights(
             size_t nVectors, algorithmFPType s, algorithmFPType c, algorithmFPType invSqrtC,
-            const algorithmFPType *r, algorithmFPType *nra, algorithmFPType *nre2, algorithmFPType *w)
+            const algorithmFPType *r, algorithmFPType *nra, algorithmFPType *nre2, algorithmFPType *w,
+            algorithmFPType *partialSums)
 {
-    for (size_t j = 0; j < nVectors; j++)
+    const size_t nBlocks = getNumberOfBlocks(nVectors);
+    daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
     {
-        nra[j] = r[j] + s;
-        nre2[j] = nra[j] * invSqrtC;
-        w[j] = -nra[j] * nra[j] / c;
-    }
-    daal::internal::Math<algorithmFPType,cpu>::vExp(nVectors, w, w);
-    daal::internal::Math<algorithmFPType,cpu>::vErf(nVectors, nre2, nre2);
+        size_t startRow = iBlock * nRowsInBlock;
+        size_t nRows = getNumberOfRowsInBlock(nVectors, iBlock);
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = startRow; j < startRow + nRows; j++)
+        {
+            nra[j] = r[j] + s;
+            nre2[j] = nra[j] * invSqrtC;
+            w[j] = -nra[j] * nra[j] / c;
+        }
+        daal::internal::Math<algorithmFPType,cpu>::vExp(nRows, w + startRow, w + startRow);
+        daal::internal::Math<algorithmFPType,cpu>::vErf(nRows, nre2 + startRow, nre2 + startRow);
+        algorithmFPType wSumBlock = (algorithmFPType)0.0;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = startRow; j < startRow + nRows; j++)
+        {
+            wSumBlock += w[j];
+        }
+        partialSums[iBlock] = wSumBlock;
+    } );
+
     algorithmFPType wSum = (algorithmFPType)0.0;
-    for (size_t j = 0; j < nVectors; j++)
-    {
-        wSum += w[j];
-    }
+    sumPartialResults<algorithmFPType>(nBlocks, 1, partialSums, &wSum);
     algorithmFPType invWSum = 1.0 / wSum;
-    for (size_t j = 0; j < nVectors; j++)
+    daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
     {
-        w[j] *= invWSum;
-    }
+        size_t startRow = iBlock * nRowsInBlock;
+        size_t nRows = getNumberOfRowsInBlock(nVectors, iBlock);
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = startRow; j < startRow + nRows; j++)
+        {
+            w[j] *= invWSum;
+        }
+    } );
 }
 
 template <Method method, typename algorithmFPType, CpuType cpu>
@@ -288,7 +365,8 @@ NewtonRaphsonKernel<method, algorithmFPType, cpu>::NewtonRaphsonKernel(
     nrw  = (algorithmFPType *)daal::services::daal_malloc(nVectors * sizeof(algorithmFPType));
     nre1 = (algorithmFPType *)daal::services::daal_malloc(nVectors * sizeof(algorithmFPType));
     nre2 = (algorithmFPType *)daal::services::daal_malloc(nVectors * sizeof(algorithmFPType));
-    if (!nra || !nrb || !nrd || !nrw || !nre1 || !nre2) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+    partialSums = (algorithmFPType *)daal::services::daal_malloc(getNumberOfBlocks(nVectors) * 5 * sizeof(algorithmFPType));
+    if (!nra || !nrb || !nrd || !nrw || !nre1 || !nre2 || !partialSums) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
 
     const algorithmFPType one = (algorithmFPType)1.0;
     const algorithmFPType pi  = (algorithmFPType)3.1415926535897932384626433832795;
@@ -313,6 +391,7 @@ NewtonRaphsonKernel<method, algorithmFPType, cpu>::~NewtonRaphsonKernel()
     if (nrw) daal::services::daal_free(nrw);
     if (nre1) daal::services::daal_free(nre1);
     if (nre2) daal::services::daal_free(nre2);
+    if (partialSums) daal::services::daal_free(partialSums);
 }
 
 template <Method method, typename algorithmFPType, CpuType cpu>
@@ -339,10 +418,24 @@ void NewtonRaphsonKernel<method, algorithmFPType, cpu>::compute(algorithmFPType
     nrAlpha = ((error < gamma) ? error : gamma);
     nrT     = nrAlpha * nrAlpha / 3.0;
 
-    for (size_t j = 0; j < nVectors; j++)
+    const size_t nBlocks = getNumberOfBlocks(nVectors);
+    algorithmFPType *nrb = this->nrb;
+    daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
     {
-        nrb[j] = h[j] * y[j] * alphaSign;
-    }
+        size_t startRow = iBlock * nRowsInBlock;
+        size_t nRows = getNumberOfRowsInBlock(nVectors, iBlock);
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = startRow; j < startRow + nRows; j++)
+        {
+            nrb[j] = h[j] * y[j] * alphaSign;
+        }
+    } );
+
+    algorithmFPType *nra = this->nra, *nrd = this->nrd, *nrw = this->nrw, *nre1 = this->nre1, *nre2 = this->nre2;
+    algorithmFPType *partialSums = this->partialSums;
+    const algorithmFPType invC = this->invC, invSqrtC = this->invSqrtC;
+    algorithmFPType sums[5];
 
     bool nrDone = false;
     for (size_t nrIter = 0; !nrDone && nrIter < nrMaxIter; nrIter++)
@@ -353,24 +446,48 @@ void NewtonRaphsonKernel<method, algorithmFPType, cpu>::compute(algorithmFPType
         nrB = zero;
         nrV = zero;
         nrE = zero;
-        for (size_t j = 0; j < nVectors; j++)
-        {
-            nrd[j] = nra[j] + nrAlpha * nrb[j] - nrT;
-            nrw[j] = -invC * nrd[j] * nrd[j];
-            nre1[j] = nrd[j] * invSqrtC;
-        }
-        daal::internal::Math<algorithmFPType,cpu>::vExp(nVectors, nrw,  nrw);
-        daal::internal::Math<algorithmFPType,cpu>::vErf(nVectors, nre1, nre1);
-        for (size_t j = 0; j < nVectors; j++)
+        const algorithmFPType curAlpha = nrAlpha, curT = nrT;
+        daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
         {
-            algorithmFPType nrwb  = nrw[j] * nrb[j];
-            algorithmFPType nrwdb = nrwb * nrd[j];
-            nrW += nrw[j];
-            nrB += nrwb;
-            nrU += nrwdb;
-            nrV += nrwdb * nrb[j];
-            nrE += nre1[j] - nre2[j];
-        }
+            size_t startRow = iBlock * nRowsInBlock;
+            size_t nRows = getNumberOfRowsInBlock(nVectors, iBlock);
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = startRow; j < startRow + nRows; j++)
+            {
+                nrd[j] = nra[j] + curAlpha * nrb[j] - curT;
+                nrw[j] = -invC * nrd[j] * nrd[j];
+                nre1[j] = nrd[j] * invSqrtC;
+            }
+            daal::internal::Math<algorithmFPType,cpu>::vExp(nRows, nrw + startRow,  nrw + startRow);
+            daal::internal::Math<algorithmFPType,cpu>::vErf(nRows, nre1 + startRow, nre1 + startRow);
+
+            algorithmFPType blockW = zero, blockB = zero, blockU = zero, blockV = zero, blockE = zero;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = startRow; j < startRow + nRows; j++)
+            {
+                algorithmFPType nrwb  = nrw[j] * nrb[j];
+                algorithmFPType nrwdb = nrwb * nrd[j];
+                blockW += nrw[j];
+                blockB += nrwb;
+                blockU += nrwdb;
+                blockV += nrwdb * nrb[j];
+                blockE += nre1[j] - nre2[j];
+            }
+            algorithmFPType *partial = partialSums + 5 * iBlock;
+            partial[0] = blockW;
+            partial[1] = blockB;
+            partial[2] = blockU;
+            partial[3] = blockV;
+            partial[4] = blockE;
+        } );
+        sumPartialResults<algorithmFPType>(nBlocks, 5, partialSums, sums);
+        nrW = sums[0];
+        nrB = sums[1];
+        nrU = sums[2];
+        nrV = sums[3];
+        nrE = sums[4];
 
         /* Update Newton-Raphson variables */
         algorithmFPType invDenom = one / (two * (nrV * nrW - nrU * nrB));
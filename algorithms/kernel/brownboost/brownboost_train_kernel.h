@@ -50,7 +50,8 @@ public:
 
 private:
     void updateWeights(size_t nVectors, algorithmFPType s, algorithmFPType c, algorithmFPType invSqrtC,
-                       const algorithmFPType *r, algorithmFPType *nra, algorithmFPType *nre2, algorithmFPType *w);
+                       const algorithmFPType *r, algorithmFPType *nra, algorithmFPType *nre2, algorithmFPType *w,
+                       algorithmFPType *partialSums);
 
     algorithmFPType *reallocateAlpha(size_t oldAlphaSize, size_t alphaSize, algorithmFPType *oldAlpha);
 
@@ -81,6 +82,7 @@ struct NewtonRaphsonKernel
     algorithmFPType *nrb;
     algorithmFPType *nre1;
     algorithmFPType *nre2;
+    algorithmFPType *partialSums;   /* Partial sums computed for the blocks of observations */
 
     size_t nrMaxIter;
     algorithmFPType error;
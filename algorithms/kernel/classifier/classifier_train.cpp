@@ -103,6 +103,8 @@ void Input::checkImpl(const daal::algorithms::Parameter *parameter) const
 
 Result::Result() : daal::algorithms::Result(1) {}
 
+Result::Result(const size_t nElements) : daal::algorithms::Result(nElements) {}
+
 /**
  * Returns the model trained with the classification algorithm
  * \param[in] id    Identifier of the result, \ref ResultId
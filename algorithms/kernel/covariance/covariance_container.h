@@ -99,9 +99,20 @@
         NumericTable *crossProductTable = partialResult->get(crossProduct).get();   \
         NumericTable *sumTable          = partialResult->get(sum).get();            \
                                                                                         \
-        Parameter *parameter = static_cast<Parameter *>(_par);                          \
+        OnlineParameter *parameter = static_cast<OnlineParameter *>(_par);              \
         daal::services::Environment::env &env = *_env;                                  \
                                                                                         \
+        if (parameter->windowSize || parameter->decayFactor != 1.0)                     \
+        {                                                                               \
+            NumericTable *windowTable   = partialResult->get(windowStatistics).get();   \
+            NumericTable *countersTable = partialResult->get(windowCounters).get();     \
+                                                                                        \
+             __DAAL_CALL_KERNEL(env, KernelClass,                                       \
+                       __DAAL_KERNEL_ARGUMENTS(algorithmFPType, ComputeMethod),         \
+                       computeWindowed, dataTable, nObsTable, crossProductTable,        \
+                       sumTable, windowTable, countersTable, parameter);                \
+            return;                                                                     \
+        }                                                                               \
                                                                                         \
          __DAAL_CALL_KERNEL(env, KernelClass,                                           \
                    __DAAL_KERNEL_ARGUMENTS(algorithmFPType, ComputeMethod),             \
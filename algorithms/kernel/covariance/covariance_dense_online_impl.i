@@ -26,6 +26,7 @@
 
 #include "covariance_kernel.h"
 #include "covariance_impl.i"
+#include "service_numeric_table.h"
 
 namespace daal
 {
@@ -92,6 +93,35 @@ void CovarianceDenseOnlineKernel<algorithmFPType, method, cpu>::compute(
     }
 }
 
+template<typename algorithmFPType, Method method, CpuType cpu>
+void CovarianceDenseOnlineKernel<algorithmFPType, method, cpu>::computeWindowed(
+            NumericTable *dataTable, NumericTable *nObservationsTable,
+            NumericTable *crossProductTable, NumericTable *sumTable,
+            NumericTable *windowTable, NumericTable *countersTable, const OnlineParameter *parameter)
+{
+    size_t nFeatures = dataTable->getNumberOfColumns();
+
+    /* Partial results of the new block are computed from zero in the layout of the row of the window:
+       number of observations, sums and cross-product */
+    algorithmFPType *block = service_calloc<algorithmFPType, cpu>(1 + nFeatures + nFeatures * nFeatures);
+    if (!block)
+    { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+    HomogenNumericTableCPU<algorithmFPType, cpu> blockNObservationsTable(block, 1, 1);
+    HomogenNumericTableCPU<algorithmFPType, cpu> blockSumTable(block + 1, nFeatures, 1);
+    HomogenNumericTableCPU<algorithmFPType, cpu> blockCrossProductTable(block + 1 + nFeatures, nFeatures, nFeatures);
+
+    compute(dataTable, &blockNObservationsTable, &blockCrossProductTable, &blockSumTable, parameter);
+
+    if (this->_errors->size() == 0)
+    {
+        updateWindowedPartialResults<algorithmFPType, cpu>(nFeatures, block + 1 + nFeatures, block + 1, block,
+            nObservationsTable, crossProductTable, sumTable, windowTable, countersTable, parameter, this->_errors.get());
+    }
+
+    service_free<algorithmFPType, cpu>(block);
+}
+
 template<typename algorithmFPType, Method method, CpuType cpu>
 void CovarianceDenseOnlineKernel<algorithmFPType, method, cpu>::finalizeCompute(
             NumericTable *nObservationsTable, NumericTable *crossProductTable,
@@ -521,6 +521,216 @@ void mergeCrossProductAndSums( size_t nFeatures,
     }
 }
 
+/*********************** scaleCrossProductAndSums ************************************************/
+template<typename algorithmFPType, CpuType cpu>
+void scaleCrossProductAndSums( size_t nFeatures,
+                               algorithmFPType weight,
+                               algorithmFPType *crossProduct,
+                               algorithmFPType *sums,
+                               algorithmFPType *nObservations)
+{
+    daal::threader_for( nFeatures, nFeatures, [ = ](size_t i)
+    {
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            crossProduct[i * nFeatures + j] *= weight;
+        }
+    } );
+
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        sums[i] *= weight;
+    }
+    nObservations[0] *= weight;
+}
+
+/*********************** downdateCrossProductAndSums *********************************************/
+/* Removes the partial results of the block multiplied by the weight from the merged partial results.
+   Returns false if the subtraction cancels too many significant digits of the diagonal of the cross-product */
+template<typename algorithmFPType, CpuType cpu>
+bool downdateCrossProductAndSums( size_t nFeatures,
+                                  algorithmFPType weight,
+                                  const algorithmFPType *partialCrossProduct,
+                                  const algorithmFPType *partialSums,
+                                  const algorithmFPType *partialNObservations,
+                                  algorithmFPType *crossProduct,
+                                  algorithmFPType *sums,
+                                  algorithmFPType *nObservations)
+{
+    algorithmFPType partialNObsValue = weight * partialNObservations[0];
+    if (partialNObsValue == 0) { return true; }
+
+    algorithmFPType nObsValue    = nObservations[0];
+    algorithmFPType newNObsValue = nObsValue - partialNObsValue;
+
+    /* The block holds all the remaining observations */
+    if (newNObsValue <= nObsValue * (algorithmFPType)1e-10)
+    {
+        algorithmFPType zero = 0.0;
+        daal::services::internal::service_memset<algorithmFPType, cpu>(crossProduct, zero, nFeatures * nFeatures);
+        daal::services::internal::service_memset<algorithmFPType, cpu>(sums, zero, nFeatures);
+        nObservations[0] = zero;
+        return true;
+    }
+
+    /* Relative size of the diagonal element below which the downdated value is not trusted,
+       approximately the square root of the machine epsilon */
+    const algorithmFPType threshold = (sizeof(algorithmFPType) == sizeof(float) ? (algorithmFPType)3e-4 : (algorithmFPType)1.5e-8);
+
+    algorithmFPType invPartialNObs = 1.0 / partialNObsValue;
+    algorithmFPType invNObs        = 1.0 / nObsValue;
+    algorithmFPType invNewNObs     = 1.0 / newNObsValue;
+
+    bool isPrecise = true;
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        algorithmFPType partialSumI = weight * partialSums[i];
+        algorithmFPType newSumI     = sums[i] - partialSumI;
+        algorithmFPType diagonal    = crossProduct[i * nFeatures + i];
+
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j <= i; j++)
+        {
+            algorithmFPType partialSumJ = weight * partialSums[j];
+            crossProduct[i * nFeatures + j] -= weight * partialCrossProduct[i * nFeatures + j];
+            crossProduct[i * nFeatures + j] -= partialSumI * partialSumJ * invPartialNObs;
+            crossProduct[i * nFeatures + j] += sums[i] * sums[j] * invNObs;
+            crossProduct[i * nFeatures + j] -= newSumI * (sums[j] - partialSumJ) * invNewNObs;
+            crossProduct[j * nFeatures + i]  = crossProduct[i * nFeatures + j];
+        }
+
+        if (crossProduct[i * nFeatures + i] < 0 || crossProduct[i * nFeatures + i] < threshold * diagonal) { isPrecise = false; }
+    }
+
+    /* Downdate number of observations and sums */
+    nObservations[0] = newNObsValue;
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        sums[i] -= weight * partialSums[i];
+    }
+    return isPrecise;
+}
+
+/*********************** updateWindowedPartialResults ********************************************/
+/* The counters table holds the index of the next block and the number of the blocks removed
+   since the last recomputation. Row k % windowSize of the window table holds the number of observations,
+   the sums and the cross-product of the block k */
+template<typename algorithmFPType, CpuType cpu>
+void updateWindowedPartialResults( size_t nFeatures,
+                                   const algorithmFPType *blockCrossProduct,
+                                   const algorithmFPType *blockSums,
+                                   const algorithmFPType *blockNObservations,
+                                   NumericTable *nObservationsTable,
+                                   NumericTable *crossProductTable,
+                                   NumericTable *sumTable,
+                                   NumericTable *windowTable,
+                                   NumericTable *countersTable,
+                                   const OnlineParameter *parameter,
+                                   services::KernelErrorCollection *_errors)
+{
+    BlockDescriptor<algorithmFPType> crossProductBD, sumBD, nObservationsBD;
+    algorithmFPType *crossProduct, *sums, *nObservations;
+
+    getDenseCrossProductAndSums<algorithmFPType, cpu>(readWrite, crossProductTable, crossProductBD, &crossProduct,
+        sumTable, sumBD, &sums, nObservationsTable, nObservationsBD, &nObservations);
+
+    const algorithmFPType decayFactor = (algorithmFPType)parameter->decayFactor;
+    if (decayFactor != (algorithmFPType)1.0)
+    {
+        scaleCrossProductAndSums<algorithmFPType, cpu>(nFeatures, decayFactor, crossProduct, sums, nObservations);
+    }
+
+    if (!windowTable)
+    {
+        mergeCrossProductAndSums<algorithmFPType, cpu>(nFeatures, blockCrossProduct, blockSums, blockNObservations,
+            crossProduct, sums, nObservations);
+        releaseDenseCrossProductAndSums<algorithmFPType, cpu>(crossProductTable, crossProductBD, sumTable, sumBD,
+            nObservationsTable, nObservationsBD);
+        return;
+    }
+
+    const size_t windowSize = parameter->windowSize;
+    const size_t rowSize = 1 + nFeatures + nFeatures * nFeatures;
+
+    BlockDescriptor<algorithmFPType> windowBD;
+    windowTable->getBlockOfRows(0, windowSize, readWrite, windowBD);
+    algorithmFPType *window = windowBD.getBlockPtr();
+
+    BlockDescriptor<int> countersBD;
+    countersTable->getBlockOfRows(0, 1, readWrite, countersBD);
+    int *counters = countersBD.getBlockPtr();
+
+    const size_t nBlocks = (size_t)counters[0];
+    algorithmFPType *slot = window + (nBlocks % windowSize) * rowSize;
+
+    /* Remove the block that leaves the window, its weight was multiplied by the decay factor windowSize times */
+    bool recompute = false;
+    if (nBlocks >= windowSize)
+    {
+        algorithmFPType weight = Math<algorithmFPType, cpu>::sPowx(decayFactor, (algorithmFPType)windowSize);
+        bool isPrecise = downdateCrossProductAndSums<algorithmFPType, cpu>(nFeatures, weight, slot + 1 + nFeatures, slot + 1, slot,
+            crossProduct, sums, nObservations);
+
+        counters[1]++;
+        recompute = !isPrecise || (parameter->recomputeInterval && (size_t)counters[1] >= parameter->recomputeInterval);
+    }
+
+    /* Store the new block in the window */
+    slot[0] = blockNObservations[0];
+    daal_memcpy_s(slot + 1, nFeatures * sizeof(algorithmFPType), blockSums, nFeatures * sizeof(algorithmFPType));
+    daal_memcpy_s(slot + 1 + nFeatures, nFeatures * nFeatures * sizeof(algorithmFPType),
+                  blockCrossProduct, nFeatures * nFeatures * sizeof(algorithmFPType));
+    /* Once the window is full only the position in the window matters, so the counter stays below 2 * windowSize */
+    counters[0] = (int)(nBlocks + 1 < 2 * windowSize ? nBlocks + 1 : nBlocks + 1 - windowSize);
+
+    if (!recompute)
+    {
+        mergeCrossProductAndSums<algorithmFPType, cpu>(nFeatures, blockCrossProduct, blockSums, blockNObservations,
+            crossProduct, sums, nObservations);
+    }
+    else
+    {
+        /* Recompute the partial results from the statistics of the blocks in the window, from the oldest to the newest */
+        algorithmFPType *weighted = service_malloc<algorithmFPType, cpu>(rowSize);
+        if (!weighted)
+        {
+            _errors->add(services::ErrorMemoryAllocationFailed);
+        }
+        else
+        {
+            algorithmFPType zero = 0.0;
+            daal::services::internal::service_memset<algorithmFPType, cpu>(crossProduct, zero, nFeatures * nFeatures);
+            daal::services::internal::service_memset<algorithmFPType, cpu>(sums, zero, nFeatures);
+            nObservations[0] = zero;
+
+            for (size_t k = 0; k < windowSize; k++)
+            {
+                const algorithmFPType *blockSlot = window + ((nBlocks + 1 + k) % windowSize) * rowSize;
+                algorithmFPType weight = Math<algorithmFPType, cpu>::sPowx(decayFactor, (algorithmFPType)(windowSize - 1 - k));
+
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < rowSize; j++)
+                {
+                    weighted[j] = weight * blockSlot[j];
+                }
+                mergeCrossProductAndSums<algorithmFPType, cpu>(nFeatures, weighted + 1 + nFeatures, weighted + 1, weighted,
+                    crossProduct, sums, nObservations);
+            }
+            counters[1] = 0;
+            service_free<algorithmFPType, cpu>(weighted);
+        }
+    }
+
+    countersTable->releaseBlockOfRows(countersBD);
+    windowTable->releaseBlockOfRows(windowBD);
+    releaseDenseCrossProductAndSums<algorithmFPType, cpu>(crossProductTable, crossProductBD, sumTable, sumBD,
+        nObservationsTable, nObservationsBD);
+}
+
 /*********************** finalizeCovariance ******************************************************/
 template<typename algorithmFPType, CpuType cpu>
 void finalizeCovariance( size_t          nFeatures,
@@ -65,6 +65,10 @@ public:
             NumericTable *crossProductTable, NumericTable *sumTable,
             const Parameter *parameter);
 
+    void computeWindowed(NumericTable *dataTable, NumericTable *nObsTable,
+            NumericTable *crossProductTable, NumericTable *sumTable,
+            NumericTable *windowTable, NumericTable *countersTable, const OnlineParameter *parameter);
+
     void finalizeCompute(NumericTable *nObsTable, NumericTable *crossProductTable,
             NumericTable *sumTable, NumericTable *covTable,
             NumericTable *meanTable, const Parameter *parameter);
@@ -78,6 +82,10 @@ public:
             NumericTable *crossProductTable, NumericTable *sumTable,
             const Parameter *parameter);
 
+    void computeWindowed(NumericTable *dataTable, NumericTable *nObsTable,
+            NumericTable *crossProductTable, NumericTable *sumTable,
+            NumericTable *windowTable, NumericTable *countersTable, const OnlineParameter *parameter);
+
     void finalizeCompute(NumericTable *nObsTable, NumericTable *crossProductTable,
             NumericTable *sumTable, NumericTable *covTable,
             NumericTable *meanTable, const Parameter *parameter);
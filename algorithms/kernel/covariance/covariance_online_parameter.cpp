@@ -36,7 +36,8 @@ namespace interface1
 {
 
 /** Default constructor */
-OnlineParameter::OnlineParameter() : Parameter(), initializationProcedure(new DefaultPartialResultsInit())
+OnlineParameter::OnlineParameter() : Parameter(), initializationProcedure(new DefaultPartialResultsInit()),
+    windowSize(0), decayFactor(1.0), recomputeInterval(100)
 {}
 
 /**
@@ -45,6 +46,7 @@ OnlineParameter::OnlineParameter() : Parameter(), initializationProcedure(new De
 void OnlineParameter::check() const
 {
     if (!initializationProcedure) { this->_errors->add(services::ErrorNullAuxiliaryAlgorithm); return; }
+    DAAL_CHECK_EX(decayFactor > 0.0 && decayFactor <= 1.0, ErrorIncorrectParameter, ParameterName, decayFactorStr());
 }
 
 }//namespace interface1
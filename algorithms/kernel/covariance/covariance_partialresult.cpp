@@ -37,7 +37,7 @@ namespace interface1
 {
 
 __DAAL_REGISTER_SERIALIZATION_CLASS(PartialResult, SERIALIZATION_COVARIANCE_PARTIAL_RESULT_ID);
-PartialResult::PartialResult() : daal::algorithms::PartialResult(3)
+PartialResult::PartialResult() : daal::algorithms::PartialResult(5)
     {}
 
 /**
@@ -89,6 +89,8 @@ void PartialResult::check(const daal::algorithms::Input *input, const daal::algo
     const InputIface *algInput = static_cast<const InputIface *>(input);
     size_t nFeatures = algInput->getNumberOfFeatures();
     checkImpl(nFeatures);
+    if (this->_errors->size() != 0) { return; }
+    checkWindow(parameter, nFeatures);
 }
 
 /**
@@ -100,6 +102,8 @@ void PartialResult::check(const daal::algorithms::Parameter *parameter, int meth
 {
     size_t nFeatures = getNumberOfFeatures();
     checkImpl(nFeatures);
+    if (this->_errors->size() != 0) { return; }
+    checkWindow(parameter, nFeatures);
 }
 
 void PartialResult::checkImpl(size_t nFeatures) const
@@ -121,6 +125,17 @@ void PartialResult::checkImpl(size_t nFeatures) const
                                             sumStr(), unexpectedLayouts, 0, nFeatures, 1)) { return; }
 }
 
+void PartialResult::checkWindow(const daal::algorithms::Parameter *parameter, size_t nFeatures) const
+{
+    const OnlineParameter *onlineParameter = dynamic_cast<const OnlineParameter *>(parameter);
+    if (!onlineParameter || !onlineParameter->windowSize) { return; }
+
+    int unexpectedLayouts = (int)packed_mask;
+    if (!checkNumericTable(get(windowStatistics).get(), this->_errors.get(), windowStatisticsStr(), unexpectedLayouts, 0,
+                           1 + nFeatures + nFeatures * nFeatures, onlineParameter->windowSize)) { return; }
+    checkNumericTable(get(windowCounters).get(), this->_errors.get(), windowCountersStr(), unexpectedLayouts, 0, 2, 1);
+}
+
 void PartialResultsInitIface::setToZero(data_management::NumericTable *table)
 {
     data_management::BlockDescriptor<double> block;
@@ -149,6 +164,8 @@ void DefaultPartialResultsInit::operator()(const Input &input, services::SharedP
     setToZero(pres->get(nObservations).get());
     setToZero(pres->get(crossProduct).get());
     setToZero(pres->get(sum).get());
+    if (pres->get(windowStatistics)) { setToZero(pres->get(windowStatistics).get()); }
+    if (pres->get(windowCounters))   { setToZero(pres->get(windowCounters).get()); }
 }
 
 }//namespace interface1
@@ -45,12 +45,32 @@ DAAL_EXPORT void PartialResult::allocate(const daal::algorithms::Input *input, c
     const InputIface *algInput = static_cast<const InputIface *>(input);
     size_t nColumns = algInput->getNumberOfFeatures();
 
-    Argument::set(nObservations, data_management::NumericTablePtr(
-                      new data_management::HomogenNumericTable<size_t>(1, 1, data_management::NumericTable::doAllocate)));
+    /* Weighted number of observations of the decayed online mode is not integer */
+    const OnlineParameter *onlineParameter = dynamic_cast<const OnlineParameter *>(parameter);
+    if (onlineParameter && (onlineParameter->windowSize || onlineParameter->decayFactor != 1.0))
+    {
+        Argument::set(nObservations, data_management::NumericTablePtr(
+                          new data_management::HomogenNumericTable<algorithmFPType>(1, 1, data_management::NumericTable::doAllocate)));
+    }
+    else
+    {
+        Argument::set(nObservations, data_management::NumericTablePtr(
+                          new data_management::HomogenNumericTable<size_t>(1, 1, data_management::NumericTable::doAllocate)));
+    }
     Argument::set(crossProduct, data_management::NumericTablePtr(
                       new data_management::HomogenNumericTable<algorithmFPType>(nColumns, nColumns, data_management::NumericTable::doAllocate)));
     Argument::set(sum, data_management::NumericTablePtr(
                       new data_management::HomogenNumericTable<algorithmFPType>(nColumns, 1, data_management::NumericTable::doAllocate)));
+
+    if (onlineParameter && onlineParameter->windowSize)
+    {
+        /* One row per block of the window: number of observations, sums and cross-product of the block */
+        Argument::set(windowStatistics, data_management::NumericTablePtr(
+                          new data_management::HomogenNumericTable<algorithmFPType>(1 + nColumns + nColumns * nColumns,
+                                  onlineParameter->windowSize, data_management::NumericTable::doAllocate, algorithmFPType(0))));
+        Argument::set(windowCounters, data_management::NumericTablePtr(
+                          new data_management::HomogenNumericTable<int>(2, 1, data_management::NumericTable::doAllocate, 0)));
+    }
 }
 
 } // namespace covariance
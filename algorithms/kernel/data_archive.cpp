@@ -0,0 +1,284 @@
+/* file: data_archive.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the data archive that stores the serialized data as a sequence of segments.
+//--
+*/
+
+#if defined(_WIN32) || defined(_WIN64)
+    #include <io.h>
+#else
+    #include <errno.h>
+    #include <sys/uio.h>
+    #include <unistd.h>
+#endif
+
+#include "data_archive.h"
+
+namespace daal
+{
+namespace data_management
+{
+
+namespace interface1
+{
+
+static const byte alignmentPadding[DAAL_MALLOC_DEFAULT_ALIGNMENT] = { 0 };
+
+ScatterGatherDataArchive::ScatterGatherDataArchive(size_t minReferenceSize) :
+    _blockAllocatedSize(0), _blockOffset(0), _minBlockSize(1024 * 16), _minReferenceSize(minReferenceSize), _size(0),
+    _currentReadSegment(0), _currentReadSegmentOffset(0), _readOffset(0), _serializedBuffer(0),
+    _errors(new services::ErrorCollection())
+{
+    if(_minReferenceSize == 0) { _minReferenceSize = 1; }
+}
+
+ScatterGatherDataArchive::ScatterGatherDataArchive(byte *ptr, size_t size) :
+    _blockAllocatedSize(0), _blockOffset(0), _minBlockSize(1024 * 16), _minReferenceSize(1024 * 4), _size(0),
+    _currentReadSegment(0), _currentReadSegmentOffset(0), _readOffset(0), _serializedBuffer(0),
+    _errors(new services::ErrorCollection())
+{
+    addSegment(ptr, size);
+}
+
+ScatterGatherDataArchive::~ScatterGatherDataArchive()
+{
+    for(size_t i = 0; i < _blocks.size(); i++)
+    {
+        daal::services::daal_free( _blocks[i] );
+    }
+    if( _serializedBuffer )
+    {
+        daal::services::daal_free( _serializedBuffer );
+    }
+}
+
+size_t ScatterGatherDataArchive::alignValueUp(size_t value) const
+{
+    if (_majorVersion == 2016 && _minorVersion == 0 && _updateVersion == 0)
+    {
+        return value;
+    }
+
+    size_t alignm1 = DAAL_MALLOC_DEFAULT_ALIGNMENT - 1;
+
+    size_t alignedValue = value + alignm1;
+    alignedValue &= ~alignm1;
+    return alignedValue;
+}
+
+void ScatterGatherDataArchive::addSegment(byte *ptr, size_t size)
+{
+    if( size == 0 ) { return; }
+
+    /* Data contiguous in memory with the last segment extends it */
+    size_t nSegments = _segments.size();
+    if( nSegments > 0 && _segments[nSegments - 1].ptr + _segments[nSegments - 1].size == ptr )
+    {
+        _segments[nSegments - 1].size += size;
+    }
+    else
+    {
+        DataArchiveSegment segment;
+        segment.ptr  = ptr;
+        segment.size = size;
+        _segments.push_back(segment);
+    }
+    _size += size;
+}
+
+void ScatterGatherDataArchive::copyData(const byte *ptr, size_t size)
+{
+    if( size == 0 ) { return; }
+
+    if( _blocks.size() == 0 || _blockAllocatedSize < _blockOffset + size )
+    {
+        size_t allocationSize = (_minBlockSize > size) ? _minBlockSize : size;
+        byte *block = (byte *)daal::services::daal_malloc(allocationSize);
+        if( block == 0 )
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+        _blocks.push_back(block);
+        _blockAllocatedSize = allocationSize;
+        _blockOffset        = 0;
+    }
+
+    byte *dst = _blocks[_blocks.size() - 1] + _blockOffset;
+    daal::services::daal_memcpy_s(dst, _blockAllocatedSize - _blockOffset, ptr, size);
+    _blockOffset += size;
+
+    addSegment(dst, size);
+}
+
+void ScatterGatherDataArchive::write(byte *ptr, size_t size)
+{
+    size_t alignedSize = alignValueUp(size);
+
+    if( size >= _minReferenceSize )
+    {
+        addSegment(ptr, size);
+    }
+    else
+    {
+        copyData(ptr, size);
+    }
+    copyData(alignmentPadding, alignedSize - size);
+}
+
+void ScatterGatherDataArchive::read(byte *ptr, size_t size)
+{
+    size_t alignedSize = alignValueUp(size);
+
+    if( _size < _readOffset || _size - _readOffset < alignedSize )
+    {
+        this->_errors->add(services::ErrorDataArchiveInternal);
+        return;
+    }
+
+    /* The data is gathered from the segments, then the alignment padding is skipped */
+    size_t leftSize = alignedSize;
+    size_t copiedSize = 0;
+    while( leftSize > 0 )
+    {
+        const DataArchiveSegment &segment = _segments[_currentReadSegment];
+        size_t partSize = segment.size - _currentReadSegmentOffset;
+        partSize = (partSize < leftSize) ? partSize : leftSize;
+
+        if( copiedSize < size )
+        {
+            size_t copySize = (partSize < size - copiedSize) ? partSize : size - copiedSize;
+            daal::services::daal_memcpy_s(ptr + copiedSize, size - copiedSize, segment.ptr + _currentReadSegmentOffset, copySize);
+            copiedSize += copySize;
+        }
+
+        _currentReadSegmentOffset += partSize;
+        leftSize -= partSize;
+        if( _currentReadSegmentOffset == segment.size )
+        {
+            _currentReadSegment++;
+            _currentReadSegmentOffset = 0;
+        }
+    }
+    _readOffset += alignedSize;
+}
+
+size_t ScatterGatherDataArchive::getSizeOfArchive() const
+{
+    return _size;
+}
+
+byte *ScatterGatherDataArchive::getArchiveAsArray()
+{
+    if( _serializedBuffer ) { return _serializedBuffer; }
+
+    if( _size == 0 ) { return 0; }
+
+    _serializedBuffer = (byte *)daal::services::daal_malloc( _size );
+    if( _serializedBuffer == 0 ) { return 0; }
+
+    copyArchiveToArray(_serializedBuffer, _size);
+
+    return _serializedBuffer;
+}
+
+size_t ScatterGatherDataArchive::copyArchiveToArray( byte *ptr, size_t maxLength ) const
+{
+    if( _size == 0 || _size > maxLength ) { return _size; }
+
+    size_t offset = 0;
+    for(size_t i = 0; i < _segments.size(); i++)
+    {
+        daal::services::daal_memcpy_s(ptr + offset, maxLength - offset, _segments[i].ptr, _segments[i].size);
+        offset += _segments[i].size;
+    }
+    return _size;
+}
+
+size_t ScatterGatherDataArchive::getNumberOfSegments() const
+{
+    return _segments.size();
+}
+
+const DataArchiveSegment *ScatterGatherDataArchive::getSegments() const
+{
+    return (_segments.size() ? &_segments[0] : 0);
+}
+
+size_t ScatterGatherDataArchive::writeSegments(int fd, const DataArchiveSegment *segments, size_t nSegments)
+{
+    size_t writtenSize = 0;
+    size_t segmentOffset = 0;
+    size_t i = 0;
+
+#if defined(_WIN32) || defined(_WIN64)
+    const size_t maxChunkSize = (size_t)1 << 30;
+    while( i < nSegments )
+    {
+        size_t chunkSize = segments[i].size - segmentOffset;
+        chunkSize = (chunkSize < maxChunkSize) ? chunkSize : maxChunkSize;
+        int result = (chunkSize ? _write(fd, segments[i].ptr + segmentOffset, (unsigned int)chunkSize) : 0);
+        if( result < 0 || (result == 0 && chunkSize != 0) ) { break; }
+
+        writtenSize   += (size_t)result;
+        segmentOffset += (size_t)result;
+        if( segmentOffset == segments[i].size )
+        {
+            i++;
+            segmentOffset = 0;
+        }
+    }
+#else
+    /* The segments are written in batches, a partial write continues from the first unwritten byte */
+    const size_t maxBatchSize = 64;
+    struct iovec iov[maxBatchSize];
+    while( i < nSegments )
+    {
+        size_t nBatch = 0;
+        for(size_t j = i; j < nSegments && nBatch < maxBatchSize; j++)
+        {
+            iov[nBatch].iov_base = (void *)(segments[j].ptr + (j == i ? segmentOffset : 0));
+            iov[nBatch].iov_len  = segments[j].size - (j == i ? segmentOffset : 0);
+            nBatch++;
+        }
+
+        ssize_t result = writev(fd, iov, (int)nBatch);
+        if( result < 0 && errno == EINTR ) { continue; }
+        if( result < 0 ) { break; }
+        if( result == 0 && iov[0].iov_len != 0 ) { break; }
+
+        size_t leftSize = (size_t)result;
+        writtenSize += leftSize;
+        while( i < nSegments && leftSize >= segments[i].size - segmentOffset )
+        {
+            leftSize -= segments[i].size - segmentOffset;
+            i++;
+            segmentOffset = 0;
+        }
+        segmentOffset += leftSize;
+    }
+#endif
+
+    return writtenSize;
+}
+
+}
+}
+}
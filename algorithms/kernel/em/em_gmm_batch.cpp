@@ -56,7 +56,9 @@ Parameter::Parameter(const size_t _nComponents,
     accuracyThreshold(_accuracyThreshold),
     covariance(_covariance),
     regularizationFactor(_regularizationFactor),
-    covarianceStorage(_covarianceStorage)
+    covarianceStorage(_covarianceStorage),
+    learningRateOffset(1.0),
+    learningRateDecay(0.6)
 {}
 
 Parameter::Parameter(const Parameter &other) :
@@ -65,7 +67,9 @@ Parameter::Parameter(const Parameter &other) :
     accuracyThreshold(other.accuracyThreshold),
     covariance(other.covariance),
     regularizationFactor(other.regularizationFactor),
-    covarianceStorage(other.covarianceStorage)
+    covarianceStorage(other.covarianceStorage),
+    learningRateOffset(other.learningRateOffset),
+    learningRateDecay(other.learningRateDecay)
 {}
 
 void Parameter::check() const
@@ -75,10 +79,12 @@ void Parameter::check() const
     DAAL_CHECK_EX(nComponents > 0, ErrorEMIncorrectNumberOfComponents, ParameterName, nComponentsStr());
     DAAL_CHECK_EX(covariance, ErrorNullAuxiliaryAlgorithm, ParameterName, covarianceStr());
     DAAL_CHECK(regularizationFactor >= 0, ErrorIncorrectParameter);
+    DAAL_CHECK_EX(learningRateOffset >= 0, ErrorIncorrectParameter, ParameterName, learningRateOffsetStr());
+    DAAL_CHECK_EX(learningRateDecay > 0.5 && learningRateDecay <= 1.0, ErrorIncorrectParameter, ParameterName, learningRateDecayStr());
 }
 
 /** Default constructor */
-Input::Input() : daal::algorithms::Input(4)
+Input::Input() : InputIface(4)
 {}
 
 /**
@@ -148,6 +154,15 @@ NumericTablePtr Input::get(InputCovariancesId id, size_t index) const
     return staticPointerCast<NumericTable, SerializationIface>((*covCollection)[index]);
 }
 
+/**
+ * Returns the number of features in the input data table
+ * \return Number of features in the input data table
+ */
+size_t Input::getNumberOfFeatures() const
+{
+    return get(data)->getNumberOfColumns();
+}
+
 /**
  * Checks the correctness of the input result
  * \param[in] par       Pointer to the structure of the algorithm parameters
@@ -254,10 +269,24 @@ NumericTablePtr Result::get(ResultCovariancesId id, size_t index) const
 void Result::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const
 {
     Input *algInput = static_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
-    Parameter *algParameter = static_cast<Parameter *>(const_cast<daal::algorithms::Parameter *>(par));
+    checkImpl(algInput->get(data)->getNumberOfColumns(), static_cast<const Parameter *>(par));
+}
 
+/**
+* Checks the result of the EM for GMM algorithm in the online and distributed processing modes
+* \param[in] partialResult %Partial result of the algorithm
+* \param[in] par           %Parameter of algorithm
+* \param[in] method        Computation method
+*/
+void Result::check(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *par, int method) const
+{
+    const PartialResult *algPartialResult = static_cast<const PartialResult *>(partialResult);
+    checkImpl(algPartialResult->getNumberOfFeatures(), static_cast<const Parameter *>(par));
+}
+
+void Result::checkImpl(size_t nFeatures, const Parameter *algParameter) const
+{
     size_t nComponents = algParameter->nComponents;
-    size_t nFeatures = algInput->get(data)->getNumberOfColumns();
 
     int unexpectedLayouts = packed_mask;
     if (!checkNumericTable(get(weights).get(), this->_errors.get(), weightsStr(), unexpectedLayouts, 0, nComponents, 1)) { return; }
@@ -36,22 +36,15 @@ namespace em_gmm
 {
 
 /**
- * Allocates memory for storing results of the EM for GMM algorithm
- * \param[in] input     Pointer to the input structure
- * \param[in] parameter Pointer to the parameter structure
- * \param[in] method    Computation method
+ * Allocates memory for storing results of the EM for GMM algorithm with the given number of features
  */
 template <typename algorithmFPType>
-DAAL_EXPORT void Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+void allocateImpl(Result *result, size_t nFeatures, const Parameter *algParameter)
 {
-    Input *algInput = static_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
-    const Parameter *algParameter = static_cast<const Parameter *>(parameter);
-
-    size_t nFeatures   = algInput->get(data)->getNumberOfColumns();
     size_t nComponents = algParameter->nComponents;
 
-    set(weights, NumericTablePtr(new HomogenNumericTable<algorithmFPType>(nComponents, 1, NumericTable::doAllocate, 0)));
-    set(means, NumericTablePtr(new HomogenNumericTable<algorithmFPType>(nFeatures, nComponents, NumericTable::doAllocate, 0)));
+    result->set(weights, NumericTablePtr(new HomogenNumericTable<algorithmFPType>(nComponents, 1, NumericTable::doAllocate, 0)));
+    result->set(means, NumericTablePtr(new HomogenNumericTable<algorithmFPType>(nFeatures, nComponents, NumericTable::doAllocate, 0)));
 
     DataCollectionPtr covarianceCollection = DataCollectionPtr(new DataCollection());
     for(size_t i = 0; i < nComponents; i++)
@@ -65,10 +58,41 @@ DAAL_EXPORT void Result::allocate(const daal::algorithms::Input *input, const da
             covarianceCollection->push_back(NumericTablePtr(new HomogenNumericTable<algorithmFPType>(nFeatures, nFeatures, NumericTable::doAllocate, 0)));
         }
     }
-    set(covariances, covarianceCollection);
+    result->set(covariances, covarianceCollection);
+
+    result->set(goalFunction, NumericTablePtr(new HomogenNumericTable<algorithmFPType>(1, 1, NumericTable::doAllocate, 0)));
+    result->set(nIterations, NumericTablePtr(new HomogenNumericTable<int>(1, 1, NumericTable::doAllocate, 0)));
+}
+
+/**
+ * Allocates memory for storing results of the EM for GMM algorithm
+ * \param[in] input     Pointer to the input structure
+ * \param[in] parameter Pointer to the parameter structure
+ * \param[in] method    Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT void Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    Input *algInput = static_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
+    const Parameter *algParameter = static_cast<const Parameter *>(parameter);
+
+    size_t nFeatures = algInput->get(data)->getNumberOfColumns();
+    allocateImpl<algorithmFPType>(this, nFeatures, algParameter);
+}
+
+/**
+ * Allocates memory for storing results of the EM for GMM algorithm in the online and distributed processing modes
+ * \param[in] partialResult Pointer to the partial result structure
+ * \param[in] parameter     Pointer to the parameter structure
+ * \param[in] method        Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT void Result::allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method)
+{
+    const PartialResult *algPartialResult = static_cast<const PartialResult *>(partialResult);
+    const Parameter *algParameter = static_cast<const Parameter *>(parameter);
 
-    set(goalFunction, NumericTablePtr(new HomogenNumericTable<algorithmFPType>(1, 1, NumericTable::doAllocate, 0)));
-    set(nIterations, NumericTablePtr(new HomogenNumericTable<int>(1, 1, NumericTable::doAllocate, 0)));
+    allocateImpl<algorithmFPType>(this, algPartialResult->getNumberOfFeatures(), algParameter);
 }
 
 } // namespace em_gmm
@@ -19,6 +19,8 @@
 //  Implementation of em algorithm
 //--
 
+#ifndef __EM_GMM_DENSE_DEFAULT_BATCH_IMPL_I__
+#define __EM_GMM_DENSE_DEFAULT_BATCH_IMPL_I__
 
 #include "service_math.h"
 #include "service_lapack.h"
@@ -133,7 +135,6 @@ void EMKernel<algorithmFPType, method, cpu>::compute(
     }
                                                         );
 
-    daal::tls<Error *> threadLocalError( [ = ]()-> Error* { return new Error(); } );
     while (diff > threshold && iterCounter < maxIterations)
     {
         covs->computeSigmaInverse(iterCounter, this->_errors.get());
@@ -145,63 +146,9 @@ void EMKernel<algorithmFPType, method, cpu>::compute(
         logAlpha = alpha;
         Math<algorithmFPType, cpu>::vLog(nComponents, alpha, logAlpha);
 
-        logLikelyhood = 0;
-        daal::threader_for( nBlocks, nBlocks, [ =, &threadBuffer, &threadLocalError](size_t iBlock)
-        {
-            size_t j0 = iBlock * blockSizeDefault;
-            size_t nVectorsInCurrentBlock = blockSizeDefault;
-            if( iBlock == nBlocks - 1 )
-            {
-                nVectorsInCurrentBlock = nVectors - iBlock * blockSizeDefault;
-            }
-
-            Error *localError = threadLocalError.local();
-            Task<algorithmFPType, cpu> *tPtr = threadBuffer.local();
-            if(!tPtr) {localError->setId(ErrorMemoryAllocationFailed); return;}
-            Task<algorithmFPType, cpu> &t = *tPtr;
-
-            t.next(j0, nVectorsInCurrentBlock, localError);
-            if(localError->id() != NoErrorMessageFound) {return;}
-
-            stepE(nVectorsInCurrentBlock, t, par->covarianceStorage);
-
-            logLikelyhoodLocalArray[iBlock] = computePartialLogLikelyhood(nVectorsInCurrentBlock, t);
-
-            stepM_partial(nVectorsInCurrentBlock, t, localError);
-            if(localError->id() != NoErrorMessageFound) {return;}
-        }
-                          );
-        threadLocalError.reduce( [ = ](Error * e)-> void
-        {
-            if(e->id() != NoErrorMessageFound) { this->_errors->add(SharedPtr<Error>(new Error(*e)));}
-        });
+        logLikelyhood = computeWeightedPartialSums<algorithmFPType, cpu>(nVectors, nBlocks, blockSizeDefault, nComponents, nFeatures,
+                        threadBuffer, logLikelyhoodLocalArray, par->covarianceStorage, covs, alpha, means, sigma, this->_errors.get());
         if(!this->_errors->isEmpty()) {break;}
-
-        for(size_t i = 0; i < nComponents; i++) {alpha[i] = 0;}
-        for(size_t i = 0; i < nComponents * nFeatures; i++) {means[i] = 0;}
-        covs->setToZero();
-        size_t nElementsOnOneCov = covs->getOneCovSize();
-        threadBuffer.reduce( [ = ]( Task<algorithmFPType, cpu> *e)-> void
-        {
-            for(size_t k = 0; k < nComponents; k++)
-            {
-                if(e->mergedWSums[k] > MinVal<algorithmFPType, cpu>::get())
-                {
-                    stepM_mergePartialSums(
-                        sigma[k], &e->mergedPartialCP[k * nElementsOnOneCov],
-                        &means[k * nFeatures], &e->mergedPartialMeans[k * nFeatures],
-                        alpha[k], e->mergedWSums[k],
-                        nFeatures, covs
-                    );
-                }
-            }
-            e->setMergedToZero();
-        });
-
-        for(size_t iBlock = 0; iBlock < nBlocks; iBlock++)
-        {
-            logLikelyhood += logLikelyhoodLocalArray[iBlock];
-        }
         logLikelyhood -= logLikelyhoodCorrection;
 
         stepM_merge(iterCounter, covs);
@@ -215,7 +162,6 @@ void EMKernel<algorithmFPType, method, cpu>::compute(
 
         iterCounter++;
     }
-    threadLocalError.reduce( [ = ](Error * e)-> void { delete e; });
     threadBuffer.reduce( [ = ](Task<algorithmFPType, cpu> *v)-> void {delete( v ); });
 }
 
@@ -435,6 +381,83 @@ void stepM_partial(const size_t nVectorsInCurrentBlock, Task<algorithmFPType, cp
     return;
 }
 
+/**
+ * Function computes E-step and partial sums of M-step for all blocks of data set in parallel.
+ * Partial sums of the threads are merged into sum of weights, weighted means and cross products of the components.
+ * Returns log likelihood value of the data set without the constant term
+ */
+template<typename algorithmFPType, CpuType cpu>
+algorithmFPType computeWeightedPartialSums(
+    const size_t nVectors, const size_t nBlocks, const size_t blockSizeDefault, const size_t nComponents, const size_t nFeatures,
+    daal::tls<Task<algorithmFPType, cpu> *> &threadBuffer, algorithmFPType *logLikelyhoodLocalArray,
+    const em_gmm::CovarianceStorageId covType, GmmModel<algorithmFPType, cpu> *covs,
+    algorithmFPType *sumOfWeights, algorithmFPType *weightedMeans, algorithmFPType **cp, KernelErrorCollection *errors)
+{
+    daal::tls<Error *> threadLocalError( [ = ]()-> Error* { return new Error(); } );
+    daal::threader_for( nBlocks, nBlocks, [ =, &threadBuffer, &threadLocalError](size_t iBlock)
+    {
+        size_t j0 = iBlock * blockSizeDefault;
+        size_t nVectorsInCurrentBlock = blockSizeDefault;
+        if( iBlock == nBlocks - 1 )
+        {
+            nVectorsInCurrentBlock = nVectors - iBlock * blockSizeDefault;
+        }
+
+        Error *localError = threadLocalError.local();
+        Task<algorithmFPType, cpu> *tPtr = threadBuffer.local();
+        if(!tPtr) {localError->setId(ErrorMemoryAllocationFailed); return;}
+        Task<algorithmFPType, cpu> &t = *tPtr;
+
+        t.next(j0, nVectorsInCurrentBlock, localError);
+        if(localError->id() != NoErrorMessageFound) {return;}
+
+        stepE(nVectorsInCurrentBlock, t, covType);
+
+        logLikelyhoodLocalArray[iBlock] = computePartialLogLikelyhood(nVectorsInCurrentBlock, t);
+
+        stepM_partial(nVectorsInCurrentBlock, t, localError);
+        if(localError->id() != NoErrorMessageFound) {return;}
+    }
+                      );
+    threadLocalError.reduce( [ = ](Error * e)-> void
+    {
+        if(e->id() != NoErrorMessageFound) { errors->add(SharedPtr<Error>(new Error(*e)));}
+        delete e;
+    });
+    if(!errors->isEmpty()) {return 0;}
+
+    size_t nElementsOnOneCov = covs->getOneCovSize();
+    for(size_t i = 0; i < nComponents; i++) {sumOfWeights[i] = 0;}
+    for(size_t i = 0; i < nComponents * nFeatures; i++) {weightedMeans[i] = 0;}
+    for(size_t i = 0; i < nComponents; i++)
+    {
+        for(size_t j = 0; j < nElementsOnOneCov; j++) {cp[i][j] = 0;}
+    }
+    threadBuffer.reduce( [ = ]( Task<algorithmFPType, cpu> *e)-> void
+    {
+        for(size_t k = 0; k < nComponents; k++)
+        {
+            if(e->mergedWSums[k] > MinVal<algorithmFPType, cpu>::get())
+            {
+                stepM_mergePartialSums(
+                    cp[k], &e->mergedPartialCP[k * nElementsOnOneCov],
+                    &weightedMeans[k * nFeatures], &e->mergedPartialMeans[k * nFeatures],
+                    sumOfWeights[k], e->mergedWSums[k],
+                    nFeatures, covs
+                );
+            }
+        }
+        e->setMergedToZero();
+    });
+
+    algorithmFPType logLikelyhood = 0;
+    for(size_t iBlock = 0; iBlock < nBlocks; iBlock++)
+    {
+        logLikelyhood += logLikelyhoodLocalArray[iBlock];
+    }
+    return logLikelyhood;
+}
+
 /**
  * Function scales merged values of to get result
  */
@@ -781,3 +804,5 @@ void EMKernel<algorithmFPType, method, cpu>::getInitValues(NumericTable *initial
 } // namespace algorithms
 
 } // namespace daal
+
+#endif
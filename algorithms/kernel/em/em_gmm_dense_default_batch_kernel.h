@@ -29,6 +29,7 @@
 #include "numeric_table.h"
 #include "service_blas.h"
 #include "em_gmm_dense_default_batch_task.h"
+#include "threading.h"
 
 using namespace daal::data_management;
 
@@ -92,6 +93,13 @@ void stepM_mergePartialSums(
     algorithmFPType &w_n, algorithmFPType &w_m,
     size_t nFeatures, GmmModel<algorithmFPType, cpu> *covs);
 
+template<typename algorithmFPType, CpuType cpu>
+algorithmFPType computeWeightedPartialSums(
+    const size_t nVectors, const size_t nBlocks, const size_t blockSizeDefault, const size_t nComponents, const size_t nFeatures,
+    daal::tls<Task<algorithmFPType, cpu> *> &threadBuffer, algorithmFPType *logLikelyhoodLocalArray,
+    const em_gmm::CovarianceStorageId covType, GmmModel<algorithmFPType, cpu> *covs,
+    algorithmFPType *sumOfWeights, algorithmFPType *weightedMeans, algorithmFPType **cp, KernelErrorCollection *errors);
+
 } // namespace internal
 
 } // namespace em_gmm
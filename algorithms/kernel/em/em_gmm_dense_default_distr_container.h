@@ -0,0 +1,156 @@
+/* file: em_gmm_dense_default_distr_container.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of EM calculation algorithm container in the distributed processing mode.
+//--
+*/
+
+#ifndef __EM_GMM_DENSE_DEFAULT_DISTR_CONTAINER_H__
+#define __EM_GMM_DENSE_DEFAULT_DISTR_CONTAINER_H__
+
+#include "em_gmm_distributed.h"
+#include "em_gmm_dense_default_online_container.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace em_gmm
+{
+
+/**
+ *  \brief Initialize list of em kernels with implementations for supported architectures
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step1Local, algorithmFPType, method, cpu>::DistributedContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::EMOnlineKernel, algorithmFPType, method);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step1Local, algorithmFPType, method, cpu>::~DistributedContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void DistributedContainer<step1Local, algorithmFPType, method, cpu>::compute()
+{
+    Input *input = static_cast<Input *>(_in);
+    PartialResult *pres = static_cast<PartialResult *>(_pres);
+    const Parameter *emPar = static_cast<Parameter *>(_par);
+    size_t nComponents = emPar->nComponents;
+
+    NumericTable *dataTable = input->get(data).get();
+    NumericTable *initialWeights = 0;
+    NumericTable *initialMeans = 0;
+    daal::internal::TArray<NumericTable *, cpu> initialCovariancesPtr(nComponents);
+    NumericTable **initialCovariances = initialCovariancesPtr.get();
+    internal::getInitialModelTables(input, nComponents, initialWeights, initialMeans, initialCovariances);
+
+    daal::internal::TArray<NumericTable *, cpu> partialResultPtr(internal::nPartialResultTables + nComponents);
+    NumericTable **partialResult = partialResultPtr.get();
+    internal::getPartialResultTables(pres, nComponents, partialResult);
+
+    daal::services::Environment::env &env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::EMOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, dataTable, initialWeights, initialMeans, initialCovariances, partialResult, emPar, false)
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void DistributedContainer<step1Local, algorithmFPType, method, cpu>::finalizeCompute() {}
+
+/**
+ *  \brief Initialize list of em kernels with implementations for supported architectures
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step2Master, algorithmFPType, method, cpu>::DistributedContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::EMDistributedStep2Kernel, algorithmFPType, method);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step2Master, algorithmFPType, method, cpu>::~DistributedContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void DistributedContainer<step2Master, algorithmFPType, method, cpu>::compute()
+{
+    DistributedStep2MasterInput *input = static_cast<DistributedStep2MasterInput *>(_in);
+    PartialResult *pres = static_cast<PartialResult *>(_pres);
+    const Parameter *emPar = static_cast<Parameter *>(_par);
+    size_t nComponents = emPar->nComponents;
+    size_t nTablesInPartialResult = internal::nPartialResultTables + nComponents;
+
+    data_management::DataCollection *dcInput = input->get(partialResults).get();
+    size_t nPartialResults = dcInput->size();
+
+    daal::internal::TArray<NumericTable *, cpu> localPartialResultsPtr(nPartialResults * nTablesInPartialResult);
+    NumericTable **localPartialResults = localPartialResultsPtr.get();
+    for(size_t i = 0; i < nPartialResults; i++)
+    {
+        PartialResult *localPres = static_cast<PartialResult *>((*dcInput)[i].get());
+        internal::getPartialResultTables(localPres, nComponents, localPartialResults + i * nTablesInPartialResult);
+    }
+
+    daal::internal::TArray<NumericTable *, cpu> partialResultPtr(nTablesInPartialResult);
+    NumericTable **partialResult = partialResultPtr.get();
+    internal::getPartialResultTables(pres, nComponents, partialResult);
+
+    daal::services::Environment::env &env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::EMDistributedStep2Kernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, nPartialResults, localPartialResults, partialResult, emPar)
+
+    dcInput->clear();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void DistributedContainer<step2Master, algorithmFPType, method, cpu>::finalizeCompute()
+{
+    PartialResult *pres = static_cast<PartialResult *>(_pres);
+    Result *pRes = static_cast<Result *>(_res);
+    const Parameter *emPar = static_cast<Parameter *>(_par);
+    size_t nComponents = emPar->nComponents;
+
+    daal::internal::TArray<NumericTable *, cpu> partialResultPtr(internal::nPartialResultTables + nComponents);
+    NumericTable **partialResult = partialResultPtr.get();
+    internal::getPartialResultTables(pres, nComponents, partialResult);
+
+    NumericTable *resultGoalFunction = pRes->get(goalFunction).get();
+    NumericTable *resultNIterations = pRes->get(nIterations).get();
+    NumericTable *resultWeights = pRes->get(weights).get();
+    NumericTable *resultMeans = pRes->get(means).get();
+    daal::internal::TArray<NumericTable *, cpu> resultCovariancesPtr(nComponents);
+    NumericTable **resultCovariances = resultCovariancesPtr.get();
+    internal::getResultCovarianceTables(pRes, nComponents, resultCovariances);
+
+    daal::services::Environment::env &env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::EMDistributedStep2Kernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), finalizeCompute, partialResult, resultWeights, resultMeans, resultCovariances, resultNIterations, resultGoalFunction, emPar)
+}
+
+} // namespace em_gmm
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,115 @@
+/* file: em_gmm_dense_default_distr_step2_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the EM for GMM algorithm in the second step of the distributed processing mode.
+//--
+*/
+
+#ifndef __EM_GMM_DENSE_DEFAULT_DISTR_STEP2_IMPL_I__
+#define __EM_GMM_DENSE_DEFAULT_DISTR_STEP2_IMPL_I__
+
+#include "em_gmm_dense_default_online_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace em_gmm
+{
+namespace internal
+{
+
+/**
+ * Function merges the sufficient statistics computed on local nodes into the partial result of the master node
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+void EMDistributedStep2Kernel<algorithmFPType, method, cpu>::compute(
+    size_t nPartialResults,
+    NumericTable **localPartialResults,
+    NumericTable **partialResult,
+    const Parameter *par)
+{
+    const size_t nFeatures   = partialResult[partialMeans]->getNumberOfColumns();
+    const size_t nComponents = par->nComponents;
+    const size_t nTables     = nPartialResultTables + nComponents;
+
+    GmmModel<algorithmFPType, cpu> *covs = this->createGmmModel(nFeatures, nComponents, par->covarianceStorage);
+    SharedPtr<GmmModel<algorithmFPType, cpu> > covsShPtr(covs);
+    DAAL_CHECK(covs, ErrorMemoryAllocationFailed);
+
+    const size_t nRowsInCov = covs->getNumberOfRowsInCov();
+    PartialSums<algorithmFPType, readWrite, cpu> stats(partialResult, nComponents, nRowsInCov);
+    DAAL_CHECK(stats.isValid(), ErrorMemoryAllocationFailed);
+
+    for(size_t i = 0; i < nPartialResults; i++)
+    {
+        PartialSums<algorithmFPType, readOnly, cpu> localStats(localPartialResults + i * nTables, nComponents, nRowsInCov);
+        DAAL_CHECK(localStats.isValid(), ErrorMemoryAllocationFailed);
+
+        for(size_t k = 0; k < nComponents; k++)
+        {
+            if(localStats.sumOfWeights[k] > MinVal<algorithmFPType, cpu>::get())
+            {
+                stepM_mergePartialSums(
+                    stats.cp[k], localStats.cp[k],
+                    &stats.means[k * nFeatures], &localStats.means[k * nFeatures],
+                    stats.sumOfWeights[k], localStats.sumOfWeights[k],
+                    nFeatures, covs
+                );
+            }
+        }
+
+        const algorithmFPType nObservations = *stats.nObservations + *localStats.nObservations;
+        if(nObservations > 0)
+        {
+            *stats.goalFunction = ((*stats.nObservations) * (*stats.goalFunction) +
+                                   (*localStats.nObservations) * (*localStats.goalFunction)) / nObservations;
+        }
+        *stats.nObservations = nObservations;
+        *stats.nBlocks += *localStats.nBlocks;
+    }
+
+    this->symmetrizeCrossProducts(nFeatures, nComponents, par->covarianceStorage, stats.cp);
+}
+
+/**
+ * Function computes the result of the algorithm from the merged sufficient statistics (M-step)
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+void EMDistributedStep2Kernel<algorithmFPType, method, cpu>::finalizeCompute(
+    NumericTable **partialResult,
+    NumericTable *resultWeights,
+    NumericTable *resultMeans,
+    NumericTable **resultCovariances,
+    NumericTable *resultNIterations,
+    NumericTable *resultGoalFunction,
+    const Parameter *par)
+{
+    this->finalizePartialSums(partialResult, resultWeights, resultMeans, resultCovariances, resultNIterations, resultGoalFunction, par, false);
+}
+
+} // namespace internal
+
+} // namespace em_gmm
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,154 @@
+/* file: em_gmm_dense_default_online_container.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of EM calculation algorithm container in the online processing mode.
+//--
+*/
+
+#ifndef __EM_GMM_DENSE_DEFAULT_ONLINE_CONTAINER_H__
+#define __EM_GMM_DENSE_DEFAULT_ONLINE_CONTAINER_H__
+
+#include "em_gmm_online.h"
+#include "em_gmm_dense_default_online_kernel.h"
+#include "service_numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace em_gmm
+{
+namespace internal
+{
+
+/**
+ *  \brief Collects the numeric tables of the partial result in the order expected by the kernels:
+ *         the tables of PartialResultId followed by the cross-products of the components
+ */
+inline void getPartialResultTables(PartialResult *pres, size_t nComponents, NumericTable **tables)
+{
+    tables[nObservations]       = pres->get(nObservations).get();
+    tables[sumOfWeights]        = pres->get(sumOfWeights).get();
+    tables[partialMeans]        = pres->get(partialMeans).get();
+    tables[partialGoalFunction] = pres->get(partialGoalFunction).get();
+    tables[nProcessedBlocks]    = pres->get(nProcessedBlocks).get();
+    for(size_t i = 0; i < nComponents; i++)
+    {
+        tables[nPartialResultTables + i] = pres->get(partialCrossProducts, i).get();
+    }
+}
+
+/**
+ *  \brief Collects the input numeric tables with the initial values of the model
+ */
+inline void getInitialModelTables(Input *input, size_t nComponents, NumericTable *&initialWeights, NumericTable *&initialMeans,
+                                  NumericTable **initialCovariances)
+{
+    initialWeights = input->get(inputWeights).get();
+    initialMeans   = input->get(inputMeans).get();
+    for(size_t i = 0; i < nComponents; i++)
+    {
+        initialCovariances[i] = input->get(inputCovariances, i).get();
+    }
+}
+
+/**
+ *  \brief Collects the covariance matrices of the result
+ */
+inline void getResultCovarianceTables(Result *result, size_t nComponents, NumericTable **resultCovariances)
+{
+    for(size_t i = 0; i < nComponents; i++)
+    {
+        resultCovariances[i] = result->get(covariances, i).get();
+    }
+}
+
+} // namespace internal
+
+/**
+ *  \brief Initialize list of em kernels with implementations for supported architectures
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::OnlineContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::EMOnlineKernel, algorithmFPType, method);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::~OnlineContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void OnlineContainer<algorithmFPType, method, cpu>::compute()
+{
+    Input *input = static_cast<Input *>(_in);
+    PartialResult *pres = static_cast<PartialResult *>(_pres);
+    const Parameter *emPar = static_cast<Parameter *>(_par);
+    size_t nComponents = emPar->nComponents;
+
+    NumericTable *dataTable = input->get(data).get();
+    NumericTable *initialWeights = 0;
+    NumericTable *initialMeans = 0;
+    daal::internal::TArray<NumericTable *, cpu> initialCovariancesPtr(nComponents);
+    NumericTable **initialCovariances = initialCovariancesPtr.get();
+    internal::getInitialModelTables(input, nComponents, initialWeights, initialMeans, initialCovariances);
+
+    daal::internal::TArray<NumericTable *, cpu> partialResultPtr(internal::nPartialResultTables + nComponents);
+    NumericTable **partialResult = partialResultPtr.get();
+    internal::getPartialResultTables(pres, nComponents, partialResult);
+
+    daal::services::Environment::env &env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::EMOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, dataTable, initialWeights, initialMeans, initialCovariances, partialResult, emPar, true)
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void OnlineContainer<algorithmFPType, method, cpu>::finalizeCompute()
+{
+    PartialResult *pres = static_cast<PartialResult *>(_pres);
+    Result *pRes = static_cast<Result *>(_res);
+    const Parameter *emPar = static_cast<Parameter *>(_par);
+    size_t nComponents = emPar->nComponents;
+
+    daal::internal::TArray<NumericTable *, cpu> partialResultPtr(internal::nPartialResultTables + nComponents);
+    NumericTable **partialResult = partialResultPtr.get();
+    internal::getPartialResultTables(pres, nComponents, partialResult);
+
+    NumericTable *resultGoalFunction = pRes->get(goalFunction).get();
+    NumericTable *resultNIterations = pRes->get(nIterations).get();
+    NumericTable *resultWeights = pRes->get(weights).get();
+    NumericTable *resultMeans = pRes->get(means).get();
+    daal::internal::TArray<NumericTable *, cpu> resultCovariancesPtr(nComponents);
+    NumericTable **resultCovariances = resultCovariancesPtr.get();
+    internal::getResultCovarianceTables(pRes, nComponents, resultCovariances);
+
+    daal::services::Environment::env &env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::EMOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), finalizeCompute, partialResult, resultWeights, resultMeans, resultCovariances, resultNIterations, resultGoalFunction, emPar, true)
+}
+
+} // namespace em_gmm
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
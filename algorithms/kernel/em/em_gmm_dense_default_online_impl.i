@@ -0,0 +1,376 @@
+/* file: em_gmm_dense_default_online_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the EM for GMM algorithm in the online processing mode and
+//  in the first step of the distributed processing mode.
+//--
+*/
+
+#ifndef __EM_GMM_DENSE_DEFAULT_ONLINE_IMPL_I__
+#define __EM_GMM_DENSE_DEFAULT_ONLINE_IMPL_I__
+
+#include "em_gmm_dense_default_online_kernel.h"
+#include "em_gmm_dense_default_batch_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace em_gmm
+{
+namespace internal
+{
+
+template<typename algorithmFPType, ReadWriteMode mode, CpuType cpu>
+PartialSums<algorithmFPType, mode, cpu>::PartialSums(NumericTable *const *partialResult, size_t nComponents, size_t nRowsInCP) :
+    _cpBD(nComponents), _cpPtr(nComponents), _isValid(false)
+{
+    nObservations = _nObservationsBD.set(partialResult[em_gmm::nObservations      ], 0, 1);
+    sumOfWeights  = _sumOfWeightsBD .set(partialResult[em_gmm::sumOfWeights       ], 0, 1);
+    means         = _meansBD        .set(partialResult[em_gmm::partialMeans       ], 0, nComponents);
+    goalFunction  = _goalFunctionBD .set(partialResult[em_gmm::partialGoalFunction], 0, 1);
+    nBlocks       = _nBlocksBD      .set(partialResult[em_gmm::nProcessedBlocks   ], 0, 1);
+    cp = _cpPtr.get();
+    if(!nObservations || !sumOfWeights || !means || !goalFunction || !nBlocks || !cp || !_cpBD.get()) { return; }
+
+    for(size_t k = 0; k < nComponents; k++)
+    {
+        cp[k] = _cpBD[k].set(partialResult[nPartialResultTables + k], 0, nRowsInCP);
+        if(!cp[k]) { return; }
+    }
+    _isValid = true;
+}
+
+/**
+ * Function computes the sufficient statistics of the Gaussian mixture model for the block of data.
+ * The E-step uses the initial values of the model for the first block and the model computed from
+ * the sufficient statistics of the previous blocks otherwise. The statistics of the block are combined
+ * with the statistics of the previous blocks with the learning rate (t + 1 + t0)^(-decay)
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+void EMOnlineKernel<algorithmFPType, method, cpu>::compute(
+    NumericTable *dataTable,
+    NumericTable *initialWeights,
+    NumericTable *initialMeans,
+    NumericTable **initialCovariances,
+    NumericTable **partialResult,
+    const Parameter *par,
+    bool isOnline)
+{
+    const size_t nFeatures   = dataTable->getNumberOfColumns();
+    const size_t nVectors    = dataTable->getNumberOfRows();
+    const size_t nComponents = par->nComponents;
+
+    GmmModel<algorithmFPType, cpu> *covs = this->createGmmModel(nFeatures, nComponents, par->covarianceStorage);
+    SharedPtr<GmmModel<algorithmFPType, cpu> > covsShPtr(covs);
+    DAAL_CHECK(covs, ErrorMemoryAllocationFailed);
+
+    const size_t nElementsOnOneCov = covs->getOneCovSize();
+    PartialSums<algorithmFPType, readWrite, cpu> stats(partialResult, nComponents, covs->getNumberOfRowsInCov());
+    DAAL_CHECK(stats.isValid(), ErrorMemoryAllocationFailed);
+
+    /* As in the batch processing mode, the sums of the block are written over the model used on the E-step */
+    TArray<algorithmFPType, cpu> modelPtr(nComponents + nComponents * nFeatures + nComponents * nElementsOnOneCov);
+    algorithmFPType *alpha = modelPtr.get();
+    DAAL_CHECK(alpha, ErrorMemoryAllocationFailed);
+    algorithmFPType *means = alpha + nComponents;
+    algorithmFPType **sigma = covs->getSigma();
+    for(size_t k = 0; k < nComponents; k++)
+    {
+        sigma[k] = means + nComponents * nFeatures + k * nElementsOnOneCov;
+    }
+
+    const size_t nProcessedBlocks = (isOnline ? (size_t)(*stats.nBlocks) : 0);
+    if(nProcessedBlocks == 0)
+    {
+        this->getInitValues(initialWeights, initialMeans, initialCovariances, nFeatures, nComponents, alpha, means, covs);
+    }
+    else
+    {
+        this->computeModel(nFeatures, nComponents, nProcessedBlocks, stats.sumOfWeights, stats.means, stats.cp, alpha, means, covs);
+    }
+    if(!this->_errors->isEmpty()) { return; }
+
+    covs->setCovRegularizer(par->regularizationFactor);
+    covs->computeSigmaInverse(nProcessedBlocks, this->_errors.get());
+    if(!this->_errors->isEmpty()) { return; }
+
+    algorithmFPType *logSqrtInvDetSigma = covs->getLogSqrtInvDetSigma();
+    Math<algorithmFPType, cpu>::vLog(nComponents, logSqrtInvDetSigma, logSqrtInvDetSigma);
+    Math<algorithmFPType, cpu>::vLog(nComponents, alpha, alpha);
+
+    size_t blockSizeDefault = 512;
+    size_t nBlocks = nVectors / blockSizeDefault;
+    nBlocks += (nBlocks * blockSizeDefault != nVectors);
+    if(nBlocks == 1)
+    {
+        blockSizeDefault = nVectors;
+    }
+
+    TArray<algorithmFPType, cpu> logLikelyhoodLocalArrayPtr(nBlocks);
+    algorithmFPType *logLikelyhoodLocalArray = logLikelyhoodLocalArrayPtr.get();
+    DAAL_CHECK(logLikelyhoodLocalArray, ErrorMemoryAllocationFailed);
+
+    daal::tls<Task<algorithmFPType, cpu> *> threadBuffer( [ = ]()-> Task<algorithmFPType, cpu> *
+    {
+        return new Task<algorithmFPType, cpu>(dataTable, blockSizeDefault, nFeatures, nComponents, alpha, means, covs);
+    }
+                                                        );
+
+    algorithmFPType logLikelyhood = computeWeightedPartialSums<algorithmFPType, cpu>(nVectors, nBlocks, blockSizeDefault, nComponents, nFeatures,
+                                    threadBuffer, logLikelyhoodLocalArray, par->covarianceStorage, covs, alpha, means, sigma, this->_errors.get());
+    threadBuffer.reduce( [ = ](Task<algorithmFPType, cpu> *v)-> void {delete( v ); });
+    if(!this->_errors->isEmpty()) { return; }
+
+    if(nProcessedBlocks == 0)
+    {
+        /* Sums of the local data in the distributed processing mode, averages over the first block in the online processing mode */
+        const algorithmFPType scale = (isOnline ? (algorithmFPType)1.0 / nVectors : (algorithmFPType)1.0);
+        for(size_t k = 0; k < nComponents; k++)
+        {
+            stats.sumOfWeights[k] = alpha[k] * scale;
+            for(size_t j = 0; j < nElementsOnOneCov; j++)
+            {
+                stats.cp[k][j] = sigma[k][j] * scale;
+            }
+        }
+        for(size_t i = 0; i < nComponents * nFeatures; i++)
+        {
+            stats.means[i] = means[i];
+        }
+        *stats.goalFunction  = logLikelyhood / nVectors;
+        *stats.nObservations = nVectors;
+        *stats.nBlocks       = 1;
+    }
+    else
+    {
+        /* Stepwise update of the sufficient statistics: s = (1 - rho) * s + rho * s(block) */
+        const algorithmFPType rho = Math<algorithmFPType, cpu>::sPowx(nProcessedBlocks + 1 + par->learningRateOffset, -par->learningRateDecay);
+        const algorithmFPType oldScale = (algorithmFPType)1.0 - rho;
+        const algorithmFPType newScale = rho / nVectors;
+        for(size_t k = 0; k < nComponents; k++)
+        {
+            stats.sumOfWeights[k] *= oldScale;
+            algorithmFPType blockWeight = alpha[k] * newScale;
+            for(size_t j = 0; j < nElementsOnOneCov; j++)
+            {
+                stats.cp[k][j] *= oldScale;
+                sigma[k][j]    *= newScale;
+            }
+            if(blockWeight > MinVal<algorithmFPType, cpu>::get())
+            {
+                stepM_mergePartialSums(
+                    stats.cp[k], sigma[k],
+                    &stats.means[k * nFeatures], &means[k * nFeatures],
+                    stats.sumOfWeights[k], blockWeight,
+                    nFeatures, covs
+                );
+            }
+        }
+        *stats.goalFunction   = oldScale * (*stats.goalFunction) + newScale * logLikelyhood;
+        *stats.nObservations += nVectors;
+        *stats.nBlocks       += 1;
+    }
+
+    this->symmetrizeCrossProducts(nFeatures, nComponents, par->covarianceStorage, stats.cp);
+}
+
+/**
+ * Function computes the result of the algorithm from the sufficient statistics
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+void EMOnlineKernel<algorithmFPType, method, cpu>::finalizeCompute(
+    NumericTable **partialResult,
+    NumericTable *resultWeights,
+    NumericTable *resultMeans,
+    NumericTable **resultCovariances,
+    NumericTable *resultNIterations,
+    NumericTable *resultGoalFunction,
+    const Parameter *par,
+    bool isOnline)
+{
+    this->finalizePartialSums(partialResult, resultWeights, resultMeans, resultCovariances, resultNIterations, resultGoalFunction, par, isOnline);
+}
+
+template<typename algorithmFPType, CpuType cpu>
+GmmModel<algorithmFPType, cpu> *EMPartialSumsKernel<algorithmFPType, cpu>::createGmmModel(size_t nFeatures, size_t nComponents, CovarianceStorageId covType)
+{
+    if(covType == diagonal)
+    {
+        return new GmmModelDiag<algorithmFPType, cpu>(nFeatures, nComponents);
+    }
+    return new GmmModelFull<algorithmFPType, cpu>(nFeatures, nComponents);
+}
+
+/**
+ * Read initial values and copy them to work arrays.
+ */
+template<typename algorithmFPType, CpuType cpu>
+void EMPartialSumsKernel<algorithmFPType, cpu>::getInitValues(NumericTable *initialWeights, NumericTable *initialMeans, NumericTable **initialCovariances,
+                                                              size_t nFeatures, size_t nComponents,
+                                                              algorithmFPType *alpha, algorithmFPType *means, GmmModel<algorithmFPType, cpu> *covs)
+{
+    ReadRows<algorithmFPType, cpu, NumericTable> bd;
+
+    const algorithmFPType *initialWeightsArray = bd.set(initialWeights, 0, 1);
+    DAAL_CHECK(initialWeightsArray, ErrorMemoryAllocationFailed);
+    size_t nCopy = nComponents * sizeof(algorithmFPType);
+    daal_memcpy_s(alpha, nCopy, initialWeightsArray, nCopy);
+
+    const algorithmFPType *initialMeansArray = bd.set(initialMeans, 0, nComponents);
+    DAAL_CHECK(initialMeansArray, ErrorMemoryAllocationFailed);
+    nCopy = nComponents * nFeatures * sizeof(algorithmFPType);
+    daal_memcpy_s(means, nCopy, initialMeansArray, nCopy);
+
+    nCopy = covs->getOneCovSize() * sizeof(algorithmFPType);
+    algorithmFPType **sigma = covs->getSigma();
+    for(size_t i = 0; i < nComponents; i++)
+    {
+        const algorithmFPType *initCov = bd.set(initialCovariances[i], 0, covs->getNumberOfRowsInCov());
+        DAAL_CHECK(initCov, ErrorMemoryAllocationFailed);
+        daal_memcpy_s(sigma[i], nCopy, initCov, nCopy);
+    }
+}
+
+/**
+ * Function computes weights, means and covariances of the components from the sufficient statistics (M-step)
+ */
+template<typename algorithmFPType, CpuType cpu>
+void EMPartialSumsKernel<algorithmFPType, cpu>::computeModel(size_t nFeatures, size_t nComponents, size_t nProcessedBlocks,
+                                                             const algorithmFPType *sumOfWeights, const algorithmFPType *partialMeans, algorithmFPType *const *cp,
+                                                             algorithmFPType *alpha, algorithmFPType *means, GmmModel<algorithmFPType, cpu> *covs)
+{
+    algorithmFPType totalWeight = 0;
+    for(size_t k = 0; k < nComponents; k++)
+    {
+        totalWeight += sumOfWeights[k];
+    }
+
+    const size_t nElementsOnOneCov = covs->getOneCovSize();
+    algorithmFPType **sigma = covs->getSigma();
+    for(size_t k = 0; k < nComponents; k++)
+    {
+        if(sumOfWeights[k] < MinVal<algorithmFPType, cpu>::get())
+        {
+            this->_errors->add(ErrorEMEmptyComponent).addIntDetail(Component, k).addIntDetail(Iteration, nProcessedBlocks);
+            return;
+        }
+        alpha[k] = sumOfWeights[k] / totalWeight;
+        for(size_t j = 0; j < nFeatures; j++)
+        {
+            means[k * nFeatures + j] = partialMeans[k * nFeatures + j];
+        }
+        for(size_t j = 0; j < nElementsOnOneCov; j++)
+        {
+            sigma[k][j] = cp[k][j];
+        }
+        covs->finalize(k, sumOfWeights[k]);
+    }
+}
+
+/**
+ * Function copies the lower triangle of the full cross-products to the upper triangle
+ */
+template<typename algorithmFPType, CpuType cpu>
+void EMPartialSumsKernel<algorithmFPType, cpu>::symmetrizeCrossProducts(size_t nFeatures, size_t nComponents, CovarianceStorageId covType,
+                                                                        algorithmFPType *const *cp)
+{
+    if(covType == diagonal) { return; }
+    for(size_t k = 0; k < nComponents; k++)
+    {
+        for(size_t i = 0; i < nFeatures; i++)
+        {
+            for(size_t j = 0; j < i; j++)
+            {
+                cp[k][j * nFeatures + i] = cp[k][i * nFeatures + j];
+            }
+        }
+    }
+}
+
+/**
+ * Function computes weights, means and covariances of the components and the log-likelyhood
+ * from the sufficient statistics stored in the partial result
+ */
+template<typename algorithmFPType, CpuType cpu>
+void EMPartialSumsKernel<algorithmFPType, cpu>::finalizePartialSums(
+    NumericTable **partialResult,
+    NumericTable *resultWeights,
+    NumericTable *resultMeans,
+    NumericTable **resultCovariances,
+    NumericTable *resultNIterations,
+    NumericTable *resultGoalFunction,
+    const Parameter *par,
+    bool isOnline)
+{
+    const size_t nFeatures   = resultMeans->getNumberOfColumns();
+    const size_t nComponents = par->nComponents;
+
+    GmmModel<algorithmFPType, cpu> *covs = createGmmModel(nFeatures, nComponents, par->covarianceStorage);
+    SharedPtr<GmmModel<algorithmFPType, cpu> > covsShPtr(covs);
+    DAAL_CHECK(covs, ErrorMemoryAllocationFailed);
+
+    const size_t nRowsInCov = covs->getNumberOfRowsInCov();
+    PartialSums<algorithmFPType, readOnly, cpu> stats(partialResult, nComponents, nRowsInCov);
+    DAAL_CHECK(stats.isValid(), ErrorMemoryAllocationFailed);
+
+    WriteOnlyRows<algorithmFPType, cpu, NumericTable> weightsBD(resultWeights, 0, 1);
+    algorithmFPType *alpha = weightsBD.get();
+    DAAL_CHECK(alpha, ErrorMemoryAllocationFailed);
+
+    WriteOnlyRows<algorithmFPType, cpu, NumericTable> meansBD(resultMeans, 0, nComponents);
+    algorithmFPType *means = meansBD.get();
+    DAAL_CHECK(means, ErrorMemoryAllocationFailed);
+
+    TArray<WriteOnlyRows<algorithmFPType, cpu, NumericTable>, cpu> covsPtr(nComponents);
+    WriteOnlyRows<algorithmFPType, cpu, NumericTable> *covsNt = covsPtr.get();
+    DAAL_CHECK(covsNt, ErrorMemoryAllocationFailed);
+    algorithmFPType **sigma = covs->getSigma();
+    for(size_t k = 0; k < nComponents; k++)
+    {
+        sigma[k] = covsNt[k].set(resultCovariances[k], 0, nRowsInCov);
+        DAAL_CHECK(sigma[k], ErrorMemoryAllocationFailed);
+    }
+
+    computeModel(nFeatures, nComponents, (size_t)(*stats.nBlocks), stats.sumOfWeights, stats.means, stats.cp, alpha, means, covs);
+    if(!this->_errors->isEmpty()) { return; }
+
+    WriteOnlyRows<int, cpu, NumericTable> nIterationsBD(resultNIterations, 0, 1);
+    int *nIterationsArray = nIterationsBD.get();
+    DAAL_CHECK(nIterationsArray, ErrorMemoryAllocationFailed);
+    nIterationsArray[0] = (isOnline ? *stats.nBlocks : 1);
+
+    WriteOnlyRows<algorithmFPType, cpu, NumericTable> goalFunctionBD(resultGoalFunction, 0, 1);
+    algorithmFPType *logLikelyhood = goalFunctionBD.get();
+    DAAL_CHECK(logLikelyhood, ErrorMemoryAllocationFailed);
+
+    algorithmFPType pi = 3.1415926535897932384626433;
+    const algorithmFPType nObservations = *stats.nObservations;
+    logLikelyhood[0] = nObservations * (*stats.goalFunction) - 0.5 * nObservations * nFeatures * Math<algorithmFPType, cpu>::sLog(2 * pi);
+}
+
+} // namespace internal
+
+} // namespace em_gmm
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
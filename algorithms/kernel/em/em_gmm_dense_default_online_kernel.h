@@ -0,0 +1,176 @@
+/* file: em_gmm_dense_default_online_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template functions that compute the sufficient statistics of the Gaussian mixture model
+//  in the online and distributed processing modes of the EM for GMM algorithm.
+//--
+*/
+
+#ifndef __EM_GMM_DENSE_DEFAULT_ONLINE_KERNEL_H__
+#define __EM_GMM_DENSE_DEFAULT_ONLINE_KERNEL_H__
+
+#include "em_gmm_types.h"
+#include "kernel.h"
+#include "numeric_table.h"
+#include "em_gmm_dense_default_batch_kernel.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace em_gmm
+{
+namespace internal
+{
+
+/**
+ * Number of the numeric tables in the partial result of the EM for GMM algorithm that are stored before
+ * the cross-products of the components. The tables are passed to the kernels in the order of PartialResultId
+ * followed by nComponents tables of the partial cross-products
+ */
+const size_t nPartialResultTables = 5;
+
+/**
+ * Arrays of the sufficient statistics of the Gaussian mixture model stored in the tables of the partial result
+ */
+template<typename algorithmFPType, ReadWriteMode mode, CpuType cpu>
+class PartialSums
+{
+public:
+    PartialSums(NumericTable *const *partialResult, size_t nComponents, size_t nRowsInCP);
+
+    bool isValid() const { return _isValid; }
+
+    algorithmFPType *nObservations;
+    algorithmFPType *sumOfWeights;
+    algorithmFPType *means;
+    algorithmFPType *goalFunction;
+    int *nBlocks;
+    algorithmFPType **cp;
+
+private:
+    typedef GetRows<algorithmFPType, algorithmFPType, cpu, mode, NumericTable> Rows;
+    Rows _nObservationsBD;
+    Rows _sumOfWeightsBD;
+    Rows _meansBD;
+    Rows _goalFunctionBD;
+    GetRows<int, int, cpu, mode, NumericTable> _nBlocksBD;
+    TArray<Rows, cpu> _cpBD;
+    TArray<algorithmFPType *, cpu> _cpPtr;
+    bool _isValid;
+};
+
+/**
+ * Common functions of the kernels that work with the sufficient statistics of the Gaussian mixture model
+ */
+template<typename algorithmFPType, CpuType cpu>
+class EMPartialSumsKernel : public Kernel
+{
+protected:
+    GmmModel<algorithmFPType, cpu> *createGmmModel(size_t nFeatures, size_t nComponents, CovarianceStorageId covType);
+
+    void getInitValues(NumericTable *initialWeights, NumericTable *initialMeans, NumericTable **initialCovariances,
+                       size_t nFeatures, size_t nComponents, algorithmFPType *alpha, algorithmFPType *means, GmmModel<algorithmFPType, cpu> *covs);
+
+    void computeModel(size_t nFeatures, size_t nComponents, size_t nProcessedBlocks,
+                      const algorithmFPType *sumOfWeights, const algorithmFPType *partialMeans, algorithmFPType *const *cp,
+                      algorithmFPType *alpha, algorithmFPType *means, GmmModel<algorithmFPType, cpu> *covs);
+
+    void symmetrizeCrossProducts(size_t nFeatures, size_t nComponents, CovarianceStorageId covType, algorithmFPType *const *cp);
+
+    void finalizePartialSums(
+        NumericTable **partialResult,
+        NumericTable *resultWeights,
+        NumericTable *resultMeans,
+        NumericTable **resultCovariances,
+        NumericTable *resultNIterations,
+        NumericTable *resultGoalFunction,
+        const Parameter *par,
+        bool isOnline);
+};
+
+/**
+ * Kernel that computes the sufficient statistics of the Gaussian mixture model for the block of data.
+ * In the online processing mode the statistics of the block are combined with the statistics of the
+ * previous blocks by the stepwise EM update, in the first step of the distributed processing mode they
+ * are computed for the local data
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class EMOnlineKernel : public EMPartialSumsKernel<algorithmFPType, cpu>
+{
+public:
+    EMOnlineKernel() {};
+
+    void compute(
+        NumericTable *dataTable,
+        NumericTable *initialWeights,
+        NumericTable *initialMeans,
+        NumericTable **initialCovariances,
+        NumericTable **partialResult,
+        const Parameter *par,
+        bool isOnline);
+
+    void finalizeCompute(
+        NumericTable **partialResult,
+        NumericTable *resultWeights,
+        NumericTable *resultMeans,
+        NumericTable **resultCovariances,
+        NumericTable *resultNIterations,
+        NumericTable *resultGoalFunction,
+        const Parameter *par,
+        bool isOnline);
+};
+
+/**
+ * Kernel that merges the sufficient statistics computed on local nodes and runs the M-step
+ * in the second step of the distributed processing mode
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class EMDistributedStep2Kernel : public EMPartialSumsKernel<algorithmFPType, cpu>
+{
+public:
+    EMDistributedStep2Kernel() {};
+
+    void compute(
+        size_t nPartialResults,
+        NumericTable **localPartialResults,
+        NumericTable **partialResult,
+        const Parameter *par);
+
+    void finalizeCompute(
+        NumericTable **partialResult,
+        NumericTable *resultWeights,
+        NumericTable *resultMeans,
+        NumericTable **resultCovariances,
+        NumericTable *resultNIterations,
+        NumericTable *resultGoalFunction,
+        const Parameter *par);
+};
+
+} // namespace internal
+
+} // namespace em_gmm
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,73 @@
+/* file: em_gmm_dense_distr_fpt.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of EM Distributed constructors
+//--
+*/
+
+#include "em_gmm_distributed.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace em_gmm
+{
+namespace interface1
+{
+
+template<typename algorithmFPType, Method method>
+Distributed<step1Local, algorithmFPType, method>::Distributed(const size_t nComponents) :
+    parameter(nComponents, services::SharedPtr<covariance::Batch<algorithmFPType, covariance::defaultDense> >
+              (new covariance::Batch<algorithmFPType, covariance::defaultDense>()))
+{
+    initialize();
+}
+
+template<typename algorithmFPType, Method method>
+void Distributed<step1Local, algorithmFPType, method>::initialize()
+{
+    Analysis<distributed>::_ac = new __DAAL_ALGORITHM_CONTAINER(distributed, DistributedContainer, step1Local, algorithmFPType, method)(&_env);
+    _in  = &input;
+    _par = &parameter;
+}
+
+template<typename algorithmFPType, Method method>
+Distributed<step2Master, algorithmFPType, method>::Distributed(const size_t nComponents) :
+    parameter(nComponents, services::SharedPtr<covariance::Batch<algorithmFPType, covariance::defaultDense> >
+              (new covariance::Batch<algorithmFPType, covariance::defaultDense>()))
+{
+    initialize();
+}
+
+template<typename algorithmFPType, Method method>
+void Distributed<step2Master, algorithmFPType, method>::initialize()
+{
+    Analysis<distributed>::_ac = new __DAAL_ALGORITHM_CONTAINER(distributed, DistributedContainer, step2Master, algorithmFPType, method)(&_env);
+    _in  = &input;
+    _par = &parameter;
+}
+
+template class Distributed<step1Local, DAAL_FPTYPE, defaultDense>;
+template class Distributed<step2Master, DAAL_FPTYPE, defaultDense>;
+
+}
+} // namespace em_gmm
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,239 @@
+/* file: em_gmm_partial_result.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the EM for GMM algorithm interface in the online and distributed processing modes.
+//--
+*/
+
+#include "em_gmm_types.h"
+#include "daal_defines.h"
+#include "serialization_utils.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace em_gmm
+{
+namespace interface1
+{
+
+__DAAL_REGISTER_SERIALIZATION_CLASS(PartialResult, SERIALIZATION_EM_GMM_PARTIAL_RESULT_ID);
+
+/** Default constructor */
+PartialResult::PartialResult() : daal::algorithms::PartialResult(6)
+{
+    Argument::set(partialCrossProducts, DataCollectionPtr(new DataCollection()));
+}
+
+/**
+ * Sets the partial result of the EM for GMM algorithm
+ * \param[in] id    Identifier of the partial result
+ * \param[in] ptr   Pointer to the numeric table with the partial result
+ */
+void PartialResult::set(PartialResultId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Sets the collection of partial cross-products of the EM for GMM algorithm
+ * \param[in] id    Identifier of the collection of partial cross-products
+ * \param[in] ptr   Pointer to the collection of partial cross-products
+ */
+void PartialResult::set(PartialResultCovariancesId id, const DataCollectionPtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Returns the partial result of the EM for GMM algorithm
+ * \param[in] id   Identifier of the partial result
+ * \return         Partial result that corresponds to the given identifier
+ */
+NumericTablePtr PartialResult::get(PartialResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Returns the collection of partial cross-products of the EM for GMM algorithm
+ * \param[in] id   Identifier of the collection of partial cross-products
+ * \return         Collection of partial cross-products that corresponds to the given identifier
+ */
+DataCollectionPtr PartialResult::get(PartialResultCovariancesId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Returns the partial cross-product with a given index from the collection of partial cross-products
+ * \param[in] id    Identifier of the collection of partial cross-products
+ * \param[in] index Index of the partial cross-product to be returned
+ * \return          Pointer to the table with the partial cross-product
+ */
+NumericTablePtr PartialResult::get(PartialResultCovariancesId id, size_t index) const
+{
+    DataCollectionPtr cpCollection = this->get(id);
+    return staticPointerCast<NumericTable, SerializationIface>((*cpCollection)[index]);
+}
+
+/**
+ * Returns the number of features in the data processed by the algorithm
+ * \return Number of features in the data processed by the algorithm
+ */
+size_t PartialResult::getNumberOfFeatures() const
+{
+    return get(partialMeans)->getNumberOfColumns();
+}
+
+/**
+ * Checks the partial result of the EM for GMM algorithm
+ * \param[in] input   %Input of the algorithm
+ * \param[in] par     %Parameter of the algorithm
+ * \param[in] method  Computation method
+ */
+void PartialResult::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const
+{
+    size_t nFeatures = static_cast<const InputIface *>(input)->getNumberOfFeatures();
+    checkImpl(nFeatures, static_cast<const Parameter *>(par));
+}
+
+/**
+ * Checks the partial result of the EM for GMM algorithm
+ * \param[in] par     %Parameter of the algorithm
+ * \param[in] method  Computation method
+ */
+void PartialResult::check(const daal::algorithms::Parameter *par, int method) const
+{
+    NumericTablePtr meansTable = get(partialMeans);
+    DAAL_CHECK_EX(meansTable, ErrorNullNumericTable, ArgumentName, partialMeansStr());
+    checkImpl(meansTable->getNumberOfColumns(), static_cast<const Parameter *>(par));
+}
+
+void PartialResult::checkImpl(size_t nFeatures, const Parameter *algParameter) const
+{
+    size_t nComponents = algParameter->nComponents;
+
+    int unexpectedLayouts = (int)packed_mask;
+    if (!checkNumericTable(get(nObservations).get(), this->_errors.get(), nObservationsStr(), unexpectedLayouts, 0, 1, 1)) { return; }
+    if (!checkNumericTable(get(sumOfWeights).get(), this->_errors.get(), sumOfWeightsStr(), unexpectedLayouts, 0, nComponents, 1)) { return; }
+    if (!checkNumericTable(get(partialMeans).get(), this->_errors.get(), partialMeansStr(), unexpectedLayouts, 0, nFeatures, nComponents)) { return; }
+    if (!checkNumericTable(get(partialGoalFunction).get(), this->_errors.get(), partialGoalFunctionStr(), unexpectedLayouts, 0, 1, 1)) { return; }
+    if (!checkNumericTable(get(nProcessedBlocks).get(), this->_errors.get(), nProcessedBlocksStr(), unexpectedLayouts, 0, 1, 1)) { return; }
+
+    DataCollectionPtr cpCollection = get(partialCrossProducts);
+    DAAL_CHECK(cpCollection, ErrorNullPartialResultDataCollection);
+    DAAL_CHECK(cpCollection->size() == nComponents, ErrorIncorrectNumberOfElementsInResultCollection);
+
+    size_t nRowsInCP = (algParameter->covarianceStorage == full ? nFeatures : 1);
+    for(size_t i = 0; i < nComponents; i++)
+    {
+        NumericTablePtr nt = NumericTable::cast((*cpCollection)[i]);
+        DAAL_CHECK_EX(nt, ErrorIncorrectElementInCollection, ArgumentName, partialCrossProductsStr());
+        if (!checkNumericTable(nt.get(), this->_errors.get(), partialCrossProductsStr(), unexpectedLayouts, 0, nFeatures, nRowsInCP)) { return; }
+    }
+}
+
+/** Default constructor */
+DistributedStep2MasterInput::DistributedStep2MasterInput() : InputIface(1)
+{
+    Argument::set(partialResults, DataCollectionPtr(new DataCollection()));
+}
+
+/**
+ * Returns an input object for the EM for GMM algorithm in the second step of the distributed processing mode
+ * \param[in] id    Identifier of the input object
+ * \return          %Input object that corresponds to the given identifier
+ */
+DataCollectionPtr DistributedStep2MasterInput::get(MasterInputId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets an input object for the EM for GMM algorithm in the second step of the distributed processing mode
+ * \param[in] id    Identifier of the input object
+ * \param[in] ptr   Pointer to the object
+ */
+void DistributedStep2MasterInput::set(MasterInputId id, const DataCollectionPtr &ptr)
+{
+    Argument::set(id, staticPointerCast<SerializationIface, DataCollection>(ptr));
+}
+
+/**
+ * Adds partial results computed on local nodes to the input for the EM for GMM algorithm
+ * in the second step of the distributed processing mode
+ * \param[in] id    Identifier of the input object
+ * \param[in] value Pointer to the object
+ */
+void DistributedStep2MasterInput::add(MasterInputId id, const SharedPtr<PartialResult> &value)
+{
+    DataCollectionPtr collection = get(id);
+    collection->push_back(value);
+}
+
+/**
+ * Returns the number of features in the data processed on local nodes
+ * \return Number of features in the data processed on local nodes
+ */
+size_t DistributedStep2MasterInput::getNumberOfFeatures() const
+{
+    DataCollectionPtr collection = get(partialResults);
+    SharedPtr<PartialResult> pres = staticPointerCast<PartialResult, SerializationIface>((*collection)[0]);
+    return pres->getNumberOfFeatures();
+}
+
+/**
+ * Checks an input object for the EM for GMM algorithm in the second step of the distributed processing mode
+ * \param[in] par     %Parameter of the algorithm
+ * \param[in] method  Computation method
+ */
+void DistributedStep2MasterInput::check(const daal::algorithms::Parameter *par, int method) const
+{
+    DataCollectionPtr collection = get(partialResults);
+    DAAL_CHECK(collection, ErrorNullInputDataCollection);
+
+    size_t nBlocks = collection->size();
+    DAAL_CHECK(nBlocks > 0, ErrorIncorrectNumberOfInputNumericTables);
+
+    SharedPtr<PartialResult> firstPres = dynamicPointerCast<PartialResult, SerializationIface>((*collection)[0]);
+    DAAL_CHECK(firstPres, ErrorIncorrectElementInPartialResultCollection);
+    DAAL_CHECK_EX(firstPres->get(partialMeans), ErrorNullNumericTable, ArgumentName, partialMeansStr());
+
+    size_t nFeatures = firstPres->getNumberOfFeatures();
+    for(size_t i = 0; i < nBlocks; i++)
+    {
+        SharedPtr<PartialResult> pres = dynamicPointerCast<PartialResult, SerializationIface>((*collection)[i]);
+        DAAL_CHECK(pres, ErrorIncorrectElementInPartialResultCollection);
+
+        pres->setErrorCollection(this->_errors);
+        pres->check(par, method);
+        if (!this->_errors->isEmpty()) { return; }
+        DAAL_CHECK_EX(pres->getNumberOfFeatures() == nFeatures, ErrorIncorrectNumberOfColumns, ArgumentName, partialMeansStr());
+    }
+}
+
+} // namespace interface1
+} // namespace em_gmm
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,71 @@
+/* file: em_gmm_partial_result.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the EM for GMM partial result.
+//--
+*/
+
+#ifndef __EM_GMM_PARTIAL_RESULT_
+#define __EM_GMM_PARTIAL_RESULT_
+
+#include "em_gmm_types.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace em_gmm
+{
+
+/**
+ * Allocates memory for storing partial results of the EM for GMM algorithm
+ * \param[in] input     Pointer to the input structure
+ * \param[in] parameter Pointer to the parameter structure
+ * \param[in] method    Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT void PartialResult::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    const Parameter *algParameter = static_cast<const Parameter *>(parameter);
+
+    size_t nFeatures   = static_cast<const InputIface *>(input)->getNumberOfFeatures();
+    size_t nComponents = algParameter->nComponents;
+
+    set(nObservations, NumericTablePtr(new HomogenNumericTable<algorithmFPType>(1, 1, NumericTable::doAllocate, 0)));
+    set(sumOfWeights, NumericTablePtr(new HomogenNumericTable<algorithmFPType>(nComponents, 1, NumericTable::doAllocate, 0)));
+    set(partialMeans, NumericTablePtr(new HomogenNumericTable<algorithmFPType>(nFeatures, nComponents, NumericTable::doAllocate, 0)));
+    set(partialGoalFunction, NumericTablePtr(new HomogenNumericTable<algorithmFPType>(1, 1, NumericTable::doAllocate, 0)));
+    set(nProcessedBlocks, NumericTablePtr(new HomogenNumericTable<int>(1, 1, NumericTable::doAllocate, 0)));
+
+    size_t nRowsInCP = (algParameter->covarianceStorage == diagonal ? 1 : nFeatures);
+    DataCollectionPtr cpCollection = DataCollectionPtr(new DataCollection());
+    for(size_t i = 0; i < nComponents; i++)
+    {
+        cpCollection->push_back(NumericTablePtr(new HomogenNumericTable<algorithmFPType>(nFeatures, nRowsInCP, NumericTable::doAllocate, 0)));
+    }
+    set(partialCrossProducts, cpCollection);
+}
+
+} // namespace em_gmm
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -56,6 +56,17 @@ DAAL_EXPORT int daal::services::Environment::getCpuId(int enable)
     return static_cast<int>(_env.cpuid);
 }
 
+DAAL_EXPORT int daal::services::Environment::setCpuId(int cpuid)
+{
+    int detected = static_cast<int>(__daal_serv_cpu_detect(cpu_default));
+    if(cpuid == detected || (cpuid >= (int)daal::sse2 && cpuid <= (int)daal::avx2 && cpuid <= detected))
+    {
+        _env.cpuid = cpuid;
+        _env.cpuid_init_flag = true;
+    }
+    return getCpuId();
+}
+
 daal::services::Environment::LibraryThreadingType __daal_serv_get_thr_set()
 {
     return daal_thr_set;
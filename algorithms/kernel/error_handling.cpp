@@ -728,6 +728,7 @@ void ErrorMessageCollection::parseResourceFile()
     add(ErrorIncorrectCrossProductTableSize, "Number of columns or rows in cross-product numeric table is incorrect");
     add(ErrorCrossProductTableIsNotSquare, "Number of columns or rows in cross-product numeric table is not equal");
     add(ErrorInputCorrelationNotSupportedInOnlineAndDistributed, "Input correlation matrix is not supported in online and distributed computation modes");
+    add(ErrorFailedToComputeRandomizedDecomposition, "Failed to compute the randomized singular value decomposition");
 
     // QR errors: -8000..-8199
 
@@ -771,6 +772,9 @@ void ErrorMessageCollection::parseResourceFile()
     add(ErrorRleDataFormat, "Input compressed stream is in wrong format or corrupted");
     add(ErrorRleDataFormatLessThenHeader, "Size of input compressed stream is less then compressed block header size");
     add(ErrorRleDataFormatNotFullBlock, "Input compressed stream contains not a whole number of compressed blocks");
+    add(ErrorCompressionFramedDataFormat, "Input compressed stream is not a framed stream of a supported version or is corrupted");
+    add(ErrorCompressionFrameIndexOutOfRange, "Index of the frame is out of range");
+    add(ErrorCompressionFramedStreamIsFinalized, "Data cannot be added to the framed compression stream after the compressed data was read");
 
     // Min-max normalization errors: -9400..-9499
     add(ErrorLowerBoundGreaterThanOrEqualToUpperBound, "Lower bound parameter greater than or equal to upper bound");
@@ -811,6 +815,8 @@ void ErrorMessageCollection::parseResourceFile()
     add(ErrorSQLstmtHandle, "ErrorSQLstmtHandle");
     add(ErrorOnFileOpen, "Error on file open");
     add(ErrorOnFileRead, "Error on file read");
+    add(ErrorOnFileWrite, "Error on file write");
+    add(ErrorIncorrectFileFormat, "File format is incorrect");
 
     add(ErrorKDBNoConnection, "ErrorKDBNoConnection");
     add(ErrorKDBWrongCredentials, "ErrorKDBWrongCredentials");
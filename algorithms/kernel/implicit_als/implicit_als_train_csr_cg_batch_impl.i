@@ -0,0 +1,243 @@
+/* file: implicit_als_train_csr_cg_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of impicit ALS training algorithm with conjugate-gradient method
+//  for batch processing mode
+//--
+*/
+
+#ifndef __IMPLICIT_ALS_TRAIN_CSR_CG_BATCH_IMPL_I__
+#define __IMPLICIT_ALS_TRAIN_CSR_CG_BATCH_IMPL_I__
+
+#include "threading.h"
+#include "service_blas.h"
+
+using namespace daal::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace implicit_als
+{
+namespace training
+{
+namespace internal
+{
+/**
+ *  \brief Copies the upper triangle of the cross-product computed by SYRK into the lower one,
+ *         so the cross-product can be multiplied by a vector with GEMV
+ */
+template <typename algorithmFPType, CpuType cpu>
+void ImplicitALSTrainKernel<algorithmFPType, conjugateGradientCSR, cpu>::symmetrizeXtX(size_t nFactors, algorithmFPType *xtx)
+{
+    for (size_t i = 0; i < nFactors; i++)
+    {
+        for (size_t j = 0; j < i; j++)
+        {
+            xtx[j * nFactors + i] = xtx[i * nFactors + j];
+        }
+    }
+}
+
+/**
+ *  \brief Multiplies the matrix of the system of normal equations for the i-th row by the vector x:
+ *         y = (XtX + lambda * nnz * I) * x + sum over the non-zero entries of alpha * r * (f' * x) * f.
+ *         The matrix itself is not formed, only the non-zero entries of the row are accessed
+ */
+template <typename algorithmFPType, CpuType cpu>
+void ImplicitALSTrainKernel<algorithmFPType, conjugateGradientCSR, cpu>::multiplyBySystem(
+    size_t i, algorithmFPType *data, size_t *colIndices, size_t *rowOffsets,
+    size_t nFactors, algorithmFPType *colFactors, algorithmFPType alpha, algorithmFPType lambda,
+    algorithmFPType *xtx, algorithmFPType *x, algorithmFPType *y)
+{
+    size_t startIdx = rowOffsets[i]   - 1;
+    size_t endIdx   = rowOffsets[i + 1] - 1;
+
+    /* GEMV parameters */
+    char trans = 'N';
+    algorithmFPType one = 1.0;
+    algorithmFPType gamma = lambda * (endIdx - startIdx);
+    DAAL_INT iOne = 1;
+
+    for (size_t k = 0; k < nFactors; k++)
+    {
+        y[k] = gamma * x[k];
+    }
+    Blas<algorithmFPType, cpu>::xxgemv(&trans, (DAAL_INT *)&nFactors, (DAAL_INT *)&nFactors, &one, xtx, (DAAL_INT *)&nFactors,
+                                       x, &iOne, &one, y, &iOne);
+
+    for (size_t j = startIdx; j < endIdx; j++)
+    {
+        algorithmFPType c1 = alpha * data[j];
+        algorithmFPType *colFactorsRow = colFactors + (colIndices[j] - 1) * nFactors;
+
+        algorithmFPType dotProduct = 0.0;
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            dotProduct += colFactorsRow[k] * x[k];
+        }
+        dotProduct *= c1;
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            y[k] += dotProduct * colFactorsRow[k];
+        }
+    }
+}
+
+/**
+ *  \brief Updates the rows of factors with nCGIterations steps of the conjugate-gradient method
+ *         applied to the systems of normal equations. The current values of the factors are used
+ *         as the initial approximation
+ */
+template <typename algorithmFPType, CpuType cpu>
+void ImplicitALSTrainKernel<algorithmFPType, conjugateGradientCSR, cpu>::computeFactorsCG(
+    size_t nRows, algorithmFPType *data, size_t *colIndices, size_t *rowOffsets,
+    size_t nFactors, algorithmFPType *colFactors, algorithmFPType *rowFactors,
+    algorithmFPType alpha, algorithmFPType lambda, size_t nCGIterations,
+    algorithmFPType *xtx, daal::tls<algorithmFPType *> *cgBuffer)
+{
+    bool memoryError = false;
+    daal::threader_for(nRows, nRows, [ & ](size_t i)
+    {
+        algorithmFPType *buffer = cgBuffer->local();
+        if (!buffer) { memoryError = true; return; }
+
+        algorithmFPType *r  = buffer;
+        algorithmFPType *p  = buffer + nFactors;
+        algorithmFPType *ap = buffer + 2 * nFactors;
+        algorithmFPType *x  = rowFactors + i * nFactors;
+
+        /* Right-hand side of the system of normal equations */
+        service_memset<algorithmFPType, cpu>(r, 0.0, nFactors);
+        size_t startIdx = rowOffsets[i]   - 1;
+        size_t endIdx   = rowOffsets[i + 1] - 1;
+        for (size_t j = startIdx; j < endIdx; j++)
+        {
+            algorithmFPType c1 = alpha * data[j];
+            if (c1 > 0.0)
+            {
+                algorithmFPType c = c1 + 1.0;
+                algorithmFPType *colFactorsRow = colFactors + (colIndices[j] - 1) * nFactors;
+                for (size_t k = 0; k < nFactors; k++)
+                {
+                    r[k] += c * colFactorsRow[k];
+                }
+            }
+        }
+
+        /* Residual of the initial approximation */
+        multiplyBySystem(i, data, colIndices, rowOffsets, nFactors, colFactors, alpha, lambda, xtx, x, ap);
+        algorithmFPType rr = 0.0;
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            r[k] -= ap[k];
+            p[k]  = r[k];
+            rr   += r[k] * r[k];
+        }
+
+        for (size_t iter = 0; iter < nCGIterations && rr > 0.0; iter++)
+        {
+            multiplyBySystem(i, data, colIndices, rowOffsets, nFactors, colFactors, alpha, lambda, xtx, p, ap);
+
+            algorithmFPType pap = 0.0;
+            for (size_t k = 0; k < nFactors; k++)
+            {
+                pap += p[k] * ap[k];
+            }
+            if (!(pap > 0.0)) { break; }
+
+            algorithmFPType step = rr / pap;
+            algorithmFPType rrNew = 0.0;
+            for (size_t k = 0; k < nFactors; k++)
+            {
+                x[k] += step * p[k];
+                r[k] -= step * ap[k];
+                rrNew += r[k] * r[k];
+            }
+
+            algorithmFPType beta = rrNew / rr;
+            for (size_t k = 0; k < nFactors; k++)
+            {
+                p[k] = r[k] + beta * p[k];
+            }
+            rr = rrNew;
+        }
+    } );
+    if (memoryError) { this->_errors->add(services::ErrorMemoryAllocationFailed); }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void ImplicitALSTrainBatchKernel<algorithmFPType, conjugateGradientCSR, cpu>::compute(const NumericTable *dataTable,
+                                                                                      implicit_als::Model *initModel,
+                                                                                      implicit_als::Model *model,
+                                                                                      const Parameter *parameter)
+{
+    ImplicitALSTrainTask<algorithmFPType, conjugateGradientCSR, cpu> task(dataTable, initModel, model, parameter, this);
+    if (!this->_errors->isEmpty()) { return; }
+
+    size_t maxIterations   = parameter->maxIterations;
+    size_t nCGIterations   = parameter->nCGIterations;
+    algorithmFPType alpha  = (algorithmFPType)(parameter->alpha);
+    algorithmFPType lambda = (algorithmFPType)(parameter->lambda);
+
+    size_t nItems = task.nItems;
+    size_t nUsers = task.nUsers;
+    size_t nFactors = task.nFactors;
+    algorithmFPType *itemsFactors = task.itemsFactors;
+    algorithmFPType *usersFactors = task.usersFactors;
+    algorithmFPType *xtx = task.xtx;
+    daal::tls<algorithmFPType *> *cgBuffer = task.cgBuffer;
+
+    algorithmFPType *data = task.data;
+    algorithmFPType *tdata = task.tdata;
+    size_t *colIndices = task.colIndices;
+    size_t *rowOffsets = task.rowOffsets;
+    size_t *rowIndices = task.rowIndices;
+    size_t *colOffsets = task.colOffsets;
+
+    /* The initial model contains only the items factors, the users factors start from zero */
+    service_memset<algorithmFPType, cpu>(usersFactors, 0.0, nUsers * nFactors);
+
+    algorithmFPType beta = 0.0;
+    for (size_t i = 0; i < maxIterations; i++)
+    {
+        this->computeXtX(&nItems, &nFactors, &beta, itemsFactors, &nFactors, xtx, &nFactors);
+        this->symmetrizeXtX(nFactors, xtx);
+
+        this->computeFactorsCG(nUsers, data, colIndices, rowOffsets, nFactors, itemsFactors, usersFactors,
+                               alpha, lambda, nCGIterations, xtx, cgBuffer);
+        if (!this->_errors->isEmpty()) { return; }
+
+        this->computeXtX(&nUsers, &nFactors, &beta, usersFactors, &nFactors, xtx, &nFactors);
+        this->symmetrizeXtX(nFactors, xtx);
+
+        this->computeFactorsCG(nItems, tdata, rowIndices, colOffsets, nFactors, usersFactors, itemsFactors,
+                               alpha, lambda, nCGIterations, xtx, cgBuffer);
+        if (!this->_errors->isEmpty()) { return; }
+    }
+}
+
+}
+}
+}
+}
+}
+
+#endif
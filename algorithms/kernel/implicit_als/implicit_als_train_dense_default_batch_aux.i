@@ -165,15 +165,15 @@ void ImplicitALSTrainTask<algorithmFPType, fastCSR, cpu>::csr2csc(
     daal::services::daal_memcpy_s(cooColIndices, dataSize * sizeof(size_t), colIndices, dataSize * sizeof(size_t));
 
     /* Create array of row indices for COO data */
-    for (size_t i = 1; i <= nUsers; i++)
+    daal::threader_for(nUsers, nUsers, [ & ](size_t i)
     {
-        size_t rowStart = rowOffsets[i-1] - 1;
-        size_t rowEnd   = rowOffsets[i] - 1;
+        size_t rowStart = rowOffsets[i] - 1;
+        size_t rowEnd   = rowOffsets[i + 1] - 1;
         for (size_t k = rowStart; k < rowEnd; k++)
         {
-            rowIndices[k] = i;
+            rowIndices[k] = i + 1;
         }
-    }
+    } );
 
     /* Sort arrays that represent data in COO format (values, column indices and row indices) over the column indices,
        and re-order arrays of values and row indices accordingly */
@@ -243,12 +243,48 @@ template <typename algorithmFPType, CpuType cpu>
 void ImplicitALSTrainTask<algorithmFPType, defaultDense, cpu>::transpose(
             size_t nRows, size_t nCols, algorithmFPType *data, algorithmFPType *tdata)
 {
-    for (size_t i = 0; i < nRows; i++)
+    daal::threader_for(nCols, nCols, [ & ](size_t j)
     {
-        for (size_t j = 0; j < nCols; j++)
+        for (size_t i = 0; i < nRows; i++)
         {
             tdata[j * nRows + i] = data[i * nCols + j];
         }
+    } );
+}
+
+template <typename algorithmFPType, CpuType cpu>
+ImplicitALSTrainTask<algorithmFPType, conjugateGradientCSR, cpu>::ImplicitALSTrainTask(
+            const NumericTable *dataTable, implicit_als::Model *initModel,
+            implicit_als::Model *model, const Parameter *parameter,
+            ImplicitALSTrainKernelBase<algorithmFPType, cpu> *algorithm) :
+    ImplicitALSTrainTask<algorithmFPType, fastCSR, cpu>(dataTable, initModel, model, parameter, algorithm),
+    cgBuffer(NULL)
+{
+    if (!_algorithm->_errors->isEmpty()) { return; }
+
+    size_t nFactors = this->nFactors;
+    cgBuffer = new daal::tls<algorithmFPType *>([ = ]() -> algorithmFPType*
+    {
+        return (algorithmFPType *)daal::services::daal_malloc(3 * nFactors * sizeof(algorithmFPType));
+    });
+
+    if (!cgBuffer)
+    {  _algorithm->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+    if (!cgBuffer->local())
+    {  _algorithm->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+ImplicitALSTrainTask<algorithmFPType, conjugateGradientCSR, cpu>::~ImplicitALSTrainTask()
+{
+    if (cgBuffer)
+    {
+        cgBuffer->reduce([](algorithmFPType* cgData)
+        {
+            if(cgData) { daal::services::daal_free(cgData); }
+        } );
+        delete cgBuffer;
     }
 }
 
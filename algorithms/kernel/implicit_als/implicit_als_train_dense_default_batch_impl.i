@@ -112,20 +112,60 @@ void ImplicitALSTrainKernelBase<algorithmFPType, cpu>::computeFactors(
     } );
 }
 
+template <typename algorithmFPType, CpuType cpu>
+void ImplicitALSTrainKernelBase<algorithmFPType, cpu>::computeFactorsCost(
+    size_t nRows, size_t nFactors, algorithmFPType *factors, algorithmFPType lambda,
+    daal::tls<algorithmFPType *> &partialCost)
+{
+    daal::threader_for(nRows, nRows, [ & ](size_t i)
+    {
+        algorithmFPType *costFunction = partialCost.local();
+        if (!costFunction) { return; }
+
+        algorithmFPType *factorsI = factors + i * nFactors;
+        algorithmFPType sumFactors2 = 0.0;
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            sumFactors2 += factorsI[k] * factorsI[k];
+        }
+        *costFunction += lambda * sumFactors2;
+    } );
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void ImplicitALSTrainKernelBase<algorithmFPType, cpu>::reduceCost(
+    daal::tls<algorithmFPType *> &partialCost, algorithmFPType *costFunctionPtr)
+{
+    algorithmFPType costFunction = 0.0;
+    bool memoryError = false;
+    partialCost.reduce([ & ](algorithmFPType *localCost)
+    {
+        if (!localCost) { memoryError = true; return; }
+        costFunction += *localCost;
+        service_free<algorithmFPType, cpu>(localCost);
+    } );
+    if (memoryError) { this->_errors->add(services::ErrorMemoryAllocationFailed); }
+    *costFunctionPtr = costFunction;
+}
+
 template <typename algorithmFPType, CpuType cpu>
 void ImplicitALSTrainKernel<algorithmFPType, fastCSR, cpu>::computeCostFunction(
     size_t nUsers, size_t nItems, size_t nFactors, algorithmFPType *data, size_t *colIndices, size_t *rowOffsets,
     algorithmFPType *itemsFactors, algorithmFPType *usersFactors, algorithmFPType alpha, algorithmFPType lambda,
     algorithmFPType *costFunctionPtr)
 {
-    algorithmFPType zero = 0.0;
-    algorithmFPType one = 1.0;
-    algorithmFPType costFunction = zero;
-    algorithmFPType sumUsers2 = zero;
-    algorithmFPType sumItems2 = zero;
+    /* Partial sums of the cost function computed by each thread */
+    daal::tls<algorithmFPType *> partialCost([ = ]() -> algorithmFPType*
+    {
+        return service_calloc<algorithmFPType, cpu>(1);
+    });
 
-    for (size_t i = 0; i < nUsers; i++)
+    daal::threader_for(nUsers, nUsers, [ & ](size_t i)
     {
+        algorithmFPType *costFunction = partialCost.local();
+        if (!costFunction) { return; }
+
+        algorithmFPType one = 1.0;
         size_t startIdx = rowOffsets[i]   - 1;
         size_t endIdx   = rowOffsets[i + 1] - 1;
         algorithmFPType *usersI = usersFactors + i * nFactors;
@@ -139,21 +179,21 @@ void ImplicitALSTrainKernel<algorithmFPType, fastCSR, cpu>::computeCostFunction(
             {
                 dotProduct += usersI[k] * itemsJ[k];
             }
-            algorithmFPType sqrError = 1.0 - dotProduct;
+            algorithmFPType sqrError = one - dotProduct;
             sqrError *= sqrError;
-            costFunction += c * sqrError;
+            *costFunction += c * sqrError;
         }
-    }
-    for (size_t i = 0; i < nItems * nFactors; i++)
-    {
-        sumItems2 += itemsFactors[i] * itemsFactors[i];
-    }
-    for (size_t i = 0; i < nUsers * nFactors; i++)
-    {
-        sumUsers2 += usersFactors[i] * usersFactors[i];
-    }
-    costFunction += lambda * (sumItems2 + sumUsers2);
-    *costFunctionPtr = costFunction;
+
+        algorithmFPType sumUsers2 = 0.0;
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            sumUsers2 += usersI[k] * usersI[k];
+        }
+        *costFunction += lambda * sumUsers2;
+    } );
+
+    this->computeFactorsCost(nItems, nFactors, itemsFactors, lambda, partialCost);
+    this->reduceCost(partialCost, costFunctionPtr);
 }
 
 template <typename algorithmFPType, CpuType cpu>
@@ -162,14 +202,18 @@ void ImplicitALSTrainKernel<algorithmFPType, defaultDense, cpu>::computeCostFunc
     algorithmFPType *itemsFactors, algorithmFPType *usersFactors, algorithmFPType alpha, algorithmFPType lambda,
     algorithmFPType *costFunctionPtr)
 {
-    algorithmFPType zero = 0.0;
-    algorithmFPType one = 1.0;
-    algorithmFPType costFunction = zero;
-    algorithmFPType sumUsers2 = zero;
-    algorithmFPType sumItems2 = zero;
+    /* Partial sums of the cost function computed by each thread */
+    daal::tls<algorithmFPType *> partialCost([ = ]() -> algorithmFPType*
+    {
+        return service_calloc<algorithmFPType, cpu>(1);
+    });
 
-    for (size_t i = 0; i < nUsers; i++)
+    daal::threader_for(nUsers, nUsers, [ & ](size_t i)
     {
+        algorithmFPType *costFunction = partialCost.local();
+        if (!costFunction) { return; }
+
+        algorithmFPType one = 1.0;
         algorithmFPType *usersI = usersFactors + i * nFactors;
         for (size_t j = 0; j < nItems; j++)
         {
@@ -185,20 +229,20 @@ void ImplicitALSTrainKernel<algorithmFPType, defaultDense, cpu>::computeCostFunc
                 }
                 algorithmFPType sqrError = one - dotProduct;
                 sqrError *= sqrError;
-                costFunction += c * sqrError;
+                *costFunction += c * sqrError;
             }
         }
-    }
-    for (size_t i = 0; i < nItems * nFactors; i++)
-    {
-        sumItems2 += itemsFactors[i] * itemsFactors[i];
-    }
-    for (size_t i = 0; i < nUsers * nFactors; i++)
-    {
-        sumUsers2 += usersFactors[i] * usersFactors[i];
-    }
-    costFunction += lambda * (sumItems2 + sumUsers2);
-    *costFunctionPtr = costFunction;
+
+        algorithmFPType sumUsers2 = 0.0;
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            sumUsers2 += usersI[k] * usersI[k];
+        }
+        *costFunction += lambda * sumUsers2;
+    } );
+
+    this->computeFactorsCost(nItems, nFactors, itemsFactors, lambda, partialCost);
+    this->reduceCost(partialCost, costFunctionPtr);
 }
 
 template <typename algorithmFPType, CpuType cpu>
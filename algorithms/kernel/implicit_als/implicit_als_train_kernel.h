@@ -69,6 +69,7 @@ protected:
     friend struct ImplicitALSTrainTaskBase<algorithmFPType, cpu>;
     friend struct ImplicitALSTrainTask<algorithmFPType, fastCSR, cpu>;
     friend struct ImplicitALSTrainTask<algorithmFPType, defaultDense, cpu>;
+    friend struct ImplicitALSTrainTask<algorithmFPType, conjugateGradientCSR, cpu>;
     friend struct ImplicitALSTrainDistrStep3Task<algorithmFPType, cpu>;
 
     void updateSystem(size_t *nCols, algorithmFPType *x, algorithmFPType *coeff, algorithmFPType *p,
@@ -88,6 +89,13 @@ protected:
     virtual void computeCostFunction(size_t nItems, size_t nUsers, size_t nFactors, algorithmFPType *data,
                 size_t *colIndices, size_t *rowOffsets, algorithmFPType *itemsFactors, algorithmFPType *usersFactors,
                 algorithmFPType alpha, algorithmFPType lambda, algorithmFPType *costFunctionPtr) = 0;
+
+    /* Adds the regularization terms of the rows of factors to the partial sums of the cost function */
+    void computeFactorsCost(size_t nRows, size_t nFactors, algorithmFPType *factors, algorithmFPType lambda,
+                daal::tls<algorithmFPType *> &partialCost);
+
+    /* Sums the partial values of the cost function computed by the threads and releases them */
+    void reduceCost(daal::tls<algorithmFPType *> &partialCost, algorithmFPType *costFunctionPtr);
 };
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -120,6 +128,23 @@ protected:
                 algorithmFPType alpha, algorithmFPType lambda, algorithmFPType *costFunctionPtr);
 };
 
+template <typename algorithmFPType, CpuType cpu>
+class ImplicitALSTrainKernel<algorithmFPType, conjugateGradientCSR, cpu> : public ImplicitALSTrainKernel<algorithmFPType, fastCSR, cpu>
+{
+protected:
+    void symmetrizeXtX(size_t nFactors, algorithmFPType *xtx);
+
+    void computeFactorsCG(
+                size_t nRows, algorithmFPType *data, size_t *colIndices, size_t *rowOffsets,
+                size_t nFactors, algorithmFPType *colFactors, algorithmFPType *rowFactors,
+                algorithmFPType alpha, algorithmFPType lambda, size_t nCGIterations,
+                algorithmFPType *xtx, daal::tls<algorithmFPType *> *cgBuffer);
+
+    void multiplyBySystem(size_t i, algorithmFPType *data, size_t *colIndices, size_t *rowOffsets,
+                size_t nFactors, algorithmFPType *colFactors, algorithmFPType alpha, algorithmFPType lambda,
+                algorithmFPType *xtx, algorithmFPType *x, algorithmFPType *y);
+};
+
 template <typename algorithmFPType, Method method, CpuType cpu>
 class ImplicitALSTrainBatchKernel : public ImplicitALSTrainKernel<algorithmFPType, method, cpu>
 {};
@@ -144,6 +169,17 @@ public:
     friend struct ImplicitALSTrainTask<algorithmFPType, fastCSR, cpu>;
 };
 
+template <typename algorithmFPType, CpuType cpu>
+class ImplicitALSTrainBatchKernel<algorithmFPType, conjugateGradientCSR, cpu> :
+    public ImplicitALSTrainKernel<algorithmFPType, conjugateGradientCSR, cpu>
+{
+public:
+    void compute(const NumericTable *data, implicit_als::Model *initModel, implicit_als::Model *model,
+                const Parameter *parameter);
+
+    friend struct ImplicitALSTrainTask<algorithmFPType, conjugateGradientCSR, cpu>;
+};
+
 
 template <typename algorithmFPType, CpuType cpu>
 struct ImplicitALSTrainTaskBase
@@ -268,6 +304,22 @@ protected:
     using ImplicitALSTrainTaskBase<algorithmFPType, cpu>::_algorithm;
 };
 
+template <typename algorithmFPType, CpuType cpu>
+struct ImplicitALSTrainTask<algorithmFPType, conjugateGradientCSR, cpu> : ImplicitALSTrainTask<algorithmFPType, fastCSR, cpu>
+{
+    ImplicitALSTrainTask(const NumericTable *dataTable, implicit_als::Model *initModel, implicit_als::Model *model, const Parameter *parameter,
+                ImplicitALSTrainKernelBase<algorithmFPType, cpu> *algorithm);
+
+    virtual ~ImplicitALSTrainTask();
+
+    /* Residual, search direction and product of the system matrix by the search direction
+       of the conjugate-gradient method, 3 * nFactors values per thread */
+    daal::tls<algorithmFPType *> *cgBuffer;
+
+protected:
+    using ImplicitALSTrainTaskBase<algorithmFPType, cpu>::_algorithm;
+};
+
 template <typename algorithmFPType, CpuType cpu>
 struct ImplicitALSTrainDistrStep3Task
 {
@@ -25,6 +25,8 @@
 #define __KDTREE_KNN_CLASSIFICATION_MODEL_IMPL_
 
 #include "algorithms/k_nearest_neighbors/kdtree_knn_classification_model.h"
+#include "services/daal_memory.h"
+#include "threading.h"
 
 namespace daal
 {
@@ -56,13 +58,119 @@ public:
     }
 };
 
+/**
+ * Inner node or leaf of the KD-tree in the compact layout.
+ * The children of an inner node are stored one after another, so only the index of the left child is kept.
+ */
+template <typename algorithmFpType>
+struct KDTreeCompactNode
+{
+    unsigned int dimension;     /* Splitting dimension of the inner node, or __KDTREE_COMPACT_LEAF for the leaf */
+    unsigned int index;         /* Index of the left child of the inner node, or index of the range of points of the leaf */
+    algorithmFpType cutPoint;   /* Cut point of the inner node */
+};
+
+/**
+ * Range of points of the training data set that belong to the leaf of the KD-tree
+ */
+struct KDTreeCompactLeaf
+{
+    unsigned int start;
+    unsigned int end;
+};
+
+/**
+ * KD-tree in the compact layout that is used for batched search of nearest neighbors:
+ * 32-bit indices, cut points in the floating-point type of the model, the ranges of points of the leaves
+ * stored contiguously and separately from the inner nodes, and the training points stored by columns.
+ * The layout is derived from the KD-tree table and the training data and is not serialized.
+ */
+class KDTreeCompactLayout
+{
+public:
+    KDTreeCompactLayout() : _nodes(nullptr), _leaves(nullptr), _points(nullptr), _nodeCount(0), _leafCount(0), _pointCount(0), _columnCount(0),
+        _fpTypeSize(0) {}
+
+    ~KDTreeCompactLayout()
+    {
+        services::daal_free(_nodes);
+        services::daal_free(_leaves);
+        services::daal_free(_points);
+    }
+
+    /**
+     * Allocates memory for nodes and leaves of the KD-tree and for the training points
+     * \param[in] maxNodeCount  Maximal number of nodes
+     * \param[in] maxLeafCount  Maximal number of leaves
+     * \param[in] pointCount    Number of training points
+     * \param[in] columnCount   Number of features of the training points
+     * \return true if memory is allocated successfully
+     */
+    template <typename algorithmFpType>
+    bool allocate(size_t maxNodeCount, size_t maxLeafCount, size_t pointCount, size_t columnCount)
+    {
+        _nodes = services::daal_malloc(maxNodeCount * sizeof(KDTreeCompactNode<algorithmFpType>));
+        _leaves = static_cast<KDTreeCompactLeaf *>(services::daal_malloc(maxLeafCount * sizeof(KDTreeCompactLeaf)));
+        _points = services::daal_malloc(pointCount * columnCount * sizeof(algorithmFpType));
+        _pointCount = pointCount;
+        _columnCount = columnCount;
+        _fpTypeSize = sizeof(algorithmFpType);
+        return (_nodes && _leaves && _points);
+    }
+
+    /**
+     * Returns the nodes of the KD-tree
+     * \return Nodes of the KD-tree, or null pointer if the layout is built for another floating-point type
+     */
+    template <typename algorithmFpType>
+    KDTreeCompactNode<algorithmFpType> * getNodes() const
+    {
+        return (_fpTypeSize == sizeof(algorithmFpType)) ? static_cast<KDTreeCompactNode<algorithmFpType> *>(_nodes) : nullptr;
+    }
+
+    KDTreeCompactLeaf * getLeaves() const { return _leaves; }
+
+    /**
+     * Returns the values of the feature for all training points, in the order of the points in the training data set
+     * \param[in] column  Index of the feature
+     * \return Values of the feature, or null pointer if the layout is built for another floating-point type
+     */
+    template <typename algorithmFpType>
+    algorithmFpType * getColumn(size_t column) const
+    {
+        return (_fpTypeSize == sizeof(algorithmFpType)) ? static_cast<algorithmFpType *>(_points) + column * _pointCount : nullptr;
+    }
+
+    size_t getPointCount() const { return _pointCount; }
+
+    size_t getColumnCount() const { return _columnCount; }
+
+    size_t getNodeCount() const { return _nodeCount; }
+
+    size_t getLeafCount() const { return _leafCount; }
+
+    void setNodeCount(size_t value) { _nodeCount = value; }
+
+    void setLeafCount(size_t value) { _leafCount = value; }
+
+private:
+    void * _nodes;
+    KDTreeCompactLeaf * _leaves;
+    void * _points;
+    size_t _nodeCount;
+    size_t _leafCount;
+    size_t _pointCount;
+    size_t _columnCount;
+    size_t _fpTypeSize;
+};
+
 class Model::ModelImpl
 {
 public:
     /**
      * Empty constructor for deserialization
      */
-    ModelImpl() : _kdTreeTable(), _rootNodeIndex(0), _lastNodeIndex(0), _data(), _labels() {}
+    ModelImpl() : _kdTreeTable(), _compactKDTree(), _rootNodeIndex(0), _lastNodeIndex(0), _data(), _labels() {}
 
     /**
      * Returns the KD-tree table
@@ -82,6 +190,35 @@ public:
     */
     void setKDTreeTable(const services::SharedPtr<KDTreeTable> & value) { _kdTreeTable = value; }
 
+    /**
+     * Returns the KD-tree in the compact layout
+     * \return KD-tree in the compact layout, empty pointer if it was not built for the model
+     */
+    services::SharedPtr<const KDTreeCompactLayout> getCompactKDTree() const { return _compactKDTree; }
+
+    /**
+    *  Sets the KD-tree in the compact layout
+    *  \param[in]  value  KD-tree in the compact layout
+    */
+    void setCompactKDTree(const services::SharedPtr<const KDTreeCompactLayout> & value) { _compactKDTree = value; }
+
+    /**
+     * Returns the KD-tree in the compact layout, builds it on first use for the model that was deserialized
+     * or trained for another floating-point type. Concurrent predictions with the same model build the layout once
+     * \param[in]  build  Functor that builds the layout from the model
+     * \return KD-tree in the compact layout, empty pointer if it cannot be built
+     */
+    template <typename algorithmFpType, typename Build>
+    services::SharedPtr<const KDTreeCompactLayout> getCompactKDTree(const Build & build) const
+    {
+        daal::mutex::scoped_lock lock(_compactKDTreeMutex);
+        if (!_compactKDTree || !_compactKDTree->getNodes<algorithmFpType>())
+        {
+            _compactKDTree = build(*this);
+        }
+        return _compactKDTree;
+    }
+
     /**
      * Returns the index of KD-tree root node
      * \return Index of KD-tree root node
@@ -126,6 +263,7 @@ public:
         arch->setSharedPtrObj(_kdTreeTable);
         arch->setSharedPtrObj(_data);
         arch->setSharedPtrObj(_labels);
+        if (onDeserialize) { _compactKDTree.reset(); }
     }
 
     /**
@@ -208,6 +346,8 @@ public:
 
 private:
     services::SharedPtr<KDTreeTable> _kdTreeTable;
+    mutable services::SharedPtr<const KDTreeCompactLayout> _compactKDTree;
+    mutable daal::mutex _compactKDTreeMutex;
     size_t _rootNodeIndex;
     size_t _lastNodeIndex;
     data_management::NumericTablePtr _data;
@@ -218,6 +358,9 @@ private:
 
 using interface1::KDTreeTable;
 using interface1::KDTreeNode;
+using interface1::KDTreeCompactNode;
+using interface1::KDTreeCompactLeaf;
+using interface1::KDTreeCompactLayout;
 
 } // namespace kdtree_knn_classification
 } // namespace algorithms
@@ -86,6 +86,8 @@ void Input::check(const daal::algorithms::Parameter *parameter, int method) cons
     errors.setCanThrow(false);
     DAAL_CHECK(checkNumericTable(m->impl()->getData().get(), &errors, dataStr()), ErrorModelNotFullInitialized);
     DAAL_CHECK(checkNumericTable(m->impl()->getLabels().get(), &errors, labelsStr()), ErrorModelNotFullInitialized);
+    if (method == bruteForce) { return; }
+
     DAAL_CHECK(checkNumericTable(m->impl()->getKDTreeTable().get(), &errors, kdTreeTableStr(), 0, NumericTableIface::aos, 4),
                ErrorModelNotFullInitialized);
     const auto kdTreeNumberOfRows = m->impl()->getKDTreeTable()->getNumberOfRows();
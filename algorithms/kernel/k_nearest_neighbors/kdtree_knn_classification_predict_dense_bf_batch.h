@@ -0,0 +1,67 @@
+/* file: kdtree_knn_classification_predict_dense_bf_batch.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template function that computes K-Nearest Neighbors prediction results for the brute-force method.
+//--
+*/
+
+#ifndef __KDTREE_KNN_CLASSIFICATION_PREDICT_DENSE_BF_BATCH_H__
+#define __KDTREE_KNN_CLASSIFICATION_PREDICT_DENSE_BF_BATCH_H__
+
+#include "kdtree_knn_classification_predict_dense_default_batch.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace prediction
+{
+namespace internal
+{
+
+template <typename algorithmFpType, CpuType cpu> struct BruteForceLocal;
+
+template <typename algorithmFpType, CpuType cpu>
+class KNNClassificationPredictKernel<algorithmFpType, bruteForce, cpu> : public daal::algorithms::Kernel
+{
+public:
+    static const size_t queryBlockSize = 128;   /* Number of queries processed by a thread at once */
+    static const size_t dataBlockSize  = 256;   /* Number of observations of the training data set in the tile of distances */
+
+    void compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, const daal::algorithms::Parameter * par);
+
+protected:
+    void computeSquaredNorms(const NumericTable & data, algorithmFpType * norms);
+
+    void computeDistances(const algorithmFpType * queries, size_t queryCount, const NumericTable & data, size_t firstPoint, size_t pointCount,
+                          const algorithmFpType * norms, algorithmFpType * distances);
+
+    void updateNearestNeighbors(size_t queryCount, size_t firstPoint, size_t pointCount, const algorithmFpType * distances, size_t k,
+                                BruteForceLocal<algorithmFpType, cpu> & local);
+};
+
+} // namespace internal
+} // namespace prediction
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,281 @@
+/* file: kdtree_knn_classification_predict_dense_bf_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of K-Nearest Neighbors prediction for the brute-force method.
+//  Squared Euclidean distances ||x||^2 - 2 x.y + ||y||^2 are computed by tiles of
+//  queries and observations of the training data set using matrix-matrix multiplication.
+//  The term ||x||^2 is the same for all the distances of the query and is omitted.
+//--
+*/
+
+#ifndef __KDTREE_KNN_CLASSIFICATION_PREDICT_DENSE_BF_BATCH_IMPL_I__
+#define __KDTREE_KNN_CLASSIFICATION_PREDICT_DENSE_BF_BATCH_IMPL_I__
+
+#include "threading.h"
+#include "daal_defines.h"
+#include "service_memory.h"
+#include "service_defines.h"
+#include "service_data_utils.h"
+#include "service_numeric_table.h"
+#include "service_blas.h"
+#include "numeric_table.h"
+#include "kdtree_knn_classification_predict_dense_bf_batch.h"
+#include "kdtree_knn_classification_model_impl.h"
+#include "kdtree_knn_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace prediction
+{
+namespace internal
+{
+
+using namespace daal::services::internal;
+using namespace daal::services;
+using namespace daal::internal;
+using namespace kdtree_knn_classification::internal;
+
+template <typename algorithmFpType, CpuType cpu>
+struct BruteForceLocal
+{
+    algorithmFpType * tile;         /* Tile of distances from the block of queries to the block of the training data set */
+    algorithmFpType * distances;    /* Distances to k nearest neighbors of each query, sorted in ascending order */
+    size_t * indexes;               /* Indices of k nearest neighbors of each query */
+    size_t * counts;                /* Number of nearest neighbors found for each query */
+    algorithmFpType * classes;      /* Labels of nearest neighbors of the query */
+};
+
+template<typename algorithmFpType, CpuType cpu>
+void KNNClassificationPredictKernel<algorithmFpType, bruteForce, cpu>::
+    compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, const daal::algorithms::Parameter * par)
+{
+    typedef BruteForceLocal<algorithmFpType, cpu> Local;
+
+    const kdtree_knn_classification::Parameter * const parameter = static_cast<const kdtree_knn_classification::Parameter *>(par);
+    const Model * const model = static_cast<const Model *>(m);
+    const size_t k = parameter->k;
+    const NumericTable & data = *(model->impl()->getData());
+    const NumericTable & labels = *(model->impl()->getLabels());
+
+    const size_t dataRowCount = data.getNumberOfRows();
+    const size_t xRowCount = x->getNumberOfRows();
+    const size_t yColumnCount = y->getNumberOfColumns();
+    if (dataRowCount == 0 || xRowCount == 0) { return; }
+
+    TArray<algorithmFpType, cpu> normsArray(dataRowCount);
+    algorithmFpType * const norms = normsArray.get();
+    if (!norms) { _errors->add(services::ErrorMemoryAllocationFailed); return; }
+    computeSquaredNorms(data, norms);
+
+    data_management::BlockDescriptor<algorithmFpType> labelsBD;
+    const_cast<NumericTable &>(labels).getBlockOfColumnValues(0, 0, dataRowCount, readOnly, labelsBD);
+    const algorithmFpType * const labelsPtr = labelsBD.getBlockPtr();
+
+    daal::tls<Local *> localTLS([=]()-> Local *
+    {
+        Local * const ptr = service_scalable_calloc<Local, cpu>(1);
+        if (!ptr) { _errors->add(services::ErrorMemoryAllocationFailed); return nullptr; }
+
+        ptr->tile = service_scalable_malloc<algorithmFpType, cpu>(queryBlockSize * dataBlockSize);
+        ptr->distances = service_scalable_malloc<algorithmFpType, cpu>(queryBlockSize * k);
+        ptr->indexes = service_scalable_malloc<size_t, cpu>(queryBlockSize * k);
+        ptr->counts = service_scalable_malloc<size_t, cpu>(queryBlockSize);
+        ptr->classes = service_scalable_malloc<algorithmFpType, cpu>(k);
+        if (!ptr->tile || !ptr->distances || !ptr->indexes || !ptr->counts || !ptr->classes)
+        {
+            _errors->add(services::ErrorMemoryAllocationFailed);
+        }
+        return ptr;
+    } );
+
+    const size_t blockCount = (xRowCount + queryBlockSize - 1) / queryBlockSize;
+    daal::threader_for(blockCount, blockCount, [=, &localTLS, &data](int iBlock)
+    {
+        Local * const local = localTLS.local();
+        if (!local || !local->tile || !local->distances || !local->indexes || !local->counts || !local->classes) { return; }
+
+        const size_t first = iBlock * queryBlockSize;
+        const size_t queryCount = min<cpu>(static_cast<size_t>(queryBlockSize), xRowCount - first);
+
+        data_management::BlockDescriptor<algorithmFpType> xBD;
+        const_cast<NumericTable &>(*x).getBlockOfRows(first, queryCount, readOnly, xBD);
+        const algorithmFpType * const dx = xBD.getBlockPtr();
+        data_management::BlockDescriptor<algorithmFpType> yBD;
+        y->getBlockOfRows(first, queryCount, writeOnly, yBD);
+        algorithmFpType * const dy = yBD.getBlockPtr();
+
+        for (size_t q = 0; q < queryCount; ++q)
+        {
+            local->counts[q] = 0;
+        }
+
+        for (size_t firstPoint = 0; firstPoint < dataRowCount; firstPoint += dataBlockSize)
+        {
+            const size_t pointCount = min<cpu>(static_cast<size_t>(dataBlockSize), dataRowCount - firstPoint);
+            computeDistances(dx, queryCount, data, firstPoint, pointCount, norms, local->tile);
+            updateNearestNeighbors(queryCount, firstPoint, pointCount, local->tile, k, *local);
+        }
+
+        for (size_t q = 0; q < queryCount; ++q)
+        {
+            const size_t count = local->counts[q];
+            const size_t * const indexes = local->indexes + q * k;
+            for (size_t i = 0; i < count; ++i)
+            {
+                local->classes[i] = labelsPtr[indexes[i]];
+            }
+            dy[q * yColumnCount] = computeMajorityClass<algorithmFpType, cpu>(count, local->classes);
+        }
+
+        y->releaseBlockOfRows(yBD);
+        const_cast<NumericTable &>(*x).releaseBlockOfRows(xBD);
+    } );
+
+    localTLS.reduce([=](Local * ptr) -> void
+    {
+        if (ptr)
+        {
+            service_scalable_free<algorithmFpType, cpu>(ptr->tile);
+            service_scalable_free<algorithmFpType, cpu>(ptr->distances);
+            service_scalable_free<size_t, cpu>(ptr->indexes);
+            service_scalable_free<size_t, cpu>(ptr->counts);
+            service_scalable_free<algorithmFpType, cpu>(ptr->classes);
+            service_scalable_free<Local, cpu>(ptr);
+        }
+    } );
+
+    const_cast<NumericTable &>(labels).releaseBlockOfColumnValues(labelsBD);
+}
+
+/**
+ * Computes squared Euclidean norms of the observations of the training data set
+ */
+template<typename algorithmFpType, CpuType cpu>
+void KNNClassificationPredictKernel<algorithmFpType, bruteForce, cpu>::
+    computeSquaredNorms(const NumericTable & data, algorithmFpType * norms)
+{
+    const size_t rowCount = data.getNumberOfRows();
+    const size_t columnCount = data.getNumberOfColumns();
+    const size_t blockCount = (rowCount + dataBlockSize - 1) / dataBlockSize;
+    daal::threader_for(blockCount, blockCount, [=, &data](int iBlock)
+    {
+        const size_t first = iBlock * dataBlockSize;
+        const size_t count = min<cpu>(static_cast<size_t>(dataBlockSize), rowCount - first);
+
+        data_management::BlockDescriptor<algorithmFpType> dataBD;
+        const_cast<NumericTable &>(data).getBlockOfRows(first, count, readOnly, dataBD);
+        const algorithmFpType * const dd = dataBD.getBlockPtr();
+        for (size_t i = 0; i < count; ++i)
+        {
+            const algorithmFpType * const row = dd + i * columnCount;
+            algorithmFpType sum = 0;
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < columnCount; ++j)
+            {
+                sum += row[j] * row[j];
+            }
+            norms[first + i] = sum;
+        }
+        const_cast<NumericTable &>(data).releaseBlockOfRows(dataBD);
+    } );
+}
+
+/**
+ * Computes the tile of distances ||y||^2 - 2 x.y from the block of queries x
+ * to the block of observations y of the training data set
+ */
+template<typename algorithmFpType, CpuType cpu>
+void KNNClassificationPredictKernel<algorithmFpType, bruteForce, cpu>::
+    computeDistances(const algorithmFpType * queries, size_t queryCount, const NumericTable & data, size_t firstPoint, size_t pointCount,
+                     const algorithmFpType * norms, algorithmFpType * distances)
+{
+    const size_t columnCount = data.getNumberOfColumns();
+
+    data_management::BlockDescriptor<algorithmFpType> dataBD;
+    const_cast<NumericTable &>(data).getBlockOfRows(firstPoint, pointCount, readOnly, dataBD);
+    algorithmFpType * const dd = const_cast<algorithmFpType *>(dataBD.getBlockPtr());
+
+    /* distances[q * pointCount + i] = -2 * x[q].y[i] */
+    char transa = 'T', transb = 'N';
+    algorithmFpType alpha = -2.0, beta = 0.0;
+    DAAL_INT mm = pointCount, nn = queryCount, kk = columnCount;
+    DAAL_INT lda = columnCount, ldb = columnCount, ldc = pointCount;
+    Blas<algorithmFpType, cpu>::xxgemm(&transa, &transb, &mm, &nn, &kk, &alpha, dd, &lda, const_cast<algorithmFpType *>(queries), &ldb,
+                                       &beta, distances, &ldc);
+
+    const_cast<NumericTable &>(data).releaseBlockOfRows(dataBD);
+
+    const algorithmFpType * const blockNorms = norms + firstPoint;
+    for (size_t q = 0; q < queryCount; ++q)
+    {
+        algorithmFpType * const row = distances + q * pointCount;
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < pointCount; ++i)
+        {
+            row[i] += blockNorms[i];
+        }
+    }
+}
+
+/**
+ * Merges the tile of distances into the sorted lists of k nearest neighbors of the queries
+ */
+template<typename algorithmFpType, CpuType cpu>
+void KNNClassificationPredictKernel<algorithmFpType, bruteForce, cpu>::
+    updateNearestNeighbors(size_t queryCount, size_t firstPoint, size_t pointCount, const algorithmFpType * distances, size_t k,
+                           BruteForceLocal<algorithmFpType, cpu> & local)
+{
+    for (size_t q = 0; q < queryCount; ++q)
+    {
+        const algorithmFpType * const row = distances + q * pointCount;
+        algorithmFpType * const nearestDistances = local.distances + q * k;
+        size_t * const nearestIndexes = local.indexes + q * k;
+        size_t count = local.counts[q];
+
+        for (size_t i = 0; i < pointCount; ++i)
+        {
+            const algorithmFpType distance = row[i];
+            if (count == k && !(distance < nearestDistances[k - 1])) { continue; }
+
+            size_t pos = (count < k) ? count++ : k - 1;
+            for (; pos > 0 && distance < nearestDistances[pos - 1]; --pos)
+            {
+                nearestDistances[pos] = nearestDistances[pos - 1];
+                nearestIndexes[pos] = nearestIndexes[pos - 1];
+            }
+            nearestDistances[pos] = distance;
+            nearestIndexes[pos] = firstPoint + i;
+        }
+        local.counts[q] = count;
+    }
+}
+
+} // namespace internal
+} // namespace prediction
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
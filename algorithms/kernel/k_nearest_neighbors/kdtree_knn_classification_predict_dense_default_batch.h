@@ -53,6 +53,8 @@ using namespace daal::data_management;
 template <typename algorithmFpType, CpuType cpu> struct GlobalNeighbors;
 template <typename T, CpuType cpu> class Heap;
 template <typename algorithmFpType> struct SearchNode;
+template <typename algorithmFpType> struct PacketSearchNode;
+template <typename algorithmFpType, CpuType cpu> struct PacketSearchLocal;
 
 template <typename algorithmFpType, prediction::Method method, CpuType cpu>
 class KNNClassificationPredictKernel : public daal::algorithms::Kernel
@@ -71,6 +73,16 @@ protected:
 
     void predict(algorithmFpType & predictedClass, const Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap, const NumericTable & labels,
                  size_t k);
+
+    void computeBatched(const NumericTable * x, const KDTreeCompactLayout & kdTree, const NumericTable & labels, NumericTable * y, size_t k);
+
+    size_t findLeaf(const algorithmFpType * query, const KDTreeCompactNode<algorithmFpType> * nodes);
+
+    void findNearestNeighborsForPacket(const algorithmFpType * const * queries, size_t queryCount, PacketSearchLocal<algorithmFpType, cpu> & local,
+                                       size_t k, const KDTreeCompactLayout & kdTree);
+
+    void predict(algorithmFpType & predictedClass, const Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap, const algorithmFpType * labels,
+                 algorithmFpType * classes);
 };
 
 } // namespace internal
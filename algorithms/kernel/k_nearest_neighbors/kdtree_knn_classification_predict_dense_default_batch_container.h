@@ -24,6 +24,7 @@
 
 #include "kdtree_knn_classification_predict.h"
 #include "kdtree_knn_classification_predict_dense_default_batch.h"
+#include "kdtree_knn_classification_predict_dense_bf_batch.h"
 
 namespace daal
 {
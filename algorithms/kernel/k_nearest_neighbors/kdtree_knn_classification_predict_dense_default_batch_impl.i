@@ -33,6 +33,8 @@
 #include "service_math.h"
 #include "service_rng.h"
 #include "service_sort.h"
+#include "service_defines.h"
+#include "service_numeric_table.h"
 #include "numeric_table.h"
 #include "kdtree_knn_classification_predict_dense_default_batch.h"
 #include "kdtree_knn_classification_model_impl.h"
@@ -295,6 +297,38 @@ struct SearchNode
     algorithmFpType minDistance;
 };
 
+template <typename algorithmFpType>
+struct PacketSearchNode
+{
+    size_t nodeIndex;
+    algorithmFpType minDistance[__KDTREE_QUERY_PACKET_SIZE];
+};
+
+template <typename algorithmFpType, CpuType cpu>
+struct PacketSearchLocal
+{
+    Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> heaps[__KDTREE_QUERY_PACKET_SIZE];
+    kdtree_knn_classification::internal::Stack<PacketSearchNode<algorithmFpType>, cpu> stack;
+    algorithmFpType * distances;    /* Tile of distances from the queries of the packet to the points of the leaf */
+    algorithmFpType * classes;      /* Labels of nearest neighbors of the query */
+    size_t * leafIndexes;           /* Indices of the leaves the queries of the block belong to */
+    size_t * queryIndexes;          /* Indices of the queries of the block ordered by the leaves */
+
+    static void release(PacketSearchLocal * ptr)
+    {
+        ptr->stack.clear();
+        for (size_t i = 0; i < __KDTREE_QUERY_PACKET_SIZE; ++i)
+        {
+            ptr->heaps[i].clear();
+        }
+        service_scalable_free<algorithmFpType, cpu>(ptr->distances);
+        service_scalable_free<algorithmFpType, cpu>(ptr->classes);
+        service_scalable_free<size_t, cpu>(ptr->leafIndexes);
+        service_scalable_free<size_t, cpu>(ptr->queryIndexes);
+        service_scalable_free<PacketSearchLocal, cpu>(ptr);
+    }
+};
+
 template<typename algorithmFpType, CpuType cpu>
 void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
     compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, const daal::algorithms::Parameter * par)
@@ -313,6 +347,18 @@ void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
     const NumericTable & data = *(model->impl()->getData());
     const NumericTable & labels = *(model->impl()->getLabels());
 
+    /* The layout is built at training; the deserialized model builds it once on first prediction */
+    const services::SharedPtr<const KDTreeCompactLayout> compactKDTree = model->impl()->getCompactKDTree<algorithmFpType>(
+        [](const Model::ModelImpl & impl) -> services::SharedPtr<const KDTreeCompactLayout>
+        {
+            return buildCompactKDTree<algorithmFpType, cpu>(*(impl.getKDTreeTable()), impl.getRootNodeIndex(), *(impl.getData()));
+        } );
+    if (compactKDTree)
+    {
+        computeBatched(x, *compactKDTree, labels, y, k);
+        return;
+    }
+
     size_t iSize = 1;
     while (iSize < k) { iSize *= 2; }
     const size_t heapSize = (iSize / 16 + 1) * 16;
@@ -514,6 +560,263 @@ void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
     }
 }
 
+template<typename algorithmFpType, CpuType cpu>
+void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
+    computeBatched(const NumericTable * x, const KDTreeCompactLayout & kdTree, const NumericTable & labels, NumericTable * y, size_t k)
+{
+    typedef PacketSearchLocal<algorithmFpType, cpu> Local;
+
+    const size_t packetSize = __KDTREE_QUERY_PACKET_SIZE;
+    const size_t tileSize = __KDTREE_LEAF_BUCKET_SIZE + 1;
+    const size_t dataRowCount = kdTree.getPointCount();
+    data_management::BlockDescriptor<algorithmFpType> labelsBD;
+    const_cast<NumericTable &>(labels).getBlockOfColumnValues(0, 0, dataRowCount, readOnly, labelsBD);
+    const algorithmFpType * const labelsPtr = labelsBD.getBlockPtr();
+
+    size_t iSize = 1;
+    while (iSize < k) { iSize *= 2; }
+    const size_t heapSize = (iSize / 16 + 1) * 16;
+
+    daal::tls<Local *> localTLS([=]()-> Local *
+    {
+        Local * const ptr = service_scalable_calloc<Local, cpu>(1);
+        if (!ptr) { _errors->add(services::ErrorMemoryAllocationFailed); return nullptr; }
+
+        bool isAllocated = ptr->stack.init(64);
+        for (size_t i = 0; i < packetSize; ++i)
+        {
+            isAllocated = ptr->heaps[i].init(heapSize) && isAllocated;
+        }
+        ptr->distances = service_scalable_malloc<algorithmFpType, cpu>(packetSize * tileSize);
+        ptr->classes = service_scalable_malloc<algorithmFpType, cpu>(heapSize);
+        ptr->leafIndexes = service_scalable_malloc<size_t, cpu>(__KDTREE_QUERY_BLOCK_SIZE);
+        ptr->queryIndexes = service_scalable_malloc<size_t, cpu>(__KDTREE_QUERY_BLOCK_SIZE);
+        if (!isAllocated || !ptr->distances || !ptr->classes || !ptr->leafIndexes || !ptr->queryIndexes)
+        {
+            _errors->add(services::ErrorMemoryAllocationFailed);
+            Local::release(ptr);
+            return nullptr;
+        }
+        return ptr;
+    } );
+
+    const KDTreeCompactNode<algorithmFpType> * const nodes = kdTree.getNodes<algorithmFpType>();
+    const size_t xRowCount = x->getNumberOfRows();
+    const size_t xColumnCount = x->getNumberOfColumns();
+    const size_t yColumnCount = y->getNumberOfColumns();
+    const size_t maxThreads = threader_get_threads_number();
+    const size_t rowsPerBlock = max<cpu>(min<cpu>(static_cast<size_t>(__KDTREE_QUERY_BLOCK_SIZE), (xRowCount + maxThreads - 1) / maxThreads),
+                                         static_cast<size_t>(1));
+    const size_t blockCount = (xRowCount + rowsPerBlock - 1) / rowsPerBlock;
+    daal::threader_for(blockCount, blockCount, [=, &localTLS, &kdTree](int iBlock)
+    {
+        Local * const local = localTLS.local();
+        if (!local) { return; }
+
+        const size_t first = iBlock * rowsPerBlock;
+        const size_t last = min<cpu>(first + rowsPerBlock, xRowCount);
+        const size_t queryCount = last - first;
+
+        data_management::BlockDescriptor<algorithmFpType> xBD;
+        const_cast<NumericTable &>(*x).getBlockOfRows(first, queryCount, readOnly, xBD);
+        const algorithmFpType * const dx = xBD.getBlockPtr();
+        data_management::BlockDescriptor<algorithmFpType> yBD;
+        y->getBlockOfRows(first, queryCount, writeOnly, yBD);
+        algorithmFpType * const dy = yBD.getBlockPtr();
+
+        /* Group queries that fall into the same or neighboring leaves into packets */
+        for (size_t i = 0; i < queryCount; ++i)
+        {
+            local->leafIndexes[i] = findLeaf(dx + i * xColumnCount, nodes);
+            local->queryIndexes[i] = i;
+        }
+        daal::algorithms::internal::qSort<size_t, size_t, cpu>(queryCount, local->leafIndexes, local->queryIndexes);
+
+        const algorithmFpType * queries[__KDTREE_QUERY_PACKET_SIZE];
+        for (size_t p = 0; p < queryCount; p += packetSize)
+        {
+            const size_t packetQueryCount = min<cpu>(packetSize, queryCount - p);
+            for (size_t q = 0; q < packetQueryCount; ++q)
+            {
+                queries[q] = dx + local->queryIndexes[p + q] * xColumnCount;
+            }
+
+            findNearestNeighborsForPacket(queries, packetQueryCount, *local, k, kdTree);
+
+            for (size_t q = 0; q < packetQueryCount; ++q)
+            {
+                predict(dy[local->queryIndexes[p + q] * yColumnCount], local->heaps[q], labelsPtr, local->classes);
+            }
+        }
+
+        y->releaseBlockOfRows(yBD);
+        const_cast<NumericTable &>(*x).releaseBlockOfRows(xBD);
+    } );
+
+    localTLS.reduce([=](Local * ptr) -> void
+    {
+        if (ptr) { Local::release(ptr); }
+    } );
+
+    const_cast<NumericTable &>(labels).releaseBlockOfColumnValues(labelsBD);
+}
+
+template<typename algorithmFpType, CpuType cpu>
+size_t KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
+    findLeaf(const algorithmFpType * query, const KDTreeCompactNode<algorithmFpType> * nodes)
+{
+    const KDTreeCompactNode<algorithmFpType> * node = nodes;
+    while (node->dimension != __KDTREE_COMPACT_LEAF)
+    {
+        node = nodes + node->index + ((query[node->dimension] < node->cutPoint) ? 0 : 1);
+    }
+    return node->index;
+}
+
+template<typename algorithmFpType, CpuType cpu>
+void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
+    findNearestNeighborsForPacket(const algorithmFpType * const * queries, size_t queryCount, PacketSearchLocal<algorithmFpType, cpu> & local,
+                                  size_t k, const KDTreeCompactLayout & kdTree)
+{
+    typedef GlobalNeighbors<algorithmFpType, cpu> Neighbors;
+    typedef daal::data_feature_utils::internal::MaxVal<algorithmFpType, cpu> MaxVal;
+
+    const size_t tileSize = __KDTREE_LEAF_BUCKET_SIZE + 1;
+    const KDTreeCompactNode<algorithmFpType> * const nodes = kdTree.getNodes<algorithmFpType>();
+    const KDTreeCompactLeaf * const leaves = kdTree.getLeaves();
+    const size_t columnCount = kdTree.getColumnCount();
+    algorithmFpType * const distance = local.distances;
+
+    algorithmFpType radius[__KDTREE_QUERY_PACKET_SIZE];
+    size_t active[__KDTREE_QUERY_PACKET_SIZE];
+    for (size_t q = 0; q < queryCount; ++q)
+    {
+        local.heaps[q].reset();
+        radius[q] = MaxVal::get();
+    }
+    local.stack.reset();
+
+    PacketSearchNode<algorithmFpType> cur, toPush;
+    cur.nodeIndex = 0;
+    for (size_t q = 0; q < queryCount; ++q)
+    {
+        cur.minDistance[q] = 0;
+    }
+
+    for (;;)
+    {
+        const KDTreeCompactNode<algorithmFpType> & node = nodes[cur.nodeIndex];
+
+        /* Queries of the packet for which the node is not pruned */
+        size_t activeCount = 0;
+        for (size_t q = 0; q < queryCount; ++q)
+        {
+            if (cur.minDistance[q] <= radius[q]) { active[activeCount++] = q; }
+        }
+
+        if (activeCount && node.dimension == __KDTREE_COMPACT_LEAF)
+        {
+            const KDTreeCompactLeaf & leaf = leaves[node.index];
+            for (size_t start = leaf.start; start < leaf.end; start += tileSize)
+            {
+                const size_t pointCount = min<cpu>(tileSize, leaf.end - start);
+
+                /* Tile of distances from the active queries to the points of the leaf */
+                for (size_t a = 0; a < activeCount * tileSize; ++a)
+                {
+                    distance[a] = 0;
+                }
+                for (size_t j = 0; j < columnCount; ++j)
+                {
+                    const algorithmFpType * const column = kdTree.getColumn<algorithmFpType>(j) + start;
+                    for (size_t a = 0; a < activeCount; ++a)
+                    {
+                        const algorithmFpType value = queries[active[a]][j];
+                        algorithmFpType * const d = distance + a * tileSize;
+                      PRAGMA_IVDEP
+                      PRAGMA_VECTOR_ALWAYS
+                        for (size_t i = 0; i < pointCount; ++i)
+                        {
+                            d[i] += (value - column[i]) * (value - column[i]);
+                        }
+                    }
+                }
+
+                for (size_t a = 0; a < activeCount; ++a)
+                {
+                    const size_t q = active[a];
+                    Heap<Neighbors, cpu> & heap = local.heaps[q];
+                    const algorithmFpType * const d = distance + a * tileSize;
+                    Neighbors curNeighbor;
+                    for (size_t i = 0; i < pointCount; ++i)
+                    {
+                        if (d[i] <= radius[q])
+                        {
+                            curNeighbor.distance = d[i];
+                            curNeighbor.index = start + i;
+                            if (heap.size() < k)
+                            {
+                                heap.push(curNeighbor, k);
+                                if (heap.size() == k)
+                                {
+                                    radius[q] = heap.getMax()->distance;
+                                }
+                            }
+                            else if (heap.getMax()->distance > curNeighbor.distance)
+                            {
+                                heap.replaceMax(curNeighbor);
+                                radius[q] = heap.getMax()->distance;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        else if (activeCount)
+        {
+            /* Visit first the child that is closer to the most of the active queries */
+            size_t leftCount = 0;
+            for (size_t a = 0; a < activeCount; ++a)
+            {
+                leftCount += (queries[active[a]][node.dimension] < node.cutPoint);
+            }
+            const bool isLeftFirst = (2 * leftCount >= activeCount);
+
+            cur.nodeIndex = node.index + (isLeftFirst ? 0 : 1);
+            toPush.nodeIndex = node.index + (isLeftFirst ? 1 : 0);
+            for (size_t q = 0; q < queryCount; ++q)
+            {
+                const algorithmFpType diff = queries[q][node.dimension] - node.cutPoint;
+                const bool isLeft = (diff < 0);
+                toPush.minDistance[q] = cur.minDistance[q] + ((isLeft == isLeftFirst) ? diff * diff : 0);
+                cur.minDistance[q] += (isLeft == isLeftFirst) ? 0 : diff * diff;
+            }
+            local.stack.push(toPush);
+            DAAL_PREFETCH_READ_T0(nodes + cur.nodeIndex);
+            continue;
+        }
+
+        if (local.stack.empty()) { break; }
+        cur = local.stack.pop();
+        DAAL_PREFETCH_READ_T0(nodes + cur.nodeIndex);
+    }
+}
+
+template<typename algorithmFpType, CpuType cpu>
+void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
+    predict(algorithmFpType & predictedClass, const Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap, const algorithmFpType * labels,
+            algorithmFpType * classes)
+{
+    const size_t heapSize = heap.size();
+    if (heapSize < 1) { return; }
+
+    for (size_t i = 0; i < heapSize; ++i)
+    {
+        classes[i] = labels[heap[i].index];
+    }
+    predictedClass = computeMajorityClass<algorithmFpType, cpu>(heapSize, classes);
+}
+
 template<typename algorithmFpType, CpuType cpu>
 void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
     predict(algorithmFpType & predictedClass, const Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap, const NumericTable & labels, size_t k)
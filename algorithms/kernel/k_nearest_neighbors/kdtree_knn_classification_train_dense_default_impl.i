@@ -185,6 +185,8 @@ void KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense,
     rearrangePoints(*x, indexes);
     rearrangePoints(*y, indexes);
 
+    r->impl()->setCompactKDTree(buildCompactKDTree<algorithmFpType, cpu>(*(r->impl()->getKDTreeTable()), r->impl()->getRootNodeIndex(), *x));
+
     daal_free(bboxQ);
     daal_free(indexes);
 }
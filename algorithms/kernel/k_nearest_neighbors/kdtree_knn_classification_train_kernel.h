@@ -103,6 +103,13 @@ protected:
                                     IndexValuePair<algorithmFpType, cpu> * outValues);
 };
 
+template <typename algorithmFpType, CpuType cpu>
+class KNNClassificationTrainBatchKernel<algorithmFpType, training::bruteForce, cpu> : public daal::algorithms::Kernel
+{
+public:
+    void compute(NumericTable * x, NumericTable * y, kdtree_knn_classification::Model * r, const daal::algorithms::Parameter * par);
+};
+
 } // namespace internal
 } // namespace training
 } // namespace kdtree_knn_classification
@@ -49,6 +49,10 @@
     #define DAAL_ALIGNAS(n) alignas(n)
 #endif
 
+#include "service_memory.h"
+#include "service_sort.h"
+#include "kdtree_knn_classification_model_impl.h"
+
 namespace daal
 {
 namespace algorithms
@@ -72,6 +76,9 @@ namespace internal
 #define __SIMDWIDTH 8
 
 #define __KDTREE_NULLDIMENSION (static_cast<size_t>(-1))
+#define __KDTREE_COMPACT_LEAF (static_cast<unsigned int>(-1))
+#define __KDTREE_QUERY_BLOCK_SIZE 1024
+#define __KDTREE_QUERY_PACKET_SIZE 16
 
 template <CpuType cpu, typename T>
 inline const T & min(const T & a, const T & b) { return !(b < a) ? a : b; }
@@ -166,6 +173,138 @@ private:
     size_t _sizeMinus1;
 };
 
+/**
+ * Returns the class that occurs most frequently among the labels of the nearest neighbors,
+ * the smallest label wins in case of a tie
+ * \param[in]     n        Number of the nearest neighbors
+ * \param[in,out] classes  Labels of the nearest neighbors, sorted on exit
+ */
+template <typename algorithmFpType, CpuType cpu>
+algorithmFpType computeMajorityClass(size_t n, algorithmFpType * classes)
+{
+    daal::algorithms::internal::qSort<algorithmFpType, cpu>(n, classes);
+    algorithmFpType currentClass = classes[0];
+    algorithmFpType winnerClass = currentClass;
+    size_t currentWeight = 1;
+    size_t winnerWeight = currentWeight;
+    for (size_t i = 1; i < n; ++i)
+    {
+        if (classes[i] == currentClass)
+        {
+            if((++currentWeight) > winnerWeight)
+            {
+                winnerWeight = currentWeight;
+                winnerClass = currentClass;
+            }
+        }
+        else
+        {
+            currentWeight = 1;
+            currentClass = classes[i];
+        }
+    }
+    return winnerClass;
+}
+
+struct CompactBuildNode
+{
+    size_t srcIndex;
+    size_t dstIndex;
+};
+
+/**
+ * Builds the KD-tree in the compact layout from the KD-tree table.
+ * The nodes are placed in depth-first order with the children of each inner node next to each other,
+ * and the leaves are numbered in the order of the points in the training data set.
+ * The training points are copied by columns, so that prediction does not access the training data table.
+ * Returns empty pointer if the tree cannot be represented with 32-bit indices or memory allocation fails.
+ */
+template <typename algorithmFpType, CpuType cpu>
+services::SharedPtr<const KDTreeCompactLayout> buildCompactKDTree(const KDTreeTable & kdTreeTable, size_t rootNodeIndex,
+                                                                  const data_management::NumericTable & data)
+{
+    typedef KDTreeCompactNode<algorithmFpType> CompactNode;
+
+    const size_t maxIndex = static_cast<size_t>(__KDTREE_COMPACT_LEAF);
+    const size_t maxNodeCount = kdTreeTable.getNumberOfRows();
+    const size_t pointCount = data.getNumberOfRows();
+    const size_t dimensionCount = data.getNumberOfColumns();
+    if (maxNodeCount == 0 || maxNodeCount >= maxIndex || pointCount >= maxIndex || dimensionCount >= maxIndex)
+    {
+        return services::SharedPtr<const KDTreeCompactLayout>();
+    }
+
+    services::SharedPtr<KDTreeCompactLayout> layout(new KDTreeCompactLayout());
+    Stack<CompactBuildNode, cpu> stack;
+    if (!layout->allocate<algorithmFpType>(maxNodeCount, maxNodeCount, pointCount, dimensionCount) || !stack.init(64))
+    {
+        return services::SharedPtr<const KDTreeCompactLayout>();
+    }
+
+    const KDTreeNode * const src = static_cast<const KDTreeNode *>(kdTreeTable.getArray());
+    CompactNode * const nodes = layout->getNodes<algorithmFpType>();
+    KDTreeCompactLeaf * const leaves = layout->getLeaves();
+
+    size_t nodeCount = 1;
+    size_t leafCount = 0;
+    CompactBuildNode cur;
+    cur.srcIndex = rootNodeIndex;
+    cur.dstIndex = 0;
+    stack.push(cur);
+    while (!stack.empty())
+    {
+        cur = stack.pop();
+        const KDTreeNode & srcNode = src[cur.srcIndex];
+        CompactNode & dstNode = nodes[cur.dstIndex];
+        if (srcNode.dimension == __KDTREE_NULLDIMENSION)
+        {
+            dstNode.dimension = __KDTREE_COMPACT_LEAF;
+            dstNode.index = static_cast<unsigned int>(leafCount);
+            dstNode.cutPoint = 0;
+            leaves[leafCount].start = static_cast<unsigned int>(srcNode.leftIndex);
+            leaves[leafCount].end = static_cast<unsigned int>(srcNode.rightIndex);
+            ++leafCount;
+        }
+        else
+        {
+            dstNode.dimension = static_cast<unsigned int>(srcNode.dimension);
+            dstNode.index = static_cast<unsigned int>(nodeCount);
+            dstNode.cutPoint = static_cast<algorithmFpType>(srcNode.cutPoint);
+
+            /* Push the right child first to visit the left subtree first */
+            CompactBuildNode child;
+            child.srcIndex = srcNode.rightIndex;
+            child.dstIndex = nodeCount + 1;
+            stack.push(child);
+            child.srcIndex = srcNode.leftIndex;
+            child.dstIndex = nodeCount;
+            stack.push(child);
+            nodeCount += 2;
+        }
+    }
+
+    for (size_t j = 0; j < dimensionCount; ++j)
+    {
+        data_management::BlockDescriptor<algorithmFpType> columnBD;
+        const_cast<data_management::NumericTable &>(data).getBlockOfColumnValues(j, 0, pointCount, data_management::readOnly, columnBD);
+        const algorithmFpType * const column = columnBD.getBlockPtr();
+        if (column)
+        {
+            services::daal_memcpy_s(layout->getColumn<algorithmFpType>(j), pointCount * sizeof(algorithmFpType), column,
+                                    pointCount * sizeof(algorithmFpType));
+        }
+        const_cast<data_management::NumericTable &>(data).releaseBlockOfColumnValues(columnBD);
+        if (!column)
+        {
+            return services::SharedPtr<const KDTreeCompactLayout>();
+        }
+    }
+
+    layout->setNodeCount(nodeCount);
+    layout->setLeafCount(leafCount);
+    return layout;
+}
+
 } // namespace internal
 } // namespace kdtree_knn_classification
 } // namespace algorithms
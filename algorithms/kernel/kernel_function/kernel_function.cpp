@@ -37,6 +37,39 @@ namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_KERNEL_FUNCTION_RESULT_ID);
 
+PrecomputedState::PrecomputedState(const data_management::NumericTablePtr &table) :
+    _table(table), _firstRow(0), _rowNonZeros(0), _errors(new services::ErrorCollection())
+{
+    _sqrNorms[0] = 0;
+    _sqrNorms[1] = 0;
+}
+
+PrecomputedState::PrecomputedState(const services::SharedPtr<PrecomputedState> &state,
+                                   const data_management::NumericTablePtr &rows, size_t firstRow) :
+    _table(rows), _state(state), _firstRow(firstRow), _rowNonZeros(0), _errors(new services::ErrorCollection())
+{
+    _sqrNorms[0] = 0;
+    _sqrNorms[1] = 0;
+}
+
+PrecomputedState::~PrecomputedState()
+{
+    daal::services::daal_free(_sqrNorms[0]);
+    daal::services::daal_free(_sqrNorms[1]);
+    daal::services::daal_free(_rowNonZeros);
+}
+
+bool PrecomputedState::isStateOf(const data_management::NumericTable *table) const
+{
+    if (!table || _table.get() != table) { return false; }
+    if (!_state) { return true; }
+
+    const data_management::NumericTable *stateTable = _state->getTable().get();
+    return (_state->isStateOf(stateTable) && stateTable->getNumberOfColumns() == table->getNumberOfColumns() &&
+            _firstRow <= stateTable->getNumberOfRows() &&
+            table->getNumberOfRows() <= stateTable->getNumberOfRows() - _firstRow);
+}
+
 ParameterBase::ParameterBase(size_t rowIndexX, size_t rowIndexY, size_t rowIndexResult, ComputationMode computationMode) :
     rowIndexX(rowIndexX), rowIndexY(rowIndexY), rowIndexResult(rowIndexResult), computationMode(computationMode) {}
 
@@ -79,6 +112,27 @@ void Input::checkDense() const
     size_t nFeaturesX = get(X)->getNumberOfColumns();
     if (!data_management::checkNumericTable(get(Y).get(), this->_errors.get(), YStr(), 0, 0, nFeaturesX)) { return; }
 }
+
+/**
+ * Checks that the precomputed states are the states of the input tables
+ */
+void Input::checkPrecomputedState(const ParameterBase *par) const
+{
+    const PrecomputedState *states[2]  = { par->precomputedStateX.get(), par->precomputedStateY.get() };
+    const char *stateNames[2]          = { precomputedStateXStr(), precomputedStateYStr() };
+    for (size_t i = 0; i < 2; i++)
+    {
+        if (!states[i]) { continue; }
+        if (!states[i]->isStateOf(get((InputId)i).get()))
+        {
+            services::SharedPtr<services::Error> error(new services::Error(services::ErrorIncorrectParameter));
+            error->addStringDetail(services::ParameterName, stateNames[i]);
+            this->_errors->add(error);
+            return;
+        }
+    }
+}
+
 /**
  * Returns the result of the kernel function algorithm
  * \param[in] id   Identifier of the result
@@ -30,6 +30,7 @@
 #include "kernel_function_linear.h"
 #include "kernel_function_rbf.h"
 #include "service_micro_table.h"
+#include "kernel_function_precomputed_state.h"
 #include "kernel.h"
 
 using namespace daal::internal;
@@ -124,6 +125,17 @@ struct KernelCSRImplBase : public Kernel
 
         bool inputTablesSame = ((a1 == a2) ? true : false);
 
+        /* Squared norms of the rows are taken from the precomputed states if they are set */
+        const size_t firstRowA1 = (computationMode == vectorVector ? svmPar->rowIndexX : 0);
+        const size_t firstRowA2 = (computationMode == matrixMatrix ? 0 : svmPar->rowIndexY);
+        _sqrNormsA1 = getPrecomputedSquaredNorms<algorithmFPType>(svmPar->precomputedStateX, firstRowA1,
+                                                                  precomputedStateXStr(), _errors.get());
+        _sqrNormsA2 = getPrecomputedSquaredNorms<algorithmFPType>(svmPar->precomputedStateY, firstRowA2,
+                                                                  precomputedStateYStr(), _errors.get());
+        _rowNonZerosA1 = getPrecomputedRowNonZeros(svmPar->precomputedStateX, firstRowA1);
+        _rowNonZerosA2 = getPrecomputedRowNonZeros(svmPar->precomputedStateY, firstRowA2);
+        if ((svmPar->precomputedStateX && !_sqrNormsA1) || (svmPar->precomputedStateY && !_sqrNormsA2)) { return; }
+
         prepareData(mtA1, mtA2, mtR, svmPar, &nVectors1, &dataA1, &colIndicesA1, &rowOffsetsA1,
                     &nVectors2, &dataA2, &colIndicesA2, &rowOffsetsA2, &dataR, inputTablesSame);
         computeInternal(nFeatures, nVectors1, dataA1, colIndicesA1, rowOffsetsA1,
@@ -139,6 +151,10 @@ protected:
                                              const size_t startIndex2, const size_t endIndex2, const algorithmFPType *dataA2, const size_t *colIndicesA2);
 
     ComputationMode _computationMode;
+    const algorithmFPType *_sqrNormsA1;    /* Squared norms of the rows of A1 if precomputed, 0 otherwise */
+    const algorithmFPType *_sqrNormsA2;    /* Squared norms of the rows of A2 if precomputed, 0 otherwise */
+    const size_t *_rowNonZerosA1;          /* Numbers of non-zero values in the rows of A1 if precomputed, 0 otherwise */
+    const size_t *_rowNonZerosA2;          /* Numbers of non-zero values in the rows of A2 if precomputed, 0 otherwise */
 };
 
 } // namespace internal
@@ -30,6 +30,7 @@
 #include "kernel_function_linear.h"
 #include "kernel_function_rbf.h"
 #include "service_micro_table.h"
+#include "kernel_function_precomputed_state.h"
 #include "kernel.h"
 
 using namespace daal::internal;
@@ -118,6 +119,15 @@ struct KernelImplBase : public Kernel
 
         bool inputTablesSame = ((a1 == a2) ? true : false);
 
+        /* Squared norms of the rows are taken from the precomputed states if they are set */
+        const size_t firstRowA1 = (computationMode == vectorVector ? svmPar->rowIndexX : 0);
+        const size_t firstRowA2 = (computationMode == matrixMatrix ? 0 : svmPar->rowIndexY);
+        _sqrNormsA1 = getPrecomputedSquaredNorms<algorithmFPType>(svmPar->precomputedStateX, firstRowA1,
+                                                                  precomputedStateXStr(), _errors.get());
+        _sqrNormsA2 = getPrecomputedSquaredNorms<algorithmFPType>(svmPar->precomputedStateY, firstRowA2,
+                                                                  precomputedStateYStr(), _errors.get());
+        if ((svmPar->precomputedStateX && !_sqrNormsA1) || (svmPar->precomputedStateY && !_sqrNormsA2)) { return; }
+
         prepareData(mtA1, mtA2, mtR, svmPar, &nVectors1, &dataA1, &nVectors2, &dataA2, &dataR, inputTablesSame);
         computeInternal(nFeatures, nVectors1, dataA1, nVectors2, dataA2, dataR, svmPar, inputTablesSame);
 
@@ -128,6 +138,8 @@ struct KernelImplBase : public Kernel
 
 protected:
     ComputationMode _computationMode;
+    const algorithmFPType *_sqrNormsA1;    /* Squared norms of the rows of A1 if precomputed, 0 otherwise */
+    const algorithmFPType *_sqrNormsA2;    /* Squared norms of the rows of A2 if precomputed, 0 otherwise */
 };
 
 } // namespace internal
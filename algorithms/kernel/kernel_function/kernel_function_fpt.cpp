@@ -22,6 +22,7 @@
 */
 
 #include "kernel_function_types.h"
+#include "csr_numeric_table.h"
 
 namespace daal
 {
@@ -51,6 +52,84 @@ DAAL_EXPORT void Result::allocate(const daal::algorithms::Input *input, const da
 
 template DAAL_EXPORT void Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, const int method);
 
+/**
+ * Computes squared norms of the rows of the table and, for the table in the CSR layout,
+ * numbers of non-zero values in the rows
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT bool PrecomputedState::compute()
+{
+    if (_state)
+    {
+        if (_state->compute<algorithmFPType>()) { return true; }
+        _errors->add(_state->getErrors()->getErrors());
+        return false;
+    }
+
+    const size_t fpIndex = (sizeof(algorithmFPType) == sizeof(double) ? 1 : 0);
+    if (_sqrNorms[fpIndex]) { return true; }
+    if (!_table) { _errors->add(services::ErrorNullNumericTable); return false; }
+
+    const size_t nRows = _table->getNumberOfRows();
+    const size_t nFeatures = _table->getNumberOfColumns();
+    algorithmFPType *sqrNorms = (algorithmFPType *)daal::services::daal_malloc(nRows * sizeof(algorithmFPType));
+    if (!sqrNorms) { _errors->add(services::ErrorMemoryAllocationFailed); return false; }
+
+    data_management::CSRNumericTableIface *csrTable = dynamic_cast<data_management::CSRNumericTableIface *>(_table.get());
+    if (csrTable)
+    {
+        size_t *rowNonZeros = _rowNonZeros;
+        if (!rowNonZeros)
+        {
+            rowNonZeros = (size_t *)daal::services::daal_malloc(nRows * sizeof(size_t));
+            if (!rowNonZeros)
+            {
+                daal::services::daal_free(sqrNorms);
+                _errors->add(services::ErrorMemoryAllocationFailed);
+                return false;
+            }
+        }
+
+        data_management::CSRBlockDescriptor<algorithmFPType> block;
+        csrTable->getSparseBlock(0, nRows, data_management::readOnly, block);
+        const algorithmFPType *values = block.getBlockValuesPtr();
+        const size_t *rowOffsets = block.getBlockRowIndicesPtr();
+        for (size_t i = 0; i < nRows; i++)
+        {
+            algorithmFPType sum = 0;
+            for (size_t j = rowOffsets[i] - rowOffsets[0]; j < rowOffsets[i + 1] - rowOffsets[0]; j++)
+            {
+                sum += values[j] * values[j];
+            }
+            sqrNorms[i] = sum;
+            rowNonZeros[i] = rowOffsets[i + 1] - rowOffsets[i];
+        }
+        csrTable->releaseSparseBlock(block);
+        _rowNonZeros = rowNonZeros;
+    }
+    else
+    {
+        data_management::BlockDescriptor<algorithmFPType> block;
+        _table->getBlockOfRows(0, nRows, data_management::readOnly, block);
+        const algorithmFPType *data = block.getBlockPtr();
+        for (size_t i = 0; i < nRows; i++)
+        {
+            algorithmFPType sum = 0;
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                sum += data[i * nFeatures + j] * data[i * nFeatures + j];
+            }
+            sqrNorms[i] = sum;
+        }
+        _table->releaseBlockOfRows(block);
+    }
+
+    _sqrNorms[fpIndex] = sqrNorms;
+    return true;
+}
+
+template DAAL_EXPORT bool PrecomputedState::compute<DAAL_FPTYPE>();
+
 }// namespace interface1
 }// namespace kernel function
 }// namespace algorithms
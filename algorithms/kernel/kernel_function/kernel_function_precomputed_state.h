@@ -0,0 +1,77 @@
+/* file: kernel_function_precomputed_state.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Access to the precomputed state of the kernel function inputs.
+//--
+*/
+
+#ifndef __KERNEL_FUNCTION_PRECOMPUTED_STATE_H__
+#define __KERNEL_FUNCTION_PRECOMPUTED_STATE_H__
+
+#include "kernel_function_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kernel_function
+{
+namespace internal
+{
+
+/**
+ * Returns squared norms of the rows of the input starting from the given row,
+ * 0 if the state is not set or its data is not computed in the given data type.
+ * The state is only read, so that kernel functions computed in parallel can share it
+ */
+template <typename algorithmFPType>
+const algorithmFPType *getPrecomputedSquaredNorms(const PrecomputedStatePtr &state, size_t firstRow, const char *stateName,
+                                                  services::KernelErrorCollection *errors)
+{
+    if (!state) { return 0; }
+    const algorithmFPType *sqrNorms = state->getSquaredNorms<algorithmFPType>();
+    if (!sqrNorms)
+    {
+        services::SharedPtr<services::Error> error(new services::Error(services::ErrorIncorrectParameter));
+        error->addStringDetail(services::ParameterName, stateName);
+        errors->add(error);
+        return 0;
+    }
+    return sqrNorms + firstRow;
+}
+
+/**
+ * Returns numbers of non-zero values in the rows of the input starting from the given row,
+ * 0 if the state is not set or the table is not in the CSR layout
+ */
+inline const size_t *getPrecomputedRowNonZeros(const PrecomputedStatePtr &state, size_t firstRow)
+{
+    if (!state || !state->getRowNonZeros()) { return 0; }
+    return state->getRowNonZeros() + firstRow;
+}
+
+} // namespace internal
+
+} // namespace kernel_function
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
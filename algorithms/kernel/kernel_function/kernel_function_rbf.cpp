@@ -55,6 +55,9 @@ void Input::check(const daal::algorithms::Parameter *par, int method) const
     {
         checkDense();
     }
+    if (this->_errors->size() != 0) { return; }
+
+    checkPrecomputedState(static_cast<const ParameterBase *>(par));
 }
 
 }// namespace interface1
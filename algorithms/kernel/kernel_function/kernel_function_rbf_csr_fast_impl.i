@@ -114,13 +114,27 @@ void KernelImplRBF<fastCSR, algorithmFPType, cpu>::computeInternalVectorVector(
                                                startIndex2, endIndex2, dataA2, colIndicesA2);
     factor *= -2.0;
 
-    for (size_t index = startIndex1; index < endIndex1; index++)
+    if (this->_sqrNormsA1)
     {
-        factor += dataA1[index] * dataA1[index];
+        factor += this->_sqrNormsA1[0];
     }
-    for (size_t index = startIndex2; index < endIndex2; index++)
+    else
+    {
+        for (size_t index = startIndex1; index < endIndex1; index++)
+        {
+            factor += dataA1[index] * dataA1[index];
+        }
+    }
+    if (this->_sqrNormsA2)
     {
-        factor += dataA2[index] * dataA2[index];
+        factor += this->_sqrNormsA2[0];
+    }
+    else
+    {
+        for (size_t index = startIndex2; index < endIndex2; index++)
+        {
+            factor += dataA2[index] * dataA2[index];
+        }
     }
     factor *= coeff;
     daal::internal::Math<algorithmFPType, cpu>::vExp(1, &factor, dataR);
@@ -139,20 +153,43 @@ void KernelImplRBF<fastCSR, algorithmFPType, cpu>::computeInternalMatrixVector(
     size_t endIndex2   = rowOffsetsA2[1] - 1;
 
     algorithmFPType factor = 0.0;
-    for (size_t index = startIndex2; index < endIndex2; index++)
+    if (this->_sqrNormsA2)
     {
-        factor += dataA2[index] * dataA2[index];
+        factor = this->_sqrNormsA2[0];
     }
+    else
+    {
+        for (size_t index = startIndex2; index < endIndex2; index++)
+        {
+            factor += dataA2[index] * dataA2[index];
+        }
+    }
+    const algorithmFPType *sqrNormsA1 = this->_sqrNormsA1;
+    const size_t *rowNonZerosA1 = this->_rowNonZerosA1;
     for (size_t i = 0; i < nVectors1; i++)
     {
         size_t startIndex1 = rowOffsetsA1[i]   - 1;
         size_t endIndex1   = rowOffsetsA1[i + 1] - 1;
-        dataR[i] = computeDotProduct(startIndex1, endIndex1, dataA1, colIndicesA1,
-                                     startIndex2, endIndex2, dataA2, colIndicesA2);
-        dataR[i] = -2.0 * dataR[i] + factor;
-        for (size_t index = startIndex1; index < endIndex1; index++)
+        if (rowNonZerosA1 && rowNonZerosA1[i] == 0)
+        {
+            dataR[i] = factor;
+        }
+        else
+        {
+            dataR[i] = computeDotProduct(startIndex1, endIndex1, dataA1, colIndicesA1,
+                                         startIndex2, endIndex2, dataA2, colIndicesA2);
+            dataR[i] = -2.0 * dataR[i] + factor;
+        }
+        if (sqrNormsA1)
+        {
+            dataR[i] += sqrNormsA1[i];
+        }
+        else
         {
-            dataR[i] += dataA1[index] * dataA1[index];
+            for (size_t index = startIndex1; index < endIndex1; index++)
+            {
+                dataR[i] += dataA1[index] * dataA1[index];
+            }
         }
         dataR[i] *= coeff;
 
@@ -211,35 +248,62 @@ void KernelImplRBF<fastCSR, algorithmFPType, cpu>::computeInternalMatrixMatrix(
     }
     else
     {
-        algorithmFPType *buffer = (algorithmFPType *)daal::services::daal_malloc((nVectors1 + nVectors2) * sizeof(algorithmFPType));
-        if (!buffer) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+        /* Squared norms that are not precomputed are computed in the buffer */
+        const size_t bufferSize = (this->_sqrNormsA1 ? 0 : nVectors1) + (this->_sqrNormsA2 ? 0 : nVectors2);
+        algorithmFPType *buffer = NULL;
+        if (bufferSize)
+        {
+            buffer = (algorithmFPType *)daal::services::daal_malloc(bufferSize * sizeof(algorithmFPType));
+            if (!buffer) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+        }
         algorithmFPType *sqrDataA1 = buffer;
-        algorithmFPType *sqrDataA2 = buffer + nVectors1;
+        algorithmFPType *sqrDataA2 = buffer + (this->_sqrNormsA1 ? 0 : nVectors1);
+        const size_t *rowNonZerosA1 = this->_rowNonZerosA1;
+        const size_t *rowNonZerosA2 = this->_rowNonZerosA2;
 
         daal::threader_for_optional(nVectors1, nVectors1, [=](size_t i)
         {
             for (size_t j = 0; j < nVectors2; j++)
             {
+                if ((rowNonZerosA1 && rowNonZerosA1[i] == 0) || (rowNonZerosA2 && rowNonZerosA2[j] == 0))
+                {
+                    dataR[i * nVectors2 + j] = zero;
+                    continue;
+                }
                 dataR[i * nVectors2 + j] = computeDotProduct(rowOffsetsA1[i] - 1, rowOffsetsA1[i + 1] - 1, dataA1, colIndicesA1,
                                                              rowOffsetsA2[j] - 1, rowOffsetsA2[j + 1] - 1, dataA2, colIndicesA2);
             }
         } );
-        daal::threader_for_optional(nVectors1, nVectors1, [=](size_t i)
+        if (this->_sqrNormsA1)
         {
-            sqrDataA1[i] = zero;
-            for (size_t j = rowOffsetsA1[i] - 1; j < rowOffsetsA1[i + 1] - 1; j++)
+            sqrDataA1 = const_cast<algorithmFPType *>(this->_sqrNormsA1);
+        }
+        else
+        {
+            daal::threader_for_optional(nVectors1, nVectors1, [=](size_t i)
             {
-                sqrDataA1[i] += dataA1[j] * dataA1[j];
-            }
-        } );
-        daal::threader_for_optional(nVectors2, nVectors2, [=](size_t i)
+                sqrDataA1[i] = zero;
+                for (size_t j = rowOffsetsA1[i] - 1; j < rowOffsetsA1[i + 1] - 1; j++)
+                {
+                    sqrDataA1[i] += dataA1[j] * dataA1[j];
+                }
+            } );
+        }
+        if (this->_sqrNormsA2)
+        {
+            sqrDataA2 = const_cast<algorithmFPType *>(this->_sqrNormsA2);
+        }
+        else
         {
-            sqrDataA2[i] = zero;
-            for (size_t j = rowOffsetsA2[i] - 1; j < rowOffsetsA2[i + 1] - 1; j++)
+            daal::threader_for_optional(nVectors2, nVectors2, [=](size_t i)
             {
-                sqrDataA2[i] += dataA2[j] * dataA2[j];
-            }
-        } );
+                sqrDataA2[i] = zero;
+                for (size_t j = rowOffsetsA2[i] - 1; j < rowOffsetsA2[i + 1] - 1; j++)
+                {
+                    sqrDataA2[i] += dataA2[j] * dataA2[j];
+                }
+            } );
+        }
         daal::threader_for_optional(nVectors1, nVectors1, [=](size_t i)
         {
             for (size_t k = 0; k < nVectors2; k++)
@@ -115,6 +115,11 @@ void KernelImplRBF<defaultDense, algorithmFPType, cpu>::computeInternalMatrixVec
 {
     const Parameter *rbfPar = static_cast<const Parameter *>(par);
     algorithmFPType invSqrSigma = (algorithmFPType)(1.0 / (rbfPar->sigma * rbfPar->sigma));
+    if (this->_sqrNormsA1)
+    {
+        computeInternalMatrixVectorPrecomputed(nFeatures, nVectors1, dataA1, dataA2, dataR, invSqrSigma);
+        return;
+    }
     for (size_t i = 0; i < nVectors1; i++)
     {
         algorithmFPType factor = 0.0;
@@ -135,6 +140,63 @@ void KernelImplRBF<defaultDense, algorithmFPType, cpu>::computeInternalMatrixVec
     daal::internal::Math<algorithmFPType, cpu>::vExp(nVectors1, dataR, dataR);
 }
 
+/**
+ * Computes the kernel function values as exp(-(|x_i|^2 + |y|^2 - 2 * x_i * y) / (2 * sigma^2))
+ * using the precomputed squared norms of the vectors in the set X
+ */
+template <typename algorithmFPType, CpuType cpu>
+void KernelImplRBF<defaultDense, algorithmFPType, cpu>::computeInternalMatrixVectorPrecomputed(
+    size_t nFeatures, size_t nVectors1, const algorithmFPType *dataA1, const algorithmFPType *dataA2,
+    algorithmFPType *dataR, algorithmFPType invSqrSigma)
+{
+    algorithmFPType sqrNormA2 = 0.0;
+    if (this->_sqrNormsA2)
+    {
+        sqrNormA2 = this->_sqrNormsA2[0];
+    }
+    else
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            sqrNormA2 += dataA2[j] * dataA2[j];
+        }
+    }
+
+    /* dataR = -2 * A1 * A2 */
+    char trans = 'T';
+    algorithmFPType zero = 0.0, negTwo = -2.0;
+    DAAL_INT m = (DAAL_INT)nFeatures;
+    DAAL_INT n = (DAAL_INT)nVectors1;
+    DAAL_INT inc = 1;
+    if (is_in_parallel())
+    {
+        Blas<algorithmFPType, cpu>::xxgemv(&trans, &m, &n, &negTwo, (algorithmFPType *)dataA1, &m, (algorithmFPType *)dataA2, &inc,
+                                           &zero, dataR, &inc);
+    }
+    else
+    {
+        Blas<algorithmFPType, cpu>::xgemv(&trans, &m, &n, &negTwo, (algorithmFPType *)dataA1, &m, (algorithmFPType *)dataA2, &inc,
+                                          &zero, dataR, &inc);
+    }
+
+    const algorithmFPType coeff = -0.5 * invSqrSigma;
+    const algorithmFPType *sqrNormsA1 = this->_sqrNormsA1;
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < nVectors1; i++)
+    {
+        algorithmFPType sqrDistance = dataR[i] + sqrNormsA1[i] + sqrNormA2;
+        dataR[i] = coeff * (sqrDistance > zero ? sqrDistance : zero);
+        if( dataR[i] < Math<algorithmFPType, cpu>::vExpThreshold() )
+        {
+            dataR[i] = Math<algorithmFPType, cpu>::vExpThreshold();
+        }
+    }
+    daal::internal::Math<algorithmFPType, cpu>::vExp(nVectors1, dataR, dataR);
+}
+
 template <typename algorithmFPType, CpuType cpu>
 void KernelImplRBF<defaultDense, algorithmFPType, cpu>::computeInternalMatrixMatrix(
     size_t nFeatures, size_t nVectors1, const algorithmFPType *dataA1,
@@ -163,24 +225,44 @@ void KernelImplRBF<defaultDense, algorithmFPType, cpu>::computeInternalMatrixMat
                                               &negTwo, (algorithmFPType *)dataA2, (DAAL_INT *)&nFeatures, (algorithmFPType *)dataA1, (DAAL_INT *)&nFeatures, &zero,
                                               dataR, (DAAL_INT *)&nVectors2);
         }
-        algorithmFPType *buffer = (algorithmFPType *)daal::services::daal_malloc((nVectors1 + nVectors2) * sizeof(algorithmFPType));
-        if (!buffer) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+        /* Squared norms that are not precomputed are computed in the buffer */
+        const size_t bufferSize = (this->_sqrNormsA1 ? 0 : nVectors1) + (this->_sqrNormsA2 ? 0 : nVectors2);
+        algorithmFPType *buffer = NULL;
+        if (bufferSize)
+        {
+            buffer = (algorithmFPType *)daal::services::daal_malloc(bufferSize * sizeof(algorithmFPType));
+            if (!buffer) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+        }
         algorithmFPType *sqrDataA1 = buffer;
-        algorithmFPType *sqrDataA2 = buffer + nVectors1;
-        for (size_t i = 0; i < nVectors1; i++)
+        algorithmFPType *sqrDataA2 = buffer + (this->_sqrNormsA1 ? 0 : nVectors1);
+        if (this->_sqrNormsA1)
+        {
+            sqrDataA1 = const_cast<algorithmFPType *>(this->_sqrNormsA1);
+        }
+        else
         {
-            sqrDataA1[i] = zero;
-            for (size_t j = 0; j < nFeatures; j++)
+            for (size_t i = 0; i < nVectors1; i++)
             {
-                sqrDataA1[i] += dataA1[i * nFeatures + j] * dataA1[i * nFeatures + j];
+                sqrDataA1[i] = zero;
+                for (size_t j = 0; j < nFeatures; j++)
+                {
+                    sqrDataA1[i] += dataA1[i * nFeatures + j] * dataA1[i * nFeatures + j];
+                }
             }
         }
-        for (size_t i = 0; i < nVectors2; i++)
+        if (this->_sqrNormsA2)
         {
-            sqrDataA2[i] = zero;
-            for (size_t j = 0; j < nFeatures; j++)
+            sqrDataA2 = const_cast<algorithmFPType *>(this->_sqrNormsA2);
+        }
+        else
+        {
+            for (size_t i = 0; i < nVectors2; i++)
             {
-                sqrDataA2[i] += dataA2[i * nFeatures + j] * dataA2[i * nFeatures + j];
+                sqrDataA2[i] = zero;
+                for (size_t j = 0; j < nFeatures; j++)
+                {
+                    sqrDataA2[i] += dataA2[i * nFeatures + j] * dataA2[i * nFeatures + j];
+                }
             }
         }
         for (size_t i = 0; i < nVectors1; i++)
@@ -68,6 +68,10 @@ struct KernelImplRBF<defaultDense, algorithmFPType, cpu> :
         size_t nVectors2, const algorithmFPType *dataA2,
         algorithmFPType *dataR, const ParameterBase *par);
 
+    void computeInternalMatrixVectorPrecomputed(
+        size_t nFeatures, size_t nVectors1, const algorithmFPType *dataA1, const algorithmFPType *dataA2,
+        algorithmFPType *dataR, algorithmFPType invSqrSigma);
+
     void computeInternalMatrixMatrix(
         size_t nFeatures, size_t nVectors1, const algorithmFPType *dataA1,
         size_t nVectors2, const algorithmFPType *dataA2,
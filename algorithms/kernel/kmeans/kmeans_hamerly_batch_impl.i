@@ -0,0 +1,637 @@
+/* file: kmeans_hamerly_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of Lloyd method for K-means algorithm accelerated with
+//  the bounds on the distances from the observations to the centroids (Hamerly method).
+//--
+*/
+
+#include "algorithm.h"
+#include "numeric_table.h"
+#include "threading.h"
+#include "daal_defines.h"
+#include "service_memory.h"
+#include "service_micro_table.h"
+#include "service_math.h"
+#include "service_blas.h"
+#include "service_defines.h"
+#include "service_data_utils.h"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace internal
+{
+
+/**
+ *  \brief Thread-local partial sums of the observations assigned to the centroids and buffers of the thread
+ */
+template<typename algorithmFPType, CpuType cpu>
+struct HamerlyTlsTask
+{
+    HamerlyTlsTask(size_t dim, size_t nClusters, size_t blockSize) : goalFunc(0)
+    {
+        cS1       = service_calloc<algorithmFPType, cpu>(nClusters * dim);
+        cS0       = service_calloc<int, cpu>(nClusters);
+        rows      = service_malloc<algorithmFPType, cpu>(blockSize * dim);
+        dist      = service_malloc<algorithmFPType, cpu>(blockSize * nClusters);
+        searchIdx = service_malloc<size_t, cpu>(blockSize);
+        memoryError = (!cS1 || !cS0 || !rows || !dist || !searchIdx);
+    }
+
+    ~HamerlyTlsTask()
+    {
+        service_free<algorithmFPType, cpu>(cS1);
+        service_free<int, cpu>(cS0);
+        service_free<algorithmFPType, cpu>(rows);
+        service_free<algorithmFPType, cpu>(dist);
+        service_free<size_t, cpu>(searchIdx);
+    }
+
+    algorithmFPType *cS1;       /*!< Sums of the observations assigned to the centroids */
+    int *cS0;                   /*!< Numbers of the observations assigned to the centroids */
+    algorithmFPType goalFunc;   /*!< Sum of the squared distances from the observations to the nearest centroids */
+    algorithmFPType *rows;      /*!< Observations of the block that need the distances to all the centroids */
+    algorithmFPType *dist;      /*!< Dot products of these observations and the centroids */
+    size_t *searchIdx;          /*!< Indices of these observations in the block */
+    bool memoryError;
+};
+
+/**
+ *  \brief Centroids and the bounds on the distances kept between the iterations.
+ *         For each observation the nearest centroid is stored with the lower bound on the distance to the second nearest one.
+ *         The distance to the assigned centroid is computed exactly on each iteration, because it is needed for the goal function,
+ *         and serves as the upper bound. If it does not exceed the lower bound or the half of the distance from the assigned
+ *         centroid to the nearest other centroid, the assignment does not change
+ */
+template<typename algorithmFPType, CpuType cpu>
+struct HamerlyTask
+{
+    HamerlyTask(size_t _dim, size_t _nClusters, size_t _nRows) :
+        dim(_dim), nClusters(_nClusters), nRows(_nRows), blockSize(512), tls(NULL),
+        maxDrift(0), secondMaxDrift(0), maxDriftIdx(0)
+    {
+        centers     = service_malloc<algorithmFPType, cpu>(nClusters * dim);
+        newCenters  = service_malloc<algorithmFPType, cpu>(nClusters * dim);
+        cNorm2      = service_malloc<algorithmFPType, cpu>(nClusters);
+        halfMinDist = service_malloc<algorithmFPType, cpu>(nClusters);
+        drift       = service_calloc<algorithmFPType, cpu>(nClusters);
+        assignments = service_calloc<int, cpu>(nRows);
+        lower       = service_calloc<algorithmFPType, cpu>(nRows);
+        memoryError = (!centers || !newCenters || !cNorm2 || !halfMinDist || !drift || !assignments || !lower);
+
+        const size_t d = dim, k = nClusters, b = blockSize;
+        tls = new daal::tls<HamerlyTlsTask<algorithmFPType, cpu> *>( [ = ]()-> HamerlyTlsTask<algorithmFPType, cpu> *
+        {
+            return new HamerlyTlsTask<algorithmFPType, cpu>(d, k, b);
+        } );
+    }
+
+    ~HamerlyTask()
+    {
+        tls->reduce( [ = ](HamerlyTlsTask<algorithmFPType, cpu> *tt)-> void
+        {
+            delete tt;
+        } );
+        delete tls;
+
+        service_free<algorithmFPType, cpu>(centers);
+        service_free<algorithmFPType, cpu>(newCenters);
+        service_free<algorithmFPType, cpu>(cNorm2);
+        service_free<algorithmFPType, cpu>(halfMinDist);
+        service_free<algorithmFPType, cpu>(drift);
+        service_free<int, cpu>(assignments);
+        service_free<algorithmFPType, cpu>(lower);
+    }
+
+    /** Computes the squared norms of the centroids, the distances between them and the maximal drifts */
+    void updateCentroidsGeometry();
+
+    /**
+     *  Assigns the observations to the nearest centroids and accumulates the partial sums
+     *  \param[in] ntData       Input data set
+     *  \param[in] fullSearch   If true, the distances to all the centroids are computed for all the observations
+     */
+    template<Method method>
+    void assignThreaded(const NumericTable *ntData, bool fullSearch);
+
+    /**
+     *  Collects the partial sums of the threads and clears them
+     *  \return false if the memory allocation of a thread failed
+     */
+    bool reduce(size_t *s0, algorithmFPType *s1, algorithmFPType *goalFunc);
+
+    /** Returns true if the bounds prove that the nearest centroid of the observation did not change, updates the lower bound */
+    inline bool keepsAssignment(size_t a, algorithmFPType dist2, algorithmFPType &lowerBound) const
+    {
+        lowerBound -= (a == maxDriftIdx ? secondMaxDrift : maxDrift);
+        const algorithmFPType upperBound = daal::internal::Math<algorithmFPType, cpu>::sSqrt(dist2);
+        return (upperBound <= lowerBound || upperBound <= halfMinDist[a]);
+    }
+
+    /** Finds the nearest centroid from the dot products of the observation and the centroids */
+    inline void selectNearest(const algorithmFPType *dot, algorithmFPType xNorm2,
+                              int &nearest, algorithmFPType &minDist2, algorithmFPType &lowerBound) const
+    {
+        const algorithmFPType maxVal = data_feature_utils::internal::MaxVal<algorithmFPType, cpu>::get();
+        algorithmFPType min1 = maxVal, min2 = maxVal;
+        size_t idx = 0;
+        for (size_t j = 0; j < nClusters; j++)
+        {
+            const algorithmFPType d2 = cNorm2[j] - 2 * dot[j];
+            if (d2 < min1)
+            {
+                min2 = min1;
+                min1 = d2;
+                idx  = j;
+            }
+            else if (d2 < min2)
+            {
+                min2 = d2;
+            }
+        }
+
+        nearest  = (int)idx;
+        minDist2 = min1 + xNorm2;
+        if (minDist2 < (algorithmFPType)0) { minDist2 = (algorithmFPType)0; }
+        if (nClusters > 1)
+        {
+            min2 += xNorm2;
+            lowerBound = daal::internal::Math<algorithmFPType, cpu>::sSqrt(min2 > (algorithmFPType)0 ? min2 : (algorithmFPType)0);
+        }
+        else
+        {
+            lowerBound = maxVal;
+        }
+    }
+
+    void processBlockDense(HamerlyTlsTask<algorithmFPType, cpu> *tt, const NumericTable *ntData,
+                           size_t startRow, size_t nRowsInBlock, bool fullSearch);
+
+    void processBlockCSR(HamerlyTlsTask<algorithmFPType, cpu> *tt, const NumericTable *ntData,
+                         size_t startRow, size_t nRowsInBlock, bool fullSearch);
+
+    size_t dim;
+    size_t nClusters;
+    size_t nRows;
+    size_t blockSize;
+    daal::tls<HamerlyTlsTask<algorithmFPType, cpu> *> *tls;
+
+    algorithmFPType *centers;       /*!< Centroids of the current iteration */
+    algorithmFPType *newCenters;    /*!< Centroids computed on the current iteration */
+    algorithmFPType *cNorm2;        /*!< Squared norms of the centroids */
+    algorithmFPType *halfMinDist;   /*!< Half of the distance from the centroid to the nearest other centroid */
+    algorithmFPType *drift;         /*!< Distance the centroid moved on the last update */
+    algorithmFPType maxDrift;       /*!< Maximal drift of the centroids */
+    algorithmFPType secondMaxDrift; /*!< Maximal drift of the centroids except the one with maximal drift */
+    size_t maxDriftIdx;             /*!< Index of the centroid with maximal drift */
+
+    int *assignments;               /*!< Nearest centroids of the observations */
+    algorithmFPType *lower;         /*!< Lower bounds on the distances from the observations to the second nearest centroids */
+    bool memoryError;
+};
+
+template<typename algorithmFPType, CpuType cpu>
+void HamerlyTask<algorithmFPType, cpu>::updateCentroidsGeometry()
+{
+    const size_t p = dim;
+    const size_t k = nClusters;
+    const algorithmFPType *c = centers;
+    algorithmFPType *norm2 = cNorm2;
+    algorithmFPType *halfDist = halfMinDist;
+    const algorithmFPType maxVal = data_feature_utils::internal::MaxVal<algorithmFPType, cpu>::get();
+
+    for (size_t i = 0; i < k; i++)
+    {
+        algorithmFPType sum = 0;
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < p; j++)
+        {
+            sum += c[i * p + j] * c[i * p + j];
+        }
+        norm2[i] = sum;
+    }
+
+    daal::threader_for( k, k, [=](int i)
+    {
+        algorithmFPType minDist2 = maxVal;
+        for (size_t l = 0; l < k; l++)
+        {
+            if (l == (size_t)i) { continue; }
+            algorithmFPType dist2 = 0;
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; j++)
+            {
+                const algorithmFPType diff = c[i * p + j] - c[l * p + j];
+                dist2 += diff * diff;
+            }
+            if (dist2 < minDist2) { minDist2 = dist2; }
+        }
+        halfDist[i] = (k > 1 ? (algorithmFPType)0.5 * daal::internal::Math<algorithmFPType, cpu>::sSqrt(minDist2) : maxVal);
+    } );
+
+    maxDrift = secondMaxDrift = 0;
+    maxDriftIdx = 0;
+    for (size_t i = 0; i < k; i++)
+    {
+        if (drift[i] > maxDrift)
+        {
+            secondMaxDrift = maxDrift;
+            maxDrift       = drift[i];
+            maxDriftIdx    = i;
+        }
+        else if (drift[i] > secondMaxDrift)
+        {
+            secondMaxDrift = drift[i];
+        }
+    }
+}
+
+template<typename algorithmFPType, CpuType cpu>
+void HamerlyTask<algorithmFPType, cpu>::processBlockDense(HamerlyTlsTask<algorithmFPType, cpu> *tt, const NumericTable *ntData,
+                                                          size_t startRow, size_t nRowsInBlock, bool fullSearch)
+{
+    const size_t p = dim;
+    int *cS0 = tt->cS0;
+    algorithmFPType *cS1 = tt->cS1;
+    int *assign = assignments + startRow;
+    algorithmFPType *lowerBound = lower + startRow;
+
+    BlockMicroTable<algorithmFPType, readOnly, cpu> mtData(ntData);
+    algorithmFPType *data;
+    mtData.getBlockOfRows(startRow, nRowsInBlock, &data);
+
+    algorithmFPType goal = 0;
+    size_t nSearch = 0;
+    for (size_t i = 0; i < nRowsInBlock; i++)
+    {
+        if (fullSearch) { tt->searchIdx[nSearch++] = i; continue; }
+
+        const algorithmFPType *x = data + i * p;
+        const size_t a = assign[i];
+        const algorithmFPType *c = centers + a * p;
+        algorithmFPType dist2 = 0;
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < p; j++)
+        {
+            dist2 += (x[j] - c[j]) * (x[j] - c[j]);
+        }
+
+        if (!keepsAssignment(a, dist2, lowerBound[i])) { tt->searchIdx[nSearch++] = i; continue; }
+
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < p; j++)
+        {
+            cS1[a * p + j] += x[j];
+        }
+        cS0[a]++;
+        goal += dist2;
+    }
+
+    if (nSearch > 0)
+    {
+        /* Distances to all the centroids are computed for the gathered observations at once */
+        algorithmFPType *rows = tt->rows;
+        algorithmFPType *dot  = tt->dist;
+        for (size_t s = 0; s < nSearch; s++)
+        {
+            const algorithmFPType *x = data + tt->searchIdx[s] * p;
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; j++)
+            {
+                rows[s * p + j] = x[j];
+            }
+        }
+
+        char transa = 't';
+        char transb = 'n';
+        DAAL_INT _m = nClusters;
+        DAAL_INT _n = nSearch;
+        DAAL_INT _k = p;
+        algorithmFPType alpha = 1.0;
+        DAAL_INT lda = p;
+        DAAL_INT ldy = p;
+        algorithmFPType beta = 0.0;
+        DAAL_INT ldaty = nClusters;
+
+        Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, centers,
+                                           &lda, rows, &ldy, &beta, dot, &ldaty);
+
+        for (size_t s = 0; s < nSearch; s++)
+        {
+            const size_t i = tt->searchIdx[s];
+            const algorithmFPType *x = rows + s * p;
+            algorithmFPType xNorm2 = 0;
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; j++)
+            {
+                xNorm2 += x[j] * x[j];
+            }
+
+            algorithmFPType dist2;
+            selectNearest(dot + s * nClusters, xNorm2, assign[i], dist2, lowerBound[i]);
+
+            const size_t a = assign[i];
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; j++)
+            {
+                cS1[a * p + j] += x[j];
+            }
+            cS0[a]++;
+            goal += dist2;
+        }
+    }
+
+    tt->goalFunc += goal;
+    mtData.release();
+}
+
+template<typename algorithmFPType, CpuType cpu>
+void HamerlyTask<algorithmFPType, cpu>::processBlockCSR(HamerlyTlsTask<algorithmFPType, cpu> *tt, const NumericTable *ntData,
+                                                        size_t startRow, size_t nRowsInBlock, bool fullSearch)
+{
+    CSRNumericTableIface *ntCSR = dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(ntData));
+
+    const size_t p = dim;
+    int *cS0 = tt->cS0;
+    algorithmFPType *cS1 = tt->cS1;
+    int *assign = assignments + startRow;
+    algorithmFPType *lowerBound = lower + startRow;
+    algorithmFPType *dot = tt->dist;
+
+    CSRBlockDescriptor<algorithmFPType> dataBlock;
+    ntCSR->getSparseBlock(startRow, nRowsInBlock, readOnly, dataBlock);
+    const algorithmFPType *values = dataBlock.getBlockValuesPtr();
+    const size_t *colIdx = dataBlock.getBlockColumnIndicesPtr();
+    const size_t *rowIdx = dataBlock.getBlockRowIndicesPtr();
+
+    algorithmFPType goal = 0;
+    for (size_t i = 0; i < nRowsInBlock; i++)
+    {
+        const size_t valuesNum = rowIdx[i + 1] - rowIdx[i];
+        const algorithmFPType *x = values + (rowIdx[i] - rowIdx[0]);
+        const size_t *cols = colIdx + (rowIdx[i] - rowIdx[0]);
+
+        algorithmFPType xNorm2 = 0;
+        for (size_t t = 0; t < valuesNum; t++)
+        {
+            xNorm2 += x[t] * x[t];
+        }
+
+        bool search = fullSearch;
+        algorithmFPType dist2 = 0;
+        if (!fullSearch)
+        {
+            const size_t a = assign[i];
+            const algorithmFPType *c = centers + a * p;
+            algorithmFPType xc = 0;
+            for (size_t t = 0; t < valuesNum; t++)
+            {
+                xc += x[t] * c[cols[t] - 1];
+            }
+            dist2 = xNorm2 - 2 * xc + cNorm2[a];
+            if (dist2 < (algorithmFPType)0) { dist2 = (algorithmFPType)0; }
+            search = !keepsAssignment(a, dist2, lowerBound[i]);
+        }
+
+        if (search)
+        {
+            for (size_t j = 0; j < nClusters; j++)
+            {
+                const algorithmFPType *c = centers + j * p;
+                algorithmFPType xc = 0;
+                for (size_t t = 0; t < valuesNum; t++)
+                {
+                    xc += x[t] * c[cols[t] - 1];
+                }
+                dot[j] = xc;
+            }
+            selectNearest(dot, xNorm2, assign[i], dist2, lowerBound[i]);
+        }
+
+        const size_t a = assign[i];
+        for (size_t t = 0; t < valuesNum; t++)
+        {
+            cS1[a * p + cols[t] - 1] += x[t];
+        }
+        cS0[a]++;
+        goal += dist2;
+    }
+
+    tt->goalFunc += goal;
+    ntCSR->releaseSparseBlock(dataBlock);
+}
+
+template<typename algorithmFPType, CpuType cpu>
+template<Method method>
+void HamerlyTask<algorithmFPType, cpu>::assignThreaded(const NumericTable *ntData, bool fullSearch)
+{
+    const size_t n = nRows;
+    const size_t blockSizeDefault = blockSize;
+    size_t nBlocks = n / blockSizeDefault;
+    nBlocks += (nBlocks * blockSizeDefault != n);
+
+    daal::threader_for( nBlocks, nBlocks, [=](int k)
+    {
+        HamerlyTlsTask<algorithmFPType, cpu> *tt = tls->local();
+        if (tt->memoryError) { return; }
+
+        const size_t startRow = k * blockSizeDefault;
+        const size_t nRowsInBlock = ((size_t)k == nBlocks - 1 ? n - startRow : blockSizeDefault);
+        if (method == hamerlyCSR)
+        {
+            processBlockCSR(tt, ntData, startRow, nRowsInBlock, fullSearch);
+        }
+        else
+        {
+            processBlockDense(tt, ntData, startRow, nRowsInBlock, fullSearch);
+        }
+    } );
+}
+
+template<typename algorithmFPType, CpuType cpu>
+bool HamerlyTask<algorithmFPType, cpu>::reduce(size_t *s0, algorithmFPType *s1, algorithmFPType *goalFunc)
+{
+    const size_t p = dim;
+    const size_t k = nClusters;
+    for (size_t i = 0; i < k; i++)
+    {
+        s0[i] = 0;
+    }
+    for (size_t i = 0; i < k * p; i++)
+    {
+        s1[i] = 0;
+    }
+    *goalFunc = 0;
+
+    bool status = true;
+    tls->reduce( [&](HamerlyTlsTask<algorithmFPType, cpu> *tt)-> void
+    {
+        if (tt->memoryError) { status = false; return; }
+        for (size_t i = 0; i < k; i++)
+        {
+            s0[i] += tt->cS0[i];
+            tt->cS0[i] = 0;
+        }
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < k * p; i++)
+        {
+            s1[i] += tt->cS1[i];
+            tt->cS1[i] = 0;
+        }
+        *goalFunc += tt->goalFunc;
+        tt->goalFunc = 0;
+    } );
+    return status;
+}
+
+#define __DAAL_FABS(a) (((a)>(algorithmFPType)0.0)?(a):(-(a)))
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+void KMeansHamerlyBatchKernel<method, algorithmFPType, cpu>::compute( size_t na, const NumericTable *const *a,
+                                                                      size_t nr, const NumericTable *const *r, const Parameter *par)
+{
+    NumericTable *ntData = const_cast<NumericTable *>( a[0] );
+
+    const size_t nIter = par->maxIterations;
+    const size_t p = ntData->getNumberOfColumns();
+    const size_t n = ntData->getNumberOfRows();
+    const size_t nClusters = par->nClusters;
+
+    HamerlyTask<algorithmFPType, cpu> task(p, nClusters, n);
+    size_t *clusterS0 = service_malloc<size_t, cpu>(nClusters);
+    algorithmFPType *clusterS1 = service_malloc<algorithmFPType, cpu>(nClusters * p);
+    if (task.memoryError || !clusterS0 || !clusterS1)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        service_free<size_t, cpu>(clusterS0);
+        service_free<algorithmFPType, cpu>(clusterS1);
+        return;
+    }
+
+    BlockMicroTable<algorithmFPType, readOnly, cpu> mtInClusters( a[1] );
+    algorithmFPType *inClusters;
+    mtInClusters.getBlockOfRows( 0, nClusters, &inClusters );
+    daal::services::daal_memcpy_s(task.centers, nClusters * p * sizeof(algorithmFPType), inClusters, nClusters * p * sizeof(algorithmFPType));
+    mtInClusters.release();
+
+    task.updateCentroidsGeometry();
+
+    size_t kIter;
+    algorithmFPType oldTargetFunc = (algorithmFPType)0.0;
+    for (kIter = 0; kIter < nIter; kIter++)
+    {
+        /* On the first iteration there are no bounds yet */
+        task.template assignThreaded<method>(ntData, kIter == 0);
+
+        algorithmFPType newTargetFunc;
+        if (!task.reduce(clusterS0, clusterS1, &newTargetFunc)) { break; }
+
+        /* Centroids without the observations stay in place */
+        for (size_t i = 0; i < nClusters; i++)
+        {
+            algorithmFPType *newCenter = task.newCenters + i * p;
+            const algorithmFPType *center = task.centers + i * p;
+            const algorithmFPType coeff = (clusterS0[i] > 0 ? (algorithmFPType)1.0 / clusterS0[i] : (algorithmFPType)0.0);
+            algorithmFPType drift2 = 0;
+            for (size_t j = 0; j < p; j++)
+            {
+                newCenter[j] = (clusterS0[i] > 0 ? clusterS1[i * p + j] * coeff : center[j]);
+                drift2 += (newCenter[j] - center[j]) * (newCenter[j] - center[j]);
+            }
+            task.drift[i] = daal::internal::Math<algorithmFPType, cpu>::sSqrt(drift2);
+        }
+
+        algorithmFPType *tmp = task.centers;
+        task.centers = task.newCenters;
+        task.newCenters = tmp;
+        task.updateCentroidsGeometry();
+
+        if ( par->accuracyThreshold > (algorithmFPType)0.0 )
+        {
+            if ( __DAAL_FABS(oldTargetFunc - newTargetFunc) < par->accuracyThreshold )
+            {
+                kIter++;
+                break;
+            }
+        }
+        oldTargetFunc = newTargetFunc;
+    }
+
+    if (par->assignFlag && this->_errors->size() == 0)
+    {
+        /* The bounds are updated with the drifts of the last iteration */
+        task.template assignThreaded<method>(ntData, nIter == 0);
+        algorithmFPType goal;
+        task.reduce(clusterS0, clusterS1, &goal);
+
+        BlockMicroTable<int, writeOnly, cpu> mtAssign( r[1] );
+        int *assign;
+        mtAssign.getBlockOfRows( 0, n, &assign );
+        daal::services::daal_memcpy_s(assign, n * sizeof(int), task.assignments, n * sizeof(int));
+        mtAssign.release();
+    }
+
+    bool memoryError = false;
+    task.tls->reduce( [&](HamerlyTlsTask<algorithmFPType, cpu> *tt)-> void
+    {
+        memoryError = memoryError || tt->memoryError;
+    } );
+    if (memoryError) { this->_errors->add(services::ErrorMemoryAllocationFailed); }
+
+    service_free<size_t, cpu>(clusterS0);
+    service_free<algorithmFPType, cpu>(clusterS1);
+
+    BlockMicroTable<algorithmFPType, writeOnly, cpu> mtClusters( r[0] );
+    algorithmFPType *clusters;
+    mtClusters.getBlockOfRows( 0, nClusters, &clusters );
+    daal::services::daal_memcpy_s(clusters, nClusters * p * sizeof(algorithmFPType), task.centers, nClusters * p * sizeof(algorithmFPType));
+    mtClusters.release();
+
+    int* nIterations;
+    BlockMicroTable<int, writeOnly, cpu> mtIterations( r[3] );
+    mtIterations.getBlockOfRows(0, 1, &nIterations);
+    *nIterations = kIter;
+    mtIterations.release();
+
+    algorithmFPType *goal;
+    BlockMicroTable<algorithmFPType, writeOnly, cpu> mtTarget( r[2] );
+    mtTarget.getBlockOfRows(0, 1, &goal);
+    *goal = oldTargetFunc;
+    mtTarget.release();
+}
+
+} // namespace daal::algorithms::kmeans::internal
+} // namespace daal::algorithms::kmeans
+} // namespace daal::algorithms
+} // namespace daal
@@ -76,7 +76,7 @@ size_t Input::getNumberOfFeatures() const
 void Input::check(const daal::algorithms::Parameter *parameter, int method) const
 {
     const Parameter *kmPar = static_cast<const Parameter *>(parameter);
-    if(method == lloydCSR)
+    if(method == lloydCSR || method == hamerlyCSR)
     {
         int expectedLayout = (int)NumericTableIface::csrArray;
         if (!checkNumericTable(get(data).get(), this->_errors.get(), dataStr(), 0, expectedLayout)) { return; }
@@ -86,6 +86,18 @@ void Input::check(const daal::algorithms::Parameter *parameter, int method) cons
         if (!checkNumericTable(get(data).get(), this->_errors.get(), dataStr())) { return; }
     }
     size_t inputFeatures = get(data)->getNumberOfColumns();
+    if(method == hamerlyDense || method == hamerlyCSR)
+    {
+        /* The bounds of the Hamerly method are valid for the Euclidean distance only */
+        NumericTablePtr dataTable = get(data);
+        for(size_t i = 0; i < inputFeatures; i++)
+        {
+            if(dataTable->getFeatureType(i) == data_feature_utils::DAAL_CATEGORICAL)
+            {
+                this->_errors->add(Error::create(ErrorIncorrectTypeOfInputNumericTable, ArgumentName, dataStr())); return;
+            }
+        }
+    }
     if (!checkNumericTable(get(inputCentroids).get(), this->_errors.get(), inputCentroidsStr(), 0, 0, inputFeatures, kmPar->nClusters)) { return; }
 }
 
@@ -47,6 +47,23 @@ public:
     void compute(size_t na, const NumericTable *const *a, size_t nr, const NumericTable *const *r, const Parameter *par);
 };
 
+/**
+ *  Kernel of the Lloyd iterations that keeps the bounds on the distances from the observations to the centroids
+ *  and computes the distances to all the centroids only for the observations which assignments may change
+ */
+template <Method method, typename algorithmFPType, CpuType cpu>
+class KMeansHamerlyBatchKernel: public Kernel
+{
+public:
+    void compute(size_t na, const NumericTable *const *a, size_t nr, const NumericTable *const *r, const Parameter *par);
+};
+
+template <typename algorithmFPType, CpuType cpu>
+class KMeansBatchKernel<hamerlyDense, algorithmFPType, cpu>: public KMeansHamerlyBatchKernel<hamerlyDense, algorithmFPType, cpu> {};
+
+template <typename algorithmFPType, CpuType cpu>
+class KMeansBatchKernel<hamerlyCSR, algorithmFPType, cpu>: public KMeansHamerlyBatchKernel<hamerlyCSR, algorithmFPType, cpu> {};
+
 template <Method method, typename algorithmFPType, CpuType cpu>
 class KMeansDistributedStep1Kernel: public Kernel
 {
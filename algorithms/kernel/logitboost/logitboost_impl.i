@@ -28,6 +28,8 @@
 #include <cmath>
 #include "service_math.h"
 #include "service_data_utils.h"
+#include "threading.h"
+#include "boosting_blocks_impl.i"
 
 namespace daal
 {
@@ -39,30 +41,26 @@ namespace internal
 {
 
 /**
- *  \brief Update additive function's F values.
+ *  \brief Update additive function's F values for the block of observations.
  *         Step 2.b) of the Algorithm 6 from [1] (page 356).
  *
- *  \param dim[in]          Number of features
  *  \param n[in]            Number of observations
  *  \param nc[in]           Number of classes
- *  \param x[in]            Input dataset
- *  \param xbm[in]          Buffer manager associated with input dataset
- *  \param splitFeature[in] Indices of the split features
- *  \param splitPoint[in]   Split points
- *  \param lMean[in]        "left" average sof weighted responses
- *  \param rMean[in]        "right" averages of weighted responses
+ *  \param startRow[in]     Index of the first observation in the block
+ *  \param nRows[in]        Number of observations in the block
+ *  \param pred[in]         Predictions of the weak learners of size nc x n
  *  \param F[out]           Additive function's values (column-major format:
  *                          values for the first sample come first,
  *                          for the second - second, etc)
  */
 template<typename algorithmFPType, CpuType cpu>
-void UpdateF(size_t dim, size_t n, size_t nc, algorithmFPType *pred, algorithmFPType *F)
+void UpdateFBlock(size_t n, size_t nc, size_t startRow, size_t nRows, const algorithmFPType *pred, algorithmFPType *F)
 {
     algorithmFPType s, r, rj;
     algorithmFPType inv_nc = 1.0 / (algorithmFPType)nc;
     algorithmFPType coef = (algorithmFPType)(nc - 1) / (algorithmFPType)nc;
 
-    for ( size_t i = 0; i < n; i++ )
+    for ( size_t i = startRow; i < startRow + nRows; i++ )
     {
         for ( size_t j = 0; j < nc; j++ )
         {
@@ -84,50 +82,82 @@ void UpdateF(size_t dim, size_t n, size_t nc, algorithmFPType *pred, algorithmFP
             F[i * nc + j] += coef * ( rj - s * inv_nc );
         }
     }
+}
+
+/**
+ *  \brief Update additive function's F values.
+ *         Step 2.b) of the Algorithm 6 from [1] (page 356).
+ *         The observations are processed by blocks in parallel
+ *
+ *  \param dim[in]          Number of features
+ *  \param n[in]            Number of observations
+ *  \param nc[in]           Number of classes
+ *  \param pred[in]         Predictions of the weak learners of size nc x n
+ *  \param F[out]           Additive function's values (column-major format:
+ *                          values for the first sample come first,
+ *                          for the second - second, etc)
+ */
+template<typename algorithmFPType, CpuType cpu>
+void UpdateF(size_t dim, size_t n, size_t nc, algorithmFPType *pred, algorithmFPType *F)
+{
+    using namespace daal::algorithms::boosting::internal;
 
-    return;
+    size_t nBlocks = getNumberOfBlocks(n);
+    daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
+    {
+        UpdateFBlock<algorithmFPType, cpu>(n, nc, iBlock * nRowsInBlock, getNumberOfRowsInBlock(n, iBlock), pred, F);
+    } );
 }
 
 /**
- *  \brief Update probailities matrix
+ *  \brief Update probailities matrix.
+ *         The observations are processed by blocks in parallel
  *
  *  \param nc[in]   Number of classes
  *  \param n[in]    Number of observations
  *  \param F[in]    Values of additive function
  *  \param P[out]   Probailities matrix of size nc x n
+ *  \param Fbuf[in] Buffer of size nc for each block of observations
  */
 template<typename algorithmFPType, CpuType cpu>
 void UpdateP( size_t nc, size_t n, algorithmFPType *F, algorithmFPType *P, algorithmFPType *Fbuf )
 {
-    algorithmFPType s;
+    using namespace daal::algorithms::boosting::internal;
+
     algorithmFPType zero = (algorithmFPType)0.0;
     algorithmFPType overflowThreshold = daal::data_feature_utils::internal::MaxVal<algorithmFPType, cpu>::get();
 
-    for ( size_t i = 0; i < n; i++ )
+    size_t nBlocks = getNumberOfBlocks(n);
+    daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
     {
-        daal::internal::Math<algorithmFPType,cpu>::vExp(nc, F + i * nc, Fbuf);
+        size_t startRow = iBlock * nRowsInBlock;
+        size_t nRows = getNumberOfRowsInBlock(n, iBlock);
+        algorithmFPType *FbufBlock = Fbuf + iBlock * nc;
 
-        s = 0.0;
-        for ( size_t j = 0; j < nc; j++ )
+        for ( size_t i = startRow; i < startRow + nRows; i++ )
         {
-            s += Fbuf[j];
-        }
+            daal::internal::Math<algorithmFPType,cpu>::vExp(nc, F + i * nc, FbufBlock);
 
-        s = (algorithmFPType)1.0 / s;
-        for ( size_t j = 0; j < nc; j++ )
-        {
-            if (Fbuf[j] > overflowThreshold)
+            algorithmFPType s = 0.0;
+            for ( size_t j = 0; j < nc; j++ )
             {
-                P[j * n + i] = zero;
+                s += FbufBlock[j];
             }
-            else
+
+            s = (algorithmFPType)1.0 / s;
+            for ( size_t j = 0; j < nc; j++ )
             {
-                P[j * n + i] = Fbuf[j] * s;
+                if (FbufBlock[j] > overflowThreshold)
+                {
+                    P[j * n + i] = zero;
+                }
+                else
+                {
+                    P[j * n + i] = FbufBlock[j] * s;
+                }
             }
         }
-    }
-
-    return;
+    } );
 }
 
 } // namespace daal::algorithms::logitboost::internal
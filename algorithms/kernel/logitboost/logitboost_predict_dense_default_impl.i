@@ -32,9 +32,12 @@
 
 #include "service_memory.h"
 #include "service_numeric_table.h"
+#include "service_defines.h"
 #include "logitboost_impl.i"
+#include "boosting_blocks_impl.i"
 
 using namespace daal::algorithms::logitboost::internal;
+using namespace daal::algorithms::boosting::internal;
 
 namespace daal
 {
@@ -47,78 +50,119 @@ namespace prediction
 namespace internal
 {
 
+/**
+ *  \brief Buffers of the thread that computes the predictions for the blocks of observations
+ */
+template<typename algorithmFPType, CpuType cpu>
+struct LogitBoostPredictTask
+{
+    LogitBoostPredictTask(const services::SharedPtr<weak_learner::prediction::Batch> &learnerPredict, size_t nc) :
+        predictor(learnerPredict), memoryError(false)
+    {
+        pred = daal::services::internal::service_malloc<algorithmFPType, cpu>(nRowsInBlock * nc);
+        F    = daal::services::internal::service_malloc<algorithmFPType, cpu>(nRowsInBlock * nc);
+        if (!pred || !F) { memoryError = true; }
+    }
+
+    ~LogitBoostPredictTask()
+    {
+        daal::services::internal::service_free<algorithmFPType, cpu>(pred);
+        daal::services::internal::service_free<algorithmFPType, cpu>(F);
+    }
+
+    bool hasErrors() { return (memoryError || predictor.hasErrors()); }
+
+    WeakLearnerBlockPredictor<algorithmFPType, cpu> predictor;
+    algorithmFPType *pred;      /* Predictions of the weak learners of one iteration */
+    algorithmFPType *F;         /* Additive function values */
+    bool memoryError;
+};
+
 template<typename algorithmFPType, CpuType cpu>
 void LogitBoostPredictKernel<defaultDense, algorithmFPType, cpu>::compute( NumericTablePtr a,
         const Model *m, NumericTable *r, const Parameter *par )
 {
     Parameter *parameter = const_cast<Parameter *>(par);
-    size_t dim = a->getNumberOfColumns();       /* Number of features in input dataset */
     size_t n   = a->getNumberOfRows();          /* Number of observations in input dataset */
     size_t nc  = parameter->nClasses;           /* Number of classes */
     size_t M   = m->getIterations();            /* Number of terms of additive regression in the model */
-    algorithmFPType *pred;
-    algorithmFPType *F;      /* Additive function values */
     Model *boostModel = const_cast<Model *>(m);
-
-    /* Allocate memory */
-    pred = (algorithmFPType *) daal::services::daal_malloc (n * nc * sizeof(algorithmFPType));
-    F    = (algorithmFPType *) daal::services::daal_malloc (n * nc * sizeof(algorithmFPType));
-    if (!pred || !F)
-    {
-        this->_errors->add(services::ErrorMemoryAllocationFailed); return;
-    }
-    daal::services::internal::service_memset<algorithmFPType, cpu>(F, 0, n * nc);
+    NumericTable *x = a.get();
 
     services::SharedPtr<weak_learner::prediction::Batch> learnerPredict = parameter->weakLearnerPrediction;
-    learnerPredict->inputBase->set(classifier::prediction::data, a);
 
-    /* Calculate additive function values */
-    for ( size_t m = 0; m < M; m++ )
+    /* Each thread computes the additive function values and the classes labels for its blocks of observations */
+    daal::tls<LogitBoostPredictTask<algorithmFPType, cpu> *> tlsTask( [ = ]()
     {
-        for (size_t j = 0; j < nc; j++)
-        {
-            services::SharedPtr<daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu> > predTable(
-                new daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>(pred + j * n, 1, n));
-            services::SharedPtr<classifier::prediction::Result> predictionRes(new classifier::prediction::Result());
-            predictionRes->set(classifier::prediction::prediction, predTable);
-            learnerPredict->setResult(predictionRes);
-            services::SharedPtr<weak_learner::Model> learnerModel = boostModel->getWeakLearnerModel(m * nc + j);
-
-            learnerPredict->inputBase->set(classifier::prediction::model, learnerModel);
-            learnerPredict->computeNoThrow();
-            if(learnerPredict->getErrors()->size() != 0) {this->_errors->add(learnerPredict->getErrors()->getErrors()); return;}
-        }
+        return new LogitBoostPredictTask<algorithmFPType, cpu>(learnerPredict, nc);
+    } );
 
-        UpdateF<algorithmFPType, cpu>( dim, n, nc, pred, F );
-    }
+    size_t nBlocks = getNumberOfBlocks(n);
+    daal::threader_for(nBlocks, nBlocks, [ =, &tlsTask ](int iBlock)
+    {
+        LogitBoostPredictTask<algorithmFPType, cpu> *task = tlsTask.local();
+        if (task->hasErrors()) { return; }
 
-    /* Calculate classes labels for input data */
-    int *cl;
-    BlockDescriptor<int> block;
-    r->getBlockOfColumnValues( 0, 0, n, writeOnly, block );
-    cl = block.getBlockPtr();
-    algorithmFPType fmax;
+        size_t startRow = iBlock * nRowsInBlock;
+        size_t nRows = getNumberOfRowsInBlock(n, iBlock);
+        if (!task->predictor.setBlock(x, startRow, nRows)) { return; }
 
-    for ( size_t i = 0; i < n; i++ )
-    {
-        int idx = 0;
-        fmax = F[i * nc];
-        for ( int j = 1; j < nc; j++ )
+        algorithmFPType *pred = task->pred;
+        algorithmFPType *F    = task->F;
+        daal::services::internal::service_memset<algorithmFPType, cpu>(F, 0, nRows * nc);
+
+        /* Calculate additive function values */
+        for ( size_t m = 0; m < M; m++ )
         {
-            if ( F[i * nc + j] > fmax )
+            for (size_t j = 0; j < nc; j++)
             {
-                idx = j;
-                fmax = F[i * nc + j];
+                const algorithmFPType *predJ = task->predictor.predict(boostModel->getWeakLearnerModel(m * nc + j));
+                if (!predJ) { task->predictor.releaseBlock(); return; }
+
+                algorithmFPType *predBlock = pred + j * nRows;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nRows; i++)
+                {
+                    predBlock[i] = predJ[i];
+                }
             }
+
+            UpdateFBlock<algorithmFPType, cpu>( nRows, nc, 0, nRows, pred, F );
         }
+        task->predictor.releaseBlock();
 
-        cl[i] = idx;
-    }
+        /* Calculate classes labels for input data */
+        BlockDescriptor<int> block;
+        r->getBlockOfColumnValues( 0, startRow, nRows, writeOnly, block );
+        int *cl = block.getBlockPtr();
+        if (!cl) { task->memoryError = true; return; }
 
-    r->releaseBlockOfColumnValues( block );
+        for ( size_t i = 0; i < nRows; i++ )
+        {
+            size_t idx = 0;
+            algorithmFPType fmax = F[i * nc];
+            for ( size_t j = 1; j < nc; j++ )
+            {
+                if ( F[i * nc + j] > fmax )
+                {
+                    idx = j;
+                    fmax = F[i * nc + j];
+                }
+            }
 
-    daal::services::daal_free (F);
-    daal::services::daal_free (pred);
+            cl[i] = (int)idx;
+        }
+
+        r->releaseBlockOfColumnValues( block );
+    } );
+
+    tlsTask.reduce( [ = ](LogitBoostPredictTask<algorithmFPType, cpu> *task)
+    {
+        if (task->memoryError) { this->_errors->add(services::ErrorMemoryAllocationFailed); }
+        task->predictor.addErrors(this->_errors.get());
+        delete task;
+    } );
 }
 
 } // namepsace internal
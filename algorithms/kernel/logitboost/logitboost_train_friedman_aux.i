@@ -39,6 +39,8 @@
 #define __LOGITBOOST_TRAIN_FRIEDMAN_AUX_I__
 
 #include "stump_train_impl.i"
+#include "service_defines.h"
+#include "boosting_blocks_impl.i"
 
 using namespace daal::algorithms::logitboost::internal;
 
@@ -54,22 +56,26 @@ namespace internal
 {
 
 /**
- *  \brief Update working responses and weights for current class
+ *  \brief Update working responses and weights for current class.
+ *         The observations are processed by blocks in parallel
  *
- *  \param n[in]        Number of observations in training data set
- *  \param nc[in]       Number of classes in training data set
- *  \param curClass[in] Index of the current class
- *  \param label[in]    Array of class labels for each observation
- *  \param P[in]        Matrix of probabilities of size nc x n
- *  \param thrW[in]     Threshold for weight calculations
- *  \param w[out]       Array of weights of size n
- *  \param thrZ[in]     Threshold for responses calculations
- *  \param w[out]       Array of responses of size n
+ *  \param n[in]            Number of observations in training data set
+ *  \param nc[in]           Number of classes in training data set
+ *  \param curClass[in]     Index of the current class
+ *  \param label[in]        Array of class labels for each observation
+ *  \param P[in]            Matrix of probabilities of size nc x n
+ *  \param thrW[in]         Threshold for weight calculations
+ *  \param w[out]           Array of weights of size n
+ *  \param thrZ[in]         Threshold for responses calculations
+ *  \param z[out]           Array of responses of size n
+ *  \param partialSums[in]  Buffer for the partial sums of the blocks of observations
  */
 template<typename algorithmFPType, CpuType cpu>
 void initWZ(size_t n, size_t nc, size_t curClass, int *label, algorithmFPType *P,
-            algorithmFPType thrW, algorithmFPType *w, algorithmFPType thrZ, algorithmFPType *z)
+            algorithmFPType thrW, algorithmFPType *w, algorithmFPType thrZ, algorithmFPType *z,
+            algorithmFPType *partialSums)
 {
+    using namespace daal::algorithms::boosting::internal;
 
     algorithmFPType sumW = 0.0;
     algorithmFPType invSumW;
@@ -79,53 +85,85 @@ void initWZ(size_t n, size_t nc, size_t curClass, int *label, algorithmFPType *P
     int iCurClass = (int)curClass;
     algorithmFPType *Pptr = P + curClass * n;
 
-    for ( size_t i = 0; i < n; i++ )
+    size_t nBlocks = getNumberOfBlocks(n);
+    daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
     {
-        algorithmFPType p = Pptr[i];
-        w[i] = p * (one - p);
-        if (thrW > w[i]) { w[i] = thrW; }
-        sumW += w[i];
+        size_t startRow = iBlock * nRowsInBlock;
+        size_t nRows = getNumberOfRowsInBlock(n, iBlock);
+        algorithmFPType sumWBlock = 0.0;
 
-        if (label[i] == iCurClass)
+        for ( size_t i = startRow; i < startRow + nRows; i++ )
         {
-            if (p > thrZ) { z[i] = one / p; }
-            else { z[i] = three; }
-        }
-        else
-        {
-            if (one - p > thrZ) { z[i] = -one / (one - p); }
-            else { z[i] = negThree; }
+            algorithmFPType p = Pptr[i];
+            w[i] = p * (one - p);
+            if (thrW > w[i]) { w[i] = thrW; }
+            sumWBlock += w[i];
+
+            if (label[i] == iCurClass)
+            {
+                if (p > thrZ) { z[i] = one / p; }
+                else { z[i] = three; }
+            }
+            else
+            {
+                if (one - p > thrZ) { z[i] = -one / (one - p); }
+                else { z[i] = negThree; }
+            }
         }
-    }
+        partialSums[iBlock] = sumWBlock;
+    } );
 
+    sumPartialResults<algorithmFPType>(nBlocks, 1, partialSums, &sumW);
     invSumW = one / sumW;
-    for ( size_t i = 0; i < n; i++ )
+    daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
     {
-        w[i] *= invSumW;
-    }
+        size_t startRow = iBlock * nRowsInBlock;
+        size_t nRows = getNumberOfRowsInBlock(n, iBlock);
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for ( size_t i = startRow; i < startRow + nRows; i++ )
+        {
+            w[i] *= invSumW;
+        }
+    } );
 }
 
 /**
- *  \brief Calculate training accuracy
+ *  \brief Calculate training accuracy.
+ *         The observations are processed by blocks in parallel
  *
- *  \param n[in]        Number of observations
- *  \param nc[in]       Number of classes
- *  \param y_label[in]  Classes labels
- *  \param P[in]        Array of probabilities of size nc x n
- *  \param lCurPtr[out] Log-likelihood of the model
- *  \param accPtr[out]  Training accuracy
+ *  \param n[in]            Number of observations
+ *  \param nc[in]           Number of classes
+ *  \param y_label[in]      Classes labels
+ *  \param P[in]            Array of probabilities of size nc x n
+ *  \param lCurPtr[out]     Log-likelihood of the model
+ *  \param accPtr[out]      Training accuracy
+ *  \param partialSums[in]  Buffer for the partial sums of the blocks of observations
  */
 template<typename algorithmFPType, CpuType cpu>
 void calculateAccuracy( size_t n, size_t nc, int *y_label, algorithmFPType *P,
-                        algorithmFPType *lCurPtr, algorithmFPType *accPtr )
+                        algorithmFPType *lCurPtr, algorithmFPType *accPtr, algorithmFPType *partialSums )
 {
+    using namespace daal::algorithms::boosting::internal;
+
     algorithmFPType acc, diff;
     algorithmFPType lPrev = *lCurPtr;
     algorithmFPType lCur = 0.0;
-    for ( size_t i = 0; i < n; i++)
+
+    size_t nBlocks = getNumberOfBlocks(n);
+    daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
     {
-        lCur -= daal::internal::Math<algorithmFPType,cpu>::sLog(P[y_label[i] * n + i]);
-    }
+        size_t startRow = iBlock * nRowsInBlock;
+        size_t nRows = getNumberOfRowsInBlock(n, iBlock);
+        algorithmFPType lBlock = 0.0;
+        for ( size_t i = startRow; i < startRow + nRows; i++)
+        {
+            lBlock -= daal::internal::Math<algorithmFPType,cpu>::sLog(P[y_label[i] * n + i]);
+        }
+        partialSums[iBlock] = lBlock;
+    } );
+    sumPartialResults<algorithmFPType>(nBlocks, 1, partialSums, &lCur);
+
     diff = daal::internal::Math<algorithmFPType,cpu>::sFabs(lPrev - lCur);
     acc  = daal::internal::Math<algorithmFPType,cpu>::sMin( diff, diff / (lPrev + (algorithmFPType)1e-6) );
     *accPtr = acc;
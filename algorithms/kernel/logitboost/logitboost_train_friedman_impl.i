@@ -68,7 +68,7 @@ void LogitBoostTrainKernel<friedman, algorithmFPType, cpu>::compute(const size_t
     algorithmFPType thrW, thrZ;
     algorithmFPType logL = 0.0;
 
-    algorithmFPType *pred, *F, *P, *Fbuf;
+    algorithmFPType *pred, *F, *P, *Fbuf, *partialSums;
     algorithmFPType inv_n, inv_nc;
     algorithmFPType fp_one = (algorithmFPType)1.0;
     Parameter *parameter = const_cast<Parameter *>(par);
@@ -84,13 +84,22 @@ void LogitBoostTrainKernel<friedman, algorithmFPType, cpu>::compute(const size_t
     dim = x->getNumberOfColumns();
     n   = x->getNumberOfRows();
 
+    /* Buffers for the processing of the observations by blocks */
+    const size_t nBlocks = daal::algorithms::boosting::internal::getNumberOfBlocks(n);
+
     pred = (algorithmFPType *) daal::services::daal_malloc (n * nc * sizeof(algorithmFPType));
     F    = (algorithmFPType *) daal::services::daal_malloc (n * nc * sizeof(algorithmFPType));
-    Fbuf = (algorithmFPType *) daal::services::daal_malloc (    nc * sizeof(algorithmFPType));
+    Fbuf = (algorithmFPType *) daal::services::daal_malloc (nBlocks * nc * sizeof(algorithmFPType));
     P    = (algorithmFPType *) daal::services::daal_malloc (n * nc * sizeof(algorithmFPType));
+    partialSums = (algorithmFPType *) daal::services::daal_malloc (nBlocks * sizeof(algorithmFPType));
 
-    if (!pred || !F || !P || !Fbuf)
+    if (!pred || !F || !P || !Fbuf || !partialSums)
     {
+        if (pred) { daal::services::daal_free (pred); }
+        if (F) { daal::services::daal_free (F); }
+        if (Fbuf) { daal::services::daal_free (Fbuf); }
+        if (P) { daal::services::daal_free (P); }
+        if (partialSums) { daal::services::daal_free (partialSums); }
         this->_errors->add(services::ErrorMemoryAllocationFailed); return;
     }
     services::SharedPtr<daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu> > wTable(
@@ -123,7 +132,9 @@ void LogitBoostTrainKernel<friedman, algorithmFPType, cpu>::compute(const size_t
     y->getBlockOfColumnValues( 0, 0, n, readOnly, block );
     y_label = block.getBlockPtr();
 
-    services::SharedPtr<weak_learner::training::Batch>   learnerTrain   = parameter->weakLearnerTraining;
+    /* The weak learner is copied for the training call, so that the data it caches between the iterations,
+       such as the bins of the binned stump, does not outlive the call */
+    services::SharedPtr<weak_learner::training::Batch>   learnerTrain   = parameter->weakLearnerTraining->clone();
     learnerTrain->getErrors()->setCanThrow(false);
     learnerTrain->input.set(classifier::training::data,    x);
     learnerTrain->input.set(classifier::training::labels,  zTable);
@@ -143,7 +154,7 @@ void LogitBoostTrainKernel<friedman, algorithmFPType, cpu>::compute(const size_t
            Step 2.a) of the Algorithm 6 from [1] */
         for ( size_t j = 0; j < nc; j++ )
         {
-            initWZ<algorithmFPType, cpu>(n, nc, j, y_label, P, thrW, w, thrZ, z);
+            initWZ<algorithmFPType, cpu>(n, nc, j, y_label, P, thrW, w, thrZ, z, partialSums);
 
             learnerTrain->resetResult();
             learnerTrain->computeNoThrow();
@@ -153,6 +164,7 @@ void LogitBoostTrainKernel<friedman, algorithmFPType, cpu>::compute(const size_t
                 daal::services::daal_free (F);
                 daal::services::daal_free (Fbuf);
                 daal::services::daal_free (P);
+                daal::services::daal_free (partialSums);
                 this->_errors->add(learnerTrain->getErrors()->getErrors());
                 return;
             }
@@ -177,6 +189,7 @@ void LogitBoostTrainKernel<friedman, algorithmFPType, cpu>::compute(const size_t
                 daal::services::daal_free (F);
                 daal::services::daal_free (Fbuf);
                 daal::services::daal_free (P);
+                daal::services::daal_free (partialSums);
                 this->_errors->add(learnerTrain->getErrors()->getErrors());
                 return;
             }
@@ -192,7 +205,7 @@ void LogitBoostTrainKernel<friedman, algorithmFPType, cpu>::compute(const size_t
         UpdateP<algorithmFPType, cpu>( nc, n, F, P, Fbuf );
 
         /* Calculate model accuracy */
-        calculateAccuracy<algorithmFPType, cpu>( n, nc, y_label, P, &logL, &accCur );
+        calculateAccuracy<algorithmFPType, cpu>( n, nc, y_label, P, &logL, &accCur, partialSums );
 
         if (accCur < acc)
         {
@@ -207,6 +220,7 @@ void LogitBoostTrainKernel<friedman, algorithmFPType, cpu>::compute(const size_t
     daal::services::daal_free (F);
     daal::services::daal_free (Fbuf);
     daal::services::daal_free (P);
+    daal::services::daal_free (partialSums);
 }
 
 } // namepsace internal
@@ -89,6 +89,13 @@ void OnlineContainer<algorithmFPType, method, cpu>::compute()
     Parameter *par = static_cast<Parameter *>(_par);
     daal::services::Environment::env &env = *_env;
 
+    if (par->windowSize || par->decayFactor != 1.0)
+    {
+        __DAAL_CALL_KERNEL(env, internal::LowOrderMomentsOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),    \
+                computeWindowed, dataTable, partialResult, par);
+        return;
+    }
+
     __DAAL_CALL_KERNEL(env, internal::LowOrderMomentsOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),    \
             compute, dataTable, partialResult, par, isOnline);
 }
@@ -148,6 +155,13 @@ void DistributedContainer<step1Local, algorithmFPType, method, cpu>::compute()
     Parameter *par = static_cast<Parameter *>(_par);
     daal::services::Environment::env &env = *_env;
 
+    if (par->windowSize || par->decayFactor != 1.0)
+    {
+        __DAAL_CALL_KERNEL(env, internal::LowOrderMomentsOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),    \
+                computeWindowed, dataTable, partialResult, par);
+        return;
+    }
+
     __DAAL_CALL_KERNEL(env, internal::LowOrderMomentsOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),    \
             compute, dataTable, partialResult, par, isOnline);
 }
@@ -864,6 +864,216 @@ void mergeSums( data_management::DataCollection *partialResultsCollection,
         sumBD, sumSqBD, sumSqCenBD);
 }
 
+/****************************************************************************************************************************/
+/* Multiplies the weighted partial results by the weight. Minimum and maximum are not weighted */
+template<typename algorithmFPType, CpuType cpu>
+void scalePartialResults( size_t nFeatures, algorithmFPType weight, algorithmFPType **resultArray )
+{
+    algorithmFPType *sums     = resultArray[(int)partialSum];
+    algorithmFPType *sumSq    = resultArray[(int)partialSumSquares];
+    algorithmFPType *sumSqCen = resultArray[(int)partialSumSquaresCentered];
+
+   PRAGMA_IVDEP
+   PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        sums[i]     *= weight;
+        sumSq[i]    *= weight;
+        sumSqCen[i] *= weight;
+    }
+    resultArray[(int)nObservations][0] *= weight;
+}
+
+/****************************************************************************************************************************/
+/* Adds the weighted partial results of the block stored as the row of the window to the partial results.
+   Negative weight removes the block. Returns false if the removal cancels too many significant digits
+   of the sum of squared differences from the means */
+template<typename algorithmFPType, CpuType cpu>
+bool mergeWeightedPartialResults( size_t nFeatures, algorithmFPType weight, const algorithmFPType *block,
+                                  algorithmFPType **resultArray )
+{
+    const algorithmFPType *blockSums     = block + 1 + ((int)partialSum - 1) * nFeatures;
+    const algorithmFPType *blockSumSq    = block + 1 + ((int)partialSumSquares - 1) * nFeatures;
+    const algorithmFPType *blockSumSqCen = block + 1 + ((int)partialSumSquaresCentered - 1) * nFeatures;
+
+    algorithmFPType *sums     = resultArray[(int)partialSum];
+    algorithmFPType *sumSq    = resultArray[(int)partialSumSquares];
+    algorithmFPType *sumSqCen = resultArray[(int)partialSumSquaresCentered];
+
+    algorithmFPType blockNObs = weight * block[0];
+    if (blockNObs == 0) { return true; }
+
+    algorithmFPType nObs    = resultArray[(int)nObservations][0];
+    algorithmFPType newNObs = nObs + blockNObs;
+
+    /* The removed block holds all the remaining observations */
+    if (newNObs <= nObs * (algorithmFPType)1e-10)
+    {
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            sums[i]     = 0.0;
+            sumSq[i]    = 0.0;
+            sumSqCen[i] = 0.0;
+        }
+        resultArray[(int)nObservations][0] = 0.0;
+        return true;
+    }
+
+    /* Relative size of the sum of squared differences below which the downdated value is not trusted,
+       approximately the square root of the machine epsilon */
+    const algorithmFPType threshold = (sizeof(algorithmFPType) == sizeof(float) ? (algorithmFPType)3e-4 : (algorithmFPType)1.5e-8);
+
+    algorithmFPType invBlockNObs = 1.0 / blockNObs;
+    algorithmFPType invNObs      = (nObs != 0 ? 1.0 / nObs : 0.0);
+    algorithmFPType invNewNObs   = 1.0 / newNObs;
+
+    bool isPrecise = true;
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        algorithmFPType blockSum = weight * blockSums[i];
+        algorithmFPType newSum   = sums[i] + blockSum;
+
+        algorithmFPType value = sumSqCen[i] + weight * blockSumSqCen[i];
+        if (nObs != 0)
+        {
+            value += blockSum * blockSum * invBlockNObs + sums[i] * sums[i] * invNObs - newSum * newSum * invNewNObs;
+        }
+        if (weight < 0 && (value < 0 || value < threshold * sumSqCen[i])) { isPrecise = false; }
+
+        sumSqCen[i] = value;
+        sums[i]     = newSum;
+        sumSq[i]   += weight * blockSumSq[i];
+    }
+    resultArray[(int)nObservations][0] = newNObs;
+    return isPrecise;
+}
+
+/****************************************************************************************************************************/
+/* The counters table holds the index of the next block and the number of the blocks removed since
+   the last recomputation. Row k % windowSize of the window table holds the number of observations and the partial results
+   of the block k in the order of PartialResultId */
+template<typename algorithmFPType, CpuType cpu>
+void updateWindowedPartialResults( size_t nFeatures, const algorithmFPType *block, PartialResult *partialResult,
+                                   const Parameter *parameter )
+{
+    NumericTablePtr resultTable[nPartialResults];
+    BlockDescriptor<algorithmFPType> resultBD[nPartialResults];
+    algorithmFPType *resultArray[nPartialResults];
+
+    for (size_t i = 0; i < nPartialResults; i++)
+    {
+        resultTable[i] = partialResult->get((PartialResultId)i);
+        resultTable[i]->getBlockOfRows(0, 1, readWrite, resultBD[i]);
+        resultArray[i] = resultBD[i].getBlockPtr();
+    }
+
+    const algorithmFPType decayFactor = (algorithmFPType)parameter->decayFactor;
+    if (decayFactor != (algorithmFPType)1.0)
+    {
+        scalePartialResults<algorithmFPType, cpu>(nFeatures, decayFactor, resultArray);
+    }
+
+    const bool computeMinMax = (parameter->estimatesToCompute != estimatesMeanVariance);
+    const algorithmFPType *blockMin = block + 1 + ((int)partialMinimum - 1) * nFeatures;
+    const algorithmFPType *blockMax = block + 1 + ((int)partialMaximum - 1) * nFeatures;
+    algorithmFPType *min = resultArray[(int)partialMinimum];
+    algorithmFPType *max = resultArray[(int)partialMaximum];
+
+    NumericTable *windowTable = partialResult->get(partialWindowStatistics).get();
+    if (!windowTable)
+    {
+        mergeWeightedPartialResults<algorithmFPType, cpu>(nFeatures, 1.0, block, resultArray);
+        if (computeMinMax)
+        {
+            for (size_t i = 0; i < nFeatures; i++)
+            {
+                if (blockMin[i] < min[i]) { min[i] = blockMin[i]; }
+                if (blockMax[i] > max[i]) { max[i] = blockMax[i]; }
+            }
+        }
+    }
+    else
+    {
+        const size_t windowSize = parameter->windowSize;
+        const size_t rowSize = 1 + (nPartialResults - 1) * nFeatures;
+
+        BlockDescriptor<algorithmFPType> windowBD;
+        windowTable->getBlockOfRows(0, windowSize, readWrite, windowBD);
+        algorithmFPType *window = windowBD.getBlockPtr();
+
+        NumericTable *countersTable = partialResult->get(partialWindowCounters).get();
+        BlockDescriptor<int> countersBD;
+        countersTable->getBlockOfRows(0, 1, readWrite, countersBD);
+        int *counters = countersBD.getBlockPtr();
+
+        const size_t nBlocks = (size_t)counters[0];
+        algorithmFPType *slot = window + (nBlocks % windowSize) * rowSize;
+
+        /* Remove the block that leaves the window, its weight was multiplied by the decay factor windowSize times */
+        bool recompute = false;
+        if (nBlocks >= windowSize)
+        {
+            algorithmFPType weight = Math<algorithmFPType, cpu>::sPowx(decayFactor, (algorithmFPType)windowSize);
+            bool isPrecise = mergeWeightedPartialResults<algorithmFPType, cpu>(nFeatures, -weight, slot, resultArray);
+
+            counters[1]++;
+            recompute = !isPrecise || (parameter->recomputeInterval && (size_t)counters[1] >= parameter->recomputeInterval);
+        }
+
+        /* Store the new block in the window */
+        daal_memcpy_s(slot, rowSize * sizeof(algorithmFPType), block, rowSize * sizeof(algorithmFPType));
+        /* Once the window is full only the position in the window matters, so the counter stays below 2 * windowSize */
+        counters[0] = (int)(nBlocks + 1 < 2 * windowSize ? nBlocks + 1 : nBlocks + 1 - windowSize);
+
+        const size_t nStoredBlocks = (nBlocks + 1 < windowSize ? nBlocks + 1 : windowSize);
+        if (!recompute)
+        {
+            mergeWeightedPartialResults<algorithmFPType, cpu>(nFeatures, 1.0, block, resultArray);
+        }
+        else
+        {
+            /* Recompute the partial results from the blocks in the window, from the oldest to the newest */
+            scalePartialResults<algorithmFPType, cpu>(nFeatures, 0.0, resultArray);
+            for (size_t k = 0; k < nStoredBlocks; k++)
+            {
+                const algorithmFPType *blockSlot = window + ((nBlocks + 1 + k) % windowSize) * rowSize;
+                algorithmFPType weight = Math<algorithmFPType, cpu>::sPowx(decayFactor, (algorithmFPType)(nStoredBlocks - 1 - k));
+                mergeWeightedPartialResults<algorithmFPType, cpu>(nFeatures, weight, blockSlot, resultArray);
+            }
+            counters[1] = 0;
+        }
+
+        /* Minimum and maximum cannot be downdated, they are recomputed over the blocks in the window */
+        if (computeMinMax)
+        {
+            for (size_t i = 0; i < nFeatures; i++)
+            {
+                min[i] = blockMin[i];
+                max[i] = blockMax[i];
+            }
+            for (size_t k = 0; k < nStoredBlocks; k++)
+            {
+                const algorithmFPType *blockSlot = window + k * rowSize;
+                const algorithmFPType *slotMin = blockSlot + 1 + ((int)partialMinimum - 1) * nFeatures;
+                const algorithmFPType *slotMax = blockSlot + 1 + ((int)partialMaximum - 1) * nFeatures;
+                for (size_t i = 0; i < nFeatures; i++)
+                {
+                    if (slotMin[i] < min[i]) { min[i] = slotMin[i]; }
+                    if (slotMax[i] > max[i]) { max[i] = slotMax[i]; }
+                }
+            }
+        }
+
+        countersTable->releaseBlockOfRows(countersBD);
+        windowTable->releaseBlockOfRows(windowBD);
+    }
+
+    for (size_t i = 0; i < nPartialResults; i++)
+    {
+        resultTable[i]->releaseBlockOfRows(resultBD[i]);
+    }
+}
+
 /****************************************************************************************************************************/
 template<typename algorithmFPType, CpuType cpu>
 void finalize( LowOrderMomentsFinalizeTask<algorithmFPType, cpu> &task )
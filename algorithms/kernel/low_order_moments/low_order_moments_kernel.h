@@ -54,6 +54,9 @@ public:
     void compute(NumericTable *dataTable, PartialResult *partialResult,
             const Parameter *parameter, bool isOnline);
 
+    void computeWindowed(NumericTable *dataTable, PartialResult *partialResult,
+            const Parameter *parameter);
+
     void finalizeCompute(NumericTable *nObservationsTable,
             NumericTable *sumTable, NumericTable *sumSqTable, NumericTable *sumSqCenTable,
             NumericTable *meanTable, NumericTable *raw2MomTable, NumericTable *varianceTable,
@@ -144,7 +147,7 @@ struct LowOrderMomentsFinalizeTask
     NumericTable *stDevTable;
     NumericTable *variationTable;
 
-    BlockDescriptor<int> nObservationsBD;
+    BlockDescriptor<algorithmFPType> nObservationsBD;
     BlockDescriptor<algorithmFPType> sumBD;
     BlockDescriptor<algorithmFPType> sumSqBD;
     BlockDescriptor<algorithmFPType> sumSqCenBD;
@@ -155,7 +158,7 @@ struct LowOrderMomentsFinalizeTask
     BlockDescriptor<algorithmFPType> stDevBD;
     BlockDescriptor<algorithmFPType> variationBD;
 
-    int *nObservations;
+    algorithmFPType *nObservations;
     algorithmFPType *sums;
     algorithmFPType *sumSq;
     algorithmFPType *sumSqCen;
@@ -105,6 +105,36 @@ void LowOrderMomentsOnlineKernel<algorithmFPType, method, cpu>::compute(
     return;
 }
 
+template<typename algorithmFPType, Method method, CpuType cpu>
+void LowOrderMomentsOnlineKernel<algorithmFPType, method, cpu>::computeWindowed(
+            NumericTable *dataTable, PartialResult *partialResult,
+            const Parameter *parameter)
+{
+    size_t nFeatures = dataTable->getNumberOfColumns();
+
+    /* Partial results of the new block are computed from scratch in the layout of the row of the window:
+       number of observations and partial results in the order of PartialResultId */
+    algorithmFPType *block = daal::services::internal::service_calloc<algorithmFPType, cpu>(1 + (nPartialResults - 1) * nFeatures);
+    if (!block) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+    PartialResult blockPartialResult;
+    blockPartialResult.set(nObservations, NumericTablePtr(new HomogenNumericTableCPU<algorithmFPType, cpu>(block, 1, 1)));
+    for (size_t i = 1; i < nPartialResults; i++)
+    {
+        blockPartialResult.set((PartialResultId)i, NumericTablePtr(
+            new HomogenNumericTableCPU<algorithmFPType, cpu>(block + 1 + (i - 1) * nFeatures, nFeatures, 1)));
+    }
+
+    compute(dataTable, &blockPartialResult, parameter, false);
+
+    if (this->_errors->size() == 0)
+    {
+        updateWindowedPartialResults<algorithmFPType, cpu>(nFeatures, block, partialResult, parameter);
+    }
+
+    daal::services::internal::service_free<algorithmFPType, cpu>(block);
+}
+
 template<typename algorithmFPType, Method method, CpuType cpu>
 void LowOrderMomentsOnlineKernel<algorithmFPType, method, cpu>::finalizeCompute(
             NumericTable *nObservationsTable,
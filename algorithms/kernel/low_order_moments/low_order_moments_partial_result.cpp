@@ -37,7 +37,7 @@ namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(PartialResult, SERIALIZATION_MOMENTS_PARTIAL_RESULT_ID);
 
-PartialResult::PartialResult() : daal::algorithms::PartialResult(nPartialResults) {}
+PartialResult::PartialResult() : daal::algorithms::PartialResult(nPartialResults + 2) {}
 
 /**
  * Gets the number of columns in the partial result of the low order %moments algorithm
@@ -92,6 +92,8 @@ void PartialResult::check(const daal::algorithms::Parameter *parameter, int meth
 
     size_t nFeatures = get(partialMinimum)->getNumberOfColumns();
     checkImpl(nFeatures);
+    if(this->_errors->size() != 0) { return; }
+    checkWindow(parameter, nFeatures);
 }
 
 /**
@@ -108,6 +110,8 @@ void PartialResult::check(const daal::algorithms::Input *input, const daal::algo
     if(!checkNumericTable(get(nObservations).get(), this->_errors.get(), nObservationsStr(), unexpectedLayouts, 0, 1, 1)) { return; }
 
     checkImpl(nFeatures);
+    if(this->_errors->size() != 0) { return; }
+    checkWindow(parameter, nFeatures);
 }
 
 void PartialResult::checkImpl(size_t nFeatures) const
@@ -123,6 +127,17 @@ void PartialResult::checkImpl(size_t nFeatures) const
     }
 }
 
+void PartialResult::checkWindow(const daal::algorithms::Parameter *parameter, size_t nFeatures) const
+{
+    const Parameter *algParameter = static_cast<const Parameter *>(parameter);
+    if(!algParameter || !algParameter->windowSize) { return; }
+
+    int unexpectedLayouts = (int)packed_mask;
+    if(!checkNumericTable(get(partialWindowStatistics).get(), this->_errors.get(), windowStatisticsStr(), unexpectedLayouts, 0,
+                          1 + (nPartialResults - 1) * nFeatures, algParameter->windowSize)) { return; }
+    checkNumericTable(get(partialWindowCounters).get(), this->_errors.get(), windowCountersStr(), unexpectedLayouts, 0, 2, 1);
+}
+
 void DefaultPartialResultInit::operator()(const Input &input, services::SharedPtr<PartialResult> &pres)
 {
     /* Initializes number of rows with zero */
@@ -169,15 +184,44 @@ void DefaultPartialResultInit::operator()(const Input &input, services::SharedPt
         nt->releaseBlockOfRows(partialEstimateBlock);
     }
     inTable->releaseBlockOfRows(firstRowBlock);
+
+    /* Initializes the window with zeros */
+    data_management::NumericTablePtr windowTable = pres->get(partialWindowStatistics);
+    if(windowTable)
+    {
+        data_management::BlockDescriptor<double> windowBlock;
+        size_t nWindowRows = windowTable->getNumberOfRows();
+        size_t windowRowSize = windowTable->getNumberOfColumns();
+        windowTable->getBlockOfRows(0, nWindowRows, data_management::writeOnly, windowBlock);
+        double *window = windowBlock.getBlockPtr();
+        for(size_t j = 0; j < nWindowRows * windowRowSize; j++)
+        {
+            window[j] = 0;
+        }
+        windowTable->releaseBlockOfRows(windowBlock);
+    }
+
+    data_management::NumericTablePtr countersTable = pres->get(partialWindowCounters);
+    if(countersTable)
+    {
+        data_management::BlockDescriptor<int> countersBlock;
+        countersTable->getBlockOfRows(0, 1, data_management::writeOnly, countersBlock);
+        int *counters = countersBlock.getBlockPtr();
+        counters[0] = 0;
+        counters[1] = 0;
+        countersTable->releaseBlockOfRows(countersBlock);
+    }
 }
 
-Parameter::Parameter(EstimatesToCompute  _estimatesToCompute) : initializationProcedure(new DefaultPartialResultInit()), estimatesToCompute(_estimatesToCompute)
+Parameter::Parameter(EstimatesToCompute  _estimatesToCompute) : estimatesToCompute(_estimatesToCompute), initializationProcedure(new DefaultPartialResultInit()),
+    windowSize(0), decayFactor(1.0), recomputeInterval(100)
 {
 }
 
 void Parameter::check() const
 {
     if(!initializationProcedure) { this->_errors->add(services::ErrorIncorrectParameter); return; }
+    DAAL_CHECK_EX(decayFactor > 0.0 && decayFactor <= 1.0, ErrorIncorrectParameter, ParameterName, decayFactorStr());
 }
 
 } // namespace interface1
@@ -43,13 +43,33 @@ DAAL_EXPORT void PartialResult::allocate(const daal::algorithms::Input *input, c
 {
     size_t nFeatures = static_cast<const InputIface *>(input)->getNumberOfColumns();
 
-    Argument::set(nObservations, data_management::NumericTablePtr(
-                      new data_management::HomogenNumericTable<size_t>(1, 1, data_management::NumericTable::doAllocate)));
+    /* Weighted number of observations of the decayed online mode is not integer */
+    const Parameter *algParameter = static_cast<const Parameter *>(parameter);
+    if(algParameter && (algParameter->windowSize || algParameter->decayFactor != 1.0))
+    {
+        Argument::set(nObservations, data_management::NumericTablePtr(
+                          new data_management::HomogenNumericTable<algorithmFPType>(1, 1, data_management::NumericTable::doAllocate)));
+    }
+    else
+    {
+        Argument::set(nObservations, data_management::NumericTablePtr(
+                          new data_management::HomogenNumericTable<size_t>(1, 1, data_management::NumericTable::doAllocate)));
+    }
     for(size_t i = 1; i < nPartialResults; i++)
     {
         Argument::set(i, data_management::NumericTablePtr(
                           new data_management::HomogenNumericTable<algorithmFPType>(nFeatures, 1, data_management::NumericTable::doAllocate)));
     }
+
+    if(algParameter && algParameter->windowSize)
+    {
+        /* One row per block of the window: number of observations and partial results of the block */
+        Argument::set(partialWindowStatistics, data_management::NumericTablePtr(
+                          new data_management::HomogenNumericTable<algorithmFPType>(1 + (nPartialResults - 1) * nFeatures,
+                                  algParameter->windowSize, data_management::NumericTable::doAllocate, algorithmFPType(0))));
+        Argument::set(partialWindowCounters, data_management::NumericTablePtr(
+                          new data_management::HomogenNumericTable<int>(2, 1, data_management::NumericTable::doAllocate, 0)));
+    }
 }
 
 }// namespace low_order_moments
@@ -0,0 +1,89 @@
+/* file: mapped_numeric_table.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the memory mapping of the files that store numeric tables in the binary format.
+//--
+*/
+
+#if defined(_WIN32) || defined(_WIN64)
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+#endif
+
+#include "mapped_numeric_table.h"
+
+namespace daal
+{
+namespace data_management
+{
+
+namespace interface1
+{
+
+MappedFile::MappedFile(const std::string &fileName) : _ptr(0), _size(0), _file(0), _mapping(0)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) { return; }
+    _file = file;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) { return; }
+
+    _mapping = CreateFileMappingA(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+    if (_mapping == NULL) { return; }
+
+    _ptr = (char *)MapViewOfFile(_mapping, FILE_MAP_COPY, 0, 0, 0);
+    if (_ptr) { _size = (size_t)fileSize.QuadPart; }
+#else
+    int fd = open(fileName.c_str(), O_RDONLY);
+    if (fd < 0) { return; }
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0)
+    {
+        void *ptr = mmap(NULL, (size_t)fileStat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (ptr != MAP_FAILED)
+        {
+            _ptr  = (char *)ptr;
+            _size = (size_t)fileStat.st_size;
+        }
+    }
+    close(fd);
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+#if defined(_WIN32) || defined(_WIN64)
+    if (_ptr) { UnmapViewOfFile(_ptr); }
+    if (_mapping) { CloseHandle((HANDLE)_mapping); }
+    if (_file) { CloseHandle((HANDLE)_file); }
+#else
+    if (_ptr) { munmap(_ptr, _size); }
+#endif
+}
+
+} // namespace interface1
+} // namespace data_management
+} // namespace daal
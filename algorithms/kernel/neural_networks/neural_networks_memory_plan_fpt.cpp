@@ -0,0 +1,321 @@
+/* file: neural_networks_memory_plan_fpt.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the memory planning for the values of the forward layers of neural network
+//--
+*/
+
+#include "neural_networks_learnable_parameters.h"
+#include "neural_networks/layers/relu/relu_layer_forward_types.h"
+#include "neural_networks/layers/smoothrelu/smoothrelu_layer_forward_types.h"
+#include "neural_networks/layers/abs/abs_layer_forward_types.h"
+#include "neural_networks/layers/prelu/prelu_layer_forward_types.h"
+#include "neural_networks/layers/tanh/tanh_layer_forward_types.h"
+#include "neural_networks/layers/logistic/logistic_layer_forward_types.h"
+#include "neural_networks/layers/dropout/dropout_layer_forward_types.h"
+#include "neural_networks/layers/softmax/softmax_layer_forward_types.h"
+#include "neural_networks/layers/batch_normalization/batch_normalization_layer_forward_types.h"
+#include "mkl_tensor.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace neural_networks
+{
+namespace internal
+{
+
+using namespace daal::services;
+using namespace daal::data_management;
+using namespace daal::algorithms::neural_networks::layers;
+
+/* Layers that use their input as the value on the prediction stage and overwrite it.
+   The dropout layer also uses its input as the value but does not modify it on the prediction stage */
+static bool isInPlaceOnPrediction(forward::Result *result)
+{
+    return dynamic_cast<relu::forward::Result *>(result) || dynamic_cast<smoothrelu::forward::Result *>(result) ||
+           dynamic_cast<abs::forward::Result *>(result) || dynamic_cast<prelu::forward::Result *>(result) ||
+           dynamic_cast<tanh::forward::Result *>(result) || dynamic_cast<logistic::forward::Result *>(result) ||
+           dynamic_cast<softmax::forward::Result *>(result) || dynamic_cast<batch_normalization::forward::Result *>(result);
+}
+
+/* Element-wise layers whose backward stage does not need their input */
+static bool isInPlaceOnTraining(forward::Result *result)
+{
+    return dynamic_cast<tanh::forward::Result *>(result) || dynamic_cast<logistic::forward::Result *>(result) ||
+           dynamic_cast<dropout::forward::Result *>(result);
+}
+
+/* Checks whether the allocated result keeps the tensor for the backward stage.
+   The result is only read: the data for the backward stage is set when the result is allocated */
+static bool isUsedForBackward(const forward::Result *result, const Tensor *tensor)
+{
+    LayerDataPtr layerData = result->get(forward::resultForBackward);
+    if (!layerData) { return false; }
+
+    for (size_t i = 0; i < layerData->size(); i++)
+    {
+        if (dynamic_cast<Tensor *>(layerData->getValueByIndex((int)i).get()) == tensor) { return true; }
+    }
+    return false;
+}
+
+/* Kind of the tensor that can be shared by the layers: 1 for HomogenTensor, 2 for MklTensor, 0 otherwise */
+template<typename modelFPType>
+static int getReusableTensorKind(const Tensor *tensor)
+{
+    if (dynamic_cast<const HomogenTensor<modelFPType> *>(tensor))          { return 1; }
+    if (dynamic_cast<const daal::internal::MklTensor<modelFPType> *>(tensor)) { return 2; }
+    return 0;
+}
+
+static bool haveSameDimensions(const Tensor *a, const Tensor *b)
+{
+    const Collection<size_t> &dimsA = a->getDimensions();
+    const Collection<size_t> &dimsB = b->getDimensions();
+    if (dimsA.size() != dimsB.size()) { return false; }
+    for (size_t i = 0; i < dimsA.size(); i++)
+    {
+        if (dimsA[i] != dimsB[i]) { return false; }
+    }
+    return true;
+}
+
+/* Lifetime of the tensor in the steps of the computation: from the first step that computes it to the last step that uses it */
+struct TensorLifetime
+{
+    const Tensor *tensor;
+    size_t size;
+    size_t first;
+    size_t last;
+};
+
+static void updateLifetime(Collection<TensorLifetime> &lifetimes, const Tensor *tensor, size_t size, size_t step)
+{
+    for (size_t i = 0; i < lifetimes.size(); i++)
+    {
+        if (lifetimes[i].tensor == tensor)
+        {
+            if (step < lifetimes[i].first) { lifetimes[i].first = step; }
+            if (step > lifetimes[i].last)  { lifetimes[i].last  = step; }
+            return;
+        }
+    }
+    TensorLifetime lifetime;
+    lifetime.tensor = tensor;
+    lifetime.size   = size;
+    lifetime.first  = step;
+    lifetime.last   = step;
+    lifetimes.push_back(lifetime);
+}
+
+/* Tensors used as the values of the forward layers: the layers that compute them and the layers that use them */
+class ForwardValues
+{
+public:
+    ForwardValues(ForwardLayers *forwardLayers, Collection<NextLayers> *nextLayers) :
+        _forwardLayers(forwardLayers), _nextLayers(nextLayers) {}
+
+    /* Returns the index of the last layer among the first nLayers layers that uses the tensor.
+       The network output is used after all layers */
+    size_t getLastConsumer(const Tensor *tensor, size_t nLayers, size_t *nProducers = 0, size_t *nConsumers = 0) const
+    {
+        size_t lastConsumer = 0;
+        if (nProducers) { *nProducers = 0; }
+        if (nConsumers) { *nConsumers = 0; }
+        for (size_t i = 0; i < nLayers; i++)
+        {
+            SharedPtr<forward::Result> result = _forwardLayers->get(i)->getLayerResult();
+            if (!result) { continue; }
+
+            const NextLayers &next = _nextLayers->get(i);
+            bool isProducer = false;
+            if (next.size() == 0 && result->get(forward::value).get() == tensor)
+            {
+                isProducer = true;
+                lastConsumer = _forwardLayers->size();
+            }
+            for (size_t j = 0; j < next.size(); j++)
+            {
+                if (result->getValue(j).get() != tensor) { continue; }
+                isProducer = true;
+                if (nConsumers) { (*nConsumers)++; }
+                if (next[j] > lastConsumer) { lastConsumer = next[j]; }
+            }
+            if (isProducer && nProducers) { (*nProducers)++; }
+        }
+        return lastConsumer;
+    }
+
+    /* Returns the value of the layers computed before the layer that is not used by this or later layers
+       and matches the tensor in the kind and the dimensions */
+    template<typename modelFPType>
+    TensorPtr findDeadValue(size_t layerId, const Tensor *like) const
+    {
+        const int kind = getReusableTensorKind<modelFPType>(like);
+        if (!kind) { return TensorPtr(); }
+
+        for (size_t i = 0; i < layerId; i++)
+        {
+            SharedPtr<forward::Result> result = _forwardLayers->get(i)->getLayerResult();
+            if (!result) { continue; }
+            TensorPtr value = result->get(forward::value);
+            if (!value || value.get() == like) { continue; }
+            if (getReusableTensorKind<modelFPType>(value.get()) != kind || !haveSameDimensions(value.get(), like)) { continue; }
+            if (getLastConsumer(value.get(), layerId) < layerId) { return value; }
+        }
+        return TensorPtr();
+    }
+
+private:
+    ForwardLayers *_forwardLayers;
+    Collection<NextLayers> *_nextLayers;
+};
+
+}
+
+template<typename modelFPType>
+void DAAL_EXPORT ModelImpl::planForwardLayerResult(size_t layerId)
+{
+    using namespace services;
+    using namespace data_management;
+    using namespace layers;
+
+    forward::LayerIfacePtr forwardLayer = _forwardLayers->get(layerId);
+    SharedPtr<forward::Result> result = forwardLayer->getLayerResult();
+    if (!result || result->get(forward::value)) { return; }
+
+    internal::ForwardValues values(_forwardLayers.get(), _nextLayers.get());
+    const bool predictionStage = forwardLayer->getLayerParameter()->predictionStage;
+    const bool inPlace = (predictionStage ? internal::isInPlaceOnPrediction(result.get()) : internal::isInPlaceOnTraining(result.get()));
+    TensorPtr input = forwardLayer->getLayerInput()->get(forward::data);
+
+    if (!inPlace || !input)
+    {
+        /* On the prediction stage the value takes the buffer of a value that no layer uses any more */
+        if (!predictionStage) { return; }
+        forwardLayer->allocateResult();
+        TensorPtr value = result->get(forward::value);
+        if (!value || _nextLayers->get(layerId).size() == 0) { return; }
+        for (size_t j = 0; j < _nextLayers->get(layerId).size(); j++)
+        {
+            if (result->getValue(j).get() != value.get()) { return; }
+        }
+        TensorPtr deadValue = values.findDeadValue<modelFPType>(layerId, value.get());
+        if (deadValue) { result->set(forward::value, deadValue); }
+        return;
+    }
+
+    size_t nProducers = 0, nConsumers = 0;
+    const size_t lastConsumer = values.getLastConsumer(input.get(), _forwardLayers->size(), &nProducers, &nConsumers);
+
+    if (nProducers == 0) { return; }
+    if (predictionStage)
+    {
+        /* The layer overwrites its input, so no layer computed after it may use the input */
+        TensorPtr value = input;
+        if (lastConsumer > layerId)
+        {
+            value = values.findDeadValue<modelFPType>(layerId, input.get());
+            if (!value) { value = TensorPtr(new daal::internal::MklTensor<modelFPType>(input->getDimensions())); }
+        }
+        result->set(forward::value, value);
+        return;
+    }
+
+    /* On the training stage the input of the network and the tensors needed by the backward layers stay intact */
+    if (nConsumers != 1) { return; }
+    for (size_t i = 0; i < layerId; i++)
+    {
+        SharedPtr<forward::Result> producerResult = _forwardLayers->get(i)->getLayerResult();
+        if (producerResult && internal::isUsedForBackward(producerResult.get(), input.get())) { return; }
+    }
+    result->set(forward::value, input);
+}
+
+template<typename modelFPType>
+void DAAL_EXPORT ModelImpl::computePlannedMemorySize()
+{
+    using namespace services;
+    using namespace data_management;
+    using namespace layers;
+
+    /* Forward layer i is computed at step i, its backward layer at step 2 * nLayers - i,
+       the values of the last layers are read at step nLayers */
+    const size_t nLayers = _forwardLayers->size();
+    Collection<internal::TensorLifetime> lifetimes;
+    for (size_t i = 0; i < nLayers; i++)
+    {
+        forward::LayerIfacePtr forwardLayer = _forwardLayers->get(i);
+        SharedPtr<forward::Result> result = forwardLayer->getLayerResult();
+        if (!result) { continue; }
+
+        const NextLayers &next = _nextLayers->get(i);
+        if (next.size() == 0)
+        {
+            TensorPtr value = result->get(forward::value);
+            if (!value) { continue; }
+            internal::updateLifetime(lifetimes, value.get(), value->getSize() * sizeof(modelFPType), i);
+            internal::updateLifetime(lifetimes, value.get(), value->getSize() * sizeof(modelFPType), nLayers);
+        }
+        for (size_t j = 0; j < next.size(); j++)
+        {
+            TensorPtr value = result->getValue(j);
+            if (!value) { continue; }
+            internal::updateLifetime(lifetimes, value.get(), value->getSize() * sizeof(modelFPType), i);
+            internal::updateLifetime(lifetimes, value.get(), value->getSize() * sizeof(modelFPType), next[j]);
+        }
+    }
+
+    /* On the training stage the values kept for the backward layers live until these layers are computed */
+    for (size_t i = 0; i < nLayers; i++)
+    {
+        SharedPtr<forward::Result> result = _forwardLayers->get(i)->getLayerResult();
+        if (!result || _forwardLayers->get(i)->getLayerParameter()->predictionStage) { continue; }
+        for (size_t k = 0; k < lifetimes.size(); k++)
+        {
+            if (internal::isUsedForBackward(result.get(), lifetimes[k].tensor))
+            {
+                internal::updateLifetime(lifetimes, lifetimes[k].tensor, lifetimes[k].size, 2 * nLayers - i);
+            }
+        }
+    }
+
+    _plannedMemorySize = 0;
+    for (size_t step = 0; step <= 2 * nLayers; step++)
+    {
+        size_t size = 0;
+        for (size_t i = 0; i < lifetimes.size(); i++)
+        {
+            if (lifetimes[i].first <= step && step <= lifetimes[i].last)
+            {
+                size += lifetimes[i].size;
+            }
+        }
+        if (size > _plannedMemorySize) { _plannedMemorySize = size; }
+    }
+}
+
+template DAAL_EXPORT void ModelImpl::planForwardLayerResult<DAAL_FPTYPE>(size_t layerId);
+template DAAL_EXPORT void ModelImpl::computePlannedMemorySize<DAAL_FPTYPE>();
+
+}
+}
+}
@@ -185,6 +185,10 @@ void TrainingKernelBase<algorithmFPType, cpu>::initializeBase(Tensor *data, Mode
     nSamples = data->getDimensionSize(0);
     if (nSamples < batchSizeParam) { return; }
 
+    /* The batches read ahead and the batch being processed are stored in the separate buffers */
+    nBatches = (nSamples - batchSizeParam) / batchSizeParam + 1;
+    nBuffers = (parameter->prefetchDepth < nBatches - 1 ? parameter->prefetchDepth : nBatches - 1) + 1;
+
     learnableLayerIndices = new LearnableLayerIndices(forwardLayers.get());
     if (learnableLayerIndices->getError())
     {
@@ -235,12 +239,13 @@ void TrainingKernelBase<algorithmFPType, cpu>::initializeBase(Tensor *data, Mode
     sampleSize[0] = batchSizeParam;
     sample.reset(new HomogenTensor<algorithmFPType>(sampleSize, Tensor::notAllocate));
 
-    /* Initialize buffers to manage reading memory operations for the ground truth input tensors */
-    groundTruthTensors = new ReadSubtensor<algorithmFPType, cpu>[nLastLayers];
+    /* Initialize buffers to manage reading memory operations for the input data and ground truth tensors */
+    dataTensors = new ReadSubtensor<algorithmFPType, cpu>[nBuffers];
+    groundTruthTensors = new ReadSubtensor<algorithmFPType, cpu>[nLastLayers * nBuffers];
 
     /* Create tensors to pass as input ground truth to the loss layers in neural network */
     sampleGroundTruthCollection = new HomogenTensorPtr[nLastLayers];
-    if (!sampleGroundTruthCollection || !groundTruthTensors)
+    if (!sampleGroundTruthCollection || !dataTensors || !groundTruthTensors)
     {
         resetBase();
         this->_errors->add(ErrorMemoryAllocationFailed);
@@ -277,13 +282,14 @@ void TrainingKernelBase<algorithmFPType, cpu>::computeBase(Tensor *data, Model *
     firstForwardInput->set(forward::data, sample);
     firstForwardResult->setResultForBackward(firstForwardInput);
 
-    /* Buffer that manages reading memory operations for the input data tensor */
-    ReadSubtensor<algorithmFPType, cpu> dataSubtensor(data, 0, 0, 0, 0);
-
-    for (size_t i = 0; i < nLastLayers; i++)
+    for (size_t k = 0; k < nBuffers; k++)
     {
-        TensorPtr groundTruthTensor = Tensor::cast((*groundTruthCollectionPtr)[lastLayersIndices->tensorIndex(i)]);
-        groundTruthTensors[i].set(*groundTruthTensor, 0, 0, 0, 0);
+        dataTensors[k].set(data, 0, 0, 0, 0);
+        for (size_t i = 0; i < nLastLayers; i++)
+        {
+            TensorPtr groundTruthTensor = Tensor::cast((*groundTruthCollectionPtr)[lastLayersIndices->tensorIndex(i)]);
+            groundTruthTensors[i * nBuffers + k].set(*groundTruthTensor, 0, 0, 0, 0);
+        }
     }
 
     for(size_t i = 0; i < nSolvers; i++)
@@ -292,83 +298,135 @@ void TrainingKernelBase<algorithmFPType, cpu>::computeBase(Tensor *data, Model *
         solver.setSolverOptionalResult(nnModel->getSolverOptionalArgument(i));
     }
 
-    for(size_t i = 0; i < nSamples - batchSizeParam + 1; i += batchSizeParam)
+    /* The first batches are read synchronously, then each batch is read prefetchDepth iterations ahead */
+    const size_t prefetchDepth = nBuffers - 1;
+    for (size_t b = 0; b < prefetchDepth; b++)
+    {
+        readBatch(b);
+    }
+
+    for(size_t b = 0; b < nBatches; b++)
     {
-        /* Update weights and biases of the network */
-        sample->setArray(const_cast<algorithmFPType *>(dataSubtensor.next(0, 0, i, batchSizeParam)));
-        for (size_t j = 0; j < nLastLayers; j++)
+        bool isProcessed = true;
+        if (prefetchDepth == 0 || b + prefetchDepth >= nBatches)
         {
-            HomogenTensorPtr sampleGroundTruth = HomogenTensor<algorithmFPType>::cast(sampleGroundTruthCollection[j]);
-            sampleGroundTruth->setArray(const_cast<algorithmFPType *>(groundTruthTensors[j].next(0, 0, i, batchSizeParam)));
+            if (prefetchDepth == 0) { readBatch(b); }
+            isProcessed = processBatch(b, nnModel, forwardLayers.get(), backwardLayers.get());
         }
-
-        /* Forward pass through the neural network */
-        for(size_t layerId = 0; layerId < nLayers; layerId++)
+        else
         {
-            layers::forward::LayerIfacePtr forwardLayer = forwardLayers->get(layerId);
-            forwardLayer->computeNoThrow();
-            if (!processLayerErrors(layerId, forwardLayer->getErrors()->getErrors(), this->_errors))
+            /* The batch b + prefetchDepth is read into the buffer of the batch b - 1 while the batch b is processed */
+            ForwardLayers *forwardLayersPtr = forwardLayers.get();
+            BackwardLayers *backwardLayersPtr = backwardLayers.get();
+            daal::threader_for(2, 2, [ =, &isProcessed ](int task)
             {
-                resetBase();
-                return;
-            }
+                if (task == 0)
+                {
+                    isProcessed = processBatch(b, nnModel, forwardLayersPtr, backwardLayersPtr);
+                }
+                else
+                {
+                    readBatch(b + prefetchDepth);
+                }
+            });
+        }
+
+        if (!isProcessed)
+        {
+            resetBase();
+            return;
+        }
+    }
+    for(size_t i = 0; i < nSolvers; i++)
+    {
+        Solver<algorithmFPType> &solver = solvers[i];
+        nnModel->setSolverOptionalArgument(solver.getSolverOptionalResult(), i);
+    }
+}
+
+template<typename algorithmFPType, CpuType cpu>
+void TrainingKernelBase<algorithmFPType, cpu>::readBatch(size_t batchIdx)
+{
+    const size_t k = batchIdx % nBuffers;
+    dataTensors[k].next(0, 0, batchIdx * batchSizeParam, batchSizeParam);
+    for (size_t j = 0; j < nLastLayers; j++)
+    {
+        groundTruthTensors[j * nBuffers + k].next(0, 0, batchIdx * batchSizeParam, batchSizeParam);
+    }
+}
+
+template<typename algorithmFPType, CpuType cpu>
+bool TrainingKernelBase<algorithmFPType, cpu>::processBatch(size_t batchIdx, Model *nnModel,
+                                                            ForwardLayers *forwardLayers, BackwardLayers *backwardLayers)
+{
+    using namespace optimization_solver;
+
+    const size_t k = batchIdx % nBuffers;
+    sample->setArray(const_cast<algorithmFPType *>(dataTensors[k].get()));
+    for (size_t j = 0; j < nLastLayers; j++)
+    {
+        HomogenTensorPtr sampleGroundTruth = HomogenTensor<algorithmFPType>::cast(sampleGroundTruthCollection[j]);
+        sampleGroundTruth->setArray(const_cast<algorithmFPType *>(groundTruthTensors[j * nBuffers + k].get()));
+    }
+
+    /* Forward pass through the neural network */
+    for(size_t layerId = 0; layerId < nLayers; layerId++)
+    {
+        layers::forward::LayerIfacePtr forwardLayer = forwardLayers->get(layerId);
+        forwardLayer->computeNoThrow();
+        if (!processLayerErrors(layerId, forwardLayer->getErrors()->getErrors(), this->_errors))
+        {
+            return false;
+        }
+    }
+
+    /* Backward pass through the neural network */
+    for(int layerId = nLayers - 1; layerId >= 0; layerId--)
+    {
+        layers::backward::LayerIfacePtr backwardLayer = backwardLayers->get(layerId);
+        backwardLayer->computeNoThrow();
+        if (!processLayerErrors(layerId, backwardLayer->getErrors()->getErrors(), this->_errors))
+        {
+            return false;
         }
+    }
 
-        /* Backward pass through the neural network */
-        for(int layerId = nLayers - 1; layerId >= 0; layerId--)
+    /* Update weights and biases of the network */
+    if (isBatch)
+    {
+        if (oneTableForAllWeights)
         {
-            layers::backward::LayerIfacePtr backwardLayer = backwardLayers->get(layerId);
-            backwardLayer->computeNoThrow();
-            if (!processLayerErrors(layerId, backwardLayer->getErrors()->getErrors(), this->_errors))
+            Solver<algorithmFPType> &solver = solvers[0];
+            SharedPtr<KernelErrorCollection> solverErrors = solver.updateWeightsAndBiases(
+                nnModel->getWeightsAndBiases(), nnModel->getWeightsAndBiasesDerivatives());
+            if(solverErrors->size() != 0)
             {
-                resetBase();
-                return;
+                this->_errors->add(solverErrors);
+                return false;
             }
+            nnModel->setWeightsAndBiases(solver.getMinimum());
         }
-
-        /* Update weights and biases of the network */
-        if (isBatch)
+        else
         {
-            if (oneTableForAllWeights)
+            for(size_t i = 0; i < nSolvers; i++)
             {
-                Solver<algorithmFPType> &solver = solvers[0];
+                size_t layerId = learnableLayerIndices->layerIndex(i);
+                Solver<algorithmFPType> &solver = solvers[i];
+
                 SharedPtr<KernelErrorCollection> solverErrors = solver.updateWeightsAndBiases(
-                    nnModel->getWeightsAndBiases(), nnModel->getWeightsAndBiasesDerivatives());
+                    nnModel->getWeightsAndBiases(layerId), nnModel->getWeightsAndBiasesDerivatives(layerId));
+
                 if(solverErrors->size() != 0)
                 {
-                    resetBase();
                     this->_errors->add(solverErrors);
-                    return;
+                    return false;
                 }
-                nnModel->setWeightsAndBiases(solver.getMinimum());
-            }
-            else
-            {
-                for(size_t i = 0; i < nSolvers; i++)
-                {
-                    size_t layerId = learnableLayerIndices->layerIndex(i);
-                    Solver<algorithmFPType> &solver = solvers[i];
 
-                    SharedPtr<KernelErrorCollection> solverErrors = solver.updateWeightsAndBiases(
-                        nnModel->getWeightsAndBiases(layerId), nnModel->getWeightsAndBiasesDerivatives(layerId));
-
-                    if(solverErrors->size() != 0)
-                    {
-                        resetBase();
-                        this->_errors->add(solverErrors);
-                        return;
-                    }
-
-                    nnModel->setWeightsAndBiases(layerId, solver.getMinimum());
-                }
+                nnModel->setWeightsAndBiases(layerId, solver.getMinimum());
             }
         }
     }
-    for(size_t i = 0; i < nSolvers; i++)
-    {
-        Solver<algorithmFPType> &solver = solvers[i];
-        nnModel->setSolverOptionalArgument(solver.getSolverOptionalResult(), i);
-    }
+    return true;
 }
 
 template<typename algorithmFPType, CpuType cpu>
@@ -379,6 +437,7 @@ void TrainingKernelBase<algorithmFPType, cpu>::resetBase()
     if(lastLayersIndices)           { delete lastLayersIndices; lastLayersIndices = NULL; }
     if(sampleGroundTruthCollection) { delete [] sampleGroundTruthCollection; sampleGroundTruthCollection = NULL; }
     if(groundTruthTensors)          { delete [] groundTruthTensors; groundTruthTensors = NULL; }
+    if(dataTensors)                 { delete [] dataTensors; dataTensors = NULL; }
     sample.reset();
 
 }
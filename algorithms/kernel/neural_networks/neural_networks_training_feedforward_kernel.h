@@ -33,6 +33,7 @@
 #include "optimization_solver/iterative_solver/iterative_solver_batch.h"
 #include "optimization_solver/iterative_solver/iterative_solver_types.h"
 #include "service_tensor.h"
+#include "threading.h"
 #include "neural_networks_feedforward.h"
 #include "neural_networks_training_feedforward.h"
 
@@ -64,6 +65,7 @@ public:
                            lastLayersIndices(NULL),
                            solvers(NULL),
                            sampleGroundTruthCollection(NULL),
+                           dataTensors(NULL),
                            groundTruthTensors(NULL) {}
 protected:
     void initializeBase(Tensor* data, Model *nnModel, const neural_networks::training::Parameter *parameter,
@@ -71,8 +73,13 @@ protected:
     void computeBase(Tensor *data, Model *model, KeyValueDataCollectionPtr groundTruthCollectionPtr);
     void resetBase();
 private:
+    void readBatch(size_t batchIdx);
+    bool processBatch(size_t batchIdx, Model *nnModel, ForwardLayers *forwardLayers, BackwardLayers *backwardLayers);
+
     size_t nSolvers;
     size_t batchSizeParam;
+    size_t nBatches;
+    size_t nBuffers;
     size_t nLastLayers;
     size_t nLayers;
     size_t nSamples;
@@ -83,7 +90,8 @@ private:
     Solver<algorithmFPType> *solvers;
     HomogenTensorPtr sample;
     HomogenTensorPtr *sampleGroundTruthCollection;
-    ReadSubtensor<algorithmFPType, cpu> *groundTruthTensors;
+    ReadSubtensor<algorithmFPType, cpu> *dataTensors;           /* nBuffers batches of the input data */
+    ReadSubtensor<algorithmFPType, cpu> *groundTruthTensors;    /* nBuffers batches of the ground truth of each last layer */
 };
 
 /**
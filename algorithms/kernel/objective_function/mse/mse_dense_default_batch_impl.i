@@ -39,7 +39,7 @@ inline void MSEKernel<algorithmFPType, method, cpu>::compute(NumericTable *dataN
                                                              NumericTable *valueNT, NumericTable *hessianNT, NumericTable *gradientNT, Parameter *parameter)
 {
     MSETask<algorithmFPType, cpu> *task = NULL;
-    algorithmFPType *argumentArray = NULL, *dataBlock = NULL, *dependentVariablesBlock = NULL;
+    algorithmFPType *argumentArray = NULL;
     algorithmFPType *value = NULL, *gradient = NULL, *hessian = NULL;
 
     size_t nDataRows = dataNT->getNumberOfRows();
@@ -58,9 +58,40 @@ inline void MSEKernel<algorithmFPType, method, cpu>::compute(NumericTable *dataN
 
     task->setResultValuesToZero(&value, &gradient, &hessian);
 
-    size_t blockSize = blockSizeDefault;
     size_t nBlocks = task->batchSize / blockSizeDefault;
     nBlocks += (nBlocks * blockSizeDefault != task->batchSize);
+
+    /* On one thread the blocks are processed serially in the order of the summation of the original algorithm */
+    if(nBlocks > 1 && threader_get_threads_number() > 1)
+    {
+        computeParallel(task, argumentArray, nBlocks, value, gradient, hessian);
+    }
+    else
+    {
+        computeSerial(task, argumentArray, nBlocks, value, gradient, hessian);
+    }
+    if(task->error.id() != NoErrorMessageFound) {this->_errors->add(task->error.id()); task->releaseResultValues(); delete task; return;}
+
+    if (task->hessianFlag)
+    {
+        symmetrizeHessian(task, hessian);
+    }
+
+    normalizeResults(task, value, gradient, hessian);
+
+    task->releaseResultValues();
+
+    delete task;
+
+    return;
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void MSEKernel<algorithmFPType, method, cpu>::computeSerial(MSETask<algorithmFPType, cpu> *task, algorithmFPType *argumentArray, size_t nBlocks,
+                                                            algorithmFPType *value, algorithmFPType *gradient, algorithmFPType *hessian)
+{
+    algorithmFPType *dataBlock = NULL, *dependentVariablesBlock = NULL;
+    size_t blockSize = blockSizeDefault;
     if(nBlocks == 1) { blockSize = task->batchSize; }
 
     for(size_t block = 0; block < nBlocks; block++)
@@ -71,20 +102,86 @@ inline void MSEKernel<algorithmFPType, method, cpu>::compute(NumericTable *dataN
         }
 
         task->getCurrentBlock(block * blockSizeDefault, blockSize, &dataBlock, &dependentVariablesBlock);
-        if(task->error.id() != NoErrorMessageFound) {this->_errors->add(task->error.id()); return;}
+        if(task->error.id() != NoErrorMessageFound) { return; }
 
-        computeMSE(blockSize, task, dataBlock, argumentArray, dependentVariablesBlock, value, gradient, hessian);
+        computeMSE(blockSize, task, dataBlock, argumentArray, dependentVariablesBlock, task->xMultTheta, value, gradient, hessian, false);
 
         task->releaseCurrentBlock();
     }
+}
 
-    normalizeResults(task, value, gradient, hessian);
+/**
+ *  \brief Computes the partial results of the blocks of rows in parallel. Each thread accumulates the partial sums
+ *         of its blocks in thread local storage with sequential BLAS calls, the partial sums are reduced at the end
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+void MSEKernel<algorithmFPType, method, cpu>::computeParallel(MSETask<algorithmFPType, cpu> *task, algorithmFPType *argumentArray, size_t nBlocks,
+                                                              algorithmFPType *value, algorithmFPType *gradient, algorithmFPType *hessian)
+{
+    const size_t argumentSize = task->argumentSize;
+    const size_t batchSize = task->batchSize;
+    const bool gatherRows = task->gatherRows;
+    const bool hessianFlag = task->hessianFlag;
+    const size_t blockSizeMax = blockSizeDefault;
 
-    task->releaseResultValues();
+    daal::tls<MSEThreadData<algorithmFPType, cpu> *> tlsData([ = ]()
+    {
+        return new MSEThreadData<algorithmFPType, cpu>(argumentSize, blockSizeMax, gatherRows, hessianFlag);
+    });
 
-    delete task;
+    bool blockAccessFailed = false;
+    daal::threader_for(nBlocks, nBlocks, [ & ](int iBlock)
+    {
+        MSEThreadData<algorithmFPType, cpu> *local = tlsData.local();
+        if(local->allocationFailed) { return; }
 
-    return;
+        const size_t startRow = iBlock * blockSizeDefault;
+        const size_t blockSize = (startRow + blockSizeDefault > batchSize ? batchSize - startRow : blockSizeDefault);
+
+        algorithmFPType *dataBlock = NULL, *dependentVariablesBlock = NULL;
+        if(!task->getThreadBlock(startRow, blockSize, local, &dataBlock, &dependentVariablesBlock))
+        {
+            blockAccessFailed = true;
+        }
+        else
+        {
+            computeMSE(blockSize, task, dataBlock, argumentArray, dependentVariablesBlock, local->xMultTheta,
+                       local->value, local->gradient, local->hessian, true);
+        }
+        task->releaseThreadBlock(local);
+    });
+
+    bool allocationFailed = false;
+    tlsData.reduce([ & ](MSEThreadData<algorithmFPType, cpu> *local)
+    {
+        if(local->allocationFailed)
+        {
+            allocationFailed = true;
+            delete local;
+            return;
+        }
+        if(task->valueFlag)
+        {
+            value[0] += local->value[0];
+        }
+        if(task->gradientFlag)
+        {
+            for(size_t j = 0; j < argumentSize; j++)
+            {
+                gradient[j] += local->gradient[j];
+            }
+        }
+        if(hessianFlag)
+        {
+            for(size_t j = 0; j < argumentSize * argumentSize; j++)
+            {
+                hessian[j] += local->hessian[j];
+            }
+        }
+        delete local;
+    });
+
+    if(allocationFailed || blockAccessFailed) { task->error.setId(ErrorMemoryAllocationFailed); }
 }
 
 template<typename algorithmFPType, Method method, CpuType cpu>
@@ -94,9 +191,11 @@ inline void MSEKernel<algorithmFPType, method, cpu>::computeMSE(
     algorithmFPType *data,
     algorithmFPType *argumentArray,
     algorithmFPType *dependentVariablesArray,
+    algorithmFPType *xMultTheta,
     algorithmFPType *value,
     algorithmFPType *gradient,
-    algorithmFPType *hessian)
+    algorithmFPType *hessian,
+    bool sequentialBlas)
 {
     char trans = 'T';
     algorithmFPType one = 1.0;
@@ -107,11 +206,17 @@ inline void MSEKernel<algorithmFPType, method, cpu>::computeMSE(
     DAAL_INT ione = 1;
     algorithmFPType theta0 = argumentArray[0];
     algorithmFPType *theta = &argumentArray[1];
-    algorithmFPType *xMultTheta = task->xMultTheta;
 
     if (task->gradientFlag || task->valueFlag)
     {
-        Blas<algorithmFPType, cpu>::xgemv(&trans, &dim, &n, &one, data, &dim, theta, &ione, &zero, xMultTheta, &ione);
+        if (sequentialBlas)
+        {
+            Blas<algorithmFPType, cpu>::xxgemv(&trans, &dim, &n, &one, data, &dim, theta, &ione, &zero, xMultTheta, &ione);
+        }
+        else
+        {
+            Blas<algorithmFPType, cpu>::xgemv(&trans, &dim, &n, &one, data, &dim, theta, &ione, &zero, xMultTheta, &ione);
+        }
 
         for(size_t i = 0; i < blockSize; i++)
         {
@@ -145,7 +250,14 @@ inline void MSEKernel<algorithmFPType, method, cpu>::computeMSE(
         char notrans = 'N';
         DAAL_INT argumentSize = dim + 1;
 
-        Blas<algorithmFPType, cpu>::xsyrk(&uplo, &notrans, &dim, &n, &one, data, &dim, &one, hessian + argumentSize + 1, &argumentSize);
+        if (sequentialBlas)
+        {
+            Blas<algorithmFPType, cpu>::xxsyrk(&uplo, &notrans, &dim, &n, &one, data, &dim, &one, hessian + argumentSize + 1, &argumentSize);
+        }
+        else
+        {
+            Blas<algorithmFPType, cpu>::xsyrk(&uplo, &notrans, &dim, &n, &one, data, &dim, &one, hessian + argumentSize + 1, &argumentSize);
+        }
 
         for (size_t i = 0; i < blockSize; i++)
         {
@@ -154,15 +266,23 @@ inline void MSEKernel<algorithmFPType, method, cpu>::computeMSE(
                 hessian[j + 1] += data[i * nTheta + j];
             }
         }
+    }
+}
 
-        for (size_t i = 0; i < argumentSize; i++)
+/**
+ *  \brief Fills the part of the hessian that is not computed by computeMSE
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+void MSEKernel<algorithmFPType, method, cpu>::symmetrizeHessian(MSETask<algorithmFPType, cpu> *task, algorithmFPType *hessian)
+{
+    size_t argumentSize = task->argumentSize;
+    for (size_t i = 0; i < argumentSize; i++)
+    {
+        for (size_t j = 1; j < i; j++)
         {
-            for (size_t j = 1; j < i; j++)
-            {
-                hessian[j * argumentSize + i] = hessian[i * argumentSize + j];
-            }
-            hessian[i * argumentSize] = hessian[i];
+            hessian[j * argumentSize + i] = hessian[i * argumentSize + j];
         }
+        hessian[i * argumentSize] = hessian[i];
     }
 }
 
@@ -27,6 +27,8 @@
 #include "kernel.h"
 #include "service_numeric_table.h"
 #include "service_blas.h"
+#include "service_memory.h"
+#include "threading.h"
 #include "numeric_table.h"
 
 using namespace daal::data_management;
@@ -44,6 +46,28 @@ namespace mse
 namespace internal
 {
 
+/**
+ *  \brief Thread local data of the parallel computation: the tile with the rows of the block,
+ *         the residuals and the partial sums of the results accumulated by the thread
+ */
+template<typename algorithmFPType, CpuType cpu>
+struct MSEThreadData
+{
+    MSEThreadData(size_t argumentSize, size_t blockSize, bool gatherRows, bool hessianFlag);
+    ~MSEThreadData();
+
+    BlockDescriptor<algorithmFPType> dataBlock;
+    BlockDescriptor<algorithmFPType> dependentVariablesBlock;
+
+    algorithmFPType *dataBlockMemory;
+    algorithmFPType *dependentVariablesBlockMemory;
+    algorithmFPType *xMultTheta;
+    algorithmFPType *value;
+    algorithmFPType *gradient;
+    algorithmFPType *hessian;
+    bool allocationFailed;
+};
+
 template<typename algorithmFPType, CpuType cpu>
 struct MSETask
 {
@@ -55,6 +79,11 @@ struct MSETask
     virtual void getCurrentBlock(size_t startIdx, size_t blockSize, algorithmFPType **pBlockData, algorithmFPType **pBlockDependentVariables) = 0;
     virtual void releaseCurrentBlock() = 0;
 
+    /* Thread-safe analogues of getCurrentBlock and releaseCurrentBlock that use the buffers of the thread */
+    virtual bool getThreadBlock(size_t startIdx, size_t blockSize, MSEThreadData<algorithmFPType, cpu> *local,
+                                algorithmFPType **pBlockData, algorithmFPType **pBlockDependentVariables) = 0;
+    virtual void releaseThreadBlock(MSEThreadData<algorithmFPType, cpu> *local) = 0;
+
     void setResultValuesToZero(algorithmFPType **value, algorithmFPType **gradient, algorithmFPType **hessian);
     void getResultValues(algorithmFPType **value, algorithmFPType **gradient, algorithmFPType **hessian);
     void releaseResultValues();
@@ -79,6 +108,7 @@ struct MSETask
     size_t argumentSize;
     size_t nTheta;
     size_t batchSize;
+    bool gatherRows;
     algorithmFPType *xMultTheta;
     Error error;
 };
@@ -110,6 +140,7 @@ struct MSETaskAll : public MSETask<algorithmFPType, cpu>
     using MSETask<algorithmFPType, cpu>::argumentSize;
     using MSETask<algorithmFPType, cpu>::nTheta;
     using MSETask<algorithmFPType, cpu>::batchSize;
+    using MSETask<algorithmFPType, cpu>::gatherRows;
     using MSETask<algorithmFPType, cpu>::xMultTheta;
     using MSETask<algorithmFPType, cpu>::error;
 
@@ -119,6 +150,10 @@ struct MSETaskAll : public MSETask<algorithmFPType, cpu>
 
     virtual void getCurrentBlock(size_t startIdx, size_t blockSize, algorithmFPType **pBlockData, algorithmFPType **pBlockDependentVariables);
     virtual void releaseCurrentBlock();
+
+    virtual bool getThreadBlock(size_t startIdx, size_t blockSize, MSEThreadData<algorithmFPType, cpu> *local,
+                                algorithmFPType **pBlockData, algorithmFPType **pBlockDependentVariables);
+    virtual void releaseThreadBlock(MSEThreadData<algorithmFPType, cpu> *local);
 };
 
 template<typename algorithmFPType, CpuType cpu>
@@ -148,6 +183,7 @@ struct MSETaskSample : public MSETask<algorithmFPType, cpu>
     using MSETask<algorithmFPType, cpu>::argumentSize;
     using MSETask<algorithmFPType, cpu>::nTheta;
     using MSETask<algorithmFPType, cpu>::batchSize;
+    using MSETask<algorithmFPType, cpu>::gatherRows;
     using MSETask<algorithmFPType, cpu>::xMultTheta;
     using MSETask<algorithmFPType, cpu>::error;
 
@@ -159,6 +195,10 @@ struct MSETaskSample : public MSETask<algorithmFPType, cpu>
     virtual void getCurrentBlock(size_t startIdx, size_t blockSize, algorithmFPType **pBlockData, algorithmFPType **pBlockDependentVariables);
     virtual void releaseCurrentBlock();
 
+    virtual bool getThreadBlock(size_t startIdx, size_t blockSize, MSEThreadData<algorithmFPType, cpu> *local,
+                                algorithmFPType **pBlockData, algorithmFPType **pBlockDependentVariables);
+    virtual void releaseThreadBlock(MSEThreadData<algorithmFPType, cpu> *local);
+
     NumericTable *ntIndices;
     BlockDescriptor<int> indicesBlock;
     int *indicesArray;
@@ -174,15 +214,25 @@ public:
     void compute(NumericTable *data, NumericTable *dependentVariables, NumericTable *argument,
                  NumericTable *value, NumericTable *hessian, NumericTable *gradient, Parameter *parameter);
 private:
+    void computeSerial(MSETask<algorithmFPType, cpu> *task, algorithmFPType *argumentArray, size_t nBlocks,
+                       algorithmFPType *value, algorithmFPType *gradient, algorithmFPType *hessian);
+
+    void computeParallel(MSETask<algorithmFPType, cpu> *task, algorithmFPType *argumentArray, size_t nBlocks,
+                         algorithmFPType *value, algorithmFPType *gradient, algorithmFPType *hessian);
+
     void computeMSE(
         size_t blockSize,
         MSETask<algorithmFPType, cpu> *task,
         algorithmFPType *data,
         algorithmFPType *argumentArray,
         algorithmFPType *dependentVariablesArray,
+        algorithmFPType *xMultTheta,
         algorithmFPType *value,
         algorithmFPType *gradient,
-        algorithmFPType *hessian);
+        algorithmFPType *hessian,
+        bool sequentialBlas);
+
+    void symmetrizeHessian(MSETask<algorithmFPType, cpu> *task, algorithmFPType *hessian);
 
     void normalizeResults(
         MSETask<algorithmFPType, cpu> *task,
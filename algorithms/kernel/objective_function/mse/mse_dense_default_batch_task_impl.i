@@ -35,6 +35,46 @@ namespace mse
 namespace internal
 {
 
+template<typename algorithmFPType, CpuType cpu>
+MSEThreadData<algorithmFPType, cpu>::MSEThreadData(size_t argumentSize, size_t blockSize, bool gatherRows, bool hessianFlag) :
+    dataBlockMemory(NULL), dependentVariablesBlockMemory(NULL), hessian(NULL), allocationFailed(false)
+{
+    using namespace daal::services::internal;
+    const size_t nTheta = argumentSize - 1;
+    if(gatherRows)
+    {
+        if(nTheta > 0)
+        {
+            dataBlockMemory = service_scalable_malloc<algorithmFPType, cpu>(blockSize * nTheta);
+            if(!dataBlockMemory) { allocationFailed = true; }
+        }
+        dependentVariablesBlockMemory = service_scalable_malloc<algorithmFPType, cpu>(blockSize);
+        if(!dependentVariablesBlockMemory) { allocationFailed = true; }
+    }
+
+    xMultTheta = service_scalable_malloc<algorithmFPType, cpu>(blockSize);
+    value      = service_scalable_calloc<algorithmFPType, cpu>(1);
+    gradient   = service_scalable_calloc<algorithmFPType, cpu>(argumentSize);
+    if(!xMultTheta || !value || !gradient) { allocationFailed = true; }
+
+    if(hessianFlag)
+    {
+        hessian = service_scalable_calloc<algorithmFPType, cpu>(argumentSize * argumentSize);
+        if(!hessian) { allocationFailed = true; }
+    }
+}
+
+template<typename algorithmFPType, CpuType cpu>
+MSEThreadData<algorithmFPType, cpu>::~MSEThreadData()
+{
+    using namespace daal::services::internal;
+    if(dataBlockMemory) { service_scalable_free<algorithmFPType, cpu>(dataBlockMemory); }
+    if(dependentVariablesBlockMemory) { service_scalable_free<algorithmFPType, cpu>(dependentVariablesBlockMemory); }
+    if(xMultTheta) { service_scalable_free<algorithmFPType, cpu>(xMultTheta); }
+    if(value) { service_scalable_free<algorithmFPType, cpu>(value); }
+    if(gradient) { service_scalable_free<algorithmFPType, cpu>(gradient); }
+    if(hessian) { service_scalable_free<algorithmFPType, cpu>(hessian); }
+}
 
 template<typename algorithmFPType, CpuType cpu>
 MSETask<algorithmFPType, cpu>::MSETask(NumericTable *data, NumericTable *dependentVariables, NumericTable *argument,
@@ -43,7 +83,8 @@ MSETask<algorithmFPType, cpu>::MSETask(NumericTable *data, NumericTable *depende
     error(NoErrorMessageFound),
     ntData(data),
     ntDependentVariables(dependentVariables),
-    ntArgument(argument)
+    ntArgument(argument),
+    gatherRows(false)
 {
     ntValue    = value;
     ntHessian  = hessian;
@@ -184,6 +225,30 @@ void MSETaskAll<algorithmFPType, cpu>::releaseCurrentBlock()
     ntDependentVariables->releaseBlockOfRows(dependentVariablesBlock);
 }
 
+template<typename algorithmFPType, CpuType cpu>
+bool MSETaskAll<algorithmFPType, cpu>::getThreadBlock(
+    size_t startIdx,
+    size_t blockSize,
+    MSEThreadData<algorithmFPType, cpu> *local,
+    algorithmFPType **pBlockData,
+    algorithmFPType **pBlockDependentVariables)
+{
+    ntData->getBlockOfRows(startIdx, blockSize, readOnly, local->dataBlock);
+    *pBlockData = local->dataBlock.getBlockPtr();
+
+    ntDependentVariables->getBlockOfRows(startIdx, blockSize, readOnly, local->dependentVariablesBlock);
+    *pBlockDependentVariables = local->dependentVariablesBlock.getBlockPtr();
+
+    return (*pBlockData && *pBlockDependentVariables);
+}
+
+template<typename algorithmFPType, CpuType cpu>
+void MSETaskAll<algorithmFPType, cpu>::releaseThreadBlock(MSEThreadData<algorithmFPType, cpu> *local)
+{
+    ntData->releaseBlockOfRows(local->dataBlock);
+    ntDependentVariables->releaseBlockOfRows(local->dependentVariablesBlock);
+}
+
 template<typename algorithmFPType, CpuType cpu>
 MSETaskSample<algorithmFPType, cpu>::MSETaskSample(NumericTable *data, NumericTable *dependentVariables, NumericTable *argument,
                                                    NumericTable *value, NumericTable *hessian, NumericTable *gradient, Parameter *parameter, size_t blockSizeDefault,
@@ -198,6 +263,7 @@ MSETaskSample<algorithmFPType, cpu>::MSETaskSample(NumericTable *data, NumericTa
     if(!indicesArray) {error.setId(ErrorMemoryAllocationFailed); return;}
 
     batchSize = ntIndices->getNumberOfColumns();
+    gatherRows = true;
     size_t allocationSize = blockSizeDefault;
     if(batchSize < blockSizeDefault)
     {
@@ -260,6 +326,46 @@ void MSETaskSample<algorithmFPType, cpu>::getCurrentBlock(
 template<typename algorithmFPType, CpuType cpu>
 void MSETaskSample<algorithmFPType, cpu>::releaseCurrentBlock() {}
 
+template<typename algorithmFPType, CpuType cpu>
+bool MSETaskSample<algorithmFPType, cpu>::getThreadBlock(
+    size_t startIdx,
+    size_t blockSize,
+    MSEThreadData<algorithmFPType, cpu> *local,
+    algorithmFPType **pBlockData,
+    algorithmFPType **pBlockDependentVariables)
+{
+    algorithmFPType *dataArray = NULL, *dependentVariablesArray = NULL;
+    *pBlockData = local->dataBlockMemory;
+    *pBlockDependentVariables = local->dependentVariablesBlockMemory;
+    for(size_t idx = 0; idx < blockSize; idx++)
+    {
+        size_t index = indicesArray[startIdx + idx];
+        ntData->getBlockOfRows(index, 1, readOnly, local->dataBlock);
+        dataArray = local->dataBlock.getBlockPtr();
+        ntDependentVariables->getBlockOfRows(index, 1, readOnly, local->dependentVariablesBlock);
+        dependentVariablesArray = local->dependentVariablesBlock.getBlockPtr();
+        if(!dataArray || !dependentVariablesArray)
+        {
+            ntData->releaseBlockOfRows(local->dataBlock);
+            ntDependentVariables->releaseBlockOfRows(local->dependentVariablesBlock);
+            return false;
+        }
+
+        for(size_t j = 0; j < nTheta; j++)
+        {
+            (*pBlockData)[idx * nTheta + j] = dataArray[j];
+        }
+        (*pBlockDependentVariables)[idx] = dependentVariablesArray[0];
+
+        ntData->releaseBlockOfRows(local->dataBlock);
+        ntDependentVariables->releaseBlockOfRows(local->dependentVariablesBlock);
+    }
+    return true;
+}
+
+template<typename algorithmFPType, CpuType cpu>
+void MSETaskSample<algorithmFPType, cpu>::releaseThreadBlock(MSEThreadData<algorithmFPType, cpu> *local) {}
+
 } // namespace daal::internal
 
 } // namespace mse
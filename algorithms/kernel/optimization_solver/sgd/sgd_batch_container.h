@@ -28,6 +28,7 @@
 #include "sgd_dense_default_kernel.h"
 #include "sgd_dense_minibatch_kernel.h"
 #include "sgd_dense_momentum_kernel.h"
+#include "sgd_dense_async_parallel_kernel.h"
 
 namespace daal
 {
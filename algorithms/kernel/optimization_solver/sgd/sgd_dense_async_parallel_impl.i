@@ -0,0 +1,234 @@
+/* file: sgd_dense_async_parallel_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of asynchronous parallel sgd algorithm
+//--
+*/
+
+#ifndef __SGD_DENSE_ASYNC_PARALLEL_IMPL_I__
+#define __SGD_DENSE_ASYNC_PARALLEL_IMPL_I__
+
+#include "service_numeric_table.h"
+#include "service_math.h"
+#include "service_utils.h"
+#include "service_rng.h"
+#include "iterative_solver_kernel.h"
+#include "threading.h"
+#include "daal_atomic_int.h"
+
+using namespace daal::algorithms::optimization_solver::iterative_solver::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace sgd
+{
+namespace internal
+{
+
+/**
+ *  \brief Kernel for asynchronous parallel SGD calculation.
+ *         Iteration it is processed by the worker it % nWorkers. The workers update the shared argument
+ *         without locking, so the updates of the different workers may interleave (Hogwild! update rule)
+ */
+template<typename algorithmFPType, CpuType cpu>
+void SGDKernel<algorithmFPType, asyncParallel, cpu>::compute(NumericTable *inputArgument, NumericTable *minimum, NumericTable *nIterations,
+        Parameter<asyncParallel> *parameter, NumericTable *learningRateSequence,
+        NumericTable *batchIndices, OptionalArgument *optionalArgument, OptionalArgument *optionalResult)
+{
+    const size_t argumentSize      = inputArgument->getNumberOfRows();
+    const size_t maxIterations     = parameter->nIterations;
+    const size_t batchSize         = parameter->batchSize;
+    const size_t syncInterval      = parameter->synchronizationInterval;
+    const double accuracyThreshold = parameter->accuracyThreshold;
+
+    /* if maxIterations == 0, set result as start point, the number of executed iters to 0 */
+    WriteRows<int, cpu, NumericTable> nIterationsBD(*nIterations, 0, 1);
+    int *nProceededIterations = nIterationsBD.get();
+    nProceededIterations[0] = 0;
+
+    {
+        WriteRows<algorithmFPType, cpu, NumericTable> minimumBD(*minimum, 0, argumentSize);
+        ReadRows<algorithmFPType, cpu, NumericTable> startValueBD(*inputArgument, 0, argumentSize);
+        DAAL_CHECK(minimumBD.get() && startValueBD.get(), ErrorMemoryAllocationFailed);
+        if(minimumBD.get() != startValueBD.get())
+        {
+            daal_memcpy_s(minimumBD.get(), argumentSize * sizeof(algorithmFPType), startValueBD.get(), argumentSize * sizeof(algorithmFPType));
+        }
+    }
+    if(maxIterations == 0) { return; }
+
+    sum_of_functions::BatchPtr function = parameter->function;
+    const size_t nTerms = function->sumOfFunctionsParameter->numberOfTerms;
+
+    IndicesStatus indicesStatus = (batchIndices ? user : (batchSize < nTerms ? random : all));
+
+    size_t nWorkers = threader_get_threads_number();
+    if(nWorkers > maxIterations) { nWorkers = maxIterations; }
+    if(nWorkers == 0) { nWorkers = 1; }
+
+    /* Worker 0 continues the random stream saved in the optional argument, the other workers use independent streams */
+    TArray<SGDAsyncWorker<algorithmFPType, cpu> *, cpu> workers(nWorkers);
+    DAAL_CHECK(workers.get(), ErrorMemoryAllocationFailed);
+    bool initFailed = false;
+    for(size_t w = 0; w < nWorkers; w++)
+    {
+        workers[w] = new SGDAsyncWorker<algorithmFPType, cpu>(function, argumentSize, batchSize, indicesStatus);
+        if(!workers[w]->function.get() || !workers[w]->ntArgument->getArray()) { initFailed = true; continue; }
+        if(indicesStatus == random &&
+           !workers[w]->rngTask.init((w == 0 ? optionalArgument : NULL), nTerms, (int)(parameter->seed + w), sgd::rngState))
+        {
+            initFailed = true;
+        }
+    }
+
+    ReadRows<int, cpu> predefinedBatchIndicesBD(batchIndices, 0, maxIterations);
+    const int *predefinedBatchIndices = predefinedBatchIndicesBD.get();
+
+    ReadRows<algorithmFPType, cpu, NumericTable> learningRateBD(*learningRateSequence, 0, 1);
+    const algorithmFPType *learningRateArray = learningRateBD.get();
+    const size_t learningRateLength = learningRateSequence->getNumberOfColumns();
+
+    WriteRows<algorithmFPType, cpu, NumericTable> sharedArgumentBD(*minimum, 0, argumentSize);
+    algorithmFPType *sharedArgument = sharedArgumentBD.get();
+    if(!sharedArgument || (indicesStatus == user && !predefinedBatchIndices)) { initFailed = true; }
+
+    if(initFailed)
+    {
+        for(size_t w = 0; w < nWorkers; w++) { delete workers[w]; }
+        this->_errors->add(ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    SGDAsyncWorker<algorithmFPType, cpu> **workersArray = workers.get();
+    services::AtomicInt converged(0);
+    daal::threader_for(nWorkers, nWorkers, [ =, &converged ](size_t w)
+    {
+        SGDAsyncWorker<algorithmFPType, cpu> *worker = workersArray[w];
+        algorithmFPType *localArgument = worker->ntArgument->getArray();
+        size_t nLocalIterations = 0;
+
+        for(size_t it = w; it < maxIterations && !converged.get(); it += nWorkers, nLocalIterations++)
+        {
+            if(nLocalIterations % syncInterval == 0)
+            {
+                for(size_t j = 0; j < argumentSize; j++)
+                {
+                    localArgument[j] = sharedArgument[j];
+                }
+            }
+
+            if(indicesStatus == user)
+            {
+                worker->ntBatchIndices->setArray(const_cast<int *>(predefinedBatchIndices + it * batchSize));
+            }
+            else if(indicesStatus == random)
+            {
+                worker->ntBatchIndices->setArray(const_cast<int *>(worker->rngTask.get(*worker->errors,
+                                                                   RngTask<int, cpu>::eUniformWithoutReplacement)));
+            }
+
+            worker->function->computeNoThrow();
+            if(worker->errors->size() != 0 || worker->function->getErrors()->size() != 0) { worker->failed = true; converged.set(1); break; }
+
+            NumericTable *gradientTable = worker->function->getResult()->get(objective_function::gradientIdx).get();
+            ReadRows<algorithmFPType, cpu, NumericTable> gradientBD(*gradientTable, 0, argumentSize);
+            const algorithmFPType *gradient = gradientBD.get();
+            if(!gradient) { worker->failed = true; converged.set(1); break; }
+
+            if(maxIterations != 1)
+            {
+                algorithmFPType pointNorm = 0, gradientNorm = 0;
+                for(size_t j = 0; j < argumentSize; j++)
+                {
+                    pointNorm    += localArgument[j] * localArgument[j];
+                    gradientNorm += gradient[j] * gradient[j];
+                }
+                const algorithmFPType one = 1.0;
+                const algorithmFPType gradientThreshold = accuracyThreshold *
+                    daal::internal::Math<algorithmFPType, cpu>::sMax(one, daal::internal::Math<algorithmFPType, cpu>::sSqrt(pointNorm));
+                if(daal::internal::Math<algorithmFPType, cpu>::sSqrt(gradientNorm) < gradientThreshold) { converged.set(1); break; }
+            }
+
+            const algorithmFPType learningRate = (learningRateLength > 1 ? learningRateArray[it] : learningRateArray[0]);
+
+            /* Lock-free update of the shared argument, the copy of the worker follows its own updates */
+            for(size_t j = 0; j < argumentSize; j++)
+            {
+                const algorithmFPType step = learningRate * gradient[j];
+                sharedArgument[j]  -= step;
+                localArgument[j]   -= step;
+            }
+            worker->nUpdates++;
+        }
+    } );
+
+    size_t nUpdates = 0;
+    for(size_t w = 0; w < nWorkers; w++)
+    {
+        nUpdates += workers[w]->nUpdates;
+        if(workers[w]->failed)
+        {
+            this->_errors->add(workers[w]->errors);
+            this->_errors->add(workers[w]->function->getErrors()->getErrors());
+        }
+    }
+    nProceededIterations[0] = (int)nUpdates;
+
+    bool saveFailed = (parameter->optionalResultRequired && indicesStatus == random &&
+                       !workers[0]->rngTask.save(optionalResult, sgd::rngState, *this->_errors));
+
+    for(size_t w = 0; w < nWorkers; w++) { delete workers[w]; }
+
+    if(saveFailed) { this->_errors->add(ErrorMemoryAllocationFailed); }
+}
+
+template<typename algorithmFPType, CpuType cpu>
+SGDAsyncWorker<algorithmFPType, cpu>::SGDAsyncWorker(const sum_of_functions::BatchPtr &objectiveFunction, size_t argumentSize, size_t batchSize,
+                                                     IndicesStatus indicesStatus) :
+    function(objectiveFunction->clone()),
+    ntArgument(new HomogenNumericTableCPU<algorithmFPType, cpu>(1, argumentSize)),
+    rngTask(NULL, batchSize),
+    errors(new services::KernelErrorCollection()),
+    nUpdates(0),
+    failed(false)
+{
+    if(!function.get()) { return; }
+    function->sumOfFunctionsInput->set(sum_of_functions::argument, ntArgument);
+    if(indicesStatus == user || indicesStatus == random)
+    {
+        ntBatchIndices = SharedPtr<HomogenNumericTableCPU<int, cpu> >(new HomogenNumericTableCPU<int, cpu>(NULL, batchSize, 1));
+        function->sumOfFunctionsParameter->batchIndices = ntBatchIndices;
+    }
+    else
+    {
+        function->sumOfFunctionsParameter->batchIndices = NumericTablePtr();
+    }
+}
+
+} // namespace daal::internal
+} // namespace sgd
+} // namespace optimization_solver
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,90 @@
+/* file: sgd_dense_async_parallel_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+//++
+//  Declaration of template function that calculate asynchronous parallel sgd.
+//--
+
+
+#ifndef __SGD_DENSE_ASYNC_PARALLEL_KERNEL_H__
+#define __SGD_DENSE_ASYNC_PARALLEL_KERNEL_H__
+
+#include "sgd_batch.h"
+#include "kernel.h"
+#include "numeric_table.h"
+#include "iterative_solver_kernel.h"
+#include "sgd_dense_kernel.h"
+#include "sgd_dense_minibatch_kernel.h"
+#include "service_numeric_table.h"
+#include "service_math.h"
+#include "service_utils.h"
+
+using namespace daal::data_management;
+using namespace daal::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace sgd
+{
+namespace internal
+{
+
+template<typename algorithmFPType, CpuType cpu>
+class SGDKernel<algorithmFPType, asyncParallel, cpu> : public iterative_solver::internal::IterativeSolverKernel<algorithmFPType, cpu>
+{
+public:
+    void compute(NumericTable *inputArgument, NumericTable *minimum, NumericTable *nIterations,
+                 Parameter<asyncParallel> *parameter, NumericTable *learningRateSequence,
+                 NumericTable *batchIndices, OptionalArgument *optionalArgument, OptionalArgument *optionalResult);
+    using iterative_solver::internal::IterativeSolverKernel<algorithmFPType, cpu>::vectorNorm;
+};
+
+/**
+ * Data of one worker of the asynchronous parallel SGD: the copy of the objective function,
+ * the copy of the argument the gradient is computed at, and the stream of random batch indices
+ */
+template<typename algorithmFPType, CpuType cpu>
+struct SGDAsyncWorker
+{
+    SGDAsyncWorker(const sum_of_functions::BatchPtr &objectiveFunction, size_t argumentSize, size_t batchSize,
+                   IndicesStatus indicesStatus);
+
+    sum_of_functions::BatchPtr function;
+    SharedPtr<daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu> > ntArgument;
+    SharedPtr<daal::internal::HomogenNumericTableCPU<int, cpu> > ntBatchIndices;
+    iterative_solver::internal::RngTask<int, cpu> rngTask;
+    services::KernelErrorCollectionPtr errors;
+    size_t nUpdates;
+    bool failed;
+};
+
+} // namespace daal::internal
+
+} // namespace sgd
+
+} // namespace optimization_solver
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
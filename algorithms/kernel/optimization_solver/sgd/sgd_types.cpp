@@ -209,6 +209,53 @@ void Parameter<momentum>::check() const
                   ArgumentName, "batchSize");
 }
 
+/**
+ * Constructs the parameter class of the asynchronous parallel Stochastic gradient descent algorithm
+ * \param[in] function                Objective function represented as sum of functions
+ * \param[in] nIterations             Maximal number of iterations of the algorithm, summed over all threads
+ * \param[in] accuracyThreshold       Accuracy of the algorithm. The algorithm terminates when this accuracy is achieved
+ * \param[in] batchIndices            Numeric table that represents 32 bit integer indices of terms in the objective function. If no indices
+                                      are provided, the implementation will generate random indices.
+ * \param[in] batchSize               Number of batch indices to compute the stochastic gradient
+ * \param[in] synchronizationInterval Number of iterations of a thread after which the thread reads the shared argument again
+ * \param[in] learningRateSequence    Numeric table that contains values of the learning rate sequence
+ * \param[in] seed                    Seed for random generation of 32 bit integer indices of terms in the objective function.
+ */
+Parameter<asyncParallel>::Parameter(
+    const sum_of_functions::BatchPtr &function,
+    size_t nIterations,
+    double accuracyThreshold,
+    data_management::NumericTablePtr batchIndices,
+    size_t batchSize,
+    size_t synchronizationInterval,
+    data_management::NumericTablePtr learningRateSequence,
+    size_t seed) :
+    BaseParameter(function,
+                  nIterations,
+                  accuracyThreshold,
+                  batchIndices,
+                  learningRateSequence,
+                  seed),
+    batchSize(batchSize),
+    synchronizationInterval(synchronizationInterval)
+{}
+
+/**
+ * Checks the correctness of the parameter
+ */
+void Parameter<asyncParallel>::check() const
+{
+    BaseParameter::check();
+    if(batchIndices.get() != NULL)
+    {
+        if(!checkNumericTable(batchIndices.get(), this->_errors.get(), batchIndicesStr(), 0, 0, batchSize, nIterations)) {return;}
+    }
+
+    DAAL_CHECK_EX(batchSize <= function->sumOfFunctionsParameter->numberOfTerms && batchSize > 0, ErrorIncorrectParameter, \
+                  ArgumentName, "batchSize");
+    DAAL_CHECK_EX(synchronizationInterval > 0, ErrorIncorrectParameter, ArgumentName, "synchronizationInterval");
+}
+
 static bool checkRngState(const daal::algorithms::Input *input,
                           const daal::algorithms::Parameter *par,
                           const SerializationIface *pItem,
@@ -22,6 +22,7 @@
 */
 
 #include "outlier_detection_multivariate_types.h"
+#include "outlierdetection_multivariate_kernel.h"
 #include "serialization_utils.h"
 
 using namespace daal::data_management;
@@ -80,8 +81,9 @@ Parameter<defaultDense>::Parameter() : daal::algorithms::Parameter(), initializa
 
 void Parameter<defaultDense>::check() const {}
 
-Parameter<baconDense>::Parameter(BaconInitializationMethod initMethod, double alpha, double toleranceToConverge) :
-        initMethod(initMethod), alpha(alpha), toleranceToConverge(toleranceToConverge) {}
+Parameter<baconDense>::Parameter(BaconInitializationMethod initMethod, double alpha, double toleranceToConverge,
+                                 bool computeTimings) :
+        initMethod(initMethod), alpha(alpha), toleranceToConverge(toleranceToConverge), computeTimings(computeTimings) {}
 
 void Parameter<baconDense>::check() const
 {
@@ -129,7 +131,7 @@ void Input::check(const daal::algorithms::Parameter *par, int method) const
     if (!checkNumericTable(get(data).get(), this->_errors.get(), dataStr())) { return; }
 }
 
-Result::Result() : daal::algorithms::Result(1) {}
+Result::Result() : daal::algorithms::Result(2) {}
 
 /**
  * Returns result of the multivariate outlier detection algorithm
@@ -161,6 +163,12 @@ void Result::check(const daal::algorithms::Input *input, const daal::algorithms:
     size_t nVectors  = algInput->get(data)->getNumberOfRows();
     int unexpectedLayouts = packed_mask;
     if (!checkNumericTable(get(weights).get(), this->_errors.get(), weightsStr(), unexpectedLayouts, 0, 1, nVectors)) { return; }
+
+    if (method == baconDense && par && static_cast<const Parameter<baconDense> *>(par)->computeTimings)
+    {
+        if (!checkNumericTable(get(timings).get(), this->_errors.get(), timingsStr(), unexpectedLayouts, 0, baconNumberOfTimings,
+                               internal::baconMaxIterations + 1)) { return; }
+    }
 }
 
 } // namespace interface1
@@ -25,6 +25,7 @@
 #define __OUTLIERDETECTION_MULTIVARIATE_BATCH_H__
 
 #include "outlier_detection_multivariate_types.h"
+#include "outlierdetection_multivariate_kernel.h"
 
 namespace daal
 {
@@ -49,6 +50,13 @@ DAAL_EXPORT void Result::allocate(const daal::algorithms::Input *input, const da
     size_t nVectors = algInput->get(data)->getNumberOfRows();
     Argument::set(weights, data_management::SerializationIfacePtr(
                       new data_management::HomogenNumericTable<algorithmFPType>(1, nVectors, data_management::NumericTable::doAllocate)));
+
+    if (method == baconDense && parameter && static_cast<const Parameter<baconDense> *>(parameter)->computeTimings)
+    {
+        Argument::set(timings, data_management::SerializationIfacePtr(
+                          new data_management::HomogenNumericTable<double>(baconNumberOfTimings, internal::baconMaxIterations + 1,
+                                                                           data_management::NumericTable::doAllocate)));
+    }
 }
 
 } // namespace interface1
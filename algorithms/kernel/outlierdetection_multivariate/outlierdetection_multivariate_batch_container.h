@@ -51,10 +51,11 @@ void BatchContainer<algorithmFPType, method, cpu>::compute()
 
     NumericTable *a = static_cast<NumericTable *>(input->get(data).get());
     NumericTable *r = static_cast<NumericTable *>(result->get(weights).get());
+    NumericTable *t = static_cast<NumericTable *>(result->get(timings).get());
     daal::algorithms::Parameter *par = _par;
     daal::services::Environment::env &env = *_env;
 
-    __DAAL_CALL_KERNEL(env, internal::OutlierDetectionKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, a, r, par);
+    __DAAL_CALL_KERNEL(env, internal::OutlierDetectionKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, a, r, t, par);
 }
 
 } // namespace multivariate_outlier_detection
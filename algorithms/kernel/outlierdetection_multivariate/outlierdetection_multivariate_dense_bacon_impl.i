@@ -30,7 +30,11 @@
 #include "service_micro_table.h"
 #include "service_numeric_table.h"
 #include "service_math.h"
-#include "service_stat.h"
+#include "service_blas.h"
+#include "service_lapack.h"
+#include "service_sort.h"
+#include "threading.h"
+#include "service_trace.h"
 
 #include "outlierdetection_multivariate_dense_bacon_kernel.h"
 
@@ -47,32 +51,426 @@ namespace internal
 {
 
 template <typename algorithmFPType, CpuType cpu>
-void OutlierDetectionKernel<algorithmFPType, baconDense, cpu>::compute(const NumericTable *a, NumericTable *r, const daal::algorithms::Parameter *par)
+BaconSubset<algorithmFPType, cpu>::BaconSubset(size_t nFeatures) :
+    nFeatures(nFeatures), nRows(0), shift(NULL), sum(NULL), crossProduct(NULL), location(NULL), cholesky(NULL),
+    _buffer(3 * nFeatures + 2 * nFeatures * nFeatures)
 {
-    const __int64 nBaconParams = 3;
-    algorithmFPType baconParams[nBaconParams];
-    Parameter<baconDense> *odPar = static_cast<Parameter<baconDense> *>(const_cast<daal::algorithms::Parameter *>(par));
-    if (odPar == NULL)
+    algorithmFPType *buffer = _buffer.get();
+    if (!buffer) { return; }
+    shift        = buffer;
+    sum          = shift + nFeatures;
+    location     = sum + nFeatures;
+    crossProduct = location + nFeatures;
+    cholesky     = crossProduct + nFeatures * nFeatures;
+    for (size_t i = 0; i < _buffer.size(); i++)
     {
-        odPar = new Parameter<baconDense>();
+        buffer[i] = (algorithmFPType)0.0;
     }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void BaconSubset<algorithmFPType, cpu>::reset(const algorithmFPType *newShift)
+{
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        shift[j] = newShift[j];
+        sum[j]   = (algorithmFPType)0.0;
+    }
+    for (size_t j = 0; j < nFeatures * nFeatures; j++)
+    {
+        crossProduct[j] = (algorithmFPType)0.0;
+    }
+    nRows = 0;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+bool BaconSubset<algorithmFPType, cpu>::computeCholeskyFactor()
+{
+    if (nRows < 2) { return false; }
 
-    switch (odPar->initMethod)
+    const algorithmFPType invN  = (algorithmFPType)1.0 / (algorithmFPType)nRows;
+    const algorithmFPType invN1 = (algorithmFPType)1.0 / (algorithmFPType)(nRows - 1);
+    for (size_t j = 0; j < nFeatures; j++)
     {
-    case baconMedian:
-    default:
+        location[j] = shift[j] + sum[j] * invN;
+    }
+
+    /* Variance-covariance matrix of the subset: (CP - sum * sum' / n) / (n - 1), upper triangle */
+    for (size_t j = 0; j < nFeatures; j++)
     {
-        baconParams[0] = (algorithmFPType)__DAAL_VSL_SS_METHOD_BACON_MEDIAN_INIT;
-        break;
+        for (size_t i = 0; i <= j; i++)
+        {
+            cholesky[j * nFeatures + i] = (crossProduct[j * nFeatures + i] - sum[i] * sum[j] * invN) * invN1;
+        }
     }
-    case baconMahalanobis:
+
+    DAAL_INT dim = (DAAL_INT)nFeatures;
+    char uplo = 'U';
+    DAAL_INT info;
+    Lapack<algorithmFPType, cpu>::xpotrf(&uplo, &dim, cholesky, &dim, &info);
+    return (info == 0);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+BaconThreadData<algorithmFPType, cpu>::BaconThreadData(size_t nFeatures) :
+    sum(NULL), crossProduct(NULL), centered(NULL), entering(NULL), leaving(NULL), distance(NULL), nRows(0), nLeaving(0),
+    distancesTime(0), subsetUpdateTime(0), allocationFailed(false),
+    _buffer(nFeatures + nFeatures * nFeatures + 3 * baconBlockSize * nFeatures + baconBlockSize)
+{
+    algorithmFPType *buffer = _buffer.get();
+    if (!buffer) { allocationFailed = true; return; }
+    sum          = buffer;
+    crossProduct = sum + nFeatures;
+    centered     = crossProduct + nFeatures * nFeatures;
+    entering     = centered + baconBlockSize * nFeatures;
+    leaving      = entering + baconBlockSize * nFeatures;
+    distance     = leaving + baconBlockSize * nFeatures;
+    for (size_t j = 0; j < nFeatures + nFeatures * nFeatures; j++)
     {
-        baconParams[0] = (algorithmFPType)__DAAL_VSL_SS_METHOD_BACON_MAHALANOBIS_INIT;
-        break;
+        buffer[j] = (algorithmFPType)0.0;
     }
+}
+
+/** Returns the current time in nanoseconds if the execution times are measured, 0 otherwise */
+inline unsigned long long baconTime(bool measure)
+{
+    return (measure ? services::Tracer::getTime() : 0);
+}
+
+/** Converts the time in nanoseconds to seconds */
+inline double baconSeconds(unsigned long long nanoseconds)
+{
+    return (double)nanoseconds * 1.0e-9;
+}
+
+/**
+ *  \brief Computes the squared distances of the block of observations to the location.
+ *         The Mahalanobis distances are computed by the triangular solve with the Cholesky factor of the
+ *         variance-covariance matrix for all observations of the block at once, the Euclidean distances if the factor is NULL
+ */
+template <typename algorithmFPType, CpuType cpu>
+void computeBlockDistances(const algorithmFPType *data, size_t nFeatures, size_t nRows, const algorithmFPType *location,
+                           const algorithmFPType *cholesky, algorithmFPType *centered, algorithmFPType *distance)
+{
+    for (size_t i = 0; i < nRows; i++)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            centered[i * nFeatures + j] = data[i * nFeatures + j] - location[j];
+        }
     }
-    baconParams[1] = (algorithmFPType)(odPar->alpha);
-    baconParams[2] = (algorithmFPType)(odPar->toleranceToConverge);
+
+    if (cholesky)
+    {
+        /* The block is the column-major matrix nFeatures x nRows, solve U' * Z = X - location */
+        DAAL_INT dim = (DAAL_INT)nFeatures;
+        DAAL_INT n   = (DAAL_INT)nRows;
+        char uplo  = 'U';
+        char trans = 'T';
+        char diag  = 'N';
+        DAAL_INT info;
+        Lapack<algorithmFPType, cpu>::xxtrtrs(&uplo, &trans, &diag, &dim, &n, const_cast<algorithmFPType *>(cholesky), &dim,
+                                              centered, &dim, &info);
+    }
+
+    for (size_t i = 0; i < nRows; i++)
+    {
+        algorithmFPType d = (algorithmFPType)0.0;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            d += centered[i * nFeatures + j] * centered[i * nFeatures + j];
+        }
+        distance[i] = d;
+    }
+}
+
+/**
+ *  \brief Adds the observations centered on the shift vector to the partial sums with the sign, +1 or -1,
+ *         the cross-products are updated by the rank-k update
+ */
+template <typename algorithmFPType, CpuType cpu>
+void accumulateBlockSums(const algorithmFPType *rows, size_t nFeatures, size_t nRows, algorithmFPType sign,
+                         algorithmFPType *sum, algorithmFPType *crossProduct)
+{
+    if (nRows == 0) { return; }
+
+    for (size_t i = 0; i < nRows; i++)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            sum[j] += sign * rows[i * nFeatures + j];
+        }
+    }
+
+    DAAL_INT dim = (DAAL_INT)nFeatures;
+    DAAL_INT n   = (DAAL_INT)nRows;
+    char uplo  = 'U';
+    char trans = 'N';
+    algorithmFPType one = (algorithmFPType)1.0;
+    Blas<algorithmFPType, cpu>::xxsyrk(&uplo, &trans, &dim, &n, &sign, const_cast<algorithmFPType *>(rows), &dim, &one,
+                                       crossProduct, &dim);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void OutlierDetectionKernel<algorithmFPType, baconDense, cpu>::computeMedian(const algorithmFPType *data, size_t nFeatures,
+                                                                             size_t nVectors, algorithmFPType *median)
+{
+    daal::tls<algorithmFPType *> tlsColumn([ = ]()
+    {
+        return daal::services::internal::service_malloc<algorithmFPType, cpu>(nVectors);
+    });
+
+    bool allocationFailed = false;
+    daal::threader_for(nFeatures, nFeatures, [ & ](int j)
+    {
+        algorithmFPType *column = tlsColumn.local();
+        if (!column) { allocationFailed = true; return; }
+
+        for (size_t i = 0; i < nVectors; i++)
+        {
+            column[i] = data[i * nFeatures + j];
+        }
+        daal::algorithms::internal::qSort<algorithmFPType, cpu>(nVectors, column);
+        median[j] = ((nVectors % 2) ? column[nVectors / 2] : (column[nVectors / 2 - 1] + column[nVectors / 2]) * (algorithmFPType)0.5);
+    });
+
+    tlsColumn.reduce([ = ](algorithmFPType *column)
+    {
+        daal::services::internal::service_free<algorithmFPType, cpu>(column);
+    });
+
+    if (allocationFailed) { this->_errors->add(services::ErrorMemoryAllocationFailed); }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void OutlierDetectionKernel<algorithmFPType, baconDense, cpu>::computeDistances(const algorithmFPType *data, size_t nFeatures,
+                                                                                size_t nVectors, const algorithmFPType *location,
+                                                                                const algorithmFPType *cholesky, algorithmFPType *distance,
+                                                                                double *times)
+{
+    size_t nBlocks = nVectors / baconBlockSize;
+    nBlocks += (nBlocks * baconBlockSize != nVectors);
+
+    daal::tls<BaconThreadData<algorithmFPType, cpu> *> tlsData([ = ]()
+    {
+        return new BaconThreadData<algorithmFPType, cpu>(nFeatures);
+    });
+
+    bool allocationFailed = false;
+    daal::threader_for(nBlocks, nBlocks, [ & ](int iBlock)
+    {
+        BaconThreadData<algorithmFPType, cpu> *local = tlsData.local();
+        if (local->allocationFailed) { allocationFailed = true; return; }
+
+        const size_t startRow = iBlock * baconBlockSize;
+        const size_t nRows = (startRow + baconBlockSize > nVectors ? nVectors - startRow : baconBlockSize);
+        const unsigned long long start = baconTime(times != NULL);
+        computeBlockDistances<algorithmFPType, cpu>(data + startRow * nFeatures, nFeatures, nRows, location, cholesky,
+                                                    local->centered, distance + startRow);
+        local->distancesTime += baconTime(times != NULL) - start;
+    });
+
+    tlsData.reduce([ = ](BaconThreadData<algorithmFPType, cpu> *local)
+    {
+        if (times) { times[baconDistancesTime] += baconSeconds(local->distancesTime); }
+        delete local;
+    });
+
+    if (allocationFailed) { this->_errors->add(services::ErrorMemoryAllocationFailed); }
+}
+
+/**
+ *  \brief Updates the basic subset by the blocks of observations processed in parallel.
+ *         If computeMembership is true, the observations closer to the location of the subset than the threshold form the new subset,
+ *         and only the observations that enter or leave the subset update its statistics. Otherwise the statistics are accumulated
+ *         for the observations with the non-zero weights
+ *
+ *  \return Number of the observations in the new subset
+ */
+template <typename algorithmFPType, CpuType cpu>
+size_t OutlierDetectionKernel<algorithmFPType, baconDense, cpu>::updateSubset(const algorithmFPType *data, size_t nFeatures,
+                                                                              size_t nVectors, algorithmFPType *weight,
+                                                                              BaconSubset<algorithmFPType, cpu> &subset,
+                                                                              bool computeMembership, algorithmFPType thresholdSq,
+                                                                              size_t &nLeaving, double *times)
+{
+    size_t nBlocks = nVectors / baconBlockSize;
+    nBlocks += (nBlocks * baconBlockSize != nVectors);
+
+    daal::tls<BaconThreadData<algorithmFPType, cpu> *> tlsData([ = ]()
+    {
+        return new BaconThreadData<algorithmFPType, cpu>(nFeatures);
+    });
+
+    const algorithmFPType *shift = subset.shift;
+    const algorithmFPType *location = subset.location;
+    const algorithmFPType *cholesky = subset.cholesky;
+    bool allocationFailed = false;
+    daal::threader_for(nBlocks, nBlocks, [ & ](int iBlock)
+    {
+        BaconThreadData<algorithmFPType, cpu> *local = tlsData.local();
+        if (local->allocationFailed) { allocationFailed = true; return; }
+
+        const size_t startRow = iBlock * baconBlockSize;
+        const size_t nRows = (startRow + baconBlockSize > nVectors ? nVectors - startRow : baconBlockSize);
+        const algorithmFPType *blockData = data + startRow * nFeatures;
+        algorithmFPType *blockWeight = weight + startRow;
+
+        if (computeMembership)
+        {
+            const unsigned long long start = baconTime(times != NULL);
+            computeBlockDistances<algorithmFPType, cpu>(blockData, nFeatures, nRows, location, cholesky,
+                                                        local->centered, local->distance);
+            local->distancesTime += baconTime(times != NULL) - start;
+        }
+
+        const unsigned long long start = baconTime(times != NULL);
+
+        size_t nBlockEntering = 0, nBlockLeaving = 0;
+        for (size_t i = 0; i < nRows; i++)
+        {
+            const bool inOldSubset = (blockWeight[i] != (algorithmFPType)0.0);
+            const bool inNewSubset = (computeMembership ? local->distance[i] < thresholdSq : inOldSubset);
+            local->nRows += inNewSubset;
+            blockWeight[i] = (inNewSubset ? (algorithmFPType)1.0 : (algorithmFPType)0.0);
+            const bool isEntering = inNewSubset && !(computeMembership && inOldSubset);
+            const bool isLeaving  = inOldSubset && !inNewSubset;
+            if (!isEntering && !isLeaving) { continue; }
+
+            algorithmFPType *row = (isEntering ? local->entering + (nBlockEntering++) * nFeatures :
+                                    local->leaving + (nBlockLeaving++) * nFeatures);
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                row[j] = blockData[i * nFeatures + j] - shift[j];
+            }
+        }
+
+        accumulateBlockSums<algorithmFPType, cpu>(local->entering, nFeatures, nBlockEntering, (algorithmFPType)1.0,
+                                                  local->sum, local->crossProduct);
+        accumulateBlockSums<algorithmFPType, cpu>(local->leaving, nFeatures, nBlockLeaving, (algorithmFPType)-1.0,
+                                                  local->sum, local->crossProduct);
+        local->nLeaving += nBlockLeaving;
+        local->subsetUpdateTime += baconTime(times != NULL) - start;
+    });
+
+    size_t nNewRows = 0;
+    nLeaving = 0;
+    tlsData.reduce([ & ](BaconThreadData<algorithmFPType, cpu> *local)
+    {
+        if (!local->allocationFailed)
+        {
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                subset.sum[j] += local->sum[j];
+            }
+            for (size_t j = 0; j < nFeatures * nFeatures; j++)
+            {
+                subset.crossProduct[j] += local->crossProduct[j];
+            }
+            nNewRows += local->nRows;
+            nLeaving += local->nLeaving;
+        }
+        if (times)
+        {
+            times[baconDistancesTime]    += baconSeconds(local->distancesTime);
+            times[baconSubsetUpdateTime] += baconSeconds(local->subsetUpdateTime);
+        }
+        delete local;
+    });
+
+    if (allocationFailed) { this->_errors->add(services::ErrorMemoryAllocationFailed); }
+    subset.nRows = nNewRows;
+    return nNewRows;
+}
+
+/**
+ *  \brief Selects the initial basic subset of the observations with the smallest distances. The size of the subset
+ *         is increased while its variance-covariance matrix is not positive definite
+ */
+template <typename algorithmFPType, CpuType cpu>
+bool OutlierDetectionKernel<algorithmFPType, baconDense, cpu>::selectInitialSubset(const algorithmFPType *data, size_t nFeatures,
+                                                                                   size_t nVectors, algorithmFPType *distance,
+                                                                                   algorithmFPType *weight,
+                                                                                   BaconSubset<algorithmFPType, cpu> &subset,
+                                                                                   double *times)
+{
+    TArray<algorithmFPType, cpu> sortedDistancePtr(nVectors);
+    algorithmFPType *sortedDistance = sortedDistancePtr.get();
+    if (!sortedDistance) { this->_errors->add(services::ErrorMemoryAllocationFailed); return false; }
+
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        sortedDistance[i] = distance[i];
+    }
+    daal::algorithms::internal::qSort<algorithmFPType, cpu>(nVectors, sortedDistance);
+
+    size_t nInitRows = baconInitSubsetFactor * nFeatures;
+    if (nInitRows > nVectors) { nInitRows = nVectors; }
+
+    const algorithmFPType *shift = subset.shift;
+    for (;;)
+    {
+        const algorithmFPType threshold = sortedDistance[nInitRows - 1];
+        for (size_t i = 0; i < nVectors; i++)
+        {
+            weight[i] = (distance[i] <= threshold ? (algorithmFPType)1.0 : (algorithmFPType)0.0);
+        }
+
+        size_t nLeaving = 0;
+        subset.reset(shift);
+        updateSubset(data, nFeatures, nVectors, weight, subset, false, (algorithmFPType)0.0, nLeaving, times);
+        if (!this->_errors->isEmpty()) { return false; }
+
+        const unsigned long long start = baconTime(times != NULL);
+        const bool isPositiveDefinite = subset.computeCholeskyFactor();
+        if (times) { times[baconCholeskyTime] += baconSeconds(baconTime(true) - start); }
+        if (isPositiveDefinite) { return true; }
+        if (nInitRows == nVectors) { this->_errors->add(services::ErrorOutlierDetectionInternal); return false; }
+
+        nInitRows = (2 * nInitRows < nVectors ? 2 * nInitRows : nVectors);
+    }
+}
+
+/**
+ *  \brief Returns the squared threshold of the distances for the basic subset of nSubsetRows observations:
+ *         the corrected square root of the (1 - alpha) quantile of the chi-square distribution with nFeatures degrees of freedom
+ */
+template <typename algorithmFPType, CpuType cpu>
+algorithmFPType OutlierDetectionKernel<algorithmFPType, baconDense, cpu>::computeThreshold(size_t nFeatures, size_t nVectors,
+                                                                                          size_t nSubsetRows, double alpha)
+{
+    const double p = (double)nFeatures;
+    const double n = (double)nVectors;
+    const double r = (double)nSubsetRows;
+    const double h = (double)((nVectors + nFeatures + 1) / 2);
+
+    double cnp = 1.0;
+    if (n > p)         { cnp += (p + 1.0) / (n - p); }
+    if (n - h - p > 0) { cnp += 1.0 / (n - h - p); }
+    const double chr = (h > r ? (h - r) / (h + r) : 0.0);
+
+    /* Wilson-Hilferty approximation of the quantile of the chi-square distribution */
+    const double z = -Math<double, cpu>::sCdfNormInv(alpha);
+    const double a = 2.0 / (9.0 * p);
+    const double q = 1.0 - a + z * Math<double, cpu>::sSqrt(a);
+    const double chiSquare = p * q * q * q;
+
+    const double c = cnp + chr;
+    return (algorithmFPType)(c * c * chiSquare);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void OutlierDetectionKernel<algorithmFPType, baconDense, cpu>::compute(const NumericTable *a, NumericTable *r, NumericTable *t,
+                                                                       const daal::algorithms::Parameter *par)
+{
+    Parameter<baconDense> defaultParameter;
+    const Parameter<baconDense> *odPar = (par ? static_cast<const Parameter<baconDense> *>(par) : &defaultParameter);
 
     BlockMicroTable<algorithmFPType, readOnly, cpu> mtA(a);
     FeatureMicroTable<algorithmFPType, writeOnly, cpu> mtR(r);
@@ -82,12 +480,120 @@ void OutlierDetectionKernel<algorithmFPType, baconDense, cpu>::compute(const Num
     algorithmFPType *data, *weight;
     mtA.getBlockOfRows(0, nVectors, &data);
     mtR.getBlockOfColumnValues(0, 0, nVectors, &weight);
+    if (!data || !weight) { mtA.release(); mtR.release(); this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
 
-    Statistics<algorithmFPType, cpu>::xoutlierdetection(data, (__int64)nFeatures, (__int64)nVectors, nBaconParams, baconParams, weight);
+    BaconSubset<algorithmFPType, cpu> subset(nFeatures);
+    TArray<algorithmFPType, cpu> distancePtr(nVectors);
+    algorithmFPType *distance = distancePtr.get();
+    if (!subset.isValid() || !distance) { mtA.release(); mtR.release(); this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+    /* Execution times of the initialization and of each iteration, one row of baconNumberOfTimings values per step */
+    const bool measure = (t && odPar->computeTimings);
+    TArray<double, cpu> timesPtr(measure ? (baconMaxIterations + 1) * baconNumberOfTimings : 0);
+    double *times = timesPtr.get();
+    if (measure && !times) { mtA.release(); mtR.release(); this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+    for (size_t i = 0; i < timesPtr.size(); i++)
+    {
+        times[i] = 0.0;
+    }
+
+    /* Initial basic subset: the observations closest to the mean of all observations in the Mahalanobis distance
+       or to the coordinate-wise median in the Euclidean distance */
+    {
+        DAAL_TRACE_SCOPE("algorithm", "bacon.init");
+        const unsigned long long initStart = baconTime(measure);
+        if (odPar->initMethod == baconMahalanobis)
+        {
+            for (size_t i = 0; i < nVectors; i++)
+            {
+                weight[i] = (algorithmFPType)1.0;
+            }
+            size_t nLeaving = 0;
+            subset.reset(data);
+            updateSubset(data, nFeatures, nVectors, weight, subset, false, (algorithmFPType)0.0, nLeaving, times);
+            if (this->_errors->isEmpty())
+            {
+                const unsigned long long start = baconTime(measure);
+                const bool isPositiveDefinite = subset.computeCholeskyFactor();
+                if (measure) { times[baconCholeskyTime] += baconSeconds(baconTime(true) - start); }
+                if (!isPositiveDefinite) { this->_errors->add(services::ErrorOutlierDetectionInternal); }
+            }
+            if (this->_errors->isEmpty())
+            {
+                computeDistances(data, nFeatures, nVectors, subset.location, subset.cholesky, distance, times);
+                subset.reset(subset.location);
+            }
+        }
+        else
+        {
+            TArray<algorithmFPType, cpu> medianPtr(nFeatures);
+            algorithmFPType *median = medianPtr.get();
+            if (!median) { this->_errors->add(services::ErrorMemoryAllocationFailed); }
+            if (this->_errors->isEmpty()) { computeMedian(data, nFeatures, nVectors, median); }
+            if (this->_errors->isEmpty())
+            {
+                computeDistances(data, nFeatures, nVectors, median, NULL, distance, times);
+                subset.reset(median);
+            }
+        }
+        if (this->_errors->isEmpty()) { selectInitialSubset(data, nFeatures, nVectors, distance, weight, subset, times); }
+        if (measure) { times[baconTotalTime] = baconSeconds(baconTime(true) - initStart); }
+    }
+    distancePtr.reset(0);
+
+    /* Each iteration computes the distances to the current subset and forms the new subset in one pass over the data.
+       The statistics of the subset are updated with the observations that enter or leave it */
+    size_t nSubsetRows = subset.nRows;
+    for (size_t iteration = 0; iteration < baconMaxIterations && this->_errors->isEmpty(); iteration++)
+    {
+        DAAL_TRACE_SCOPE("algorithm", "bacon.iteration");
+        double *iterationTimes = (measure ? times + (iteration + 1) * baconNumberOfTimings : NULL);
+        const unsigned long long iterationStart = baconTime(measure);
+
+        const unsigned long long choleskyStart = baconTime(measure);
+        const bool isPositiveDefinite = subset.computeCholeskyFactor();
+        if (measure) { iterationTimes[baconCholeskyTime] = baconSeconds(baconTime(true) - choleskyStart); }
+        if (!isPositiveDefinite) { this->_errors->add(services::ErrorOutlierDetectionInternal); break; }
+
+        const algorithmFPType thresholdSq = computeThreshold(nFeatures, nVectors, nSubsetRows, odPar->alpha);
+        size_t nLeaving = 0;
+        const size_t nNewRows = updateSubset(data, nFeatures, nVectors, weight, subset, true, thresholdSq, nLeaving,
+                                             iterationTimes);
+        if (!this->_errors->isEmpty()) { break; }
+
+        if (nLeaving > nNewRows)
+        {
+            /* Most of the observations left the subset, the statistics are accumulated again to avoid the cancellation */
+            const unsigned long long rebuildStart = baconTime(measure);
+            subset.reset(subset.location);
+            updateSubset(data, nFeatures, nVectors, weight, subset, false, (algorithmFPType)0.0, nLeaving, NULL);
+            if (measure) { iterationTimes[baconRebuildTime] = baconSeconds(baconTime(true) - rebuildStart); }
+        }
+        if (measure) { iterationTimes[baconTotalTime] = baconSeconds(baconTime(true) - iterationStart); }
+
+        const size_t change = (nNewRows > nSubsetRows ? nNewRows - nSubsetRows : nSubsetRows - nNewRows);
+        const bool converged = (change == 0 || (double)change < odPar->toleranceToConverge * (double)nSubsetRows);
+        nSubsetRows = nNewRows;
+        if (converged) { break; }
+    }
 
     mtA.release();
     mtR.release();
-    if (par == NULL) { delete odPar; }
+
+    if (measure && this->_errors->isEmpty())
+    {
+        /* The rows of the iterations that are not performed contain zeros */
+        const size_t nRows = baconMaxIterations + 1;
+        BlockMicroTable<double, writeOnly, cpu> mtT(t);
+        double *timesTable;
+        mtT.getBlockOfRows(0, nRows, &timesTable);
+        if (!timesTable) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+        for (size_t i = 0; i < nRows * baconNumberOfTimings; i++)
+        {
+            timesTable[i] = times[i];
+        }
+        mtT.release();
+    }
 }
 
 } // namespace internal
@@ -30,6 +30,7 @@
 #include "service_micro_table.h"
 #include "service_numeric_table.h"
 #include "service_math.h"
+#include "threading.h"
 
 #include "outlierdetection_multivariate_kernel.h"
 
@@ -45,10 +46,91 @@ namespace multivariate_outlier_detection
 namespace internal
 {
 
+/* Number of observations in the block processed by one task */
+const size_t baconBlockSize = 1024;
+
+/* The size of the initial basic subset is baconInitSubsetFactor * nFeatures */
+const size_t baconInitSubsetFactor = 4;
+
+/**
+ *  \brief Statistics of the basic subset of observations: the sums of the observations and their cross-products
+ *         centered on the fixed shift vector, which are updated with the observations that enter or leave the subset
+ */
+template <typename algorithmFPType, CpuType cpu>
+class BaconSubset
+{
+public:
+    BaconSubset(size_t nFeatures);
+
+    bool isValid() const { return _buffer.get() != NULL; }
+
+    /** Sets the shift vector and makes the subset empty, the shift vector may be the location of the subset */
+    void reset(const algorithmFPType *newShift);
+
+    /**
+     *  \brief Computes the mean of the subset and the Cholesky factor U of its variance-covariance matrix, S = U'U
+     *  \return false if the variance-covariance matrix is not positive definite
+     */
+    bool computeCholeskyFactor();
+
+    size_t nFeatures;
+    size_t nRows;                       /* Number of observations in the subset */
+    algorithmFPType *shift;             /* Vector the observations are centered on */
+    algorithmFPType *sum;               /* Sums of the centered observations */
+    algorithmFPType *crossProduct;      /* Cross-products of the centered observations, upper triangle */
+    algorithmFPType *location;          /* Mean of the subset */
+    algorithmFPType *cholesky;          /* Cholesky factor of the variance-covariance matrix, upper triangle */
+
+private:
+    TArray<algorithmFPType, cpu> _buffer;
+};
+
+/**
+ *  \brief Buffers and partial sums of the thread that processes the blocks of observations
+ */
+template <typename algorithmFPType, CpuType cpu>
+struct BaconThreadData
+{
+    BaconThreadData(size_t nFeatures);
+
+    algorithmFPType *sum;               /* Partial sums of the centered observations */
+    algorithmFPType *crossProduct;      /* Partial cross-products of the centered observations */
+    algorithmFPType *centered;          /* Block of the observations centered on the location of the subset */
+    algorithmFPType *entering;          /* Observations of the block that enter the subset */
+    algorithmFPType *leaving;           /* Observations of the block that leave the subset */
+    algorithmFPType *distance;          /* Squared distances of the observations of the block */
+    size_t nRows;                       /* Number of the observations in the new subset */
+    size_t nLeaving;                    /* Number of the observations that leave the subset */
+    unsigned long long distancesTime;   /* Time of the distance computations in nanoseconds */
+    unsigned long long subsetUpdateTime; /* Time of the updates of the partial sums in nanoseconds */
+    bool allocationFailed;
+
+private:
+    TArray<algorithmFPType, cpu> _buffer;
+};
+
 template <typename algorithmFPType, CpuType cpu>
 struct OutlierDetectionKernel<algorithmFPType, baconDense, cpu> : public Kernel
 {
-    void compute(const NumericTable *a, NumericTable *r, const daal::algorithms::Parameter *par);
+    void compute(const NumericTable *a, NumericTable *r, NumericTable *t, const daal::algorithms::Parameter *par);
+
+protected:
+    void computeMedian(const algorithmFPType *data, size_t nFeatures, size_t nVectors, algorithmFPType *median);
+
+    /* The times arrays of size baconNumberOfTimings accumulate the execution times in seconds, they are NULL
+       if the times are not measured */
+    void computeDistances(const algorithmFPType *data, size_t nFeatures, size_t nVectors,
+                          const algorithmFPType *location, const algorithmFPType *cholesky, algorithmFPType *distance,
+                          double *times);
+
+    bool selectInitialSubset(const algorithmFPType *data, size_t nFeatures, size_t nVectors, algorithmFPType *distance,
+                             algorithmFPType *weight, BaconSubset<algorithmFPType, cpu> &subset, double *times);
+
+    size_t updateSubset(const algorithmFPType *data, size_t nFeatures, size_t nVectors, algorithmFPType *weight,
+                        BaconSubset<algorithmFPType, cpu> &subset, bool computeMembership, algorithmFPType thresholdSq,
+                        size_t &nLeaving, double *times);
+
+    algorithmFPType computeThreshold(size_t nFeatures, size_t nVectors, size_t nSubsetRows, double alpha);
 };
 
 } // namespace internal
@@ -164,7 +164,7 @@ computeInternal(size_t nFeatures, size_t nVectors,
 
 template <typename algorithmFPType, CpuType cpu>
 void OutlierDetectionKernel<algorithmFPType, defaultDense, cpu>::
-compute(const NumericTable *a, NumericTable *r, const daal::algorithms::Parameter *par)
+compute(const NumericTable *a, NumericTable *r, NumericTable *t, const daal::algorithms::Parameter *par)
 {
 
     /* Create micro-tables for input data and output results */
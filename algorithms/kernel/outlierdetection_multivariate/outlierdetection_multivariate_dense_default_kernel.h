@@ -63,7 +63,7 @@ struct OutlierDetectionKernel<algorithmFPType, defaultDense, cpu> : public Kerne
                                 algorithmFPType *location, algorithmFPType *scatter, algorithmFPType threshold,
                                 algorithmFPType *buffer);
 
-    void compute(const NumericTable *a, NumericTable *r, const daal::algorithms::Parameter *par);
+    void compute(const NumericTable *a, NumericTable *r, NumericTable *t, const daal::algorithms::Parameter *par);
 };
 
 } // namespace internal
@@ -41,10 +41,14 @@ namespace multivariate_outlier_detection
 namespace internal
 {
 
+/* Maximal number of iterations of the BACON method, guards against the oscillation of the basic subset */
+const size_t baconMaxIterations = 100;
+
 template <typename algorithmFPType, Method method, CpuType cpu>
 struct OutlierDetectionKernel : public Kernel
 {
-    void compute(const NumericTable *a, NumericTable *r, const daal::algorithms::Parameter *par);
+    /* The table t of the execution times is NULL if the times are not requested, it is used only by the BACON method */
+    void compute(const NumericTable *a, NumericTable *r, NumericTable *t, const daal::algorithms::Parameter *par);
 };
 
 } // namespace internal
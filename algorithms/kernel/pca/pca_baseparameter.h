@@ -41,6 +41,20 @@ DAAL_EXPORT BaseParameter<algorithmFPType, method>::BaseParameter() :
         initializationProcedure(services::SharedPtr<PartialResultsInitIface<method> >(new DefaultPartialResultsInit<method>()))
     {};
 
+/** Constructs PCA randomized SVD parameters */
+template<typename algorithmFPType>
+DAAL_EXPORT BaseParameter<algorithmFPType, randomizedSvd>::BaseParameter() :
+        RandomizedSvdParameter(),
+        initializationProcedure(services::SharedPtr<PartialResultsInitIface<randomizedSvd> >(new DefaultPartialResultsInit<randomizedSvd>()))
+    {};
+
+template<typename algorithmFPType>
+DAAL_EXPORT void BaseParameter<algorithmFPType, randomizedSvd>::check() const
+{
+    RandomizedSvdParameter::check();
+    DAAL_CHECK(initializationProcedure, ErrorNullInitializationProcedure);
+}
+
 }// namespace interface1
 } // namespace pca
 } // namespace algorithms
@@ -34,6 +34,8 @@ namespace interface1
 
 template DAAL_EXPORT BaseParameter<DAAL_FPTYPE, correlationDense>::BaseParameter();
 template DAAL_EXPORT BaseParameter<DAAL_FPTYPE, svdDense>::BaseParameter();
+template DAAL_EXPORT BaseParameter<DAAL_FPTYPE, randomizedSvd>::BaseParameter();
+template DAAL_EXPORT void BaseParameter<DAAL_FPTYPE, randomizedSvd>::check() const;
 
 }// namespace interface1
 }// namespace pca
@@ -0,0 +1,74 @@
+/* file: pca_dense_randomized_batch_container.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of PCA randomized SVD algorithm container.
+//--
+*/
+
+#ifndef __PCA_DENSE_RANDOMIZED_BATCH_CONTAINER_H__
+#define __PCA_DENSE_RANDOMIZED_BATCH_CONTAINER_H__
+
+#include "kernel.h"
+#include "pca_batch.h"
+#include "pca_dense_randomized_kernel.h"
+#include "pca_dense_svd_container.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+
+template <typename algorithmFPType, CpuType cpu>
+BatchContainer<algorithmFPType, randomizedSvd, cpu>::BatchContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::PCARandomizedBatchKernel, algorithmFPType);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+BatchContainer<algorithmFPType, randomizedSvd, cpu>::~BatchContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void BatchContainer<algorithmFPType, randomizedSvd, cpu>::compute()
+{
+    Input *input = static_cast<Input *>(_in);
+    Result *result = static_cast<Result *>(_res);
+    RandomizedSvdParameter *parameter = static_cast<RandomizedSvdParameter *>(_par);
+
+    internal::InputDataType dtype = getInputDataType(input);
+
+    data_management::NumericTablePtr data = input->get(pca::data);
+    data_management::NumericTablePtr eigenvalues  = result->get(pca::eigenvalues);
+    data_management::NumericTablePtr eigenvectors = result->get(pca::eigenvectors);
+
+    daal::services::Environment::env &env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::PCARandomizedBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType), setType, dtype);
+    __DAAL_CALL_KERNEL(env, internal::PCARandomizedBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType), compute,
+                       data, eigenvalues, eigenvectors, parameter);
+}
+
+}
+}
+} // namespace daal
+#endif
@@ -0,0 +1,537 @@
+/* file: pca_dense_randomized_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Functions that are used in the randomized SVD method of the PCA algorithm
+//--
+*/
+
+#ifndef __PCA_DENSE_RANDOMIZED_IMPL_I__
+#define __PCA_DENSE_RANDOMIZED_IMPL_I__
+
+#include "service_math.h"
+#include "service_memory.h"
+#include "service_numeric_table.h"
+#include "threading.h"
+
+#include "svd/svd_dense_randomized_impl.i"
+
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace internal
+{
+
+#define _RANDOMIZED_BLOCK_SIZE_ 256
+
+/**
+ *  \brief Adds the values computed by each thread for the blocks of rows of the data set to the array res
+ *
+ *  \return false if the memory allocation failed
+ */
+template <typename algorithmFPType, CpuType cpu, typename BlockFunc>
+bool sumOverBlocksOfRows(size_t nRows, size_t nCols, algorithmFPType *res, const BlockFunc &func)
+{
+    /* Split rows by blocks, the last block can be bigger than others */
+    size_t numRowsInBlock = (nRows > _RANDOMIZED_BLOCK_SIZE_) ? _RANDOMIZED_BLOCK_SIZE_ : nRows;
+    size_t numBlocks = nRows / numRowsInBlock;
+    size_t numRowsInLastBlock = numRowsInBlock + (nRows - numBlocks * numRowsInBlock);
+
+    daal::tls<algorithmFPType *> tlsData([ = ]()
+    {
+        return service_scalable_calloc<algorithmFPType, cpu>(nCols);
+    });
+
+    daal::threader_for(numBlocks, numBlocks, [ & ](size_t iBlock)
+    {
+        algorithmFPType *local = tlsData.local();
+        if (!local) { return; }
+
+        size_t startRow = iBlock * numRowsInBlock;
+        size_t nRowsLocal = (iBlock < (numBlocks - 1)) ? numRowsInBlock : numRowsInLastBlock;
+        func(startRow, nRowsLocal, local);
+    } );
+
+    bool isValid = true;
+    for (size_t j = 0; j < nCols; j++)
+    {
+        res[j] = 0;
+    }
+    tlsData.reduce([ &isValid, res, nCols ](algorithmFPType *local)
+    {
+        if (!local) { isValid = false; return; }
+        for (size_t j = 0; j < nCols; j++)
+        {
+            res[j] += local[j];
+        }
+        service_scalable_free<algorithmFPType, cpu>(local);
+    } );
+    return isValid;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+bool PCARandomizedKernelBase<algorithmFPType, cpu>::computeColumnStatistics(size_t nRows, size_t nCols, const algorithmFPType *x,
+                                                                            algorithmFPType *mean, algorithmFPType *css)
+{
+    if (!sumOverBlocksOfRows<algorithmFPType, cpu>(nRows, nCols, mean, [ = ](size_t startRow, size_t nRowsLocal, algorithmFPType *sums)
+    {
+        for (size_t i = startRow; i < startRow + nRowsLocal; i++)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nCols; j++)
+            {
+                sums[j] += x[i * nCols + j];
+            }
+        }
+    } ))
+    {
+        return false;
+    }
+
+    const algorithmFPType invN = (algorithmFPType)1.0 / (algorithmFPType)nRows;
+    for (size_t j = 0; j < nCols; j++)
+    {
+        mean[j] *= invN;
+    }
+
+    /* Centered sums of squares are computed in the second pass over the data for the numerical stability */
+    return sumOverBlocksOfRows<algorithmFPType, cpu>(nRows, nCols, css, [ = ](size_t startRow, size_t nRowsLocal, algorithmFPType *sums)
+    {
+        for (size_t i = startRow; i < startRow + nRowsLocal; i++)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nCols; j++)
+            {
+                algorithmFPType delta = x[i * nCols + j] - mean[j];
+                sums[j] += delta * delta;
+            }
+        }
+    } );
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void PCARandomizedKernelBase<algorithmFPType, cpu>::decomposeSketch(size_t nRows, size_t nCols, algorithmFPType *m, size_t nObservations,
+                                                                    data_management::NumericTable *eigenvaluesTable,
+                                                                    data_management::NumericTable *eigenvectorsTable)
+{
+    const size_t nComponents = eigenvaluesTable->getNumberOfColumns();
+    const size_t rank = (nRows < nCols ? nRows : nCols);
+
+    algorithmFPType *s = service_calloc<algorithmFPType, cpu>(rank);
+    algorithmFPType *v = service_calloc<algorithmFPType, cpu>(rank * nCols);
+    if (!s || !v)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+    }
+    else if (!svd::internal::computeSketchSVD<algorithmFPType, cpu>(nRows, nCols, m, s, v, 0))
+    {
+        this->_errors->add(services::ErrorFailedToComputeRandomizedDecomposition);
+    }
+    else
+    {
+        BlockDescriptor<algorithmFPType> eigenvaluesBlock;
+        eigenvaluesTable->getBlockOfRows(0, 1, data_management::writeOnly, eigenvaluesBlock);
+        algorithmFPType *eigenvalues = eigenvaluesBlock.getBlockPtr();
+
+        BlockDescriptor<algorithmFPType> eigenvectorsBlock;
+        eigenvectorsTable->getBlockOfRows(0, nComponents, data_management::writeOnly, eigenvectorsBlock);
+        algorithmFPType *eigenvectors = eigenvectorsBlock.getBlockPtr();
+
+        /* Components beyond the rank of the sketch are zero */
+        for (size_t i = 0; i < nComponents; i++)
+        {
+            algorithmFPType value = (i < rank ? s[i] : (algorithmFPType)0);
+            eigenvalues[i] = (nObservations ? value * value / (algorithmFPType)(nObservations - 1) : value);
+
+            for (size_t j = 0; j < nCols; j++)
+            {
+                eigenvectors[i * nCols + j] = (i < rank ? v[i * nCols + j] : (algorithmFPType)0);
+            }
+        }
+
+        eigenvaluesTable->releaseBlockOfRows(eigenvaluesBlock);
+        eigenvectorsTable->releaseBlockOfRows(eigenvectorsBlock);
+    }
+
+    service_free<algorithmFPType, cpu>(s);
+    service_free<algorithmFPType, cpu>(v);
+}
+
+/**
+ *  Auxiliary table of the block of nRows rows of the data set contains nSketch + 2 rows:
+ *      rows 0 .. nSketch - 1   the sketch of the centered block, B * diag(sigma)
+ *      row  nSketch            sqrt(nRows) * mean of the block
+ *      row  nSketch + 1        sqrt(nRows)
+ *  The centered data set is stacked from the centered blocks shifted by their means minus the total mean,
+ *  so the stacked matrix consists of the sketches and the rows sqrt(nRows) * (mean of the block - total mean)
+ */
+template <typename algorithmFPType, CpuType cpu>
+void PCARandomizedKernelBase<algorithmFPType, cpu>::mergeSketches(size_t nObservations, const algorithmFPType *sums,
+                                                                  const algorithmFPType *ssq, data_management::DataCollection &sketches,
+                                                                  data_management::NumericTable *eigenvalues,
+                                                                  data_management::NumericTable *eigenvectors)
+{
+    const size_t nCols = eigenvectors->getNumberOfColumns();
+    const size_t nSketches = sketches.size();
+
+    size_t nStackedRows = 0;
+    for (size_t i = 0; i < nSketches; i++)
+    {
+        nStackedRows += static_cast<NumericTable *>(sketches[i].get())->getNumberOfRows() - 1;
+    }
+
+    algorithmFPType *mean     = service_calloc<algorithmFPType, cpu>(nCols);
+    algorithmFPType *invSigma = service_calloc<algorithmFPType, cpu>(nCols);
+    algorithmFPType *stacked  = service_calloc<algorithmFPType, cpu>(nStackedRows * nCols);
+    if (!mean || !invSigma || !stacked)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        service_free<algorithmFPType, cpu>(mean);
+        service_free<algorithmFPType, cpu>(invSigma);
+        service_free<algorithmFPType, cpu>(stacked);
+        return;
+    }
+
+    const algorithmFPType n = (algorithmFPType)nObservations;
+    for (size_t j = 0; j < nCols; j++)
+    {
+        mean[j] = sums[j] / n;
+        algorithmFPType variance = (nObservations > 1 ? (ssq[j] - n * mean[j] * mean[j]) / (n - 1) : (algorithmFPType)0);
+        invSigma[j] = (variance > 0 ? (algorithmFPType)1.0 / daal::internal::Math<algorithmFPType, cpu>::sSqrt(variance) : (algorithmFPType)0);
+    }
+
+    algorithmFPType *row = stacked;
+    for (size_t i = 0; i < nSketches; i++)
+    {
+        NumericTable *sketchTable = static_cast<NumericTable *>(sketches[i].get());
+        const size_t nSketch = sketchTable->getNumberOfRows() - 2;
+
+        BlockDescriptor<algorithmFPType> block;
+        sketchTable->getBlockOfRows(0, nSketch + 2, data_management::readOnly, block);
+        const algorithmFPType *sketch = block.getBlockPtr();
+        const algorithmFPType *scaledMean = sketch + nSketch * nCols;
+        const algorithmFPType *sqrtN = scaledMean + nCols;
+
+        for (size_t k = 0; k < nSketch; k++, row += nCols)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nCols; j++)
+            {
+                row[j] = sketch[k * nCols + j] * invSigma[j];
+            }
+        }
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nCols; j++)
+        {
+            row[j] = (scaledMean[j] - sqrtN[j] * mean[j]) * invSigma[j];
+        }
+        row += nCols;
+
+        sketchTable->releaseBlockOfRows(block);
+    }
+
+    decomposeSketch(nStackedRows, nCols, stacked, nObservations, eigenvalues, eigenvectors);
+
+    service_free<algorithmFPType, cpu>(mean);
+    service_free<algorithmFPType, cpu>(invSigma);
+    service_free<algorithmFPType, cpu>(stacked);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void PCARandomizedBatchKernel<algorithmFPType, cpu>::compute(const data_management::NumericTablePtr &data,
+                                                             data_management::NumericTablePtr &eigenvalues,
+                                                             data_management::NumericTablePtr &eigenvectors,
+                                                             const RandomizedSvdParameter *parameter)
+{
+    const size_t nRows = data->getNumberOfRows();
+    const size_t nCols = data->getNumberOfColumns();
+
+    size_t nSketch = parameter->nComponents + parameter->nOversamples;
+    if (nSketch > nCols) { nSketch = nCols; }
+    if (nSketch > nRows) { nSketch = nRows; }
+
+    BlockDescriptor<algorithmFPType> block;
+    data->getBlockOfRows(0, nRows, data_management::readOnly, block);
+    const algorithmFPType *x = block.getBlockPtr();
+
+    /* Normalized data set and correlation matrix are decomposed as is */
+    algorithmFPType *mean = 0;
+    algorithmFPType *invSigma = 0;
+    if (this->_type == nonNormalizedDataset)
+    {
+        mean     = service_calloc<algorithmFPType, cpu>(nCols);
+        invSigma = service_calloc<algorithmFPType, cpu>(nCols);
+        if (!mean || !invSigma || !this->computeColumnStatistics(nRows, nCols, x, mean, invSigma))
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+        }
+        else
+        {
+            for (size_t j = 0; j < nCols; j++)
+            {
+                invSigma[j] = (invSigma[j] > 0 ?
+                               daal::internal::Math<algorithmFPType, cpu>::sSqrt((algorithmFPType)(nRows - 1) / invSigma[j]) : (algorithmFPType)0);
+            }
+        }
+    }
+
+    if (this->_errors->size() == 0)
+    {
+        svd::internal::RandomizedRangeFinder<algorithmFPType, cpu> finder(nRows, nCols, nSketch);
+        if (!finder.isValid())
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+        }
+        else if (!finder.compute(x, mean, invSigma, parameter->nPowerIterations, parameter->seed))
+        {
+            this->_errors->add(services::ErrorFailedToComputeRandomizedDecomposition);
+        }
+        else
+        {
+            const size_t nObservations = (this->_type == correlation ? 0 : nRows);
+            this->decomposeSketch(nSketch, nCols, finder.getSketch(), nObservations, eigenvalues.get(), eigenvectors.get());
+        }
+    }
+
+    data->releaseBlockOfRows(block);
+    service_free<algorithmFPType, cpu>(mean);
+    service_free<algorithmFPType, cpu>(invSigma);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void PCARandomizedOnlineKernel<algorithmFPType, cpu>::compute(const data_management::NumericTablePtr &data,
+                                                              data_management::NumericTablePtr &nObservations,
+                                                              data_management::NumericTablePtr &sumSVD,
+                                                              data_management::NumericTablePtr &sumSquaresSVD,
+                                                              data_management::NumericTablePtr &auxiliaryTable,
+                                                              const RandomizedSvdParameter *parameter)
+{
+    if(this->_type == correlation)
+    {
+        this->_errors->add(services::ErrorInputCorrelationNotSupportedInOnlineAndDistributed);
+        return;
+    }
+
+    const size_t nRows = data->getNumberOfRows();
+    const size_t nCols = data->getNumberOfColumns();
+    const size_t nSketch = auxiliaryTable->getNumberOfRows() - 2;
+
+    algorithmFPType *mean     = service_calloc<algorithmFPType, cpu>(nCols);
+    algorithmFPType *sigma    = service_calloc<algorithmFPType, cpu>(nCols);
+    algorithmFPType *invSigma = service_calloc<algorithmFPType, cpu>(nCols);
+
+    BlockDescriptor<algorithmFPType> block;
+    data->getBlockOfRows(0, nRows, data_management::readOnly, block);
+    const algorithmFPType *x = block.getBlockPtr();
+
+    if (!mean || !sigma || !invSigma || !this->computeColumnStatistics(nRows, nCols, x, mean, sigma))
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        data->releaseBlockOfRows(block);
+        service_free<algorithmFPType, cpu>(mean);
+        service_free<algorithmFPType, cpu>(sigma);
+        service_free<algorithmFPType, cpu>(invSigma);
+        return;
+    }
+
+    const algorithmFPType n = (algorithmFPType)nRows;
+
+    /* Update the sums and the sums of squares of the processed observations */
+    BlockDescriptor<algorithmFPType> blockSums;
+    sumSVD->getBlockOfRows(0, 1, data_management::readWrite, blockSums);
+    algorithmFPType *sums = blockSums.getBlockPtr();
+
+    BlockDescriptor<algorithmFPType> blockSsq;
+    sumSquaresSVD->getBlockOfRows(0, 1, data_management::readWrite, blockSsq);
+    algorithmFPType *ssq = blockSsq.getBlockPtr();
+
+    for (size_t j = 0; j < nCols; j++)
+    {
+        sums[j] += n * mean[j];
+        ssq[j]  += sigma[j] + n * mean[j] * mean[j];
+
+        /* Block is normalized by its own means and standard deviations */
+        sigma[j]    = (nRows > 1 ? daal::internal::Math<algorithmFPType, cpu>::sSqrt(sigma[j] / (n - 1)) : (algorithmFPType)0);
+        invSigma[j] = (sigma[j] > 0 ? (algorithmFPType)1.0 / sigma[j] : (algorithmFPType)0);
+    }
+
+    sumSVD->releaseBlockOfRows(blockSums);
+    sumSquaresSVD->releaseBlockOfRows(blockSsq);
+
+    BlockDescriptor<int> observationsBlock;
+    nObservations->getBlockOfRows(0, 1, data_management::readWrite, observationsBlock);
+    int *nProcessedObservations = observationsBlock.getBlockPtr();
+
+    /* Blocks get different sketches that do not depend on the order of the processing in one process */
+    const size_t seed = parameter->seed + (size_t)(*nProcessedObservations);
+    *nProcessedObservations += (int)nRows;
+    nObservations->releaseBlockOfRows(observationsBlock);
+
+    svd::internal::RandomizedRangeFinder<algorithmFPType, cpu> finder(nRows, nCols, nSketch);
+    if (!finder.isValid())
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+    }
+    else if (!finder.compute(x, mean, invSigma, parameter->nPowerIterations, seed))
+    {
+        this->_errors->add(services::ErrorFailedToComputeRandomizedDecomposition);
+    }
+    else
+    {
+        BlockDescriptor<algorithmFPType> auxiliaryBlock;
+        auxiliaryTable->getBlockOfRows(0, nSketch + 2, data_management::writeOnly, auxiliaryBlock);
+        algorithmFPType *auxiliary = auxiliaryBlock.getBlockPtr();
+        const algorithmFPType *sketch = finder.getSketch();
+        const algorithmFPType sqrtN = daal::internal::Math<algorithmFPType, cpu>::sSqrt(n);
+
+        for (size_t k = 0; k < nSketch; k++)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nCols; j++)
+            {
+                auxiliary[k * nCols + j] = sketch[k * nCols + j] * sigma[j];
+            }
+        }
+        for (size_t j = 0; j < nCols; j++)
+        {
+            auxiliary[nSketch * nCols + j]       = sqrtN * mean[j];
+            auxiliary[(nSketch + 1) * nCols + j] = sqrtN;
+        }
+
+        auxiliaryTable->releaseBlockOfRows(auxiliaryBlock);
+    }
+
+    data->releaseBlockOfRows(block);
+    service_free<algorithmFPType, cpu>(mean);
+    service_free<algorithmFPType, cpu>(sigma);
+    service_free<algorithmFPType, cpu>(invSigma);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void PCARandomizedOnlineKernel<algorithmFPType, cpu>::finalizeMerge(const data_management::NumericTablePtr &nObservationsTable,
+                                                                    const data_management::NumericTablePtr &sumSVD,
+                                                                    const data_management::NumericTablePtr &sumSquaresSVD,
+                                                                    const data_management::DataCollectionPtr &auxiliaryTables,
+                                                                    data_management::NumericTablePtr &eigenvalues,
+                                                                    data_management::NumericTablePtr &eigenvectors)
+{
+    if(this->_type == correlation)
+    {
+        this->_errors->add(services::ErrorInputCorrelationNotSupportedInOnlineAndDistributed);
+        return;
+    }
+
+    BlockDescriptor<int> observationsBlock;
+    nObservationsTable->getBlockOfRows(0, 1, data_management::readOnly, observationsBlock);
+    size_t nObservations = *observationsBlock.getBlockPtr();
+    nObservationsTable->releaseBlockOfRows(observationsBlock);
+
+    BlockDescriptor<algorithmFPType> blockSums;
+    sumSVD->getBlockOfRows(0, 1, data_management::readOnly, blockSums);
+
+    BlockDescriptor<algorithmFPType> blockSsq;
+    sumSquaresSVD->getBlockOfRows(0, 1, data_management::readOnly, blockSsq);
+
+    this->mergeSketches(nObservations, blockSums.getBlockPtr(), blockSsq.getBlockPtr(), *auxiliaryTables,
+                        eigenvalues.get(), eigenvectors.get());
+
+    sumSVD->releaseBlockOfRows(blockSums);
+    sumSquaresSVD->releaseBlockOfRows(blockSsq);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void PCARandomizedStep2MasterKernel<algorithmFPType, cpu>::finalizeMerge(const data_management::DataCollectionPtr &inputPartialResults,
+                                                                         data_management::NumericTablePtr &eigenvalues,
+                                                                         data_management::NumericTablePtr &eigenvectors)
+{
+    const size_t nCols = eigenvectors->getNumberOfColumns();
+    const size_t nPartialResults = inputPartialResults->size();
+
+    algorithmFPType *sums = service_calloc<algorithmFPType, cpu>(nCols);
+    algorithmFPType *ssq  = service_calloc<algorithmFPType, cpu>(nCols);
+    if (!sums || !ssq)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        service_free<algorithmFPType, cpu>(sums);
+        service_free<algorithmFPType, cpu>(ssq);
+        return;
+    }
+
+    size_t nObservations = 0;
+    data_management::DataCollection sketches;
+
+    for(size_t i = 0; i < nPartialResults; i++)
+    {
+        services::SharedPtr<PartialResult<randomizedSvd> > partialRes =
+            services::staticPointerCast<PartialResult<randomizedSvd>, data_management::SerializationIface>(inputPartialResults->get(i));
+
+        size_t nBlocks = partialRes->get(pca::auxiliaryData)->size();
+        for(size_t j = 0; j < nBlocks; j++)
+        {
+            sketches.push_back(partialRes->get(pca::auxiliaryData, j));
+        }
+
+        NumericTable *nCurrentObservationsTable = partialRes->get(pca::nObservationsSVD).get();
+        BlockDescriptor<algorithmFPType> block;
+        nCurrentObservationsTable->getBlockOfRows(0, 1, data_management::readOnly, block);
+        nObservations += *block.getBlockPtr();
+        nCurrentObservationsTable->releaseBlockOfRows(block);
+
+        NumericTable *sumTable = partialRes->get(pca::sumSVD).get();
+        BlockDescriptor<algorithmFPType> blockSums;
+        sumTable->getBlockOfRows(0, 1, data_management::readOnly, blockSums);
+        const algorithmFPType *currentSums = blockSums.getBlockPtr();
+
+        NumericTable *ssqTable = partialRes->get(pca::sumSquaresSVD).get();
+        BlockDescriptor<algorithmFPType> blockSsq;
+        ssqTable->getBlockOfRows(0, 1, data_management::readOnly, blockSsq);
+        const algorithmFPType *currentSsq = blockSsq.getBlockPtr();
+
+        for (size_t j = 0; j < nCols; j++)
+        {
+            sums[j] += currentSums[j];
+            ssq[j]  += currentSsq[j];
+        }
+
+        sumTable->releaseBlockOfRows(blockSums);
+        ssqTable->releaseBlockOfRows(blockSsq);
+    }
+
+    this->mergeSketches(nObservations, sums, ssq, sketches, eigenvalues.get(), eigenvectors.get());
+
+    service_free<algorithmFPType, cpu>(sums);
+    service_free<algorithmFPType, cpu>(ssq);
+}
+
+} // namespace internal
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+
+#endif
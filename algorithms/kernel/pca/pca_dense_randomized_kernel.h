@@ -0,0 +1,132 @@
+/* file: pca_dense_randomized_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template structs that calculate PCA using the randomized SVD.
+//--
+*/
+
+#ifndef __PCA_DENSE_RANDOMIZED_KERNEL_H__
+#define __PCA_DENSE_RANDOMIZED_KERNEL_H__
+
+#include "pca_types.h"
+#include "svd/svd_dense_default_kernel.h"
+
+#include "pca_dense_svd_base.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace internal
+{
+
+/**
+ *  \brief Common functions of the kernels of the randomized SVD method.
+ *         The data set is centered and scaled implicitly in the products with the sketch
+ */
+template <typename algorithmFPType, CpuType cpu>
+class PCARandomizedKernelBase : public PCASVDKernelBase<algorithmFPType, cpu>
+{
+public:
+    PCARandomizedKernelBase() {};
+
+    virtual ~PCARandomizedKernelBase() {}
+
+protected:
+    /**
+     *  \brief Computes the means and the centered sums of squares of the columns of the data set
+     *
+     *  \return false if the memory allocation failed
+     */
+    bool computeColumnStatistics(size_t nRows, size_t nCols, const algorithmFPType *x, algorithmFPType *mean, algorithmFPType *css);
+
+    /**
+     *  \brief Computes the eigenvalues and the eigenvectors from the SVD of the matrix M of size nRows x nCols stored by rows.
+     *         Eigenvalues are the squared singular values divided by nObservations - 1,
+     *         the singular values themselves if nObservations is zero, i.e. M is the correlation matrix
+     */
+    void decomposeSketch(size_t nRows, size_t nCols, algorithmFPType *m, size_t nObservations,
+                         data_management::NumericTable *eigenvalues, data_management::NumericTable *eigenvectors);
+
+    /**
+     *  \brief Stacks the sketches of the blocks of the data set with the rows that correct their means to the total mean
+     *         and computes the eigenvalues and the eigenvectors from the stacked matrix
+     */
+    void mergeSketches(size_t nObservations, const algorithmFPType *sums, const algorithmFPType *ssq,
+                       data_management::DataCollection &sketches,
+                       data_management::NumericTable *eigenvalues, data_management::NumericTable *eigenvectors);
+};
+
+template <typename algorithmFPType, CpuType cpu>
+class PCARandomizedBatchKernel : public PCARandomizedKernelBase<algorithmFPType, cpu>
+{
+public:
+    PCARandomizedBatchKernel() {};
+
+    void compute(const data_management::NumericTablePtr &data,
+                 data_management::NumericTablePtr &eigenvalues,
+                 data_management::NumericTablePtr &eigenvectors,
+                 const RandomizedSvdParameter *parameter);
+
+    ~PCARandomizedBatchKernel() {}
+};
+
+template <typename algorithmFPType, CpuType cpu>
+class PCARandomizedOnlineKernel : public PCARandomizedKernelBase<algorithmFPType, cpu>
+{
+public:
+    PCARandomizedOnlineKernel() {};
+
+    void compute(const data_management::NumericTablePtr &data,
+                 data_management::NumericTablePtr &nObservations,
+                 data_management::NumericTablePtr &sumSVD,
+                 data_management::NumericTablePtr &sumSquaresSVD,
+                 data_management::NumericTablePtr &auxiliaryTable,
+                 const RandomizedSvdParameter *parameter);
+
+    void finalizeMerge(const data_management::NumericTablePtr &nObservations,
+                       const data_management::NumericTablePtr &sumSVD,
+                       const data_management::NumericTablePtr &sumSquaresSVD,
+                       const data_management::DataCollectionPtr &auxiliaryTables,
+                       data_management::NumericTablePtr &eigenvalues,
+                       data_management::NumericTablePtr &eigenvectors);
+
+    ~PCARandomizedOnlineKernel() {}
+};
+
+template <typename algorithmFPType, CpuType cpu>
+class PCARandomizedStep2MasterKernel : public PCARandomizedKernelBase<algorithmFPType, cpu>
+{
+public:
+    PCARandomizedStep2MasterKernel() {};
+
+    void finalizeMerge(const data_management::DataCollectionPtr &inputPartialResults,
+                       data_management::NumericTablePtr &eigenvalues,
+                       data_management::NumericTablePtr &eigenvectors);
+
+    ~PCARandomizedStep2MasterKernel() {}
+};
+
+} // namespace internal
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -0,0 +1,112 @@
+/* file: pca_dense_randomized_online_container.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of PCA randomized SVD algorithm container.
+//--
+*/
+
+#ifndef __PCA_DENSE_RANDOMIZED_ONLINE_CONTAINER_H__
+#define __PCA_DENSE_RANDOMIZED_ONLINE_CONTAINER_H__
+
+#include "kernel.h"
+#include "pca_online.h"
+#include "pca_dense_randomized_kernel.h"
+#include "pca_dense_svd_container.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+
+template <typename algorithmFPType, CpuType cpu>
+OnlineContainer<algorithmFPType, randomizedSvd, cpu>::OnlineContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::PCARandomizedOnlineKernel, algorithmFPType);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+OnlineContainer<algorithmFPType, randomizedSvd, cpu>::~OnlineContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void OnlineContainer<algorithmFPType, randomizedSvd, cpu>::compute()
+{
+    Input *input = static_cast<Input *>(_in);
+    internal::InputDataType dtype = getInputDataType(input);
+    RandomizedSvdParameter *parameter = static_cast<RandomizedSvdParameter *>(_par);
+
+    PartialResult<randomizedSvd> *partialResult = static_cast<PartialResult<randomizedSvd> *>(_pres);
+
+    data_management::NumericTablePtr data = input->get(pca::data);
+
+    data_management::NumericTablePtr nObservations = partialResult->get(pca::nObservationsSVD);
+    data_management::NumericTablePtr sumSquaresSVD = partialResult->get(pca::sumSquaresSVD);
+    data_management::NumericTablePtr sumSVD = partialResult->get(pca::sumSVD);
+
+    /* Sketch of the block is stored with two rows of its mean and its number of observations */
+    size_t nFeatures = data->getNumberOfColumns();
+    size_t nSketch = parameter->nComponents + parameter->nOversamples;
+    if (nSketch > nFeatures) { nSketch = nFeatures; }
+    if (nSketch > data->getNumberOfRows()) { nSketch = data->getNumberOfRows(); }
+
+    data_management::DataCollectionPtr rCollection = partialResult->get(auxiliaryData);
+    data_management::NumericTablePtr auxiliaryTable(
+        new data_management::HomogenNumericTable<algorithmFPType>(nFeatures, nSketch + 2, data_management::NumericTableIface::doAllocate));
+    rCollection->push_back(auxiliaryTable);
+
+    daal::services::Environment::env &env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::PCARandomizedOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType), setType, dtype);
+    __DAAL_CALL_KERNEL(env, internal::PCARandomizedOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType), compute,
+                       data, nObservations, sumSVD, sumSquaresSVD, auxiliaryTable, parameter);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void OnlineContainer<algorithmFPType, randomizedSvd, cpu>::finalizeCompute()
+{
+    Input *input = static_cast<Input *>(_in);
+    internal::InputDataType dtype = getInputDataType(input);
+
+    Result *result = static_cast<Result *>(_res);
+
+    PartialResult<randomizedSvd> *partialResult = static_cast<PartialResult<randomizedSvd> *>(_pres);
+
+    data_management::NumericTablePtr nObservations = partialResult->get(pca::nObservationsSVD);
+    data_management::NumericTablePtr sumSquaresSVD = partialResult->get(pca::sumSquaresSVD);
+    data_management::NumericTablePtr sumSVD = partialResult->get(pca::sumSVD);
+    data_management::DataCollectionPtr rCollection = partialResult->get(auxiliaryData);
+
+    data_management::NumericTablePtr eigenvalues  = result->get(pca::eigenvalues);
+    data_management::NumericTablePtr eigenvectors = result->get(pca::eigenvectors);
+
+    daal::services::Environment::env &env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::PCARandomizedOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType), setType, dtype);
+    __DAAL_CALL_KERNEL(env, internal::PCARandomizedOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType), finalizeMerge,
+                       nObservations, sumSVD, sumSquaresSVD, rCollection, eigenvalues, eigenvectors);
+}
+
+}
+}
+} // namespace daal
+#endif
@@ -0,0 +1,84 @@
+/* file: pca_distributedinput_randomized.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of PCA randomized SVD input in the distributed processing mode.
+//--
+*/
+
+#include "algorithms/pca/pca_types.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace interface1
+{
+DistributedInput<randomizedSvd>::DistributedInput() : DistributedInput<svdDense>() {}
+
+void DistributedInput<randomizedSvd>::check(const daal::algorithms::Parameter *parameter, int method) const
+{
+    DataCollectionPtr collection = DataCollection::cast(Argument::get(partialResults));
+    DAAL_CHECK(collection, ErrorNullPartialResultDataCollection);
+    size_t nBlocks = collection->size();
+    DAAL_CHECK(nBlocks > 0, ErrorIncorrectNumberOfInputNumericTables);
+
+    for(size_t i = 0; i < nBlocks; i++)
+    {
+        SharedPtr<PartialResult<svdDense> > partRes = staticPointerCast<PartialResult<svdDense>, SerializationIface>((*collection)[i]);
+        DAAL_CHECK(partRes, ErrorIncorrectElementInPartialResultCollection);
+    }
+
+    int packedLayouts = packed_mask;
+    int csrLayout = (int)NumericTableIface::csrArray;
+    size_t nFeatures = getNFeatures();
+
+    const RandomizedSvdParameter *par = static_cast<const RandomizedSvdParameter *>(parameter);
+    DAAL_CHECK_EX(par->nComponents <= nFeatures, ErrorIncorrectParameter, ParameterName, nComponentsStr());
+
+    for(size_t j = 0; j < nBlocks; j++)
+    {
+        SharedPtr<PartialResult<svdDense> > partRes = getPartialResult(j);
+        if(!checkNumericTable(partRes->get(pca::nObservationsSVD).get(), this->_errors.get(), nObservationsSVDStr(), csrLayout, 0, 1, 1)) { return; }
+        if(!checkNumericTable(partRes->get(pca::sumSquaresSVD).get(), this->_errors.get(), sumSquaresSVDStr(), packedLayouts, 0, nFeatures, 1)) { return; }
+        if(!checkNumericTable(partRes->get(pca::sumSVD).get(), this->_errors.get(), sumSVDStr(), packedLayouts, 0, nFeatures, 1)) { return; }
+
+        DataCollectionPtr auxiliaryData = partRes->get(pca::auxiliaryData);
+        DAAL_CHECK(auxiliaryData, ErrorNullAuxiliaryDataCollection);
+        DAAL_CHECK(auxiliaryData->size() > 0, ErrorEmptyAuxiliaryDataCollection);
+
+        /* Sketch of the block contains at least one row and two rows with the block mean and the number of observations */
+        for(size_t i = 0; i < auxiliaryData->size(); i++)
+        {
+            NumericTablePtr table = NumericTable::cast((*auxiliaryData)[i]);
+            DAAL_CHECK(table, ErrorIncorrectElementInNumericTableCollection);
+            if(!checkNumericTable(table.get(), this->_errors.get(), auxiliaryDataStr(), csrLayout, 0, nFeatures)) { return; }
+            DAAL_CHECK_EX(table->getNumberOfRows() >= 3, ErrorIncorrectNumberOfRows, ArgumentName, auxiliaryDataStr());
+        }
+    }
+}
+
+} // namespace interface1
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
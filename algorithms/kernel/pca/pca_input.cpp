@@ -99,6 +99,11 @@ void Input::check(const daal::algorithms::Parameter *par, int method) const
         if(!checkNumericTable(dataTable.get(), this->_errors.get(), dataStr())) { return; }
         DAAL_CHECK_EX(dataTable->getNumberOfColumns() <= dataTable->getNumberOfRows(), ErrorIncorrectNumberOfRows, ArgumentName, dataStr());
     }
+    if(method == randomizedSvd)
+    {
+        const RandomizedSvdParameter *parameter = static_cast<const RandomizedSvdParameter *>(par);
+        DAAL_CHECK_EX(parameter->nComponents <= dataTable->getNumberOfColumns(), ErrorIncorrectParameter, ParameterName, nComponentsStr());
+    }
 }
 
 } // namespace interface1
@@ -0,0 +1,48 @@
+/* file: pca_parameter_randomized.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of PCA randomized SVD parameters.
+//--
+*/
+
+#include "algorithms/pca/pca_types.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace interface1
+{
+RandomizedSvdParameter::RandomizedSvdParameter(size_t nComponents, size_t nOversamples, size_t nPowerIterations, size_t seed) :
+    nComponents(nComponents), nOversamples(nOversamples), nPowerIterations(nPowerIterations), seed(seed) {}
+
+void RandomizedSvdParameter::check() const
+{
+    DAAL_CHECK_EX(nComponents > 0, ErrorIncorrectParameter, ParameterName, nComponentsStr());
+}
+
+} // namespace interface1
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,52 @@
+/* file: pca_partialresult_randomized.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of PCA randomized SVD partial result.
+//--
+*/
+
+#include "algorithms/pca/pca_types.h"
+#include "serialization_utils.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS3(PartialResult,randomizedSvd,SERIALIZATION_PCA_PARTIAL_RESULT_RANDOMIZED_SVD_ID);
+
+PartialResult<randomizedSvd>::PartialResult() : PartialResult<svdDense>() {};
+
+void DefaultPartialResultsInit<randomizedSvd>::operator()(const Input &input, services::SharedPtr<PartialResult<randomizedSvd> > &pres)
+{
+    setToZero(pres->get(pca::nObservationsSVD).get());
+    setToZero(pres->get(pca::sumSVD).get());
+    setToZero(pres->get(pca::sumSquaresSVD).get());
+}
+
+} // namespace interface1
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
@@ -66,7 +66,7 @@ void Result::set(ResultId id, const NumericTablePtr &value)
 void Result::check(const daal::algorithms::Input *_input, const daal::algorithms::Parameter *par, int method) const
 {
     const InputIface *input = static_cast<const InputIface *>(_input);
-    checkImpl(input->getNFeatures());
+    checkImpl(input->getNFeatures(), (method == randomizedSvd ? static_cast<const RandomizedSvdParameter *>(par)->nComponents : 0));
 }
 /**
 * Checks the results of the PCA algorithm
@@ -76,7 +76,7 @@ void Result::check(const daal::algorithms::Input *_input, const daal::algorithms
 */
 void Result::check(const daal::algorithms::PartialResult *pr, const daal::algorithms::Parameter *parameter, int method) const
 {
-    checkImpl(0);
+    checkImpl(0, (method == randomizedSvd ? static_cast<const RandomizedSvdParameter *>(parameter)->nComponents : 0));
 }
 /**
 * Checks the results of the PCA algorithm
@@ -84,13 +84,22 @@ void Result::check(const daal::algorithms::PartialResult *pr, const daal::algori
 * \param[in] method         Computation method
 * \param[in] parameter      Algorithm %parameter
 */
-void Result::checkImpl(size_t nFeatures) const
+void Result::checkImpl(size_t nFeatures, size_t nComponents) const
 {
     DAAL_CHECK(Argument::size() == 2, ErrorIncorrectNumberOfOutputNumericTables);
     int packedLayouts = packed_mask;
-    if(!checkNumericTable(get(eigenvalues).get(), this->_errors.get(), eigenvaluesStr(), packedLayouts, 0, nFeatures, 1)) { return; }
-    nFeatures = get(eigenvalues)->getNumberOfColumns();
-    if(!checkNumericTable(get(eigenvectors).get(), this->_errors.get(), eigenvectorsStr(), packedLayouts, 0, nFeatures, nFeatures)) { return; }
+    if(nComponents == 0)
+    {
+        /* All the eigenvalues and eigenvectors are computed */
+        if(!checkNumericTable(get(eigenvalues).get(), this->_errors.get(), eigenvaluesStr(), packedLayouts, 0, nFeatures, 1)) { return; }
+        nFeatures = get(eigenvalues)->getNumberOfColumns();
+        nComponents = nFeatures;
+    }
+    else
+    {
+        if(!checkNumericTable(get(eigenvalues).get(), this->_errors.get(), eigenvaluesStr(), packedLayouts, 0, nComponents, 1)) { return; }
+    }
+    if(!checkNumericTable(get(eigenvectors).get(), this->_errors.get(), eigenvectorsStr(), packedLayouts, 0, nFeatures, nComponents)) { return; }
 }
 
 } // namespace interface1
@@ -44,13 +44,14 @@ DAAL_EXPORT void Result::allocate(const daal::algorithms::Input *input, daal::al
 {
     const InputIface *in = static_cast<const InputIface *>(input);
     size_t nFeatures = in->getNFeatures();
+    size_t nComponents = (method == randomizedSvd ? static_cast<const RandomizedSvdParameter *>(parameter)->nComponents : nFeatures);
 
     set(eigenvalues,
         data_management::NumericTablePtr(new data_management::HomogenNumericTable<algorithmFPType>
-                                                           (nFeatures, 1, data_management::NumericTableIface::doAllocate, 0)));
+                                                           (nComponents, 1, data_management::NumericTableIface::doAllocate, 0)));
     set(eigenvectors,
         data_management::NumericTablePtr(new data_management::HomogenNumericTable<algorithmFPType>
-                                                           (nFeatures, nFeatures, data_management::NumericTableIface::doAllocate, 0)));
+                                                           (nFeatures, nComponents, data_management::NumericTableIface::doAllocate, 0)));
 }
 
 /**
@@ -63,15 +64,16 @@ DAAL_EXPORT void Result::allocate(const daal::algorithms::PartialResult *partial
 {
     const PartialResultBase *partialRes = static_cast<const PartialResultBase *>(partialResult);
     size_t nFeatures = partialRes->getNFeatures();
+    size_t nComponents = (method == randomizedSvd ? static_cast<const RandomizedSvdParameter *>(parameter)->nComponents : nFeatures);
 
     set(eigenvalues,
         data_management::NumericTablePtr(new data_management::HomogenNumericTable<algorithmFPType>
-                                                           (nFeatures, 1,
+                                                           (nComponents, 1,
                                                             data_management::NumericTableIface::doAllocate, 0)));
     set(eigenvectors,
         data_management::NumericTablePtr(new data_management::HomogenNumericTable<algorithmFPType>
                                                            (nFeatures,
-                                                            nFeatures, data_management::NumericTableIface::doAllocate, 0)));
+                                                            nComponents, data_management::NumericTableIface::doAllocate, 0)));
 }
 
 } // namespace pca
@@ -28,6 +28,7 @@
 #include "csr_numeric_table.h"
 #include "symmetric_matrix.h"
 #include "service_defines.h"
+#include "service_trace.h"
 
 using namespace daal::data_management;
 
@@ -71,12 +72,14 @@ public:
 
     size_t getBlockOfRows(size_t vector_idx, size_t vector_num, T **buf_ptr)
     {
+        DAAL_TRACE_SCOPE("data_management", "BlockMicroTable.getBlockOfRows");
         _nt->getBlockOfRows( vector_idx, vector_num, rwflag, _block );
         *buf_ptr = _block.getBlockPtr();
         return _block.getNumberOfRows();
     }
     void release()
     {
+        DAAL_TRACE_SCOPE("data_management", "BlockMicroTable.release");
         _nt->releaseBlockOfRows( _block );
     }
 
@@ -123,6 +126,7 @@ public:
     size_t getSparseBlock(size_t vector_idx, size_t vector_num, T **values_ptr, size_t **column_indices,
                           size_t **row_offsets)
     {
+        DAAL_TRACE_SCOPE("data_management", "CSRBlockMicroTable.getSparseBlock");
         _snt->getSparseBlock( vector_idx, vector_num, rwflag, _block );
         *values_ptr     = _block.getBlockValuesPtr();
         *column_indices = _block.getBlockColumnIndicesPtr();
@@ -60,6 +60,13 @@ void StumpTrainKernel<method, algorithmFPtype, cpu>::compute(size_t n, const Num
 
     r->setNFeatures(nFeatures);
 
+    if (method == binned)
+    {
+        /* Quantize the features once for the data set */
+        prepareBins(nVectors, nFeatures, xTable);
+        if (!this->_errors->isEmpty()) { return; }
+    }
+
     algorithmFPtype sumW, sumWY, sumWYY;
 
     BlockDescriptor<algorithmFPtype> yBlock;
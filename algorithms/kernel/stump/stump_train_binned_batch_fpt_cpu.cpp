@@ -0,0 +1,48 @@
+/* file: stump_train_binned_batch_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the binned method for Decision Stump training algorithm.
+//--
+*/
+
+#include "stump_train_batch_container.h"
+#include "stump_train_kernel.h"
+#include "stump_train_aux.i"
+#include "stump_train_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace stump
+{
+namespace training
+{
+namespace interface1
+{
+template class BatchContainer<DAAL_FPTYPE, binned, DAAL_CPU>;
+}
+namespace internal
+{
+template class StumpTrainKernel<binned, DAAL_FPTYPE, DAAL_CPU>;
+}
+}
+}
+}
+}
@@ -29,6 +29,7 @@
 #include "service_utils.h"
 #include "service_data_utils.h"
 #include "service_memory.h"
+#include "service_sort.h"
 #include "stump_train_kernel.h"
 
 namespace daal
@@ -478,6 +479,250 @@ void StumpTrainKernel<method, algorithmFPtype, cpu>::computeSums(size_t n, algor
     *sumS = ss;
 }
 
+/**
+ *  \brief Quantize the feature into at most maxNumberOfBins bins.
+ *         The bins contain close numbers of observations, equal values of the feature
+ *         always belong to the same bin
+ *
+ *  \param n[in]                Number of observations
+ *  \param x[in]                Input data feature of size n
+ *  \param sortedX[in]          Buffer of size n
+ *  \param bins[out]            Indices of the bins of the observations of size n
+ *  \param binSplitPoints[out]  Split points between the neighbouring bins
+ *  \param nBinsPtr[out]        Number of bins
+ */
+template <Method method, typename algorithmFPtype, CpuType cpu>
+void StumpTrainKernel<method, algorithmFPtype, cpu>::computeFeatureBins(size_t n, algorithmFPtype *x, algorithmFPtype *sortedX,
+                                                                        byte *bins, algorithmFPtype *binSplitPoints, size_t *nBinsPtr)
+{
+    const algorithmFPtype C05 = (algorithmFPtype)0.5;
+    algorithmFPtype binMax[maxNumberOfBins];   /* Maximal values of the feature in the bins */
+
+    daal::services::daal_memcpy_s(sortedX, n * sizeof(algorithmFPtype), x, n * sizeof(algorithmFPtype));
+    daal::algorithms::internal::qSort<algorithmFPtype, cpu>(n, sortedX);
+
+    size_t nBins = 0;
+    size_t start = 0;
+    while (start < n)
+    {
+        /* Split the remaining observations evenly between the remaining bins */
+        size_t nRemainingBins = maxNumberOfBins - nBins;
+        size_t end = start + (n - start + nRemainingBins - 1) / nRemainingBins;
+        while (end < n && sortedX[end] == sortedX[end - 1]) { end++; }
+
+        if (nBins > 0)
+        {
+            binSplitPoints[nBins - 1] = C05 * (binMax[nBins - 1] + sortedX[start]);
+        }
+        binMax[nBins++] = sortedX[end - 1];
+        start = end;
+    }
+
+    /* Find the bin of each observation */
+    for (size_t i = 0; i < n; i++)
+    {
+        size_t l = 0, r = nBins - 1;
+        while (l < r)
+        {
+            size_t m = (l + r) >> 1;
+            if (x[i] <= binMax[m]) { r = m; }
+            else { l = m + 1; }
+        }
+        bins[i] = (byte)l;
+    }
+
+    *nBinsPtr = nBins;
+}
+
+template <Method method, typename algorithmFPtype, CpuType cpu>
+void StumpTrainKernel<method, algorithmFPtype, cpu>::releaseBins()
+{
+    if (_bins)           { daal::services::daal_free(_bins); }
+    if (_binSplitPoints) { daal::services::daal_free(_binSplitPoints); }
+    if (_nBins)          { daal::services::daal_free(_nBins); }
+    _bins = NULL;
+    _binSplitPoints = NULL;
+    _nBins = NULL;
+    _binnedTable = NULL;
+    _binnedN     = 0;
+    _binnedDim   = 0;
+}
+
+/**
+ *  \brief Quantize the non-categorical features of the data set.
+ *         The bins are kept while the kernel is called for the same data set of the same size
+ *
+ *  \param n[in]            Number of observations
+ *  \param dim[in]          Number of features
+ *  \param x[in]            Input data set
+ */
+template <Method method, typename algorithmFPtype, CpuType cpu>
+void StumpTrainKernel<method, algorithmFPtype, cpu>::prepareBins(size_t n, size_t dim, const NumericTable *x)
+{
+    if (_bins && _binnedTable == x && _binnedN == n && _binnedDim == dim) { return; }
+    releaseBins();
+
+    _bins           = (byte *)daal::services::daal_malloc(dim * n * sizeof(byte));
+    _binSplitPoints = (algorithmFPtype *)daal::services::daal_malloc(dim * maxNumberOfBins * sizeof(algorithmFPtype));
+    _nBins          = (size_t *)daal::services::daal_malloc(dim * sizeof(size_t));
+    if (!_bins || !_binSplitPoints || !_nBins)
+    {
+        releaseBins();
+        this->_errors->add(services::ErrorMemoryAllocationFailed); return;
+    }
+
+    NumericTable *xNoConst = const_cast<NumericTable *>(x);
+    byte *bins = _bins;
+    algorithmFPtype *binSplitPoints = _binSplitPoints;
+    size_t *nBins = _nBins;
+
+    daal::tls<algorithmFPtype *> tlsSortedX( [ = ]()-> algorithmFPtype *
+    {
+        return (algorithmFPtype *)daal::services::daal_malloc(n * sizeof(algorithmFPtype));
+    } );
+
+    bool memoryError = false;
+    daal::threader_for( dim, dim, [ =, &tlsSortedX ](size_t k)
+    {
+        nBins[k] = 0;
+        if (xNoConst->getFeatureType(k) == data_management::data_feature_utils::DAAL_CATEGORICAL) { return; }
+
+        algorithmFPtype *sortedX = tlsSortedX.local();
+        if (!sortedX) { return; }
+
+        BlockDescriptor<algorithmFPtype> block;
+        xNoConst->getBlockOfColumnValues( k, (size_t)0, n, readOnly, block);
+        computeFeatureBins(n, block.getBlockPtr(), sortedX, bins + k * n, binSplitPoints + k * maxNumberOfBins, nBins + k);
+        xNoConst->releaseBlockOfColumnValues( block );
+    } );
+
+    tlsSortedX.reduce( [ &memoryError ](algorithmFPtype *sortedX)
+    {
+        if (sortedX) { daal::services::daal_free(sortedX); }
+        else { memoryError = true; }
+    } );
+
+    if (memoryError)
+    {
+        releaseBins();
+        this->_errors->add(services::ErrorMemoryAllocationFailed); return;
+    }
+    _binnedTable = x;
+    _binnedN     = n;
+    _binnedDim   = dim;
+}
+
+/**
+ *  \brief Fit the function f[j] by a weighted least-squares
+ *  regression of x to z with weigths w.
+ *  Process ordered or numerical feature quantized into bins.
+ *  The split is searched over the histograms of the bins
+ *
+ *  \param n[in]                Number of observations
+ *  \param bins[in]             Indices of the bins of the feature of size n
+ *  \param nBins[in]            Number of bins of the feature
+ *  \param binSplitPoints[in]   Split points between the neighbouring bins
+ *  \param w[in]                Array of weights of size n
+ *  \param z[in]                Array of weights of responses of size n
+ *  \param sumW[in]             Total sum of weights
+ *  \param sumM[in]             Total sum of weighted responses
+ *  \param sumS[in]             Total sum of weighted squares of responses
+ *  \param minSPtr[out]         Value of goal function obtained for the best split
+ *  \param splitPointPtr[out]   Resulting split point
+ *  \param lMeanPtr[out]        "left" average of weighted responses
+ *                              for resulting split
+ *  \param rMeanPtr[out]        "right" average of weighted responses
+ *                              for resulting split
+ */
+template <Method method, typename algorithmFPtype, CpuType cpu>
+void StumpTrainKernel<method, algorithmFPtype, cpu>::stumpRegressionBinned(size_t n, const byte *bins, size_t nBins,
+                                                                           const algorithmFPtype *binSplitPoints,
+                                                                           algorithmFPtype *w, algorithmFPtype *z,
+                                                                           algorithmFPtype sumW, algorithmFPtype sumM, algorithmFPtype sumS,
+                                                                           algorithmFPtype *minSPtr, algorithmFPtype *splitPointPtr,
+                                                                           algorithmFPtype *lMeanPtr, algorithmFPtype *rMeanPtr)
+{
+    if (nBins < 2) { return; }
+
+    const algorithmFPtype zero = 0.0;
+    algorithmFPtype W_per_bin[maxNumberOfBins];
+    algorithmFPtype M_per_bin[maxNumberOfBins];
+    algorithmFPtype S_per_bin[maxNumberOfBins];
+
+    for (size_t b = 0; b < nBins; b++)
+    {
+        W_per_bin[b] = zero;
+        M_per_bin[b] = zero;
+        S_per_bin[b] = zero;
+    }
+
+    /* Calculate weight; weighted mean and weighted sum of squares
+       for each bin */
+    for (size_t i = 0; i < n; i++)
+    {
+        size_t iBin = bins[i];
+        algorithmFPtype wz = w[i] * z[i];
+        W_per_bin[iBin] += w[i];
+        M_per_bin[iBin] += wz;
+        S_per_bin[iBin] += wz * z[i];
+    }
+
+    const algorithmFPtype THR = 1e-10;
+    algorithmFPtype minS = *minSPtr;
+    algorithmFPtype splitPoint = 0.0;
+    algorithmFPtype lMean = 0.0;
+    algorithmFPtype rMean = 0.0;
+
+    algorithmFPtype lw = 0.0, lM = 0.0, ls = 0.0;
+    algorithmFPtype rw = sumW, rM = sumM, rs = sumS;
+    algorithmFPtype lm, rm, lc, rc, sum;
+
+    /* Move the bins one-by-one from the right region into the left
+       and choose the optimal split */
+    for (size_t b = 0; b < nBins - 1; b++)
+    {
+        lw += W_per_bin[b];
+        lM += M_per_bin[b];
+        ls += S_per_bin[b];
+        rw -= W_per_bin[b];
+        rM -= M_per_bin[b];
+        rs -= S_per_bin[b];
+
+        /* Calculate goal functions of the left and right regions
+           (See (9.11) and (9.13) in [2]) */
+        lm = 0.0;
+        lc = 0.0;
+        if (lw > THR)
+        {
+            lm = lM / lw;
+            lc = ls - lM * lm;
+        }
+
+        rm = 0.0;
+        rc = 0.0;
+        if (rw > THR)
+        {
+            rm = rM / rw;
+            rc = rs - rM * rm;
+        }
+        sum = lc + rc;
+
+        if ( sum < minS )
+        {
+            /* remember the minimal split point and weighted means */
+            minS = sum;
+            splitPoint = binSplitPoints[b];
+            lMean = lm;
+            rMean = rm;
+        }
+    }
+
+    *minSPtr = minS;
+    *splitPointPtr = splitPoint;
+    *lMeanPtr = lMean;
+    *rMeanPtr = rMean;
+}
+
 template <Method method, typename algorithmFPtype, CpuType cpu>
 void StumpTrainKernel<method, algorithmFPtype, cpu>::doStumpRegression(size_t n, size_t dim, NumericTable *x,
                                                                        algorithmFPtype *w,
@@ -524,6 +769,12 @@ void StumpTrainKernel<method, algorithmFPtype, cpu>::doStumpRegression(size_t n,
                                        &localMinS, &localSplitPoint, &localLMean, &localRMean);
             x->releaseBlockOfColumnValues( block );
         }
+        else if (method == binned)
+        {
+            /* Here if feature k is not categorical and quantized into bins */
+            stumpRegressionBinned(n, _bins + k * n, _nBins[k], _binSplitPoints + k * maxNumberOfBins, w, z, sumW, sumM, sumS,
+                                  &localMinS, &localSplitPoint, &localLMean, &localRMean);
+        }
         else
         {
             /* Here if feature k is not categorical */
@@ -42,13 +42,32 @@ namespace training
 namespace internal
 {
 
+/* Maximal number of bins of the feature in the binned method */
+const size_t maxNumberOfBins = 256;
+
 template <Method method, typename algorithmFPtype , CpuType cpu>
 class StumpTrainKernel : public Kernel
 {
 public:
+    StumpTrainKernel() : _binnedTable(NULL), _binnedN(0), _binnedDim(0), _bins(NULL), _binSplitPoints(NULL), _nBins(NULL) {}
+    ~StumpTrainKernel() { releaseBins(); }
+
     void compute(size_t n, const NumericTable *const *a, Model *r, const Parameter *par);
 
 private:
+    void prepareBins(size_t n, size_t dim, const NumericTable *x);
+
+    void computeFeatureBins(size_t n, algorithmFPtype *x, algorithmFPtype *sortedX, byte *bins,
+                            algorithmFPtype *binSplitPoints, size_t *nBinsPtr);
+
+    void releaseBins();
+
+    void stumpRegressionBinned(size_t n, const byte *bins, size_t nBins, const algorithmFPtype *binSplitPoints,
+                               algorithmFPtype *w, algorithmFPtype *z,
+                               algorithmFPtype sumW, algorithmFPtype sumM, algorithmFPtype sumS,
+                               algorithmFPtype *minSPtr, algorithmFPtype *splitPointPtr,
+                               algorithmFPtype *lMeanPtr, algorithmFPtype *rMeanPtr);
+
     void StumpQSort( size_t n, algorithmFPtype *x, algorithmFPtype *w, algorithmFPtype *z );
 
     void stumpRegressionOrdered(size_t nVectors,
@@ -70,6 +89,15 @@ private:
                            algorithmFPtype *z,
                            size_t *splitFeature, algorithmFPtype *splitPoint,
                            algorithmFPtype *leftValue, algorithmFPtype *rightValue);
+
+    /* Quantized features of the data set that are kept between the calls of the binned method.
+       The boosting algorithms train a copy of the weak learner in each training call, so the bins live for one call */
+    const NumericTable *_binnedTable;   /* Data set the bins are computed for, not owned by the kernel */
+    size_t _binnedN;                    /* Number of observations in the data set the bins are computed for */
+    size_t _binnedDim;                  /* Number of features in the data set the bins are computed for */
+    byte *_bins;                        /* Indices of the bins of size dim x n, stored by features */
+    algorithmFPtype *_binSplitPoints;   /* Split points between the neighbouring bins of size dim x maxNumberOfBins */
+    size_t *_nBins;                     /* Numbers of bins of the features, 0 for the categorical features */
 };
 
 } // namespace daal::algorithms::stump::training::internal
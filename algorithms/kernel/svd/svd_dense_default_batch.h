@@ -44,7 +44,23 @@ template <typename algorithmFPType>
 DAAL_EXPORT void Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
 {
     const Input *in = static_cast<const Input *>(input);
-    allocateImpl<algorithmFPType>(in->get(data)->getNumberOfColumns(), in->get(data)->getNumberOfRows());
+    size_t m = in->get(data)->getNumberOfColumns();
+    size_t n = in->get(data)->getNumberOfRows();
+    if(method != randomizedDense)
+    {
+        allocateImpl<algorithmFPType>(m, n);
+        return;
+    }
+
+    /* The randomized method computes only nComponents singular values and vectors */
+    const Parameter *svdPar = static_cast<const Parameter *>(parameter);
+    size_t k = svdPar->nComponents;
+    Argument::set(singularValues, data_management::SerializationIfacePtr(
+                      new data_management::HomogenNumericTable<algorithmFPType>(k, 1, data_management::NumericTable::doAllocate)));
+    Argument::set(rightSingularMatrix, data_management::SerializationIfacePtr(
+                      new data_management::HomogenNumericTable<algorithmFPType>(m, k, data_management::NumericTable::doAllocate)));
+    Argument::set(leftSingularMatrix, data_management::SerializationIfacePtr(
+                      new data_management::HomogenNumericTable<algorithmFPType>(k, n, data_management::NumericTable::doAllocate)));
 }
 
 /**
@@ -56,6 +56,17 @@ public:
                  const size_t nr, NumericTable *r[], const daal::algorithms::Parameter *par = 0);
 };
 
+/**
+ *  \brief Kernel of the randomized method that computes nComponents largest singular values and vectors
+ */
+template<typename algorithmFPType, CpuType cpu>
+class SVDBatchKernel<algorithmFPType, daal::algorithms::svd::randomizedDense, cpu> : public Kernel
+{
+public:
+    void compute(const size_t na, const NumericTable *const *a,
+                 const size_t nr, NumericTable *r[], const daal::algorithms::Parameter *par = 0);
+};
+
 template<typename algorithmFPType, daal::algorithms::svd::Method method, CpuType cpu>
 class SVDOnlineKernel : public Kernel
 {
@@ -0,0 +1,156 @@
+/* file: svd_dense_randomized_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the randomized method of the SVD algorithm
+//--
+*/
+
+#ifndef __SVD_DENSE_RANDOMIZED_BATCH_IMPL_I__
+#define __SVD_DENSE_RANDOMIZED_BATCH_IMPL_I__
+
+#include "service_memory.h"
+#include "service_blas.h"
+#include "service_micro_table.h"
+#include "threading.h"
+
+#include "svd_dense_randomized_impl.i"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svd
+{
+namespace internal
+{
+
+/**
+ *  \brief Computes nComponents largest singular values and vectors of the data set
+ *         from the SVD of its sketch of size nSketch x nCols, nSketch = min(nComponents + nOversamples, nCols, nRows)
+ */
+template <typename algorithmFPType, CpuType cpu>
+void SVDBatchKernel<algorithmFPType, randomizedDense, cpu>::compute(const size_t na, const NumericTable *const *a,
+                                                                    const size_t nr, NumericTable *r[], const daal::algorithms::Parameter *par)
+{
+    const Parameter *svdPar = static_cast<const Parameter *>(par);
+    NumericTable *ntA = const_cast<NumericTable *>(a[0]);
+
+    const size_t nCols = ntA->getNumberOfColumns();
+    const size_t nRows = ntA->getNumberOfRows();
+    const size_t nComponents = svdPar->nComponents;
+
+    size_t nSketch = nComponents + svdPar->nOversamples;
+    if (nSketch > nCols) { nSketch = nCols; }
+    if (nSketch > nRows) { nSketch = nRows; }
+
+    BlockMicroTable<algorithmFPType, readOnly, cpu> mtA(ntA);
+    algorithmFPType *x = 0;
+    mtA.getBlockOfRows(0, nRows, &x);
+
+    RandomizedRangeFinder<algorithmFPType, cpu> finder(nRows, nCols, nSketch);
+    algorithmFPType *s = service_calloc<algorithmFPType, cpu>(nSketch);
+    algorithmFPType *v = service_calloc<algorithmFPType, cpu>(nSketch * nCols);
+    algorithmFPType *u = 0;
+    if (svdPar->leftSingularMatrix == requiredInPackedForm)
+    {
+        u = service_calloc<algorithmFPType, cpu>(nSketch * nSketch);
+    }
+
+    if (!x || !finder.isValid() || !s || !v || (svdPar->leftSingularMatrix == requiredInPackedForm && !u))
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+    }
+    else if (!finder.compute(x, 0, 0, svdPar->nPowerIterations, svdPar->seed) ||
+             !computeSketchSVD<algorithmFPType, cpu>(nSketch, nCols, finder.getSketch(), s, v, u))
+    {
+        this->_errors->add(services::ErrorFailedToComputeRandomizedDecomposition);
+    }
+    else
+    {
+        /* Components beyond the rank of the sketch are zero */
+        const size_t nComputed = (nComponents < nSketch ? nComponents : nSketch);
+
+        BlockMicroTable<algorithmFPType, writeOnly, cpu> mtS(r[0]);
+        algorithmFPType *singularValues = 0;
+        mtS.getBlockOfRows(0, 1, &singularValues);
+        for (size_t i = 0; i < nComponents; i++)
+        {
+            singularValues[i] = (i < nComputed ? s[i] : (algorithmFPType)0);
+        }
+        mtS.release();
+
+        if (svdPar->rightSingularMatrix == requiredInPackedForm)
+        {
+            BlockMicroTable<algorithmFPType, writeOnly, cpu> mtV(r[2]);
+            algorithmFPType *rightSingularMatrix = 0;
+            mtV.getBlockOfRows(0, nComponents, &rightSingularMatrix);
+            for (size_t i = 0; i < nComponents * nCols; i++)
+            {
+                rightSingularMatrix[i] = (i < nComputed * nCols ? v[i] : (algorithmFPType)0);
+            }
+            mtV.release();
+        }
+
+        if (svdPar->leftSingularMatrix == requiredInPackedForm)
+        {
+            /* Left singular vectors of the data set are Q * U, U is stored by rows of size nSketch in the array u */
+            BlockMicroTable<algorithmFPType, writeOnly, cpu> mtU(r[1]);
+            algorithmFPType *leftSingularMatrix = 0;
+            mtU.getBlockOfRows(0, nRows, &leftSingularMatrix);
+
+            char transa = 'N';
+            char transb = 'T';
+            DAAL_INT m = (DAAL_INT)nComputed;
+            DAAL_INT n = (DAAL_INT)nRows;
+            DAAL_INT k = (DAAL_INT)nSketch;
+            DAAL_INT ldc = (DAAL_INT)nComponents;
+            algorithmFPType one  = 1.0;
+            algorithmFPType zero = 0.0;
+            Blas<algorithmFPType, cpu>::xgemm(&transa, &transb, &m, &n, &k, &one, u, &k,
+                                              const_cast<algorithmFPType *>(finder.getBasis()), &n, &zero, leftSingularMatrix, &ldc);
+
+            if (nComputed < nComponents)
+            {
+                daal::threader_for(nRows, nRows, [ = ](int i)
+                {
+                    for (size_t j = nComputed; j < nComponents; j++)
+                    {
+                        leftSingularMatrix[i * nComponents + j] = (algorithmFPType)0;
+                    }
+                } );
+            }
+            mtU.release();
+        }
+    }
+
+    mtA.release();
+    service_free<algorithmFPType, cpu>(s);
+    service_free<algorithmFPType, cpu>(v);
+    service_free<algorithmFPType, cpu>(u);
+}
+
+} // namespace daal::internal
+}
+}
+} // namespace daal
+
+#endif
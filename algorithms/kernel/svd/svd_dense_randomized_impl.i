@@ -0,0 +1,298 @@
+/* file: svd_dense_randomized_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Randomized range finder and the decomposition of its sketch used by
+//  the randomized methods of the SVD and PCA algorithms.
+//--
+*/
+
+#ifndef __SVD_DENSE_RANDOMIZED_IMPL_I__
+#define __SVD_DENSE_RANDOMIZED_IMPL_I__
+
+#include "service_memory.h"
+#include "service_blas.h"
+#include "service_lapack.h"
+#include "service_rng.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svd
+{
+namespace internal
+{
+
+/**
+ *  \brief Randomized range finder for the nRows x nCols matrix Z = (X - 1 * mean^T) * diag(invSigma),
+ *         where X is the data set stored by rows. Centering and scaling are applied implicitly,
+ *         so the data set is neither copied nor modified.
+ *
+ *         The orthonormal basis Q of the approximate range of Z is computed from the Gaussian sketch Z * Omega
+ *         refined with the power iterations Z * Z^T, the QR decomposition follows every product.
+ *         The sketch B = Q^T * Z of size nSketch x nCols keeps the largest singular values and
+ *         the corresponding right singular vectors of Z
+ */
+template <typename algorithmFPType, CpuType cpu>
+class RandomizedRangeFinder
+{
+public:
+    RandomizedRangeFinder(size_t nRows, size_t nCols, size_t nSketch) :
+        _nRows(nRows), _nCols(nCols), _nSketch(nSketch), _work(0), _lwork(0)
+    {
+        _q    = daal::services::internal::service_malloc<algorithmFPType, cpu>(_nRows * _nSketch);
+        _w    = daal::services::internal::service_malloc<algorithmFPType, cpu>(_nCols * _nSketch);
+        _buf  = daal::services::internal::service_malloc<algorithmFPType, cpu>(_nCols * _nSketch);
+        _tau  = daal::services::internal::service_malloc<algorithmFPType, cpu>(_nSketch);
+        _isValid = (_q && _w && _buf && _tau);
+        if (!_isValid) { return; }
+
+        /* Workspace of the QR decompositions of the matrices of sizes nRows x nSketch and nCols x nSketch */
+        queryWorkSize(_nRows, _q);
+        queryWorkSize(_nCols, _w);
+        _work = daal::services::internal::service_malloc<algorithmFPType, cpu>(_lwork);
+        _isValid = (_work != 0);
+    }
+
+    ~RandomizedRangeFinder()
+    {
+        daal::services::internal::service_free<algorithmFPType, cpu>(_q);
+        daal::services::internal::service_free<algorithmFPType, cpu>(_w);
+        daal::services::internal::service_free<algorithmFPType, cpu>(_buf);
+        daal::services::internal::service_free<algorithmFPType, cpu>(_tau);
+        daal::services::internal::service_free<algorithmFPType, cpu>(_work);
+    }
+
+    /** Returns false if the memory allocation failed */
+    bool isValid() const { return _isValid; }
+
+    /**
+     *  \brief Computes the basis Q and the sketch B = Q^T * Z
+     *
+     *  \param x[in]                Data set of size nRows x nCols stored by rows
+     *  \param mean[in]             Values subtracted from the columns of the data set, NULL if the data set is not centered
+     *  \param invSigma[in]         Multipliers of the columns of the data set, NULL if the data set is not scaled
+     *  \param nPowerIterations[in] Number of the power iterations
+     *  \param seed[in]             Seed of the Gaussian sketch
+     *  \return false if the random number generator or the QR decomposition failed
+     */
+    bool compute(const algorithmFPType *x, const algorithmFPType *mean, const algorithmFPType *invSigma,
+                 size_t nPowerIterations, size_t seed)
+    {
+        daal::internal::BaseRNGs<cpu> baseRng((unsigned int)seed);
+        daal::internal::RNGs<algorithmFPType, cpu> rng;
+        if (rng.gaussian((DAAL_INT)(_nCols * _nSketch), _w, baseRng, (algorithmFPType)0.0, (algorithmFPType)1.0) != 0) { return false; }
+
+        multiplyByZ(x, mean, invSigma);
+        if (!orthonormalize(_q, _nRows)) { return false; }
+
+        for (size_t it = 0; it < nPowerIterations; it++)
+        {
+            multiplyByZt(x, mean, invSigma);
+            if (!orthonormalize(_w, _nCols)) { return false; }
+            multiplyByZ(x, mean, invSigma);
+            if (!orthonormalize(_q, _nRows)) { return false; }
+        }
+
+        multiplyByZt(x, mean, invSigma);
+        return true;
+    }
+
+    /** Returns the basis Q of size nRows x nSketch stored by columns */
+    const algorithmFPType *getBasis() const { return _q; }
+
+    /** Returns the sketch B = Q^T * Z of size nSketch x nCols stored by rows */
+    algorithmFPType *getSketch() { return _w; }
+
+private:
+    void queryWorkSize(size_t m, algorithmFPType *a)
+    {
+        algorithmFPType workQuery = 0;
+        DAAL_INT info = 0;
+        daal::internal::Lapack<algorithmFPType, cpu>::xgeqrf((DAAL_INT)m, (DAAL_INT)_nSketch, a, (DAAL_INT)m, _tau, &workQuery, -1, &info);
+        if ((DAAL_INT)workQuery > _lwork) { _lwork = (DAAL_INT)workQuery; }
+        daal::internal::Lapack<algorithmFPType, cpu>::xorgqr((DAAL_INT)m, (DAAL_INT)_nSketch, (DAAL_INT)_nSketch, a, (DAAL_INT)m, _tau,
+                                                            &workQuery, -1, &info);
+        if ((DAAL_INT)workQuery > _lwork) { _lwork = (DAAL_INT)workQuery; }
+        if (_lwork < (DAAL_INT)_nSketch) { _lwork = (DAAL_INT)_nSketch; }
+    }
+
+    /* Replaces the m x nSketch matrix stored by columns with the orthonormal factor of its QR decomposition */
+    bool orthonormalize(algorithmFPType *a, size_t m)
+    {
+        DAAL_INT info = 0;
+        daal::internal::Lapack<algorithmFPType, cpu>::xgeqrf((DAAL_INT)m, (DAAL_INT)_nSketch, a, (DAAL_INT)m, _tau, _work, _lwork, &info);
+        if (info != 0) { return false; }
+        daal::internal::Lapack<algorithmFPType, cpu>::xorgqr((DAAL_INT)m, (DAAL_INT)_nSketch, (DAAL_INT)_nSketch, a, (DAAL_INT)m, _tau,
+                                                            _work, _lwork, &info);
+        return (info == 0);
+    }
+
+    /* Computes Q = Z * W, where W is of size nCols x nSketch stored by columns */
+    void multiplyByZ(const algorithmFPType *x, const algorithmFPType *mean, const algorithmFPType *invSigma)
+    {
+        const size_t nRows = _nRows, nCols = _nCols;
+        algorithmFPType *w = _w;
+        if (invSigma)
+        {
+            algorithmFPType *buf = _buf;
+            daal::threader_for(_nSketch, _nSketch, [ = ](int j)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nCols; i++)
+                {
+                    buf[j * nCols + i] = w[j * nCols + i] * invSigma[i];
+                }
+            } );
+            w = _buf;
+        }
+
+        char transa = 'T';
+        char transb = 'N';
+        DAAL_INT m = (DAAL_INT)_nRows;
+        DAAL_INT n = (DAAL_INT)_nSketch;
+        DAAL_INT k = (DAAL_INT)_nCols;
+        algorithmFPType one  = 1.0;
+        algorithmFPType zero = 0.0;
+        daal::internal::Blas<algorithmFPType, cpu>::xgemm(&transa, &transb, &m, &n, &k, &one, const_cast<algorithmFPType *>(x), &k,
+                                                          w, &k, &zero, _q, &m);
+        if (!mean) { return; }
+
+        /* Z * W = X * W - 1 * (mean^T * W) */
+        algorithmFPType *q = _q;
+        daal::threader_for(_nSketch, _nSketch, [ = ](int j)
+        {
+            algorithmFPType shift = 0;
+            for (size_t i = 0; i < nCols; i++)
+            {
+                shift += mean[i] * w[j * nCols + i];
+            }
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < nRows; i++)
+            {
+                q[j * nRows + i] -= shift;
+            }
+        } );
+    }
+
+    /* Computes W = Z^T * Q */
+    void multiplyByZt(const algorithmFPType *x, const algorithmFPType *mean, const algorithmFPType *invSigma)
+    {
+        char transa = 'N';
+        char transb = 'N';
+        DAAL_INT m = (DAAL_INT)_nCols;
+        DAAL_INT n = (DAAL_INT)_nSketch;
+        DAAL_INT k = (DAAL_INT)_nRows;
+        algorithmFPType one  = 1.0;
+        algorithmFPType zero = 0.0;
+        daal::internal::Blas<algorithmFPType, cpu>::xgemm(&transa, &transb, &m, &n, &k, &one, const_cast<algorithmFPType *>(x), &m,
+                                                          _q, &k, &zero, _w, &m);
+        if (!mean && !invSigma) { return; }
+
+        /* Z^T * Q = diag(invSigma) * (X^T * Q - mean * (1^T * Q)) */
+        const size_t nRows = _nRows, nCols = _nCols;
+        const algorithmFPType *q = _q;
+        algorithmFPType *w = _w;
+        daal::threader_for(_nSketch, _nSketch, [ = ](int j)
+        {
+            if (mean)
+            {
+                algorithmFPType sum = 0;
+                for (size_t i = 0; i < nRows; i++)
+                {
+                    sum += q[j * nRows + i];
+                }
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nCols; i++)
+                {
+                    w[j * nCols + i] -= mean[i] * sum;
+                }
+            }
+            if (invSigma)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nCols; i++)
+                {
+                    w[j * nCols + i] *= invSigma[i];
+                }
+            }
+        } );
+    }
+
+    size_t _nRows;
+    size_t _nCols;
+    size_t _nSketch;
+    algorithmFPType *_q;    /* Basis of size nRows x nSketch stored by columns */
+    algorithmFPType *_w;    /* Matrix of size nCols x nSketch stored by columns, the sketch on exit */
+    algorithmFPType *_buf;  /* Scaled copy of the matrix _w */
+    algorithmFPType *_tau;
+    algorithmFPType *_work;
+    DAAL_INT _lwork;
+    bool _isValid;
+};
+
+/**
+ *  \brief Computes the singular value decomposition A = U * diag(s) * V^T of the small nRows x nCols matrix A stored by rows,
+ *         r = min(nRows, nCols)
+ *
+ *  \param a[in,out]    Matrix A, destroyed on exit
+ *  \param s[out]       r singular values in the descending order
+ *  \param v[out]       r right singular vectors of size nCols stored by rows
+ *  \param u[out]       r left singular vectors of size nRows, u[j * r + i] is the j-th element of the i-th vector.
+ *                      NULL if the left singular vectors are not needed
+ *  \return false if the memory allocation or the decomposition failed
+ */
+template <typename algorithmFPType, CpuType cpu>
+bool computeSketchSVD(size_t nRows, size_t nCols, algorithmFPType *a, algorithmFPType *s, algorithmFPType *v, algorithmFPType *u)
+{
+    /* Matrix A stored by rows is the matrix A^T stored by columns, so the left and the right singular vectors swap */
+    const DAAL_INT m = (DAAL_INT)nCols;
+    const DAAL_INT n = (DAAL_INT)nRows;
+    const DAAL_INT r = (m < n ? m : n);
+    const char jobu  = 'S';
+    const char jobvt = (u ? 'S' : 'N');
+    algorithmFPType dummy = 0;
+    algorithmFPType *vt = (u ? u : &dummy);
+    const DAAL_INT ldvt = (u ? r : 1);
+
+    algorithmFPType workQuery = 0;
+    DAAL_INT info = 0;
+    daal::internal::Lapack<algorithmFPType, cpu>::xgesvd(jobu, jobvt, m, n, a, m, s, v, m, vt, ldvt, &workQuery, -1, &info);
+    if (info != 0) { return false; }
+
+    DAAL_INT lwork = (DAAL_INT)workQuery;
+    algorithmFPType *work = daal::services::internal::service_malloc<algorithmFPType, cpu>(lwork);
+    if (!work) { return false; }
+
+    daal::internal::Lapack<algorithmFPType, cpu>::xgesvd(jobu, jobvt, m, n, a, m, s, v, m, vt, ldvt, work, lwork, &info);
+    daal::services::internal::service_free<algorithmFPType, cpu>(work);
+    return (info == 0);
+}
+
+} // namespace internal
+} // namespace svd
+} // namespace algorithms
+} // namespace daal
+
+#endif
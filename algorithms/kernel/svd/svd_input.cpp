@@ -97,6 +97,13 @@ void Input::check(const daal::algorithms::Parameter *parameter, int method) cons
     if(!checkNumericTable(dataTable.get(), this->_errors.get(), dataStr())) { return; }
 
     DAAL_CHECK_EX(dataTable->getNumberOfColumns() <= dataTable->getNumberOfRows(), ErrorIncorrectNumberOfRows, ArgumentName, dataStr());
+
+    if(method == randomizedDense)
+    {
+        const Parameter *svdPar = static_cast<const Parameter *>(parameter);
+        DAAL_CHECK_EX(svdPar->nComponents > 0 && svdPar->nComponents <= dataTable->getNumberOfColumns(),
+                      ErrorIncorrectParameter, ParameterName, nComponentsStr());
+    }
 }
 
 } // namespace interface1
@@ -72,16 +72,18 @@ void Result::check(const daal::algorithms::Input *input, const daal::algorithms:
     Parameter *svdPar   = static_cast<Parameter *>(const_cast<daal::algorithms::Parameter *>(par  ));
     size_t nVectors = algInput->get(data)->getNumberOfRows();
     size_t nFeatures = algInput->get(data)->getNumberOfColumns();
+    /* The randomized method computes only nComponents singular values and vectors */
+    size_t nComponents = (method == randomizedDense ? svdPar->nComponents : nFeatures);
     int unexpectedLayouts = (int)packed_mask;
     if(!checkNumericTable(get(singularValues).get(), this->_errors.get(), singularValuesStr(),
-        unexpectedLayouts, 0, nFeatures, 1)) { return; }
+        unexpectedLayouts, 0, nComponents, 1)) { return; }
     if(svdPar->rightSingularMatrix == requiredInPackedForm)
     {
-        if(!checkNumericTable(get(rightSingularMatrix).get(), this->_errors.get(), rightSingularMatrixStr(), unexpectedLayouts, 0, nFeatures, nFeatures)) { return; }
+        if(!checkNumericTable(get(rightSingularMatrix).get(), this->_errors.get(), rightSingularMatrixStr(), unexpectedLayouts, 0, nFeatures, nComponents)) { return; }
     }
     if(svdPar->leftSingularMatrix == requiredInPackedForm)
     {
-        if(!checkNumericTable(get(leftSingularMatrix).get(), this->_errors.get(), leftSingularMatrixStr(), unexpectedLayouts, 0, nFeatures, nVectors)) { return; }
+        if(!checkNumericTable(get(leftSingularMatrix).get(), this->_errors.get(), leftSingularMatrixStr(), unexpectedLayouts, 0, nComponents, nVectors)) { return; }
     }
 }
 /**
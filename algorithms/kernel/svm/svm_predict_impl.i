@@ -24,6 +24,8 @@
 #ifndef __SVM_PREDICT_IMPL_I__
 #define __SVM_PREDICT_IMPL_I__
 
+#include "threading.h"
+#include "service_blas.h"
 #include "service_memory.h"
 #include "service_micro_table.h"
 #include "service_numeric_table.h"
@@ -42,6 +44,102 @@ namespace prediction
 namespace internal
 {
 
+/** Number of rows of the input data set processed by one thread at once */
+template <typename algorithmFPType, CpuType cpu>
+size_t getSVMPredictRowsBlockSize()
+{
+    return 256;
+}
+
+/** Maximal number of support vectors used in one block of kernel function values */
+template <typename algorithmFPType, CpuType cpu>
+size_t getSVMPredictSVBlockSize()
+{
+    return 2048;
+}
+
+/**
+ * Thread local data used in the blocked SVM prediction.
+ * Holds the copy of the kernel function and the buffer for one block
+ * of kernel function values of size nRowsInBlock x nSVInBlock
+ */
+template <typename algorithmFPType, CpuType cpu>
+struct SVMPredictTls
+{
+    SVMPredictTls(const services::SharedPtr<kernel_function::KernelIface> &kernelTemplate,
+                  const NumericTable *xTable, const NumericTable *svTable,
+                  size_t nRowsInBlock, size_t nSVInBlock) :
+        kernel(kernelTemplate->clone()), mtX(NULL), mtSV(NULL), buffer(NULL)
+    {
+        if (!kernel) { error.setId(services::ErrorMemoryAllocationFailed); return; }
+        kernel->getErrors()->setCanThrow(false);
+
+        buffer = (algorithmFPType *)daal::services::daal_malloc(nRowsInBlock * nSVInBlock * sizeof(algorithmFPType));
+        if (!buffer) { error.setId(services::ErrorMemoryAllocationFailed); return; }
+
+        mtX  = createMicroTable(xTable);
+        mtSV = createMicroTable(svTable);
+        if (!mtX || !mtSV) { error.setId(services::ErrorMemoryAllocationFailed); return; }
+    }
+
+    virtual ~SVMPredictTls()
+    {
+        daal::services::daal_free(buffer);
+        delete mtX;
+        delete mtSV;
+    }
+
+    /**
+     * Returns the numeric table that refers to the block of rows of the table
+     * without copying the data when the table data type matches algorithmFPType
+     */
+    static NumericTablePtr getBlockTable(MicroTable *mt, size_t nFeatures, size_t startRow, size_t nRows)
+    {
+        if (mt->getDataLayout() == NumericTableIface::csrArray)
+        {
+            algorithmFPType *values;
+            size_t *colIndices, *rowOffsets;
+            static_cast<CSRBlockMicroTable<algorithmFPType, readOnly, cpu> *>(mt)->getSparseBlock(
+                startRow, nRows, &values, &colIndices, &rowOffsets);
+            return NumericTablePtr(new CSRNumericTable(values, colIndices, rowOffsets, nFeatures, nRows));
+        }
+        algorithmFPType *values;
+        static_cast<BlockMicroTable<algorithmFPType, readOnly, cpu> *>(mt)->getBlockOfRows(startRow, nRows, &values);
+        return NumericTablePtr(new HomogenNumericTableCPU<algorithmFPType, cpu>(values, nFeatures, nRows));
+    }
+
+    static void releaseBlockTable(MicroTable *mt)
+    {
+        if (mt->getDataLayout() == NumericTableIface::csrArray)
+        {
+            static_cast<CSRBlockMicroTable<algorithmFPType, readOnly, cpu> *>(mt)->release();
+        }
+        else
+        {
+            static_cast<BlockMicroTable<algorithmFPType, readOnly, cpu> *>(mt)->release();
+        }
+    }
+
+    services::SharedPtr<kernel_function::KernelIface> kernel;
+    MicroTable *mtX;
+    MicroTable *mtSV;
+    algorithmFPType *buffer;
+    services::Error error;                       /*!< Error occurred in the thread */
+    services::KernelErrorCollectionPtr kernelErrors; /*!< Errors of the kernel function computation */
+
+    bool failed() const { return (error.id() != services::NoErrorMessageFound) || kernelErrors; }
+
+protected:
+    static MicroTable *createMicroTable(const NumericTable *table)
+    {
+        if (table->getDataLayout() == NumericTableIface::csrArray)
+        {
+            return new CSRBlockMicroTable<algorithmFPType, readOnly, cpu>(table);
+        }
+        return new BlockMicroTable<algorithmFPType, readOnly, cpu>(table);
+    }
+};
+
 template <typename algorithmFPType, CpuType cpu>
 struct SVMPredictImpl<defaultDense, algorithmFPType, cpu> : public Kernel
 {
@@ -56,9 +154,6 @@ struct SVMPredictImpl<defaultDense, algorithmFPType, cpu> : public Kernel
         Model *model = static_cast<Model *>(const_cast<daal::algorithms::Model *>(m));
         Parameter *parameter = static_cast<Parameter *>(const_cast<daal::algorithms::Parameter *>(par));
 
-        services::SharedPtr<kernel_function::KernelIface> kernel = parameter->kernel->clone();
-        kernel->getErrors()->setCanThrow(false);
-
         NumericTablePtr svTable       = model->getSupportVectors();
         NumericTablePtr svCoeffTable  = model->getClassificationCoefficients();
         algorithmFPType bias = (algorithmFPType)model->getBias();
@@ -81,42 +176,153 @@ struct SVMPredictImpl<defaultDense, algorithmFPType, cpu> : public Kernel
         else
         {
             mtSVCoeff.getBlockOfColumnValues(0, 0, nSV, &svCoeff);
+            computeBlocked(xTable, svTable, nVectors, nSV, svCoeff, bias, parameter->kernel, distance);
+            mtSVCoeff.release();
+        }
+        mtR.release();
+    }
+
+protected:
+    /**
+     * Computes the decision function by blocks of nRowsInBlock input vectors and nSVInBlock support vectors.
+     * The kernel function values are never stored for more than one block per thread,
+     * the reduction with classification coefficients is fused into the processing of the block.
+     */
+    void computeBlocked(const NumericTablePtr &xTable, const NumericTablePtr &svTable, size_t nVectors, size_t nSV,
+                        algorithmFPType *svCoeff, algorithmFPType bias,
+                        const services::SharedPtr<kernel_function::KernelIface> &kernelTemplate,
+                        algorithmFPType *distance)
+    {
+        const size_t nFeatures = xTable->getNumberOfColumns();
+
+        const size_t nRowsInBlock = getSVMPredictRowsBlockSize<algorithmFPType, cpu>();
+        size_t nBlocks = nVectors / nRowsInBlock;
+        if (nBlocks * nRowsInBlock < nVectors) { nBlocks++; }
 
-            algorithmFPType *buf = (algorithmFPType *)daal::services::daal_malloc(nSV * nVectors * sizeof(algorithmFPType));
-            if (buf == NULL) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+        size_t nSVInBlock = getSVMPredictSVBlockSize<algorithmFPType, cpu>();
+        if (nSVInBlock > nSV) { nSVInBlock = nSV; }
+        size_t nSVBlocks = nSV / nSVInBlock;
+        if (nSVBlocks * nSVInBlock < nSV) { nSVBlocks++; }
 
-            NumericTablePtr shResNT(new HomogenNumericTableCPU<algorithmFPType, cpu>(buf, nSV, nVectors));
+        const NumericTable *x  = xTable.get();
+        const NumericTable *sv = svTable.get();
 
-            services::SharedPtr<kernel_function::Result> shRes(new kernel_function::Result());
-            shRes->set(kernel_function::values, shResNT);
+        /* Squared norms of the support vectors are computed once for all blocks
+           or taken from the precomputed state attached to the kernel function.
+           The attached states are only read, as other computations may share them */
+        kernel_function::PrecomputedStatePtr svState = kernelTemplate->parameterBase->precomputedStateY;
+        if (!svState || !svState->isStateOf(sv) || !svState->getSquaredNorms<algorithmFPType>())
+        {
+            svState = kernel_function::PrecomputedStatePtr(new kernel_function::PrecomputedState(svTable));
+            if (!svState->compute<algorithmFPType>()) { this->_errors->add(svState->getErrors()->getErrors()); return; }
+        }
+
+        kernel_function::PrecomputedStatePtr xState = kernelTemplate->parameterBase->precomputedStateX;
+        if (xState && (!xState->isStateOf(x) || !xState->getSquaredNorms<algorithmFPType>()))
+        {
+            xState = kernel_function::PrecomputedStatePtr();
+        }
 
-            kernel->setResult(shRes);
-            kernel->inputBase->set(kernel_function::X, xTable);
-            kernel->inputBase->set(kernel_function::Y, svTable);
-            kernel->parameterBase->computationMode = kernel_function::matrixMatrix;
-            kernel->computeNoThrow();
-            if(kernel->getErrors()->size() != 0)
+        daal::tls<SVMPredictTls<algorithmFPType, cpu> *> tls([=]()
+        {
+            return new SVMPredictTls<algorithmFPType, cpu>(kernelTemplate, x, sv, nRowsInBlock, nSVInBlock);
+        } );
+
+        daal::threader_for(nBlocks, nBlocks, [&](int iBlock)
+        {
+            SVMPredictTls<algorithmFPType, cpu> *local = tls.local();
+            if (local->failed()) { return; }
+
+            size_t startRow = iBlock * nRowsInBlock;
+            size_t nRows = nRowsInBlock;
+            if (startRow + nRows > nVectors) { nRows = nVectors - startRow; }
+
+            algorithmFPType *blockDistance = distance + startRow;
+            for (size_t i = 0; i < nRows; i++)
             {
-                mtSVCoeff.release();
-                daal::services::daal_free(buf);
-                mtR.release();
-                this->_errors->add(services::ErrorSVMinnerKernel);
-                this->_errors->add(kernel->getErrors()->getErrors());
-                return;
+                blockDistance[i] = bias;
             }
-            for (size_t i = 0; i < nVectors; i++)
+
+            NumericTablePtr xBlockTable = SVMPredictTls<algorithmFPType, cpu>::getBlockTable(local->mtX, nFeatures, startRow, nRows);
+            if (!xBlockTable) { local->error.setId(services::ErrorMemoryAllocationFailed); return; }
+
+            for (size_t iSVBlock = 0; iSVBlock < nSVBlocks; iSVBlock++)
             {
-                distance[i] = bias;
-                for (size_t j = 0; j < nSV; j++)
-                {
-                    distance[i] += buf[i * nSV + j] * svCoeff[j];
-                }
+                size_t startSV = iSVBlock * nSVInBlock;
+                size_t nSVRows = nSVInBlock;
+                if (startSV + nSVRows > nSV) { nSVRows = nSV - startSV; }
+
+                /* Support vectors are used as is if they fit into one block */
+                NumericTablePtr svBlockTable = (nSVBlocks == 1 ? svTable :
+                    SVMPredictTls<algorithmFPType, cpu>::getBlockTable(local->mtSV, nFeatures, startSV, nSVRows));
+
+                computeBlock(local, xBlockTable, svBlockTable, xState, startRow, svState, startSV,
+                             nRows, nSVRows, svCoeff + startSV, blockDistance);
+
+                if (nSVBlocks > 1) { SVMPredictTls<algorithmFPType, cpu>::releaseBlockTable(local->mtSV); }
+                if (local->failed()) { break; }
             }
 
-            mtSVCoeff.release();
-            daal::services::daal_free(buf);
+            SVMPredictTls<algorithmFPType, cpu>::releaseBlockTable(local->mtX);
+        } );
+
+        tls.reduce([=](SVMPredictTls<algorithmFPType, cpu> *local)
+        {
+            if (local->error.id() != services::NoErrorMessageFound)
+            {
+                this->_errors->add(services::SharedPtr<services::Error>(new services::Error(local->error)));
+            }
+            if (local->kernelErrors)
+            {
+                this->_errors->add(services::ErrorSVMinnerKernel);
+                this->_errors->add(local->kernelErrors);
+            }
+            delete local;
+        } );
+    }
+
+    /** Computes kernel function values for the block and accumulates them into the decision function */
+    void computeBlock(SVMPredictTls<algorithmFPType, cpu> *local, const NumericTablePtr &xBlockTable,
+                      const NumericTablePtr &svBlockTable,
+                      const kernel_function::PrecomputedStatePtr &xState, size_t startRow,
+                      const kernel_function::PrecomputedStatePtr &svState, size_t startSV,
+                      size_t nRows, size_t nSVRows, algorithmFPType *svCoeff, algorithmFPType *blockDistance)
+    {
+        NumericTablePtr shResNT(new HomogenNumericTableCPU<algorithmFPType, cpu>(local->buffer, nSVRows, nRows));
+        services::SharedPtr<kernel_function::Result> shRes(new kernel_function::Result());
+        if (!shResNT || !shRes) { local->error.setId(services::ErrorMemoryAllocationFailed); return; }
+        shRes->set(kernel_function::values, shResNT);
+
+        services::SharedPtr<kernel_function::KernelIface> &kernel = local->kernel;
+        kernel->setResult(shRes);
+        kernel->inputBase->set(kernel_function::X, xBlockTable);
+        kernel->inputBase->set(kernel_function::Y, svBlockTable);
+        kernel->parameterBase->computationMode = kernel_function::matrixMatrix;
+        kernel->parameterBase->precomputedStateX = getBlockState(xState, xBlockTable, startRow);
+        kernel->parameterBase->precomputedStateY = getBlockState(svState, svBlockTable, startSV);
+        kernel->computeNoThrow();
+        if (kernel->getErrors()->size() != 0)
+        {
+            local->kernelErrors = kernel->getErrors()->getErrors();
+            return;
         }
-        mtR.release();
+
+        /* blockDistance += K(xBlock, svBlock) * svCoeff */
+        char trans = 'T';
+        algorithmFPType one = 1.0;
+        DAAL_INT m = (DAAL_INT)nSVRows;
+        DAAL_INT n = (DAAL_INT)nRows;
+        DAAL_INT inc = 1;
+        Blas<algorithmFPType, cpu>::xxgemv(&trans, &m, &n, &one, local->buffer, &m, svCoeff, &inc,
+                                           &one, blockDistance, &inc);
+    }
+
+    /** Returns the state of the block of rows that shares the data of the state of the full table */
+    static kernel_function::PrecomputedStatePtr getBlockState(const kernel_function::PrecomputedStatePtr &state,
+                                                              const NumericTablePtr &blockTable, size_t startRow)
+    {
+        if (!state || state->getTable().get() == blockTable.get()) { return state; }
+        return kernel_function::PrecomputedStatePtr(new kernel_function::PrecomputedState(state, blockTable, startRow));
     }
 };
 
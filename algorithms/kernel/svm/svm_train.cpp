@@ -44,7 +44,7 @@ namespace training
 namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_SVM_TRAINING_RESULT_ID);
-Result::Result() : classifier::training::Result() {}
+Result::Result() : classifier::training::Result(2) {}
 
 /**
  * Returns the model trained with the SVM algorithm
@@ -56,6 +56,26 @@ services::SharedPtr<daal::algorithms::svm::Model> Result::get(classifier::traini
     return services::staticPointerCast<daal::algorithms::svm::Model, data_management::SerializationIface>(Argument::get(id));
 }
 
+/**
+ * Returns the numeric table result of the SVM training algorithm
+ * \param[in] id    Identifier of the result, \ref ResultNumericTableId
+ * \return          Numeric table that corresponds to the given identifier
+ */
+data_management::NumericTablePtr Result::get(ResultNumericTableId id) const
+{
+    return services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the numeric table result of the SVM training algorithm
+ * \param[in] id    Identifier of the result, \ref ResultNumericTableId
+ * \param[in] value Pointer to the numeric table
+ */
+void Result::set(ResultNumericTableId id, const data_management::NumericTablePtr &value)
+{
+    Argument::set(id, value);
+}
+
 void Result::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const
 {
     classifier::training::Result::check(input, parameter, method);
@@ -71,6 +91,12 @@ void Result::check(const daal::algorithms::Input *input, const daal::algorithms:
         this->_errors->add(services::Error::create(services::ErrorModelNotFullInitialized, services::ArgumentName, classificationCoefficientsStr()));
         return;
     }
+    data_management::NumericTablePtr cacheStatisticsTable = get(cacheStatistics);
+    if(cacheStatisticsTable)
+    {
+        int unexpectedLayouts = (int)data_management::packed_mask;
+        if(!data_management::checkNumericTable(cacheStatisticsTable.get(), this->_errors.get(), cacheStatisticsStr(), unexpectedLayouts, 0, 2, 1)) { return; }
+    }
 }
 
 }// namespace interface1
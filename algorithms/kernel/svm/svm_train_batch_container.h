@@ -60,10 +60,11 @@ void BatchContainer<algorithmFPType, method, cpu>::compute()
     NumericTable *y = input->get(classifier::training::labels).get();
 
     daal::algorithms::Model *r = static_cast<daal::algorithms::Model *>(result->get(classifier::training::model).get());
+    NumericTable *cacheStatisticsTable = result->get(svm::training::cacheStatistics).get();
 
     daal::algorithms::Parameter *par = _par;
     daal::services::Environment::env &env = *_env;
-    __DAAL_CALL_KERNEL(env, internal::SVMTrainImpl, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, x, y, r, par);
+    __DAAL_CALL_KERNEL(env, internal::SVMTrainImpl, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, x, y, r, cacheStatisticsTable, par);
 }
 
 } // namespace training
@@ -28,6 +28,7 @@
 #include "service_memory.h"
 #include "service_micro_table.h"
 #include "service_numeric_table.h"
+#include "svm_train_boser_lru.h"
 using namespace daal::services::internal;
 
 namespace daal
@@ -209,6 +210,26 @@ public:
      * \param[in] I              Array of flags that describe the status of feature vectors
      */
     virtual void updateShrinkingRowIndices(size_t nActiveVectors, const char *I) = 0;
+
+    /**
+     * Get the diagonal elements of the matrix Q (kernel(x[i], x[i]))
+     *
+     * \param[in]  nVectors    Number of observations in a training data set
+     * \param[out] kernelDiag  Array of size nVectors to store the diagonal elements
+     */
+    virtual void getKernelDiagonal(size_t nVectors, algorithmFPType *kernelDiag) = 0;
+
+    /**
+     * Get the number of requests of the rows of the matrix Q that were served from the cache
+     * \return Number of cache hits
+     */
+    virtual size_t getNumberOfHits() const = 0;
+
+    /**
+     * Get the number of requests of the rows of the matrix Q that required computation of the kernel function
+     * \return Number of cache misses
+     */
+    virtual size_t getNumberOfMisses() const = 0;
 };
 
 /**
@@ -229,7 +250,7 @@ public:
     SVMCacheImpl(size_t lineSize, bool doShrinking, services::SharedPtr<kernel_function::KernelIface> kernel,
                   services::SharedPtr<services::KernelErrorCollection> errors) :
         _lineSize(lineSize), doShrinking(doShrinking), shrinkingRowIndices(NULL),
-        _kernel(kernel), _errors(errors)
+        _kernel(kernel), _errors(errors), rowGetter(NULL), _nHits(0), _nMisses(0)
     {
         if (doShrinking)
         {
@@ -259,6 +280,10 @@ public:
         }
     }
 
+    virtual size_t getNumberOfHits() const { return _nHits; }
+
+    virtual size_t getNumberOfMisses() const { return _nMisses; }
+
     bool doShrinking;               /*!< Flag that enables use of the shrinking optimization technique */
     size_t *shrinkingRowIndices;    /*!< Array of input data row indices used with shrinking technique */
 protected:
@@ -267,6 +292,8 @@ protected:
     services::SharedPtr<kernel_function::KernelIface> _kernel;      /*!< Kernel function */
     services::SharedPtr<services::KernelErrorCollection> _errors;
     SVMCacheRowGetterIface<algorithmFPType, cpu> *rowGetter;
+    size_t _nHits;                  /*!< Number of requests of the rows of the matrix Q served from the cache */
+    size_t _nMisses;                /*!< Number of requests of the rows of the matrix Q that required kernel computation */
 };
 
 template<SVMCacheType cacheType, typename algorithmFPType, CpuType cpu>
@@ -284,6 +311,8 @@ class SVMCache<simpleCache, algorithmFPType, cpu> : public SVMCacheImpl<algorith
     using SVMCacheImpl<algorithmFPType, cpu>::shrinkingRowIndices;
     using SVMCacheImpl<algorithmFPType, cpu>::doShrinking;
     using SVMCacheImpl<algorithmFPType, cpu>::rowGetter;
+    using SVMCacheImpl<algorithmFPType, cpu>::_nHits;
+    using SVMCacheImpl<algorithmFPType, cpu>::_nMisses;
 public:
     /**
      * Constructs simple cache
@@ -322,6 +351,7 @@ public:
 
         _kernel->computeNoThrow();
         if(_kernel->getErrors()->size() != 0) {errors->add(_kernel->getErrors()->getErrors()); return;}
+        _nMisses = _lineSize * _nLines;
     }
 
     /**
@@ -333,6 +363,7 @@ public:
      */
     algorithmFPType *getRowBlock(size_t rowIndex, size_t startColIndex, size_t blockSize)
     {
+        _nHits += blockSize;
         return rowGetter->getRowBlock(rowIndex, startColIndex, blockSize, _lineSize, 0, _kernel,
                                       _cache, _cacheTable, shrinkingRowIndices);
     }
@@ -349,6 +380,7 @@ public:
     void getTwoRowsBlock(size_t rowIndex1, size_t rowIndex2, size_t startColIndex, size_t blockSize,
                          algorithmFPType **block1, algorithmFPType **block2)
     {
+        _nHits += 2 * blockSize;
         *block1 = rowGetter->getRowBlock(rowIndex1, startColIndex, blockSize, _lineSize, 0, _kernel,
                                          _cache, _cacheTable, shrinkingRowIndices);
         *block2 = rowGetter->getRowBlock(rowIndex2, startColIndex, blockSize, _lineSize, 0, _kernel,
@@ -361,6 +393,21 @@ public:
      */
     SVMCacheType getType() const { return simpleCache; }
 
+    /**
+     * Get the diagonal elements of the matrix Q (kernel(x[i], x[i]))
+     *
+     * \param[in]  nVectors    Number of observations in a training data set
+     * \param[out] kernelDiag  Array of size nVectors to store the diagonal elements
+     */
+    void getKernelDiagonal(size_t nVectors, algorithmFPType *kernelDiag)
+    {
+        _nHits += nVectors;
+        for (size_t i = 0; i < nVectors; i++)
+        {
+            kernelDiag[i] = *(rowGetter->getRowBlock(i, i, 1, _lineSize, 0, _kernel, _cache, _cacheTable, shrinkingRowIndices));
+        }
+    }
+
     /**
      * Move the indices of the shrunk feature vector to the end of the array
      *
@@ -396,6 +443,8 @@ class SVMCache<noCache, algorithmFPType, cpu> : public SVMCacheImpl<algorithmFPT
     using SVMCacheImpl<algorithmFPType, cpu>::shrinkingRowIndices;
     using SVMCacheImpl<algorithmFPType, cpu>::doShrinking;
     using SVMCacheImpl<algorithmFPType, cpu>::rowGetter;
+    using SVMCacheImpl<algorithmFPType, cpu>::_nHits;
+    using SVMCacheImpl<algorithmFPType, cpu>::_nMisses;
 public:
     /**
      * Constructs the cache that doesn't cache kernel function values
@@ -443,6 +492,7 @@ public:
      */
     algorithmFPType *getRowBlock(size_t rowIndex, size_t startColIndex, size_t blockSize)
     {
+        _nMisses += blockSize;
         return rowGetter->getRowBlock(rowIndex, startColIndex, blockSize, _lineSize, 0, _kernel,
                                       _cache, _cacheTable, shrinkingRowIndices);
     }
@@ -459,6 +509,7 @@ public:
     void getTwoRowsBlock(size_t rowIndex1, size_t rowIndex2, size_t startColIndex, size_t blockSize,
                     algorithmFPType **block1, algorithmFPType **block2)
     {
+        _nMisses += 2 * blockSize;
         *block1 = rowGetter->getRowBlock(rowIndex1, startColIndex, blockSize, _lineSize, 0, _kernel,
                                          _cache, _cacheTable, shrinkingRowIndices);
         *block2 = rowGetter->getRowBlock(rowIndex2, startColIndex, blockSize, _lineSize, blockSize, _kernel,
@@ -471,6 +522,21 @@ public:
      */
     SVMCacheType getType() const { return noCache; }
 
+    /**
+     * Get the diagonal elements of the matrix Q (kernel(x[i], x[i]))
+     *
+     * \param[in]  nVectors    Number of observations in a training data set
+     * \param[out] kernelDiag  Array of size nVectors to store the diagonal elements
+     */
+    void getKernelDiagonal(size_t nVectors, algorithmFPType *kernelDiag)
+    {
+        _nMisses += nVectors;
+        for (size_t i = 0; i < nVectors; i++)
+        {
+            kernelDiag[i] = *(rowGetter->getRowBlock(i, i, 1, _lineSize, 0, _kernel, _cache, _cacheTable, shrinkingRowIndices));
+        }
+    }
+
     /**
      * Move the indices of the shrunk feature vector to the end of the array
      *
@@ -492,6 +558,208 @@ protected:
     services::SharedPtr<HomogenNumericTableCPU<algorithmFPType, cpu> > _cacheTable;
 };
 
+/**
+ * LRU cache: only part of the rows of the kernel matrix fit into cache.
+ * The rows are identified by the index of the observation in the input data set,
+ * values in a row are stored in the order of observations in the input data set,
+ * so the rows stay valid after the shrinking re-orders the active observations.
+ * The least recently used row is evicted when a new row is computed.
+ */
+template<typename algorithmFPType, CpuType cpu>
+class SVMCache<lruCache, algorithmFPType, cpu> : public SVMCacheImpl<algorithmFPType, cpu>
+{
+    using SVMCacheImpl<algorithmFPType, cpu>::_cache;
+    using SVMCacheImpl<algorithmFPType, cpu>::_kernel;
+    using SVMCacheImpl<algorithmFPType, cpu>::_lineSize;
+    using SVMCacheImpl<algorithmFPType, cpu>::shrinkingRowIndices;
+    using SVMCacheImpl<algorithmFPType, cpu>::doShrinking;
+    using SVMCacheImpl<algorithmFPType, cpu>::_nHits;
+    using SVMCacheImpl<algorithmFPType, cpu>::_nMisses;
+public:
+    /**
+     * Constructs LRU cache
+     *
+     * \param[in] cacheSize     Size of cache in bytes
+     * \param[in] lineSize      Number of elements in the cache line
+     * \param[in] doShrinking   Flag that enables use of the shrinking optimization technique
+     * \param[in] xTable        Input data set
+     * \param[in] kernel        Kernel function
+     * \param[in] errors        Pointer to error collection associated with SVM training algorithm
+     */
+    SVMCache(size_t cacheSize, size_t lineSize, bool doShrinking, NumericTablePtr xTable,
+             services::SharedPtr<kernel_function::KernelIface> kernel,
+             services::SharedPtr<services::KernelErrorCollection> errors) :
+        SVMCacheImpl<algorithmFPType, cpu>(lineSize, doShrinking, kernel, errors),
+        _nLines(getNumberOfLines(cacheSize, lineSize)), _lines(_nLines, lineSize), _tmp(NULL), _isPermuted(false)
+    {
+        _cache = (algorithmFPType *)daal::services::daal_malloc(_nLines * _lineSize * sizeof(algorithmFPType));
+        _tmp   = (algorithmFPType *)daal::services::daal_malloc(2 * _lineSize * sizeof(algorithmFPType));
+        if (!_cache || !_tmp || !_lines.isValid())
+        { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+        _cacheTable = services::SharedPtr<HomogenNumericTableCPU<algorithmFPType, cpu> >(
+            new HomogenNumericTableCPU<algorithmFPType, cpu>(_cache, 1, _lineSize));
+        services::SharedPtr<kernel_function::Result> result(new kernel_function::Result());
+        result->set(kernel_function::values, _cacheTable);
+        _kernel->setResult(result);
+
+        _kernel->inputBase->set(kernel_function::X, xTable);
+        _kernel->inputBase->set(kernel_function::Y, xTable);
+    }
+
+    ~SVMCache()
+    {
+        daal::services::daal_free(_cache);
+        daal::services::daal_free(_tmp);
+    }
+
+    /**
+     * Returns the number of rows of the kernel matrix that fit into the cache of the given size
+     * \param[in] cacheSize     Size of cache in bytes
+     * \param[in] lineSize      Number of elements in the cache line
+     * \return Number of rows of the kernel matrix that fit into the cache
+     */
+    static size_t getNumberOfLines(size_t cacheSize, size_t lineSize)
+    {
+        size_t nLines = cacheSize / (lineSize * sizeof(algorithmFPType));
+        return (nLines < lineSize ? nLines : lineSize);
+    }
+
+    /**
+     * Get block of values from the row of the matrix Q (kernel(x[i], x[j]))
+     * \param[in] rowIndex      Index of the requested row
+     * \param[in] startColIndex Starting columns index of the requested block of values
+     * \param[in] blockSize     Number of requested values
+     * \return Block of values from the row of the matirx Q
+     */
+    algorithmFPType *getRowBlock(size_t rowIndex, size_t startColIndex, size_t blockSize)
+    {
+        algorithmFPType *line = getLine(this->getDataRowIndex(rowIndex), blockSize);
+        return getBlockFromLine(line, startColIndex, blockSize, _tmp);
+    }
+
+    /**
+     * Get blocks of values from the two rows of the matrix Q (kernel(x[i], x[j]))
+     * \param[in] rowIndex1     Index of the first requested row
+     * \param[in] rowIndex2     Index of the second requested row
+     * \param[in] startColIndex Starting columns index of the requested blocks of values
+     * \param[in] blockSize     Number of requested values in each block
+     * \param[out] block1       Pointer to the first  block of values
+     * \param[out] block2       Pointer to the second block of values
+     */
+    void getTwoRowsBlock(size_t rowIndex1, size_t rowIndex2, size_t startColIndex, size_t blockSize,
+                         algorithmFPType **block1, algorithmFPType **block2)
+    {
+        /* Cache contains at least two lines, so the first line is not evicted by the second request */
+        algorithmFPType *line1 = getLine(this->getDataRowIndex(rowIndex1), blockSize);
+        algorithmFPType *line2 = getLine(this->getDataRowIndex(rowIndex2), blockSize);
+        *block1 = getBlockFromLine(line1, startColIndex, blockSize, _tmp);
+        *block2 = getBlockFromLine(line2, startColIndex, blockSize, _tmp + _lineSize);
+    }
+
+    /**
+     * Get type of the cache: noCache, simpleCache or lruCache
+     * \return Type of the cache
+     */
+    SVMCacheType getType() const { return lruCache; }
+
+    /**
+     * Move the indices of the shrunk feature vector to the end of the array.
+     * The lines of the cache are not modified as they are indexed by the observations in the input data set
+     *
+     * \param[in] nActiveVectors Number of observations in a training data set that are used
+     *                           in sequential minimum optimization at the current iteration
+     * \param[in] I              Array of flags that describe the status of feature vectors
+     */
+    virtual void updateShrinkingRowIndices(size_t nActiveVectors, const char *I);
+
+    /**
+     * Get the diagonal elements of the matrix Q (kernel(x[i], x[i])) without filling the cache
+     *
+     * \param[in]  nVectors    Number of observations in a training data set
+     * \param[out] kernelDiag  Array of size nVectors to store the diagonal elements
+     */
+    void getKernelDiagonal(size_t nVectors, algorithmFPType *kernelDiag)
+    {
+        _nMisses += nVectors;
+        _cacheTable->setArray(kernelDiag);
+        _kernel->parameterBase->computationMode = kernel_function::vectorVector;
+        for (size_t i = 0; i < nVectors; i++)
+        {
+            size_t dataRowIndex = this->getDataRowIndex(i);
+            _kernel->parameterBase->rowIndexX      = dataRowIndex;
+            _kernel->parameterBase->rowIndexY      = dataRowIndex;
+            _kernel->parameterBase->rowIndexResult = i;
+            _kernel->computeNoThrow();
+        }
+        if(_kernel->getErrors()->size() != 0) { this->_errors->add(_kernel->getErrors()->getErrors()); }
+    }
+
+protected:
+    /**
+     * Returns the line of the cache that contains kernel function values for the given observation.
+     * A hit counts the requested values, a miss counts all values computed for the line
+     */
+    algorithmFPType *getLine(size_t dataRowIndex, size_t blockSize)
+    {
+        size_t iLine = _lines.find(dataRowIndex);
+        if (iLine != SVMLRULines::nil)
+        {
+            _nHits += blockSize;
+            return _cache + iLine * _lineSize;
+        }
+
+        _nMisses += _lineSize;
+        iLine = _lines.insert(dataRowIndex);
+        algorithmFPType *line = _cache + iLine * _lineSize;
+        if (!computeLine(dataRowIndex, line))
+        {
+            /* The line with the failed values is not kept in the cache */
+            _lines.remove(dataRowIndex);
+        }
+        return line;
+    }
+
+    /**
+     * Computes kernel function values for the observation and all observations in the input data set
+     * eturn false if the kernel function failed, the errors are added to the errors of the cache
+     */
+    bool computeLine(size_t dataRowIndex, algorithmFPType *line)
+    {
+        _cacheTable->setArray(line);
+        _kernel->parameterBase->computationMode = kernel_function::matrixVector;
+        _kernel->parameterBase->rowIndexY       = dataRowIndex;
+        _kernel->parameterBase->rowIndexResult  = 0;
+        _kernel->computeNoThrow();
+        if (_kernel->getErrors()->size() != 0)
+        {
+            this->_errors->add(_kernel->getErrors()->getErrors());
+            return false;
+        }
+        return true;
+    }
+
+    /** Returns the block of the line in the order of the active observations */
+    algorithmFPType *getBlockFromLine(algorithmFPType *line, size_t startColIndex, size_t blockSize, algorithmFPType *buffer)
+    {
+        if (!_isPermuted) { return line + startColIndex; }
+
+        const size_t *indices = shrinkingRowIndices + startColIndex;
+      PRAGMA_IVDEP
+        for (size_t j = 0; j < blockSize; j++)
+        {
+            buffer[j] = line[indices[j]];
+        }
+        return buffer;
+    }
+
+    size_t _nLines;         /*!< Number of lines in the cache */
+    SVMLRULines _lines;     /*!< Order of the lines of the cache by the time of the last use */
+    algorithmFPType *_tmp;  /*!< Buffer for the blocks of rows re-ordered according to shrinking */
+    bool _isPermuted;       /*!< Flag that indicates that the order of active observations differs from the input data set */
+    services::SharedPtr<HomogenNumericTableCPU<algorithmFPType, cpu> > _cacheTable;
+};
+
 } // namespace internal
 
 } // namespace training
@@ -63,7 +63,7 @@ namespace internal
 
 template <typename algorithmFPType, CpuType cpu>
 void SVMTrainImpl<boser, algorithmFPType, cpu>::compute(NumericTablePtr xTable, NumericTable *yTable, daal::algorithms::Model *r,
-            const daal::algorithms::Parameter *par)
+            NumericTable *cacheStatisticsTable, const daal::algorithms::Parameter *par)
 {
     size_t nFeatures = xTable->getNumberOfColumns();
     size_t nVectors  = xTable->getNumberOfRows();
@@ -81,6 +81,12 @@ void SVMTrainImpl<boser, algorithmFPType, cpu>::compute(NumericTablePtr xTable,
     model->setNFeatures(nFeatures);
     services::SharedPtr<kernel_function::KernelIface> kernel = svmPar->kernel->clone();
 
+    /* Squared norms of the training vectors are computed once for all kernel function calls */
+    kernel_function::PrecomputedStatePtr xState(new kernel_function::PrecomputedState(xTable));
+    if (!xState->compute<algorithmFPType>()) { this->_errors->add(xState->getErrors()->getErrors()); return; }
+    kernel->parameterBase->precomputedStateX = xState;
+    kernel->parameterBase->precomputedStateY = xState;
+
     /* Allocate memory for storing intermediate results */
     SVMTrainTask<algorithmFPType, cpu> task(cacheSize, nVectors, kernelFunctionBlockSize, doShrinking,
                                             xTable, yTable, kernel, this->_errors);
@@ -137,6 +143,7 @@ void SVMTrainImpl<boser, algorithmFPType, cpu>::compute(NumericTablePtr xTable,
             }
 
             updateTask(nActiveVectors, C, Bi, Bj, delta, y, alpha, grad, task);
+            if (this->_errors->size() != 0) { return; }
 
             if ((shrinkingIter % shrinkingStep) == 0)
             {
@@ -177,8 +184,10 @@ void SVMTrainImpl<boser, algorithmFPType, cpu>::compute(NumericTablePtr xTable,
                                           &Bi, &Bj, &delta, &ma, &Ma, &curEps))
             { break; }
             updateTask(nActiveVectors, C, Bi, Bj, delta, y, alpha, grad, task);
+            if (this->_errors->size() != 0) { return; }
         }
     }
+    if (this->_errors->size() != 0) { return; }
 
     /* Write support vectors and classification coefficients into model */
     size_t nSV = computeNumberOfSV(nVectors, alpha);
@@ -197,6 +206,17 @@ void SVMTrainImpl<boser, algorithmFPType, cpu>::compute(NumericTablePtr xTable,
     /* Calculate bias and write it into model */
     algorithmFPType bias = calculateBias(C, nVectors, y, alpha, grad);
     model->setBias((double)bias);
+
+    /* Write statistics of the kernel function values cache */
+    if (cacheStatisticsTable)
+    {
+        double *cacheStatisticsArray;
+        BlockMicroTable<double, writeOnly, cpu> mtCacheStatistics(cacheStatisticsTable);
+        mtCacheStatistics.getBlockOfRows(0, 1, &cacheStatisticsArray);
+        cacheStatisticsArray[cacheHits]   = (double)task.cache->getNumberOfHits();
+        cacheStatisticsArray[cacheMisses] = (double)task.cache->getNumberOfMisses();
+        mtCacheStatistics.release();
+    }
 }
 
 /**
@@ -831,6 +851,11 @@ SVMTrainTask<algorithmFPType, cpu>::SVMTrainTask(
         cache = new SVMCache<simpleCache,  algorithmFPType, cpu>(cacheSize, nVectors,
                     doShrinking, xTable, kernel, _errors);
     }
+    else if (SVMCache<lruCache, algorithmFPType, cpu>::getNumberOfLines(cacheSize, nVectors) >= 2)
+    {
+        cache = new SVMCache<lruCache,     algorithmFPType, cpu>(cacheSize, nVectors,
+                    doShrinking, xTable, kernel, _errors);
+    }
     else
     {
         cacheSize = kernelFunctionBlockSize;
@@ -871,12 +896,7 @@ void SVMTrainTask<algorithmFPType, cpu>::init(algorithmFPType C)
         updateI(C, i);
     }
 
-    algorithmFPType *KiiPtr;
-    for (size_t i = 0; i < nVectors; i++)
-    {
-        KiiPtr = cache->getRowBlock(i, i, 1);
-        kernelDiag[i] = *KiiPtr;
-    }
+    cache->getKernelDiagonal(nVectors, kernelDiag);
 }
 
 /**
@@ -925,6 +945,31 @@ void SVMCacheRowGetter<noCache, true, algorithmFPType, cpu>::updateShrinkingRowI
     }
 }
 
+/**
+ * \brief Move the indices of the shrunk feature vector to the end of the array.
+ *        Lines of the LRU cache are indexed by the observations in the input data set and are not re-ordered
+ *
+ * \param[in] nActiveVectors Number of observations in a training data set that are used
+ *                           in sequential minimum optimization at the current iteration
+ * \param[in] I              Array of flags that describe the status of feature vectors
+ */
+template<typename algorithmFPType, CpuType cpu>
+void SVMCache<lruCache, algorithmFPType, cpu>::updateShrinkingRowIndices(size_t nActiveVectors, const char *I)
+{
+    size_t i = 0;
+    size_t j = nActiveVectors-1;
+    while(i < j)
+    {
+        while (!(I[i] & shrink) && i < nActiveVectors - 1) i++;
+        while ( (I[j] & shrink) && j > 0)                  j--;
+        if (i >= j) break;
+        daal::swap<size_t, cpu>(shrinkingRowIndices[i], shrinkingRowIndices[j]);
+        _isPermuted = true;
+        i++;
+        j--;
+    }
+}
+
 /**
  * \brief Move the indices of the shrunk feature vector to the end of the array and
  *        re-order rows and columns in the cache accordingly
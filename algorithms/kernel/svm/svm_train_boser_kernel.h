@@ -53,7 +53,7 @@ struct SVMTrainImpl<boser, algorithmFPType, cpu> : public Kernel
     static const size_t kernelFunctionBlockSize = 1024; /* Size of the block of kernel function elements */
 
     void compute(NumericTablePtr xTable, NumericTable *yTable, daal::algorithms::Model *r,
-                 const daal::algorithms::Parameter *par);
+                 NumericTable *cacheStatisticsTable, const daal::algorithms::Parameter *par);
 
 protected:
     /**
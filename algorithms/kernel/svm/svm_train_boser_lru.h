@@ -0,0 +1,183 @@
+/* file: svm_train_boser_lru.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Order of the lines of the SVM cache of kernel matrix rows by the time of the last use
+//--
+*/
+
+#ifndef __SVM_TRAIN_BOSER_LRU_H__
+#define __SVM_TRAIN_BOSER_LRU_H__
+
+#include "services/daal_memory.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svm
+{
+namespace training
+{
+namespace internal
+{
+
+/**
+ * Maps the rows of the kernel matrix to the lines of the cache and keeps the lines
+ * in the doubly linked list ordered from the most recently used to the least recently used one
+ */
+class SVMLRULines
+{
+public:
+    static const size_t nil = (size_t)(-1);
+
+    /**
+     * \param[in] nLines    Number of lines in the cache
+     * \param[in] nRows     Number of rows of the kernel matrix
+     */
+    SVMLRULines(size_t nLines, size_t nRows) :
+        _nLines(nLines), _nUsedLines(0), _head(nil), _tail(nil),
+        _lineOfRow((size_t *)daal::services::daal_malloc(nRows * sizeof(size_t))),
+        _rowOfLine((size_t *)daal::services::daal_malloc(nLines * sizeof(size_t))),
+        _prev((size_t *)daal::services::daal_malloc(nLines * sizeof(size_t))),
+        _next((size_t *)daal::services::daal_malloc(nLines * sizeof(size_t)))
+    {
+        if (!isValid()) { return; }
+        for (size_t i = 0; i < nRows; i++)
+        {
+            _lineOfRow[i] = nil;
+        }
+    }
+
+    ~SVMLRULines()
+    {
+        daal::services::daal_free(_lineOfRow);
+        daal::services::daal_free(_rowOfLine);
+        daal::services::daal_free(_prev);
+        daal::services::daal_free(_next);
+    }
+
+    bool isValid() const { return (_lineOfRow && _rowOfLine && _prev && _next); }
+
+    /**
+     * Returns the line that stores the row and marks it as the most recently used one
+     * \return Index of the line, nil if the row is not in the cache
+     */
+    size_t find(size_t row)
+    {
+        size_t iLine = _lineOfRow[row];
+        if (iLine != nil) { moveToFront(iLine); }
+        return iLine;
+    }
+
+    /**
+     * Assigns the line to the row that is not in the cache: the unused line if any,
+     * otherwise the least recently used line, whose row is evicted from the cache
+     * \return Index of the line marked as the most recently used one
+     */
+    size_t insert(size_t row)
+    {
+        size_t iLine;
+        if (_nUsedLines < _nLines)
+        {
+            iLine = _nUsedLines++;
+        }
+        else
+        {
+            iLine = _tail;
+            unlink(iLine);
+            if (_rowOfLine[iLine] != nil) { _lineOfRow[_rowOfLine[iLine]] = nil; }
+        }
+        _lineOfRow[row] = iLine;
+        _rowOfLine[iLine] = row;
+        pushFront(iLine);
+        return iLine;
+    }
+
+    /**
+     * Removes the row from the cache. Its line becomes the least recently used one
+     * and is reused by the next insertion once all the lines are in use
+     */
+    void remove(size_t row)
+    {
+        size_t iLine = _lineOfRow[row];
+        if (iLine == nil) { return; }
+        _lineOfRow[row] = nil;
+        _rowOfLine[iLine] = nil;
+        unlink(iLine);
+        pushBack(iLine);
+    }
+
+    /** Returns the row stored in the least recently used line, nil if the cache is empty */
+    size_t getLeastRecentlyUsedRow() const { return (_tail == nil ? nil : _rowOfLine[_tail]); }
+
+    /** Returns the row stored in the most recently used line, nil if the cache is empty */
+    size_t getMostRecentlyUsedRow() const { return (_head == nil ? nil : _rowOfLine[_head]); }
+
+private:
+    SVMLRULines(const SVMLRULines &);
+    SVMLRULines &operator=(const SVMLRULines &);
+
+    void unlink(size_t iLine)
+    {
+        if (_prev[iLine] != nil) { _next[_prev[iLine]] = _next[iLine]; } else { _head = _next[iLine]; }
+        if (_next[iLine] != nil) { _prev[_next[iLine]] = _prev[iLine]; } else { _tail = _prev[iLine]; }
+    }
+
+    void pushFront(size_t iLine)
+    {
+        _prev[iLine] = nil;
+        _next[iLine] = _head;
+        if (_head != nil) { _prev[_head] = iLine; }
+        _head = iLine;
+        if (_tail == nil) { _tail = iLine; }
+    }
+
+    void pushBack(size_t iLine)
+    {
+        _next[iLine] = nil;
+        _prev[iLine] = _tail;
+        if (_tail != nil) { _next[_tail] = iLine; }
+        _tail = iLine;
+        if (_head == nil) { _head = iLine; }
+    }
+
+    void moveToFront(size_t iLine)
+    {
+        if (iLine == _head) { return; }
+        unlink(iLine);
+        pushFront(iLine);
+    }
+
+    size_t _nLines;         /*!< Number of lines in the cache */
+    size_t _nUsedLines;     /*!< Number of lines in the cache that store kernel function values */
+    size_t _head;           /*!< Most recently used line */
+    size_t _tail;           /*!< Least recently used line */
+    size_t *_lineOfRow;     /*!< Index of the line that stores the row of the kernel matrix, nil if the row is not cached */
+    size_t *_rowOfLine;     /*!< Index of the row of the kernel matrix stored in the line */
+    size_t *_prev;          /*!< Previous line in the LRU list */
+    size_t *_next;          /*!< Next line in the LRU list */
+};
+
+} // namespace internal
+} // namespace training
+} // namespace svm
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -47,6 +47,8 @@ DAAL_EXPORT void Result::allocate(const daal::algorithms::Input *input, const da
     algorithmFPType dummy = 1.0;
     set(classifier::training::model, services::SharedPtr<svm::Model>(
             new svm::Model(dummy, algInput->get(classifier::training::data)->getDataLayout())));
+    set(cacheStatistics, data_management::NumericTablePtr(
+            new data_management::HomogenNumericTable<double>(2, 1, data_management::NumericTable::doAllocate)));
 }
 
 template DAAL_EXPORT void Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
@@ -84,7 +84,7 @@ template <Method method, typename algorithmFPType, CpuType cpu>
 struct SVMTrainImpl : public Kernel
 {
     void compute(NumericTablePtr xTable, NumericTable *yTable, daal::algorithms::Model *r,
-                 const daal::algorithms::Parameter *par);
+                 NumericTable *cacheStatisticsTable, const daal::algorithms::Parameter *par);
 };
 
 } // namespace internal
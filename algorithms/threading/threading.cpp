@@ -164,6 +164,36 @@ DAAL_EXPORT bool _daal_is_in_parallel()
   #endif
 }
 
+DAAL_EXPORT void *_daal_new_mutex()
+{
+  #if defined(__DO_TBB_LAYER__)
+    return (void *)(new tbb::spin_mutex());
+  #elif defined(__DO_SEQ_LAYER__)
+    return NULL;
+  #endif
+}
+
+DAAL_EXPORT void _daal_lock_mutex(void *mutexPtr)
+{
+  #if defined(__DO_TBB_LAYER__)
+    static_cast<tbb::spin_mutex *>(mutexPtr)->lock();
+  #endif
+}
+
+DAAL_EXPORT void _daal_unlock_mutex(void *mutexPtr)
+{
+  #if defined(__DO_TBB_LAYER__)
+    static_cast<tbb::spin_mutex *>(mutexPtr)->unlock();
+  #endif
+}
+
+DAAL_EXPORT void _daal_del_mutex(void *mutexPtr)
+{
+  #if defined(__DO_TBB_LAYER__)
+    delete static_cast<tbb::spin_mutex *>(mutexPtr);
+  #endif
+}
+
 DAAL_EXPORT void * _daal_threader_env()
 {
     static daal::ThreaderEnvironment env;
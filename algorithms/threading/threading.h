@@ -25,42 +25,11 @@
 #define __THREADING_H__
 
 #include "daal_defines.h"
+#include "services/internal/daal_threading.h"
 
 namespace daal
 {
 
-typedef void (*functype)(int i, const void *a);
-typedef void (*functype2)(int i, int n, const void *a);
-typedef void *(*tls_functype)(const void *a);
-typedef void (*tls_reduce_functype)(void *p, const void *a);
-
-}
-
-extern "C" {
-
-    DAAL_EXPORT int   _daal_threader_get_max_threads();
-    DAAL_EXPORT void  _daal_threader_for(int n, int threads_request, const void *a, daal::functype func);
-    DAAL_EXPORT void  _daal_threader_for_blocked(int n, int threads_request, const void *a, daal::functype2 func);
-    DAAL_EXPORT void  _daal_threader_for_optional(int n, int threads_request, const void *a, daal::functype func);
-    DAAL_EXPORT void *_daal_get_tls_ptr( void *a, daal::tls_functype func );
-    DAAL_EXPORT void *_daal_get_tls_local( void *tlsPtr );
-    DAAL_EXPORT void  _daal_reduce_tls( void *tlsPtr, void *a, daal::tls_reduce_functype func );
-    DAAL_EXPORT void  _daal_del_tls_ptr( void *tlsPtr );
-    DAAL_EXPORT bool  _daal_is_in_parallel();
-
-    DAAL_EXPORT size_t _setNumberOfThreads(const size_t numThreads, void **init);
-
-    DAAL_EXPORT void * _daal_threader_env();
-}
-
-namespace daal
-{
-
-inline int threader_get_max_threads_number()
-{
-    return _daal_threader_get_max_threads();
-}
-
 class ThreaderEnvironment
 {
 public:
@@ -87,42 +56,30 @@ inline size_t setNumberOfThreads(const size_t numThreads, void **init)
     return _setNumberOfThreads(numThreads, init);
 }
 
-template<typename F>
-inline void threader_func(int i, const void *a)
-{
-    const F &lambda = *static_cast<const F *>(a);
-    lambda(i);
-}
-
 template<typename F>
 inline void threader_func_b(int i0, int in, const void *a)
 {
-    const F &lambda = *static_cast<const F *>(a);
-    lambda(i0, in);
-}
-
-template<typename F>
-inline void threader_for(int n, int threads_request, const F &lambda)
-{
-    const void *a = static_cast<const void *>(&lambda);
-
-    _daal_threader_for(n, threads_request, a, threader_func<F>);
+    const threader_task<F> &task = *static_cast<const threader_task<F> *>(a);
+    threader_allocator_scope allocatorScope(task.allocator);
+    task.lambda(i0, in);
 }
 
 template<typename F>
 inline void threader_for_blocked(int n, int threads_request, const F &lambda)
 {
-    const void *a = static_cast<const void *>(&lambda);
+    const threader_task<F> task(lambda);
+    const void *a = static_cast<const void *>(&task);
 
-    _daal_threader_for_blocked(n, threads_request, a, threader_func_b<F>);
+    _daal_traced_threader_for_blocked(n, threads_request, a, threader_func_b<F>);
 }
 
 template<typename F>
 inline void threader_for_optional(int n, int threads_request, const F &lambda)
 {
-    const void *a = static_cast<const void *>(&lambda);
+    const threader_task<F> task(lambda);
+    const void *a = static_cast<const void *>(&task);
 
-    _daal_threader_for_optional(n, threads_request, a, threader_func<F>);
+    _daal_traced_threader_for_optional(n, threads_request, a, threader_func<F>);
 }
 
 template<typename lambdaType>
@@ -207,6 +164,33 @@ private:
     tls_deleter *d;
 };
 
+class mutex
+{
+public:
+    mutex() : mutexPtr(_daal_new_mutex()) {}
+    ~mutex() { _daal_del_mutex(mutexPtr); }
+
+    void lock() { _daal_lock_mutex(mutexPtr); }
+    void unlock() { _daal_unlock_mutex(mutexPtr); }
+
+    class scoped_lock
+    {
+    public:
+        explicit scoped_lock(mutex &m) : _m(m) { _m.lock(); }
+        ~scoped_lock() { _m.unlock(); }
+
+    private:
+        scoped_lock(const scoped_lock &);
+        scoped_lock &operator=(const scoped_lock &);
+        mutex &_m;
+    };
+
+private:
+    mutex(const mutex &);
+    mutex &operator=(const mutex &);
+    void *mutexPtr;
+};
+
 inline bool is_in_parallel()
 {
     return _daal_is_in_parallel();
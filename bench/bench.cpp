@@ -0,0 +1,365 @@
+/* file: bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Benchmark driver: runs the algorithms on synthetic data sets and reports
+//  wall time, throughput and peak memory in the JSON format.
+//
+//  Usage: daal_bench [--option=value ...], see printUsage() for the options
+//--
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+
+#include "bench.h"
+
+using namespace daal;
+
+namespace daal
+{
+namespace bench
+{
+
+double getWallTime()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+size_t getMaxResidentBytes()
+{
+#if !defined(_WIN32)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) { return 0; }
+#if defined(__APPLE__)
+    return (size_t)usage.ru_maxrss;
+#else
+    return (size_t)usage.ru_maxrss * 1024;
+#endif
+#else
+    return 0;
+#endif
+}
+
+BenchMeasurement measure(const BenchCase &benchCase, const BenchOptions &options)
+{
+    BenchMeasurement measurement;
+    try
+    {
+        for (size_t i = 0; i < options.nWarmup; i++)
+        {
+            benchCase.run();
+        }
+        for (size_t i = 0; i < options.nRepetitions; i++)
+        {
+            /* A fresh allocator per run gives the peak of the memory allocated by the library during this run.
+               Allocations are counted in all threads, since the allocator is installed as the default one */
+            services::MemoryAllocatorPtr allocator(new services::SystemMemoryAllocator());
+            services::MemoryAllocatorPtr previous = services::getDefaultMemoryAllocator();
+            services::setDefaultMemoryAllocator(allocator);
+
+            const double start = getWallTime();
+            try
+            {
+                benchCase.run();
+            }
+            catch (...)
+            {
+                services::setDefaultMemoryAllocator(previous);
+                throw;
+            }
+            measurement.seconds.push_back(getWallTime() - start);
+
+            services::setDefaultMemoryAllocator(previous);
+
+            const services::MemoryAllocatorStatistics statistics = allocator->getStatistics();
+            measurement.peakBytes    = std::max(measurement.peakBytes, statistics.peakBytesLive);
+            measurement.nAllocations = std::max(measurement.nAllocations, statistics.nAllocations);
+        }
+    }
+    catch (const std::exception &e)
+    {
+        measurement.failed = true;
+        measurement.error  = e.what();
+    }
+    measurement.maxResidentBytes = getMaxResidentBytes();
+    return measurement;
+}
+
+namespace
+{
+
+std::string escapeJson(const std::string &value)
+{
+    std::string escaped;
+    for (size_t i = 0; i < value.size(); i++)
+    {
+        const char c = value[i];
+        if (c == '"' || c == '\\') { escaped += '\\'; escaped += c; }
+        else if (c == '\n')        { escaped += "\\n"; }
+        else if ((unsigned char)c < 0x20) { escaped += ' '; }
+        else                       { escaped += c; }
+    }
+    return escaped;
+}
+
+void writeNumber(std::ostream &out, double value)
+{
+    if (value < 0) { out << "null"; }
+    else           { out << value; }
+}
+
+} // namespace
+
+void writeJson(std::ostream &out, const BenchOptions &options, const std::vector<BenchCase> &cases,
+               const std::vector<BenchMeasurement> &measurements)
+{
+    out.precision(6);
+    out << "{\n";
+    out << "  \"config\": {\"rows\": " << options.nRows << ", \"columns\": " << options.nColumns
+        << ", \"blocks\": " << options.nBlocks << ", \"clusters\": " << options.nClusters
+        << ", \"iterations\": " << options.nIterations << ", \"density\": " << options.density
+        << ", \"warmup\": " << options.nWarmup << ", \"repetitions\": " << options.nRepetitions
+        << ", \"fptype\": \"" << options.fpType << "\", \"cpu\": \"" << escapeJson(options.cpu) << "\""
+        << ", \"cpuid\": " << services::Environment::getInstance()->getCpuId()
+        << ", \"threads\": " << services::Environment::getInstance()->getNumberOfThreads()
+        << ", \"seed\": " << options.seed << "},\n";
+    out << "  \"results\": [";
+
+    for (size_t i = 0; i < cases.size(); i++)
+    {
+        const BenchCase &c = cases[i];
+        const BenchMeasurement &m = measurements[i];
+
+        std::vector<double> sorted(m.seconds);
+        std::sort(sorted.begin(), sorted.end());
+        double mean = 0;
+        for (size_t k = 0; k < sorted.size(); k++) { mean += sorted[k]; }
+        const bool measured = !m.failed && !sorted.empty();
+        mean = measured ? mean / sorted.size() : -1.0;
+        const double best   = measured ? sorted.front() : -1.0;
+        const double median = measured ? sorted[sorted.size() / 2] : -1.0;
+
+        out << (i ? ",\n" : "\n") << "    {";
+        out << "\"algorithm\": \"" << c.algorithm << "\", \"mode\": \"" << c.mode << "\", \"format\": \"" << c.format << "\"";
+        out << ", \"rows\": " << c.nRows << ", \"columns\": " << c.nColumns;
+        out << ", \"status\": \"" << (m.failed ? "failed" : "ok") << "\"";
+        if (m.failed) { out << ", \"error\": \"" << escapeJson(m.error) << "\""; }
+        out << ", \"seconds\": [";
+        for (size_t k = 0; k < m.seconds.size(); k++) { out << (k ? ", " : "") << m.seconds[k]; }
+        out << "], \"seconds_best\": ";    writeNumber(out, best);
+        out << ", \"seconds_median\": ";   writeNumber(out, median);
+        out << ", \"seconds_mean\": ";     writeNumber(out, mean);
+        out << ", \"rows_per_second\": ";  writeNumber(out, measured && median > 0 ? c.nRows / median : -1.0);
+        out << ", \"gflops\": ";           writeNumber(out, measured && median > 0 && c.flops >= 0 ? c.flops * 1e-9 / median : -1.0);
+        out << ", \"peak_bytes\": " << m.peakBytes << ", \"allocations\": " << m.nAllocations;
+        out << ", \"max_rss_bytes\": " << m.maxResidentBytes << "}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+} // namespace bench
+} // namespace daal
+
+using namespace daal::bench;
+
+namespace
+{
+
+void printUsage(const char *name)
+{
+    std::cerr << "Usage: " << name << " [--option=value ...]\n"
+              << "  --rows=N           number of rows in the data set [100000]\n"
+              << "  --cols=N           number of columns in the data set [100]\n"
+              << "  --blocks=N         number of blocks for the online and distributed modes [4]\n"
+              << "  --density=X        ratio of non-zero values in the CSR data set [0.05]\n"
+              << "  --clusters=N       number of clusters for kmeans and components for em [20]\n"
+              << "  --iterations=N     number of iterations of the iterative algorithms [5]\n"
+              << "  --classes=N        number of classes [2]\n"
+              << "  --warmup=N         number of runs excluded from the measurements [1]\n"
+              << "  --reps=N           number of measured runs [5]\n"
+              << "  --fptype=T         float or double [double]\n"
+              << "  --cpu=C            auto, sse2, ssse3, sse42, avx, avx2, avx512_mic, avx512 [auto]\n"
+              << "  --threads=N        number of threads, 0 for the library default [0]\n"
+              << "  --seed=N           seed of the data generator [777]\n"
+              << "  --algorithms=A,B   kmeans, covariance, low_order_moments, pca, linear_regression, svm, fullyconnected,\n"
+              << "                     knn, em, implicit_als, association_rules, boosting, outlier_detection [all]\n"
+              << "  --modes=A,B        batch, online, distributed [all]\n"
+              << "  --formats=A,B      dense, csr [all]\n"
+              << "  --output=FILE      output JSON file, - for the standard output [-]\n"
+              << "  --trace=FILE       write the Chrome trace of the runs, needs the library built with REQTRACE=yes\n";
+}
+
+std::vector<std::string> splitList(const std::string &value)
+{
+    std::vector<std::string> items;
+    std::stringstream stream(value);
+    std::string item;
+    while (std::getline(stream, item, ','))
+    {
+        if (!item.empty()) { items.push_back(item); }
+    }
+    return items;
+}
+
+bool parseOptions(int argc, char *argv[], BenchOptions &options)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string argument(argv[i]);
+        const size_t separator = argument.find('=');
+        if (argument.compare(0, 2, "--") != 0 || separator == std::string::npos) { return false; }
+
+        const std::string key   = argument.substr(2, separator - 2);
+        const std::string value = argument.substr(separator + 1);
+        const size_t number = (size_t)std::strtoull(value.c_str(), 0, 10);
+
+        if      (key == "rows")       { options.nRows        = number; }
+        else if (key == "cols")       { options.nColumns     = number; }
+        else if (key == "blocks")     { options.nBlocks      = number; }
+        else if (key == "density")    { options.density      = std::atof(value.c_str()); }
+        else if (key == "clusters")   { options.nClusters    = number; }
+        else if (key == "iterations") { options.nIterations  = number; }
+        else if (key == "classes")    { options.nClasses     = number; }
+        else if (key == "warmup")     { options.nWarmup      = number; }
+        else if (key == "reps")       { options.nRepetitions = number; }
+        else if (key == "fptype")     { options.fpType       = value; }
+        else if (key == "cpu")        { options.cpu          = value; }
+        else if (key == "threads")    { options.nThreads     = number; }
+        else if (key == "seed")       { options.seed         = (unsigned int)number; }
+        else if (key == "algorithms") { options.algorithms   = splitList(value); }
+        else if (key == "modes")      { options.modes        = splitList(value); }
+        else if (key == "formats")    { options.formats      = splitList(value); }
+        else if (key == "output")     { options.output       = value; }
+        else if (key == "trace")      { options.trace        = value; }
+        else { return false; }
+    }
+    return options.nRows > 0 && options.nColumns > 0 && options.nBlocks > 0 && options.nClusters > 0 &&
+           options.nIterations > 0 && options.nRepetitions > 0 && options.density > 0 && options.density <= 1 &&
+           (options.fpType == "float" || options.fpType == "double");
+}
+
+/* Dispatch override is applied before any algorithm is created, since the algorithms select the kernels on construction */
+bool setCpu(const std::string &cpu)
+{
+    static const char *names[] = { "sse2", "ssse3", "sse42", "avx", "avx2", "avx512_mic", "avx512" };
+    if (cpu == "auto") { return true; }
+    for (int i = 0; i < (int)(sizeof(names) / sizeof(names[0])); i++)
+    {
+        if (cpu == names[i])
+        {
+            return services::Environment::getInstance()->setCpuId(i) == i;
+        }
+    }
+    return false;
+}
+
+template <typename algorithmFPType>
+void runBenchmarks(const BenchOptions &options, std::vector<BenchCase> &cases, std::vector<BenchMeasurement> &measurements)
+{
+    BenchData<algorithmFPType> data(options);
+    registerBenchCases<algorithmFPType>(data, cases);
+
+    std::vector<BenchCase> enabledCases;
+    for (size_t i = 0; i < cases.size(); i++)
+    {
+        if (options.modes.empty() || std::find(options.modes.begin(), options.modes.end(), cases[i].mode) != options.modes.end())
+        {
+            enabledCases.push_back(cases[i]);
+        }
+    }
+    cases.swap(enabledCases);
+
+    for (size_t i = 0; i < cases.size(); i++)
+    {
+        std::cerr << "Running " << cases[i].algorithm << " " << cases[i].mode << " " << cases[i].format << " ..." << std::endl;
+        measurements.push_back(measure(cases[i], options));
+    }
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    BenchOptions options;
+    if (!parseOptions(argc, argv, options))
+    {
+        printUsage(argv[0]);
+        return 1;
+    }
+    if (!setCpu(options.cpu))
+    {
+        std::cerr << "CPU type " << options.cpu << " is not supported by the processor" << std::endl;
+        return 1;
+    }
+    if (options.nThreads)
+    {
+        services::Environment::getInstance()->setNumberOfThreads(options.nThreads);
+    }
+
+    if (!options.trace.empty())
+    {
+        services::Tracer::enable();
+    }
+
+    std::vector<BenchCase> cases;
+    std::vector<BenchMeasurement> measurements;
+    if (options.fpType == "float")
+    {
+        runBenchmarks<float>(options, cases, measurements);
+    }
+    else
+    {
+        runBenchmarks<double>(options, cases, measurements);
+    }
+
+    if (!options.trace.empty() && !services::Tracer::exportChromeTrace(options.trace.c_str()))
+    {
+        std::cerr << "Cannot write the trace to " << options.trace << std::endl;
+    }
+
+    if (options.output == "-")
+    {
+        writeJson(std::cout, options, cases, measurements);
+    }
+    else
+    {
+        std::ofstream out(options.output.c_str());
+        if (!out)
+        {
+            std::cerr << "Cannot open " << options.output << std::endl;
+            return 1;
+        }
+        writeJson(out, options, cases, measurements);
+    }
+
+    for (size_t i = 0; i < measurements.size(); i++)
+    {
+        if (measurements[i].failed) { return 2; }
+    }
+    return 0;
+}
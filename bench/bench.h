@@ -0,0 +1,165 @@
+/* file: bench.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the benchmark driver infrastructure: options, synthetic data sets,
+//  benchmark cases and their measurements.
+//--
+*/
+
+#ifndef __BENCH_H__
+#define __BENCH_H__
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <ostream>
+
+#include "daal.h"
+
+namespace daal
+{
+namespace bench
+{
+
+/**
+ * Options of the benchmark run specified in the command line
+ */
+struct BenchOptions
+{
+    BenchOptions() : nRows(100000), nColumns(100), nBlocks(4), nClusters(20), nIterations(5), nClasses(2),
+        nWarmup(1), nRepetitions(5), density(0.05), nThreads(0), seed(777), fpType("double"), cpu("auto"), output("-") {}
+
+    size_t nRows;                           /*!< Number of rows in the synthetic data set */
+    size_t nColumns;                        /*!< Number of columns in the synthetic data set */
+    size_t nBlocks;                         /*!< Number of blocks for the online and distributed processing modes */
+    size_t nClusters;                       /*!< Number of clusters for K-Means and of components for EM for GMM */
+    size_t nIterations;                     /*!< Number of iterations for the iterative algorithms */
+    size_t nClasses;                        /*!< Number of classes for the classification algorithms */
+    size_t nWarmup;                         /*!< Number of runs excluded from the measurements */
+    size_t nRepetitions;                    /*!< Number of measured runs */
+    double density;                         /*!< Ratio of non-zero values in the CSR data set */
+    size_t nThreads;                        /*!< Number of threads, 0 to use the library default */
+    unsigned int seed;                      /*!< Seed of the synthetic data generator */
+    std::string fpType;                     /*!< Floating-point type of the computations: float or double */
+    std::string cpu;                        /*!< CPU type to dispatch the kernels to, auto for the detected one */
+    std::string output;                     /*!< Name of the output file, - for the standard output */
+    std::string trace;                      /*!< Name of the Chrome trace file, empty to disable the tracing */
+    std::vector<std::string> algorithms;    /*!< Families of the algorithms to run: kmeans, covariance, low_order_moments, pca,
+                                                 linear_regression, svm, fullyconnected, knn, em, implicit_als,
+                                                 association_rules, boosting, outlier_detection. All if empty */
+    std::vector<std::string> modes;         /*!< Processing modes to run, all if empty */
+    std::vector<std::string> formats;       /*!< Formats of the data sets: dense, csr. All if empty */
+};
+
+/**
+ * Synthetic data sets shared by the benchmark cases. The tables of each format are generated
+ * once, as a whole and as nBlocks blocks of rows for the online and distributed processing modes
+ */
+template <typename algorithmFPType>
+class BenchData
+{
+public:
+    BenchData(const BenchOptions &options) : _options(options), _labelsTwoClassSigns(false) {}
+
+    data_management::NumericTablePtr getDense();
+    data_management::NumericTablePtr getCSR();
+    const std::vector<data_management::NumericTablePtr> &getDenseBlocks();
+    const std::vector<data_management::NumericTablePtr> &getCSRBlocks();
+
+    /** Returns responses of the linear model of the dense data set with noise, one column */
+    data_management::NumericTablePtr getResponses();
+    const std::vector<data_management::NumericTablePtr> &getResponseBlocks();
+
+    /** Returns labels of the classes, -1 and 1 for two classes and 0 .. nClasses - 1 otherwise */
+    data_management::NumericTablePtr getLabels(bool twoClassSigns);
+
+    /** Returns the dense data set as a tensor of size nRows x nColumns */
+    data_management::TensorPtr getDenseTensor();
+
+    const BenchOptions &getOptions() const { return _options; }
+
+    static data_management::NumericTablePtr createDenseTable(size_t nRows, size_t nColumns, unsigned int seed);
+    static data_management::NumericTablePtr createCSRTable(size_t nRows, size_t nColumns, double density, unsigned int seed);
+
+private:
+    void splitIntoBlocks(const data_management::NumericTablePtr &table, bool csr, std::vector<data_management::NumericTablePtr> &blocks);
+
+    const BenchOptions &_options;
+    data_management::NumericTablePtr _dense;
+    data_management::NumericTablePtr _csr;
+    data_management::NumericTablePtr _responses;
+    data_management::NumericTablePtr _labels;
+    bool _labelsTwoClassSigns;
+    data_management::TensorPtr _denseTensor;
+    std::vector<data_management::NumericTablePtr> _denseBlocks;
+    std::vector<data_management::NumericTablePtr> _csrBlocks;
+    std::vector<data_management::NumericTablePtr> _responseBlocks;
+};
+
+/**
+ * Benchmark case: one run of an algorithm family in one processing mode on one data set format.
+ * Errors reported by the library are thrown as services::Exception by the run function
+ */
+struct BenchCase
+{
+    std::string algorithm;              /*!< Family and method of the algorithm */
+    std::string mode;                   /*!< Processing mode: batch, online, distributed */
+    std::string format;                 /*!< Format of the data set: dense, csr */
+    size_t nRows;                       /*!< Number of rows processed in one run */
+    size_t nColumns;                    /*!< Number of columns of the data set */
+    double flops;                       /*!< Number of floating-point operations in one run, negative if not defined */
+    std::function<void()> run;          /*!< Runs the algorithm */
+};
+
+/**
+ * Measurements of the benchmark case
+ */
+struct BenchMeasurement
+{
+    BenchMeasurement() : peakBytes(0), nAllocations(0), maxResidentBytes(0), failed(false) {}
+
+    std::vector<double> seconds;        /*!< Wall time of the measured runs */
+    size_t peakBytes;                   /*!< Peak of the memory allocated by the library during one run */
+    size_t nAllocations;                /*!< Number of the library allocations during one run */
+    size_t maxResidentBytes;            /*!< Maximal resident set size of the process after the runs, 0 if unknown */
+    bool failed;                        /*!< Flag that the algorithm reported errors */
+    std::string error;                  /*!< Description of the errors */
+};
+
+/** Registers the benchmark cases of all the algorithm families */
+template <typename algorithmFPType>
+void registerBenchCases(BenchData<algorithmFPType> &data, std::vector<BenchCase> &cases);
+
+/** Returns wall clock time in seconds */
+double getWallTime();
+
+/** Returns the maximal resident set size of the process in bytes, 0 if it is not available */
+size_t getMaxResidentBytes();
+
+/** Runs the warm-up and measured runs of the case and collects the measurements */
+BenchMeasurement measure(const BenchCase &benchCase, const BenchOptions &options);
+
+/** Writes the measurements in the JSON format */
+void writeJson(std::ostream &out, const BenchOptions &options, const std::vector<BenchCase> &cases,
+               const std::vector<BenchMeasurement> &measurements);
+
+} // namespace bench
+} // namespace daal
+
+#endif
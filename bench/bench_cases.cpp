@@ -0,0 +1,932 @@
+/* file: bench_cases.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Generation of the synthetic data sets and the benchmark cases of the algorithm families.
+//--
+*/
+
+#include <algorithm>
+#include <cmath>
+
+#include "bench.h"
+
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace bench
+{
+
+/**
+ * Linear congruential generator of the synthetic data. Generates the same data sets
+ * for the same seed regardless of the platform and the number of threads
+ */
+class DataGenerator
+{
+public:
+    DataGenerator(unsigned int seed) : _state(seed * 2862933555777941757ULL + 3037000493ULL) {}
+
+    /** Returns a uniformly distributed value in [0, 1) */
+    double uniform()
+    {
+        _state = _state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return (double)(_state >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+    /** Returns a uniformly distributed integer in [0, n) */
+    size_t uniform(size_t n)
+    {
+        size_t value = (size_t)(uniform() * n);
+        return value < n ? value : n - 1;
+    }
+
+private:
+    unsigned long long _state;
+};
+
+template <typename algorithmFPType>
+NumericTablePtr BenchData<algorithmFPType>::createDenseTable(size_t nRows, size_t nColumns, unsigned int seed)
+{
+    HomogenNumericTable<algorithmFPType> *table = new HomogenNumericTable<algorithmFPType>(nColumns, nRows, NumericTable::doAllocate);
+    NumericTablePtr tablePtr(table);
+    algorithmFPType *data = table->getArray();
+
+    /* Rows are grouped around a few centers, so that clustering and classification converge to meaningful results */
+    const size_t nCenters = 16;
+    DataGenerator generator(seed);
+    std::vector<double> centers(nCenters * nColumns);
+    for (size_t i = 0; i < centers.size(); i++)
+    {
+        centers[i] = 10.0 * generator.uniform() - 5.0;
+    }
+    for (size_t i = 0; i < nRows; i++)
+    {
+        const double *center = &centers[generator.uniform(nCenters) * nColumns];
+        for (size_t j = 0; j < nColumns; j++)
+        {
+            data[i * nColumns + j] = (algorithmFPType)(center[j] + generator.uniform() - 0.5);
+        }
+    }
+    return tablePtr;
+}
+
+template <typename algorithmFPType>
+NumericTablePtr BenchData<algorithmFPType>::createCSRTable(size_t nRows, size_t nColumns, double density, unsigned int seed)
+{
+    size_t nNonZerosInRow = (size_t)(density * nColumns + 0.5);
+    nNonZerosInRow = std::max<size_t>(1, std::min(nNonZerosInRow, nColumns));
+
+    CSRNumericTable *table = new CSRNumericTable((algorithmFPType *)0, 0, 0, nColumns, nRows);
+    NumericTablePtr tablePtr(table);
+    table->allocateDataMemory(nRows * nNonZerosInRow);
+
+    algorithmFPType *values = 0;
+    size_t *colIndices = 0;
+    size_t *rowOffsets = 0;
+    table->getArrays<algorithmFPType>(&values, &colIndices, &rowOffsets);
+
+    /* Column indices of each row are a random window of consecutive columns, one-based as required by CSRNumericTable */
+    DataGenerator generator(seed);
+    rowOffsets[0] = 1;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        const size_t firstColumn = generator.uniform(nColumns - nNonZerosInRow + 1);
+        for (size_t k = 0; k < nNonZerosInRow; k++)
+        {
+            const size_t index = i * nNonZerosInRow + k;
+            values[index]     = (algorithmFPType)(2.0 * generator.uniform() - 1.0);
+            colIndices[index] = firstColumn + k + 1;
+        }
+        rowOffsets[i + 1] = rowOffsets[i] + nNonZerosInRow;
+    }
+    return tablePtr;
+}
+
+template <typename algorithmFPType>
+void BenchData<algorithmFPType>::splitIntoBlocks(const NumericTablePtr &table, bool csr, std::vector<NumericTablePtr> &blocks)
+{
+    const size_t nRows    = table->getNumberOfRows();
+    const size_t nColumns = table->getNumberOfColumns();
+    const size_t nBlocks  = std::max<size_t>(1, std::min(_options.nBlocks, nRows));
+    const size_t blockSize = nRows / nBlocks;
+
+    for (size_t b = 0; b < nBlocks; b++)
+    {
+        const size_t firstRow = b * blockSize;
+        const size_t nBlockRows = (b + 1 < nBlocks) ? blockSize : nRows - firstRow;
+        if (!csr)
+        {
+            HomogenNumericTable<algorithmFPType> *dense = static_cast<HomogenNumericTable<algorithmFPType> *>(table.get());
+            HomogenNumericTable<algorithmFPType> *block = new HomogenNumericTable<algorithmFPType>(nColumns, nBlockRows, NumericTable::doAllocate);
+            std::copy(dense->getArray() + firstRow * nColumns, dense->getArray() + (firstRow + nBlockRows) * nColumns, block->getArray());
+            blocks.push_back(NumericTablePtr(block));
+            continue;
+        }
+
+        CSRNumericTable *sparse = static_cast<CSRNumericTable *>(table.get());
+        algorithmFPType *values = 0;
+        size_t *colIndices = 0;
+        size_t *rowOffsets = 0;
+        sparse->getArrays<algorithmFPType>(&values, &colIndices, &rowOffsets);
+
+        const size_t first = rowOffsets[firstRow] - 1;
+        const size_t last  = rowOffsets[firstRow + nBlockRows] - 1;
+
+        CSRNumericTable *block = new CSRNumericTable((algorithmFPType *)0, 0, 0, nColumns, nBlockRows);
+        NumericTablePtr blockPtr(block);
+        block->allocateDataMemory(last - first);
+
+        algorithmFPType *blockValues = 0;
+        size_t *blockColIndices = 0;
+        size_t *blockRowOffsets = 0;
+        block->getArrays<algorithmFPType>(&blockValues, &blockColIndices, &blockRowOffsets);
+        std::copy(values + first, values + last, blockValues);
+        std::copy(colIndices + first, colIndices + last, blockColIndices);
+        for (size_t i = 0; i <= nBlockRows; i++)
+        {
+            blockRowOffsets[i] = rowOffsets[firstRow + i] - first;
+        }
+        blocks.push_back(blockPtr);
+    }
+}
+
+template <typename algorithmFPType>
+NumericTablePtr BenchData<algorithmFPType>::getDense()
+{
+    if (!_dense)
+    {
+        _dense = createDenseTable(_options.nRows, _options.nColumns, _options.seed);
+    }
+    return _dense;
+}
+
+template <typename algorithmFPType>
+NumericTablePtr BenchData<algorithmFPType>::getCSR()
+{
+    if (!_csr)
+    {
+        _csr = createCSRTable(_options.nRows, _options.nColumns, _options.density, _options.seed);
+    }
+    return _csr;
+}
+
+template <typename algorithmFPType>
+const std::vector<NumericTablePtr> &BenchData<algorithmFPType>::getDenseBlocks()
+{
+    if (_denseBlocks.empty())
+    {
+        splitIntoBlocks(getDense(), false, _denseBlocks);
+    }
+    return _denseBlocks;
+}
+
+template <typename algorithmFPType>
+const std::vector<NumericTablePtr> &BenchData<algorithmFPType>::getCSRBlocks()
+{
+    if (_csrBlocks.empty())
+    {
+        splitIntoBlocks(getCSR(), true, _csrBlocks);
+    }
+    return _csrBlocks;
+}
+
+template <typename algorithmFPType>
+NumericTablePtr BenchData<algorithmFPType>::getResponses()
+{
+    if (!_responses)
+    {
+        const size_t nRows    = _options.nRows;
+        const size_t nColumns = _options.nColumns;
+        const algorithmFPType *data = static_cast<HomogenNumericTable<algorithmFPType> *>(getDense().get())->getArray();
+
+        HomogenNumericTable<algorithmFPType> *responses = new HomogenNumericTable<algorithmFPType>(1, nRows, NumericTable::doAllocate);
+        _responses = NumericTablePtr(responses);
+
+        DataGenerator generator(_options.seed + 1);
+        std::vector<double> beta(nColumns + 1);
+        for (size_t j = 0; j <= nColumns; j++)
+        {
+            beta[j] = 2.0 * generator.uniform() - 1.0;
+        }
+        for (size_t i = 0; i < nRows; i++)
+        {
+            double value = beta[0] + 0.01 * (generator.uniform() - 0.5);
+            for (size_t j = 0; j < nColumns; j++)
+            {
+                value += beta[j + 1] * data[i * nColumns + j];
+            }
+            responses->getArray()[i] = (algorithmFPType)value;
+        }
+    }
+    return _responses;
+}
+
+template <typename algorithmFPType>
+const std::vector<NumericTablePtr> &BenchData<algorithmFPType>::getResponseBlocks()
+{
+    if (_responseBlocks.empty())
+    {
+        splitIntoBlocks(getResponses(), false, _responseBlocks);
+    }
+    return _responseBlocks;
+}
+
+template <typename algorithmFPType>
+NumericTablePtr BenchData<algorithmFPType>::getLabels(bool twoClassSigns)
+{
+    if (!_labels || _labelsTwoClassSigns != twoClassSigns)
+    {
+        const size_t nRows    = _options.nRows;
+        const size_t nClasses = twoClassSigns ? 2 : std::max<size_t>(2, _options.nClasses);
+        const algorithmFPType *responses = static_cast<HomogenNumericTable<algorithmFPType> *>(getResponses().get())->getArray();
+
+        /* Classes are the quantiles of the responses of the linear model, so the classes are separable up to the noise */
+        std::vector<algorithmFPType> sorted(responses, responses + nRows);
+        std::sort(sorted.begin(), sorted.end());
+
+        HomogenNumericTable<algorithmFPType> *labels = new HomogenNumericTable<algorithmFPType>(1, nRows, NumericTable::doAllocate);
+        for (size_t i = 0; i < nRows; i++)
+        {
+            size_t label = (size_t)(std::upper_bound(sorted.begin(), sorted.end(), responses[i]) - sorted.begin()) * nClasses / (nRows + 1);
+            labels->getArray()[i] = twoClassSigns ? (label ? (algorithmFPType)1 : (algorithmFPType)-1) : (algorithmFPType)label;
+        }
+        _labels = NumericTablePtr(labels);
+        _labelsTwoClassSigns = twoClassSigns;
+    }
+    return _labels;
+}
+
+template <typename algorithmFPType>
+TensorPtr BenchData<algorithmFPType>::getDenseTensor()
+{
+    if (!_denseTensor)
+    {
+        const algorithmFPType *data = static_cast<HomogenNumericTable<algorithmFPType> *>(getDense().get())->getArray();
+
+        services::Collection<size_t> dims;
+        dims.push_back(_options.nRows);
+        dims.push_back(_options.nColumns);
+        HomogenTensor<algorithmFPType> *tensor = new HomogenTensor<algorithmFPType>(dims, Tensor::doAllocate);
+        std::copy(data, data + _options.nRows * _options.nColumns, tensor->getArray());
+        _denseTensor = TensorPtr(tensor);
+    }
+    return _denseTensor;
+}
+
+namespace
+{
+
+BenchCase makeCase(const char *algorithm, const char *mode, const char *format, size_t nRows, size_t nColumns, double flops,
+                   const std::function<void()> &run)
+{
+    BenchCase benchCase;
+    benchCase.algorithm = algorithm;
+    benchCase.mode      = mode;
+    benchCase.format    = format;
+    benchCase.nRows     = nRows;
+    benchCase.nColumns  = nColumns;
+    benchCase.flops     = flops;
+    benchCase.run       = run;
+    return benchCase;
+}
+
+template <typename algorithmFPType, kmeans::Method method, kmeans::init::Method initMethod>
+void registerKMeans(BenchData<algorithmFPType> &data, const char *format, const NumericTablePtr &table,
+                    const std::vector<NumericTablePtr> &blocks, std::vector<BenchCase> &cases)
+{
+    const BenchOptions &options = data.getOptions();
+    const size_t nClusters   = options.nClusters;
+    const size_t nIterations = options.nIterations;
+    const double flops = 2.0 * options.nRows * nClusters * options.nColumns * nIterations;
+
+    cases.push_back(makeCase("kmeans", "batch", format, options.nRows, options.nColumns, flops, [=]()
+    {
+        kmeans::init::Batch<algorithmFPType, initMethod> init(nClusters);
+        init.input.set(kmeans::init::data, table);
+        init.compute();
+
+        kmeans::Batch<algorithmFPType, method> algorithm(nClusters, nIterations);
+        algorithm.parameter.accuracyThreshold = 0;
+        algorithm.input.set(kmeans::data, table);
+        algorithm.input.set(kmeans::inputCentroids, init.getResult()->get(kmeans::init::centroids));
+        algorithm.compute();
+    }));
+
+    cases.push_back(makeCase("kmeans", "distributed", format, options.nRows, options.nColumns, flops, [=]()
+    {
+        const size_t nRows = table->getNumberOfRows();
+        kmeans::init::Distributed<step2Master, algorithmFPType, initMethod> masterInit(nClusters);
+        for (size_t i = 0, offset = 0; i < blocks.size(); offset += blocks[i]->getNumberOfRows(), i++)
+        {
+            kmeans::init::Distributed<step1Local, algorithmFPType, initMethod> localInit(nClusters, nRows, offset);
+            localInit.input.set(kmeans::init::data, blocks[i]);
+            localInit.compute();
+            masterInit.input.add(kmeans::init::partialResults, localInit.getPartialResult());
+        }
+        masterInit.compute();
+        masterInit.finalizeCompute();
+        NumericTablePtr centroids = masterInit.getResult()->get(kmeans::init::centroids);
+
+        for (size_t it = 0; it < nIterations; it++)
+        {
+            kmeans::Distributed<step2Master, algorithmFPType, method> master(nClusters);
+            for (size_t i = 0; i < blocks.size(); i++)
+            {
+                kmeans::Distributed<step1Local, algorithmFPType, method> local(nClusters, false);
+                local.input.set(kmeans::data, blocks[i]);
+                local.input.set(kmeans::inputCentroids, centroids);
+                local.compute();
+                master.input.add(kmeans::partialResults, local.getPartialResult());
+            }
+            master.compute();
+            master.finalizeCompute();
+            centroids = master.getResult()->get(kmeans::centroids);
+        }
+    }));
+}
+
+template <typename algorithmFPType, covariance::Method method>
+void registerCovariance(BenchData<algorithmFPType> &data, const char *format, const NumericTablePtr &table,
+                        const std::vector<NumericTablePtr> &blocks, std::vector<BenchCase> &cases)
+{
+    const BenchOptions &options = data.getOptions();
+    const double flops = (double)options.nRows * options.nColumns * options.nColumns;
+
+    cases.push_back(makeCase("covariance", "batch", format, options.nRows, options.nColumns, flops, [=]()
+    {
+        covariance::Batch<algorithmFPType, method> algorithm;
+        algorithm.input.set(covariance::data, table);
+        algorithm.compute();
+    }));
+
+    cases.push_back(makeCase("covariance", "online", format, options.nRows, options.nColumns, flops, [=]()
+    {
+        covariance::Online<algorithmFPType, method> algorithm;
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            algorithm.input.set(covariance::data, blocks[i]);
+            algorithm.compute();
+        }
+        algorithm.finalizeCompute();
+    }));
+
+    cases.push_back(makeCase("covariance", "distributed", format, options.nRows, options.nColumns, flops, [=]()
+    {
+        covariance::Distributed<step2Master, algorithmFPType, method> master;
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            covariance::Distributed<step1Local, algorithmFPType, method> local;
+            local.input.set(covariance::data, blocks[i]);
+            local.compute();
+            master.input.add(covariance::partialResults, local.getPartialResult());
+        }
+        master.compute();
+        master.finalizeCompute();
+    }));
+}
+
+template <typename algorithmFPType, low_order_moments::Method method>
+void registerMoments(BenchData<algorithmFPType> &data, const char *format, const NumericTablePtr &table,
+                     const std::vector<NumericTablePtr> &blocks, std::vector<BenchCase> &cases)
+{
+    const BenchOptions &options = data.getOptions();
+
+    cases.push_back(makeCase("low_order_moments", "batch", format, options.nRows, options.nColumns, -1.0, [=]()
+    {
+        low_order_moments::Batch<algorithmFPType, method> algorithm;
+        algorithm.input.set(low_order_moments::data, table);
+        algorithm.compute();
+    }));
+
+    cases.push_back(makeCase("low_order_moments", "online", format, options.nRows, options.nColumns, -1.0, [=]()
+    {
+        low_order_moments::Online<algorithmFPType, method> algorithm;
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            algorithm.input.set(low_order_moments::data, blocks[i]);
+            algorithm.compute();
+        }
+        algorithm.finalizeCompute();
+    }));
+
+    cases.push_back(makeCase("low_order_moments", "distributed", format, options.nRows, options.nColumns, -1.0, [=]()
+    {
+        low_order_moments::Distributed<step2Master, algorithmFPType, method> master;
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            low_order_moments::Distributed<step1Local, algorithmFPType, method> local;
+            local.input.set(low_order_moments::data, blocks[i]);
+            local.compute();
+            master.input.add(low_order_moments::partialResults, local.getPartialResult());
+        }
+        master.compute();
+        master.finalizeCompute();
+    }));
+}
+
+template <typename algorithmFPType>
+void registerPCA(BenchData<algorithmFPType> &data, std::vector<BenchCase> &cases)
+{
+    const BenchOptions &options = data.getOptions();
+    const NumericTablePtr table = data.getDense();
+    const std::vector<NumericTablePtr> blocks = data.getDenseBlocks();
+    const double p = (double)options.nColumns;
+    const double flops = options.nRows * p * p + p * p * p;
+
+    cases.push_back(makeCase("pca", "batch", "dense", options.nRows, options.nColumns, flops, [=]()
+    {
+        pca::Batch<algorithmFPType, pca::correlationDense> algorithm;
+        algorithm.input.set(pca::data, table);
+        algorithm.compute();
+    }));
+
+    cases.push_back(makeCase("pca", "distributed", "dense", options.nRows, options.nColumns, flops, [=]()
+    {
+        pca::Distributed<step2Master, algorithmFPType, pca::correlationDense> master;
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            pca::Distributed<step1Local, algorithmFPType, pca::correlationDense> local;
+            local.input.set(pca::data, blocks[i]);
+            local.compute();
+            master.input.add(pca::partialResults, local.getPartialResult());
+        }
+        master.compute();
+        master.finalizeCompute();
+    }));
+}
+
+template <typename algorithmFPType>
+void registerLinearRegression(BenchData<algorithmFPType> &data, std::vector<BenchCase> &cases)
+{
+    namespace training = linear_regression::training;
+
+    const BenchOptions &options = data.getOptions();
+    const NumericTablePtr table = data.getDense();
+    const NumericTablePtr responses = data.getResponses();
+    const std::vector<NumericTablePtr> blocks = data.getDenseBlocks();
+    const std::vector<NumericTablePtr> responseBlocks = data.getResponseBlocks();
+    const double p = (double)options.nColumns + 1;
+    const double flops = options.nRows * p * p;
+
+    cases.push_back(makeCase("linear_regression", "batch", "dense", options.nRows, options.nColumns, flops, [=]()
+    {
+        training::Batch<algorithmFPType, training::normEqDense> algorithm;
+        algorithm.input.set(training::data, table);
+        algorithm.input.set(training::dependentVariables, responses);
+        algorithm.compute();
+    }));
+
+    cases.push_back(makeCase("linear_regression", "online", "dense", options.nRows, options.nColumns, flops, [=]()
+    {
+        training::Online<algorithmFPType, training::normEqDense> algorithm;
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            algorithm.input.set(training::data, blocks[i]);
+            algorithm.input.set(training::dependentVariables, responseBlocks[i]);
+            algorithm.compute();
+        }
+        algorithm.finalizeCompute();
+    }));
+
+    cases.push_back(makeCase("linear_regression", "distributed", "dense", options.nRows, options.nColumns, flops, [=]()
+    {
+        training::Distributed<step2Master, algorithmFPType, training::normEqDense> master;
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            training::Distributed<step1Local, algorithmFPType, training::normEqDense> local;
+            local.input.set(training::data, blocks[i]);
+            local.input.set(training::dependentVariables, responseBlocks[i]);
+            local.compute();
+            master.input.add(training::partialModels, local.getPartialResult());
+        }
+        master.compute();
+        master.finalizeCompute();
+    }));
+}
+
+template <typename algorithmFPType, kernel_function::rbf::Method kernelMethod>
+void registerSVM(BenchData<algorithmFPType> &data, const char *format, const NumericTablePtr &table, std::vector<BenchCase> &cases)
+{
+    const BenchOptions &options = data.getOptions();
+    const NumericTablePtr labels = data.getLabels(true);
+    const size_t nIterations = options.nIterations;
+
+    cases.push_back(makeCase("svm_training", "batch", format, options.nRows, options.nColumns, -1.0, [=]()
+    {
+        services::SharedPtr<kernel_function::KernelIface> kernel(new kernel_function::rbf::Batch<algorithmFPType, kernelMethod>());
+        svm::training::Batch<algorithmFPType, svm::training::boser> algorithm;
+        algorithm.parameter.kernel = kernel;
+        algorithm.parameter.maxIterations = nIterations * 100;
+        algorithm.input.set(classifier::training::data, table);
+        algorithm.input.set(classifier::training::labels, labels);
+        algorithm.compute();
+    }));
+
+    /* The model for the prediction is trained once, when the case is run for the first time */
+    services::SharedPtr<services::SharedPtr<svm::Model> > model(new services::SharedPtr<svm::Model>());
+    cases.push_back(makeCase("svm_prediction", "batch", format, options.nRows, options.nColumns, -1.0, [=]()
+    {
+        services::SharedPtr<kernel_function::KernelIface> kernel(new kernel_function::rbf::Batch<algorithmFPType, kernelMethod>());
+        if (!*model)
+        {
+            svm::training::Batch<algorithmFPType, svm::training::boser> training;
+            training.parameter.kernel = kernel;
+            training.parameter.maxIterations = nIterations * 100;
+            training.input.set(classifier::training::data, table);
+            training.input.set(classifier::training::labels, labels);
+            training.compute();
+            *model = services::staticPointerCast<svm::Model, classifier::Model>(training.getResult()->get(classifier::training::model));
+        }
+
+        svm::prediction::Batch<algorithmFPType> algorithm;
+        algorithm.parameter.kernel = kernel;
+        algorithm.input.set(classifier::prediction::data, table);
+        algorithm.input.set(classifier::prediction::model, *model);
+        algorithm.compute();
+    }));
+}
+
+template <typename algorithmFPType>
+void registerFullyConnected(BenchData<algorithmFPType> &data, std::vector<BenchCase> &cases)
+{
+    namespace fullyconnected = neural_networks::layers::fullyconnected;
+
+    const BenchOptions &options = data.getOptions();
+    const TensorPtr tensor = data.getDenseTensor();
+    const size_t nOutputs = options.nColumns;
+    const double flops = 2.0 * options.nRows * options.nColumns * nOutputs;
+
+    cases.push_back(makeCase("fullyconnected_forward", "batch", "dense", options.nRows, options.nColumns, flops, [=]()
+    {
+        fullyconnected::forward::Batch<algorithmFPType> algorithm(nOutputs);
+        algorithm.input.set(neural_networks::layers::forward::data, tensor);
+        algorithm.compute();
+    }));
+}
+
+template <typename algorithmFPType>
+void registerKNN(BenchData<algorithmFPType> &data, std::vector<BenchCase> &cases)
+{
+    namespace knn = kdtree_knn_classification;
+
+    const BenchOptions &options = data.getOptions();
+    const NumericTablePtr table = data.getDense();
+    const NumericTablePtr labels = data.getLabels(false);
+
+    cases.push_back(makeCase("knn_training", "batch", "dense", options.nRows, options.nColumns, -1.0, [=]()
+    {
+        knn::training::Batch<algorithmFPType> algorithm;
+        algorithm.input.set(classifier::training::data, table);
+        algorithm.input.set(classifier::training::labels, labels);
+        algorithm.compute();
+    }));
+
+    /* The model for the prediction is trained once, when the case is run for the first time */
+    services::SharedPtr<services::SharedPtr<knn::Model> > model(new services::SharedPtr<knn::Model>());
+    cases.push_back(makeCase("knn_prediction", "batch", "dense", options.nRows, options.nColumns, -1.0, [=]()
+    {
+        if (!*model)
+        {
+            knn::training::Batch<algorithmFPType> training;
+            training.input.set(classifier::training::data, table);
+            training.input.set(classifier::training::labels, labels);
+            training.compute();
+            *model = services::staticPointerCast<knn::Model, classifier::Model>(training.getResult()->get(classifier::training::model));
+        }
+
+        knn::prediction::Batch<algorithmFPType> algorithm;
+        algorithm.input.set(classifier::prediction::data, table);
+        algorithm.input.set(classifier::prediction::model, *model);
+        algorithm.compute();
+    }));
+}
+
+template <typename algorithmFPType>
+void registerEM(BenchData<algorithmFPType> &data, std::vector<BenchCase> &cases)
+{
+    const BenchOptions &options = data.getOptions();
+    const NumericTablePtr table = data.getDense();
+    const std::vector<NumericTablePtr> blocks = data.getDenseBlocks();
+    const size_t nComponents = options.nClusters;
+    const size_t nIterations = options.nIterations;
+    const double p = (double)options.nColumns;
+    const double flops = 2.0 * options.nRows * nComponents * p * p * nIterations;
+
+    /* The initial values are computed once, when the first case is run, and are not measured */
+    services::SharedPtr<services::SharedPtr<em_gmm::init::Result> > initValues(new services::SharedPtr<em_gmm::init::Result>());
+    const std::function<void()> initialize = [=]()
+    {
+        if (*initValues) { return; }
+        em_gmm::init::Batch<algorithmFPType> init(nComponents);
+        init.input.set(em_gmm::init::data, table);
+        init.compute();
+        *initValues = init.getResult();
+    };
+
+    cases.push_back(makeCase("em_gmm", "batch", "dense", options.nRows, options.nColumns, flops, [=]()
+    {
+        initialize();
+        em_gmm::Batch<algorithmFPType> algorithm(nComponents);
+        algorithm.parameter.maxIterations = nIterations;
+        algorithm.parameter.accuracyThreshold = 0;
+        algorithm.input.set(em_gmm::data, table);
+        algorithm.input.set(em_gmm::inputValues, *initValues);
+        algorithm.compute();
+    }));
+
+    cases.push_back(makeCase("em_gmm", "online", "dense", options.nRows, options.nColumns, flops / nIterations, [=]()
+    {
+        initialize();
+        em_gmm::Online<algorithmFPType> algorithm(nComponents);
+        algorithm.input.set(em_gmm::inputValues, *initValues);
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            algorithm.input.set(em_gmm::data, blocks[i]);
+            algorithm.compute();
+        }
+        algorithm.finalizeCompute();
+    }));
+
+    cases.push_back(makeCase("em_gmm", "distributed", "dense", options.nRows, options.nColumns, flops, [=]()
+    {
+        initialize();
+        services::SharedPtr<em_gmm::Result> model;
+        for (size_t it = 0; it < nIterations; it++)
+        {
+            em_gmm::Distributed<step2Master, algorithmFPType> master(nComponents);
+            for (size_t i = 0; i < blocks.size(); i++)
+            {
+                em_gmm::Distributed<step1Local, algorithmFPType> local(nComponents);
+                local.input.set(em_gmm::data, blocks[i]);
+                if (model)
+                {
+                    local.input.set(em_gmm::inputWeights, model->get(em_gmm::weights));
+                    local.input.set(em_gmm::inputMeans, model->get(em_gmm::means));
+                    local.input.set(em_gmm::inputCovariances, model->get(em_gmm::covariances));
+                }
+                else
+                {
+                    local.input.set(em_gmm::inputValues, *initValues);
+                }
+                local.compute();
+                master.input.add(em_gmm::partialResults, local.getPartialResult());
+            }
+            master.compute();
+            master.finalizeCompute();
+            model = master.getResult();
+        }
+    }));
+}
+
+template <typename algorithmFPType, implicit_als::training::Method method>
+void registerImplicitALS(BenchData<algorithmFPType> &data, const char *name, std::vector<BenchCase> &cases)
+{
+    namespace training = implicit_als::training;
+
+    const BenchOptions &options = data.getOptions();
+    const size_t nFactors    = std::min<size_t>(options.nColumns, 16);
+    const size_t nIterations = options.nIterations;
+
+    /* The ratings of the implicit feedback are non-negative: the absolute values of the CSR data set */
+    const NumericTablePtr table = BenchData<algorithmFPType>::createCSRTable(options.nRows, options.nColumns, options.density, options.seed);
+    algorithmFPType *values = 0;
+    size_t *colIndices = 0;
+    size_t *rowOffsets = 0;
+    static_cast<CSRNumericTable *>(table.get())->getArrays<algorithmFPType>(&values, &colIndices, &rowOffsets);
+    for (size_t i = 0; i < rowOffsets[options.nRows] - 1; i++)
+    {
+        values[i] = (values[i] < 0 ? -values[i] : values[i]);
+    }
+    const double nNonZeros = (double)(rowOffsets[options.nRows] - 1);
+    const double flops = 2.0 * nIterations * ((options.nRows + options.nColumns) * nFactors * nFactors * nFactors / 3.0 +
+                                               2.0 * nNonZeros * nFactors * nFactors);
+
+    /* The initial model is computed once, when the case is run for the first time, and is not measured */
+    services::SharedPtr<implicit_als::ModelPtr> initialModel(new implicit_als::ModelPtr());
+    cases.push_back(makeCase(name, "batch", "csr", options.nRows, options.nColumns, flops, [=]()
+    {
+        if (!*initialModel)
+        {
+            training::init::Batch<algorithmFPType, training::init::fastCSR> init;
+            init.parameter.nFactors = nFactors;
+            init.input.set(training::init::data, table);
+            init.compute();
+            *initialModel = init.getResult()->get(training::init::model);
+        }
+
+        training::Batch<algorithmFPType, method> algorithm;
+        algorithm.parameter.nFactors = nFactors;
+        algorithm.parameter.maxIterations = nIterations;
+        algorithm.input.set(training::data, table);
+        algorithm.input.set(training::inputModel, *initialModel);
+        algorithm.compute();
+    }));
+}
+
+template <typename algorithmFPType>
+void registerAssociationRules(BenchData<algorithmFPType> &data, std::vector<BenchCase> &cases)
+{
+    const BenchOptions &options = data.getOptions();
+
+    /* Transactions are the rows of the CSR data set, their items are the columns of the non-zero values */
+    CSRNumericTable *csr = static_cast<CSRNumericTable *>(data.getCSR().get());
+    algorithmFPType *values = 0;
+    size_t *colIndices = 0;
+    size_t *rowOffsets = 0;
+    csr->getArrays<algorithmFPType>(&values, &colIndices, &rowOffsets);
+    const size_t nItems = rowOffsets[options.nRows] - 1;
+
+    HomogenNumericTable<algorithmFPType> *items = new HomogenNumericTable<algorithmFPType>(2, nItems, NumericTable::doAllocate);
+    const NumericTablePtr table(items);
+    for (size_t i = 0; i < options.nRows; i++)
+    {
+        for (size_t k = rowOffsets[i] - 1; k < rowOffsets[i + 1] - 1; k++)
+        {
+            items->getArray()[2 * k]     = (algorithmFPType)i;
+            items->getArray()[2 * k + 1] = (algorithmFPType)(colIndices[k] - 1);
+        }
+    }
+
+    cases.push_back(makeCase("association_rules", "batch", "csr", options.nRows, options.nColumns, -1.0, [=]()
+    {
+        association_rules::Batch<algorithmFPType> algorithm;
+        algorithm.parameter.minSupport = 0.01;
+        algorithm.parameter.minConfidence = 0.6;
+        algorithm.input.set(association_rules::data, table);
+        algorithm.compute();
+    }));
+}
+
+template <typename algorithmFPType, stump::training::Method method>
+void registerBoosting(BenchData<algorithmFPType> &data, const char *stumpName, const char *adaboostName, std::vector<BenchCase> &cases)
+{
+    const BenchOptions &options = data.getOptions();
+    const NumericTablePtr table = data.getDense();
+    const NumericTablePtr labels = data.getLabels(true);
+    const size_t nIterations = options.nIterations;
+
+    cases.push_back(makeCase(stumpName, "batch", "dense", options.nRows, options.nColumns, -1.0, [=]()
+    {
+        stump::training::Batch<algorithmFPType, method> algorithm;
+        algorithm.input.set(classifier::training::data, table);
+        algorithm.input.set(classifier::training::labels, labels);
+        algorithm.compute();
+    }));
+
+    cases.push_back(makeCase(adaboostName, "batch", "dense", options.nRows, options.nColumns, -1.0, [=]()
+    {
+        adaboost::training::Batch<algorithmFPType> algorithm;
+        algorithm.parameter.weakLearnerTraining =
+            services::SharedPtr<weak_learner::training::Batch>(new stump::training::Batch<algorithmFPType, method>());
+        algorithm.parameter.maxIterations = nIterations;
+        algorithm.input.set(classifier::training::data, table);
+        algorithm.input.set(classifier::training::labels, labels);
+        algorithm.compute();
+    }));
+}
+
+template <typename algorithmFPType>
+void registerOutlierDetection(BenchData<algorithmFPType> &data, std::vector<BenchCase> &cases)
+{
+    const BenchOptions &options = data.getOptions();
+    const NumericTablePtr table = data.getDense();
+
+    cases.push_back(makeCase("univariate_outlier_detection", "batch", "dense", options.nRows, options.nColumns, -1.0, [=]()
+    {
+        univariate_outlier_detection::Batch<algorithmFPType> algorithm;
+        algorithm.input.set(univariate_outlier_detection::data, table);
+        algorithm.compute();
+    }));
+
+    cases.push_back(makeCase("multivariate_outlier_detection", "batch", "dense", options.nRows, options.nColumns, -1.0, [=]()
+    {
+        multivariate_outlier_detection::Batch<algorithmFPType, multivariate_outlier_detection::defaultDense> algorithm;
+        algorithm.input.set(multivariate_outlier_detection::data, table);
+        algorithm.compute();
+    }));
+
+    cases.push_back(makeCase("multivariate_outlier_detection_bacon", "batch", "dense", options.nRows, options.nColumns, -1.0, [=]()
+    {
+        multivariate_outlier_detection::Batch<algorithmFPType, multivariate_outlier_detection::baconDense> algorithm;
+        algorithm.input.set(multivariate_outlier_detection::data, table);
+        algorithm.compute();
+    }));
+}
+
+bool isEnabled(const std::vector<std::string> &enabled, const char *name)
+{
+    return enabled.empty() || std::find(enabled.begin(), enabled.end(), name) != enabled.end();
+}
+
+} // namespace
+
+template <typename algorithmFPType>
+void registerBenchCases(BenchData<algorithmFPType> &data, std::vector<BenchCase> &cases)
+{
+    const BenchOptions &options = data.getOptions();
+    const std::vector<std::string> &algorithms = options.algorithms;
+
+    /* Data sets are generated on the first request, so the data sets of the disabled cases are not generated */
+    if (isEnabled(options.formats, "dense"))
+    {
+        if (isEnabled(algorithms, "kmeans"))
+        {
+            registerKMeans<algorithmFPType, kmeans::lloydDense, kmeans::init::randomDense>(data, "dense", data.getDense(), data.getDenseBlocks(), cases);
+        }
+        if (isEnabled(algorithms, "covariance"))
+        {
+            registerCovariance<algorithmFPType, covariance::defaultDense>(data, "dense", data.getDense(), data.getDenseBlocks(), cases);
+        }
+        if (isEnabled(algorithms, "low_order_moments"))
+        {
+            registerMoments<algorithmFPType, low_order_moments::defaultDense>(data, "dense", data.getDense(), data.getDenseBlocks(), cases);
+        }
+        if (isEnabled(algorithms, "pca"))
+        {
+            registerPCA<algorithmFPType>(data, cases);
+        }
+        if (isEnabled(algorithms, "linear_regression"))
+        {
+            registerLinearRegression<algorithmFPType>(data, cases);
+        }
+        if (isEnabled(algorithms, "svm"))
+        {
+            registerSVM<algorithmFPType, kernel_function::rbf::defaultDense>(data, "dense", data.getDense(), cases);
+        }
+        if (isEnabled(algorithms, "fullyconnected"))
+        {
+            registerFullyConnected<algorithmFPType>(data, cases);
+        }
+        if (isEnabled(algorithms, "knn"))
+        {
+            registerKNN<algorithmFPType>(data, cases);
+        }
+        if (isEnabled(algorithms, "em"))
+        {
+            registerEM<algorithmFPType>(data, cases);
+        }
+        if (isEnabled(algorithms, "boosting"))
+        {
+            registerBoosting<algorithmFPType, stump::training::defaultDense>(data, "stump_training", "adaboost_training", cases);
+            registerBoosting<algorithmFPType, stump::training::binned>(data, "stump_training_binned", "adaboost_training_binned", cases);
+        }
+        if (isEnabled(algorithms, "outlier_detection"))
+        {
+            registerOutlierDetection<algorithmFPType>(data, cases);
+        }
+    }
+    if (isEnabled(options.formats, "csr"))
+    {
+        if (isEnabled(algorithms, "kmeans"))
+        {
+            registerKMeans<algorithmFPType, kmeans::lloydCSR, kmeans::init::randomCSR>(data, "csr", data.getCSR(), data.getCSRBlocks(), cases);
+        }
+        if (isEnabled(algorithms, "covariance"))
+        {
+            registerCovariance<algorithmFPType, covariance::fastCSR>(data, "csr", data.getCSR(), data.getCSRBlocks(), cases);
+        }
+        if (isEnabled(algorithms, "low_order_moments"))
+        {
+            registerMoments<algorithmFPType, low_order_moments::fastCSR>(data, "csr", data.getCSR(), data.getCSRBlocks(), cases);
+        }
+        if (isEnabled(algorithms, "svm"))
+        {
+            registerSVM<algorithmFPType, kernel_function::rbf::fastCSR>(data, "csr", data.getCSR(), cases);
+        }
+        if (isEnabled(algorithms, "implicit_als"))
+        {
+            registerImplicitALS<algorithmFPType, implicit_als::training::fastCSR>(data, "implicit_als_training", cases);
+            registerImplicitALS<algorithmFPType, implicit_als::training::conjugateGradientCSR>(data, "implicit_als_training_cg", cases);
+        }
+        if (isEnabled(algorithms, "association_rules"))
+        {
+            registerAssociationRules<algorithmFPType>(data, cases);
+        }
+    }
+}
+
+template class BenchData<float>;
+template class BenchData<double>;
+template void registerBenchCases<float>(BenchData<float> &data, std::vector<BenchCase> &cases);
+template void registerBenchCases<double>(BenchData<double> &data, std::vector<BenchCase> &cases);
+
+} // namespace bench
+} // namespace daal
@@ -114,6 +114,13 @@ link.dynamic.mac = $(if $(link.dynamic.mac.$(COMPILER)),$(link.dynamic.mac.$(COM
                    -undefined dynamic_lookup -dynamiclib -Wl,-flat_namespace -Wl,-install_name,@rpath/$(@F)  -Wl,-headerpad_max_install_names $(1:%_link.txt=-filelist %_link.txt) -o $@
 #TODO think on dependence from include sequence for $(if $(link.dynamic.lnx.$(COMPILER)),...)
 
+# Link executable
+LINK.EXE = $(mkdir)$(call rm,$@)$(link.exe.cmd)
+link.exe.cmd = $(call link.exe.$(_OS),$(secure.opts.link.$(_OS)) $(or $1,$(^.no-mkdeps)) $(LOPT))
+link.exe.lnx = $(if $(link.dynamic.lnx.$(COMPILER)),$(link.dynamic.lnx.$(COMPILER)),$(error link.dynamic.lnx.$(COMPILER) must be defined)) $(-sGRP) $1 $(-eGRP) -o $@
+link.exe.win = link $(link.dynamic.win.$(COMPILER)) -WX -nologo $(-DEBL) $1 -out:$@
+link.exe.mac = $(if $(link.dynamic.mac.$(COMPILER)),$(link.dynamic.mac.$(COMPILER)),$(error link.dynamic.mac.$(COMPILER) must be defined)) $1 -o $@
+
 LINK.DYNAMIC.POST = $(call link.dynamic.post.$(_OS))
 link.dynamic.post.lnx =
 link.dynamic.post.win =
@@ -0,0 +1,177 @@
+/* file: cov_dense_window.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of dense variance-covariance matrix computation in the online
+!    processing mode over the sliding window of blocks and with the exponential
+!    forgetting.
+!
+!    The program checks the results against the results recomputed from scratch
+!    for the blocks in the window and for the weighted observations.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-COVARIANCE_DENSE_WINDOW"></a>
+ * \example cov_dense_window.cpp
+ */
+
+#include <cmath>
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+const string datasetFileName = "../data/batch/covcormoments_dense.csv";
+const size_t nVectorsInBlock = 25;
+
+/* Algorithm parameters */
+const size_t windowSize        = 3;
+const size_t recomputeInterval = 2;
+const double decayFactor       = 0.5;
+const double threshold         = 1.0e-8;
+
+bool checkWindowedCovariance(const NumericTablePtr &dataTable, size_t nBlocks);
+bool checkDecayedCovariance(const NumericTablePtr &dataTable, size_t nBlocks);
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable,
+                                                 DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file, the blocks of the data stream are taken from the table */
+    dataSource.loadDataBlock();
+    NumericTablePtr dataTable = dataSource.getNumericTable();
+    size_t nBlocks = dataTable->getNumberOfRows() / nVectorsInBlock;
+
+    bool isCorrect = checkWindowedCovariance(dataTable, nBlocks);
+    isCorrect = checkDecayedCovariance(dataTable, nBlocks) && isCorrect;
+
+    return (isCorrect ? 0 : -1);
+}
+
+bool checkWindowedCovariance(const NumericTablePtr &dataTable, size_t nBlocks)
+{
+    /* Create an algorithm to compute the variance-covariance matrix over the latest windowSize blocks.
+       The partial results are also recomputed from the blocks in the window after every recomputeInterval removed blocks */
+    covariance::Online<> algorithm;
+    algorithm.parameter.windowSize = windowSize;
+    algorithm.parameter.recomputeInterval = recomputeInterval;
+
+    bool isCorrect = true;
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        algorithm.input.set(covariance::data, getNextSubtable(dataTable, i * nVectorsInBlock, nVectorsInBlock));
+        algorithm.compute();
+        algorithm.finalizeCompute();
+        services::SharedPtr<covariance::Result> res = algorithm.getResult();
+
+        /* Recompute the variance-covariance matrix from scratch for the blocks in the window */
+        size_t nWindowBlocks = (i + 1 < windowSize ? i + 1 : windowSize);
+        covariance::Batch<> batchAlgorithm;
+        batchAlgorithm.input.set(covariance::data,
+                                 getNextSubtable(dataTable, (i + 1 - nWindowBlocks) * nVectorsInBlock, nWindowBlocks * nVectorsInBlock));
+        batchAlgorithm.compute();
+        services::SharedPtr<covariance::Result> batchRes = batchAlgorithm.getResult();
+
+        ostringstream block;
+        block << " of the window after the block " << i;
+        isCorrect = checkNumericTables(res->get(covariance::covariance), batchRes->get(covariance::covariance),
+                                       threshold, "Covariance matrix" + block.str()) && isCorrect;
+        isCorrect = checkNumericTables(res->get(covariance::mean), batchRes->get(covariance::mean),
+                                       threshold, "Mean vector" + block.str()) && isCorrect;
+    }
+    return isCorrect;
+}
+
+bool checkDecayedCovariance(const NumericTablePtr &dataTable, size_t nBlocks)
+{
+    /* Create an algorithm to compute the variance-covariance matrix with the exponential forgetting */
+    covariance::Online<> algorithm;
+    algorithm.parameter.decayFactor = decayFactor;
+
+    size_t nFeatures = dataTable->getNumberOfColumns();
+    BlockDescriptor<double> block;
+    dataTable->getBlockOfRows(0, nBlocks * nVectorsInBlock, readOnly, block);
+    double *data = block.getBlockPtr();
+
+    bool isCorrect = true;
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        algorithm.input.set(covariance::data, getNextSubtable(dataTable, i * nVectorsInBlock, nVectorsInBlock));
+        algorithm.compute();
+        algorithm.finalizeCompute();
+        services::SharedPtr<covariance::Result> res = algorithm.getResult();
+
+        /* Recompute the results from scratch, the observations of the block k have the weight decayFactor^(i - k) */
+        HomogenNumericTable<double> *mean = new HomogenNumericTable<double>(nFeatures, 1, NumericTable::doAllocate, 0.0);
+        HomogenNumericTable<double> *cov  = new HomogenNumericTable<double>(nFeatures, nFeatures, NumericTable::doAllocate, 0.0);
+        NumericTablePtr meanPtr(mean), covPtr(cov);
+        double *meanData = mean->getArray();
+        double *covData = cov->getArray();
+
+        double sumOfWeights = 0.0;
+        for (size_t k = 0; k <= i; k++)
+        {
+            double weight = pow(decayFactor, (double)(i - k));
+            for (size_t r = k * nVectorsInBlock; r < (k + 1) * nVectorsInBlock; r++)
+            {
+                sumOfWeights += weight;
+                for (size_t j = 0; j < nFeatures; j++)
+                {
+                    meanData[j] += weight * data[r * nFeatures + j];
+                }
+            }
+        }
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            meanData[j] /= sumOfWeights;
+        }
+        for (size_t k = 0; k <= i; k++)
+        {
+            double weight = pow(decayFactor, (double)(i - k));
+            for (size_t r = k * nVectorsInBlock; r < (k + 1) * nVectorsInBlock; r++)
+            {
+                for (size_t j = 0; j < nFeatures; j++)
+                {
+                    for (size_t l = 0; l < nFeatures; l++)
+                    {
+                        covData[j * nFeatures + l] += weight * (data[r * nFeatures + j] - meanData[j]) * (data[r * nFeatures + l] - meanData[l]);
+                    }
+                }
+            }
+        }
+        for (size_t j = 0; j < nFeatures * nFeatures; j++)
+        {
+            covData[j] /= (sumOfWeights - 1.0);
+        }
+
+        ostringstream blockIndex;
+        blockIndex << " with the exponential forgetting after the block " << i;
+        isCorrect = checkNumericTables(res->get(covariance::covariance), covPtr, threshold, "Covariance matrix" + blockIndex.str()) && isCorrect;
+        isCorrect = checkNumericTables(res->get(covariance::mean), meanPtr, threshold, "Mean vector" + blockIndex.str()) && isCorrect;
+    }
+
+    dataTable->releaseBlockOfRows(block);
+    return isCorrect;
+}
@@ -0,0 +1,131 @@
+/* file: em_gmm_dense_distr.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the expectation-maximization (EM) algorithm for the
+!    Gaussian mixture model (GMM) in the distributed processing mode.
+!
+!    The program checks the model against the model computed by the same number
+!    of iterations in the batch processing mode.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-EM_GMM_DISTRIBUTED"></a>
+ * \example em_gmm_dense_distr.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+const std::string datasetFileName = "../data/batch/em_gmm.csv" ;
+const size_t nBlocks         = 4;
+const size_t nVectorsInBlock = 25;
+
+/* EM algorithm parameters */
+const size_t nComponents = 2;
+const size_t nIterations = 5;
+const double threshold   = 1.0e-8;
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable,
+                                                 DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file, the data of the local nodes are the blocks of the table */
+    dataSource.loadDataBlock();
+    NumericTablePtr dataTable = dataSource.getNumericTable();
+    NumericTablePtr data[nBlocks];
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        data[i] = getNextSubtable(dataTable, i * nVectorsInBlock, nVectorsInBlock);
+    }
+
+    /* Compute initial values for the EM algorithm for the GMM on the full data set */
+    em_gmm::init::Batch<> initAlgorithm(nComponents);
+    initAlgorithm.input.set(em_gmm::init::data, dataTable);
+    initAlgorithm.compute();
+    services::SharedPtr<em_gmm::init::Result> resultInit = initAlgorithm.getResult();
+
+    /* Each call of the local and master steps is one iteration of the EM algorithm */
+    services::SharedPtr<em_gmm::Result> result;
+    for (size_t it = 0; it < nIterations; it++)
+    {
+        em_gmm::Distributed<step2Master> masterAlgorithm(nComponents);
+
+        for (size_t i = 0; i < nBlocks; i++)
+        {
+            /* Compute the sufficient statistics of the local data for the current model */
+            em_gmm::Distributed<step1Local> localAlgorithm(nComponents);
+            localAlgorithm.input.set(em_gmm::data, data[i]);
+            if (it == 0)
+            {
+                localAlgorithm.input.set(em_gmm::inputValues, resultInit);
+            }
+            else
+            {
+                localAlgorithm.input.set(em_gmm::inputWeights,     result->get(em_gmm::weights));
+                localAlgorithm.input.set(em_gmm::inputMeans,       result->get(em_gmm::means));
+                localAlgorithm.input.set(em_gmm::inputCovariances, result->get(em_gmm::covariances));
+            }
+            localAlgorithm.compute();
+
+            masterAlgorithm.input.add(em_gmm::partialResults, localAlgorithm.getPartialResult());
+        }
+
+        /* Merge the sufficient statistics and compute the model */
+        masterAlgorithm.compute();
+        masterAlgorithm.finalizeCompute();
+        result = masterAlgorithm.getResult();
+    }
+
+    /* Compute the model with the same number of iterations in the batch processing mode */
+    em_gmm::Batch<> batchAlgorithm(nComponents);
+    batchAlgorithm.parameter.maxIterations = nIterations;
+    batchAlgorithm.parameter.accuracyThreshold = 0.0;
+    batchAlgorithm.input.set(em_gmm::data, dataTable);
+    batchAlgorithm.input.set(em_gmm::inputValues, resultInit);
+    batchAlgorithm.compute();
+    services::SharedPtr<em_gmm::Result> batchResult = batchAlgorithm.getResult();
+
+    /* Print the results */
+    printNumericTable(result->get(em_gmm::weights), "Weights");
+    printNumericTable(result->get(em_gmm::means), "Means");
+    for (size_t i = 0; i < nComponents; i++)
+    {
+        printNumericTable(result->get(em_gmm::covariances, i), "Covariance");
+    }
+
+    bool isCorrect = checkNumericTables(result->get(em_gmm::weights), batchResult->get(em_gmm::weights), threshold, "Weights");
+    isCorrect = checkNumericTables(result->get(em_gmm::means), batchResult->get(em_gmm::means), threshold, "Means") && isCorrect;
+    for (size_t i = 0; i < nComponents; i++)
+    {
+        isCorrect = checkNumericTables(result->get(em_gmm::covariances, i), batchResult->get(em_gmm::covariances, i),
+                                       threshold, "Covariance") && isCorrect;
+    }
+
+    return (isCorrect ? 0 : -1);
+}
@@ -0,0 +1,121 @@
+/* file: impl_als_csr_cg_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the implicit alternating least squares (ALS) algorithm
+!    with the conjugate-gradient method in the batch processing mode.
+!
+!    The program checks the ratings predicted by the model trained with the
+!    conjugate-gradient method against the ratings predicted by the model
+!    trained with the default method from the same initial model.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-IMPLICIT_ALS_CSR_CG_BATCH"></a>
+ * \example impl_als_csr_cg_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+using namespace daal::algorithms::implicit_als;
+
+/* Input data set parameters */
+string trainDatasetFileName            = "../data/batch/implicit_als_csr.csv";
+
+typedef double  algorithmFPType;        /* Algorithm floating-point type */
+typedef double  dataFPType;             /* Input data floating-point type */
+
+/* Algorithm parameters */
+const size_t nFactors = 2;
+
+/* The conjugate-gradient method solves the systems of nFactors equations exactly
+ * in nFactors steps, so the models are expected to match up to the rounding errors */
+const size_t nCGIterations = nFactors;
+const double threshold     = 1.0e-6;
+
+NumericTablePtr dataTable;
+services::SharedPtr<Model> initialModel;
+
+void initializeModel();
+template <training::Method method>
+NumericTablePtr trainAndTestModel();
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &trainDatasetFileName);
+
+    initializeModel();
+
+    NumericTablePtr cgRatings      = trainAndTestModel<training::conjugateGradientCSR>();
+    NumericTablePtr defaultRatings = trainAndTestModel<training::fastCSR>();
+
+    printNumericTable(cgRatings, "Predicted ratings:");
+
+    bool isCorrect = checkNumericTables(cgRatings, defaultRatings, threshold, "Predicted ratings");
+
+    return (isCorrect ? 0 : -1);
+}
+
+void initializeModel()
+{
+    /* Read trainDatasetFileName from a file and create a numeric table to store the input data */
+    dataTable = NumericTablePtr(createSparseTable<dataFPType>(trainDatasetFileName));
+
+    /* Create an algorithm object to initialize the implicit ALS model with the default method */
+    training::init::Batch<algorithmFPType, training::init::fastCSR> initAlgorithm;
+    initAlgorithm.parameter.nFactors = nFactors;
+
+    /* Pass a training data set and dependent values to the algorithm */
+    initAlgorithm.input.set(training::init::data, dataTable);
+
+    /* Initialize the implicit ALS model */
+    initAlgorithm.compute();
+
+    initialModel = initAlgorithm.getResult()->get(training::init::model);
+}
+
+template <training::Method method>
+NumericTablePtr trainAndTestModel()
+{
+    /* Create an algorithm object to train the implicit ALS model with the given method */
+    training::Batch<algorithmFPType, method> algorithm;
+
+    /* Pass a training data set and the initial model to the algorithm */
+    algorithm.input.set(training::data, dataTable);
+    algorithm.input.set(training::inputModel, initialModel);
+
+    algorithm.parameter.nFactors = nFactors;
+    algorithm.parameter.nCGIterations = nCGIterations;
+
+    /* Build the implicit ALS model */
+    algorithm.compute();
+
+    /* Create an algorithm object to predict recommendations of the implicit ALS model */
+    prediction::ratings::Batch<> predictionAlgorithm;
+    predictionAlgorithm.parameter.nFactors = nFactors;
+
+    predictionAlgorithm.input.set(prediction::ratings::model, algorithm.getResult()->get(training::model));
+
+    predictionAlgorithm.compute();
+
+    return predictionAlgorithm.getResult()->get(prediction::ratings::prediction);
+}
@@ -0,0 +1,178 @@
+/* file: low_order_moms_dense_window.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of computing low order moments in the online processing mode
+!    over the sliding window of blocks and with the exponential forgetting.
+!
+!    The program checks the moments against the moments recomputed from scratch
+!    for the blocks in the window and for the weighted observations.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-LOW_ORDER_MOMENTS_DENSE_WINDOW"></a>
+ * \example low_order_moms_dense_window.cpp
+ */
+
+#include <cmath>
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+const string datasetFileName = "../data/online/covcormoments_dense.csv";
+const size_t nVectorsInBlock = 25;
+
+/* Algorithm parameters */
+const size_t windowSize        = 3;
+const size_t recomputeInterval = 2;
+const double decayFactor       = 0.5;
+const double threshold         = 1.0e-8;
+
+bool checkWindowedMoments(const NumericTablePtr &dataTable, size_t nBlocks);
+bool checkDecayedMoments(const NumericTablePtr &dataTable, size_t nBlocks);
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable,
+                                                 DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file, the blocks of the data stream are taken from the table */
+    dataSource.loadDataBlock();
+    NumericTablePtr dataTable = dataSource.getNumericTable();
+    size_t nBlocks = dataTable->getNumberOfRows() / nVectorsInBlock;
+
+    bool isCorrect = checkWindowedMoments(dataTable, nBlocks);
+    isCorrect = checkDecayedMoments(dataTable, nBlocks) && isCorrect;
+
+    return (isCorrect ? 0 : -1);
+}
+
+bool checkWindowedMoments(const NumericTablePtr &dataTable, size_t nBlocks)
+{
+    /* Create an algorithm to compute low order moments over the latest windowSize blocks.
+       The partial results are also recomputed from the blocks in the window after every recomputeInterval removed blocks */
+    low_order_moments::Online<> algorithm;
+    algorithm.parameter.windowSize = windowSize;
+    algorithm.parameter.recomputeInterval = recomputeInterval;
+
+    bool isCorrect = true;
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        algorithm.input.set(low_order_moments::data, getNextSubtable(dataTable, i * nVectorsInBlock, nVectorsInBlock));
+        algorithm.compute();
+        algorithm.finalizeCompute();
+        services::SharedPtr<low_order_moments::Result> res = algorithm.getResult();
+
+        /* Recompute the moments from scratch for the blocks in the window */
+        size_t nWindowBlocks = (i + 1 < windowSize ? i + 1 : windowSize);
+        low_order_moments::Batch<> batchAlgorithm;
+        batchAlgorithm.input.set(low_order_moments::data,
+                                 getNextSubtable(dataTable, (i + 1 - nWindowBlocks) * nVectorsInBlock, nWindowBlocks * nVectorsInBlock));
+        batchAlgorithm.compute();
+        services::SharedPtr<low_order_moments::Result> batchRes = batchAlgorithm.getResult();
+
+        ostringstream blockIndex;
+        blockIndex << " of the window after the block " << i;
+        isCorrect = checkNumericTables(res->get(low_order_moments::minimum), batchRes->get(low_order_moments::minimum),
+                                       threshold, "Minimum" + blockIndex.str()) && isCorrect;
+        isCorrect = checkNumericTables(res->get(low_order_moments::maximum), batchRes->get(low_order_moments::maximum),
+                                       threshold, "Maximum" + blockIndex.str()) && isCorrect;
+        isCorrect = checkNumericTables(res->get(low_order_moments::mean), batchRes->get(low_order_moments::mean),
+                                       threshold, "Mean" + blockIndex.str()) && isCorrect;
+        isCorrect = checkNumericTables(res->get(low_order_moments::variance), batchRes->get(low_order_moments::variance),
+                                       threshold, "Variance" + blockIndex.str()) && isCorrect;
+    }
+    return isCorrect;
+}
+
+bool checkDecayedMoments(const NumericTablePtr &dataTable, size_t nBlocks)
+{
+    /* Create an algorithm to compute low order moments with the exponential forgetting */
+    low_order_moments::Online<> algorithm;
+    algorithm.parameter.decayFactor = decayFactor;
+
+    size_t nFeatures = dataTable->getNumberOfColumns();
+    BlockDescriptor<double> block;
+    dataTable->getBlockOfRows(0, nBlocks * nVectorsInBlock, readOnly, block);
+    double *data = block.getBlockPtr();
+
+    bool isCorrect = true;
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        algorithm.input.set(low_order_moments::data, getNextSubtable(dataTable, i * nVectorsInBlock, nVectorsInBlock));
+        algorithm.compute();
+        algorithm.finalizeCompute();
+        services::SharedPtr<low_order_moments::Result> res = algorithm.getResult();
+
+        /* Recompute the mean and the variance from scratch, the observations of the block k have the weight decayFactor^(i - k) */
+        HomogenNumericTable<double> *mean     = new HomogenNumericTable<double>(nFeatures, 1, NumericTable::doAllocate, 0.0);
+        HomogenNumericTable<double> *variance = new HomogenNumericTable<double>(nFeatures, 1, NumericTable::doAllocate, 0.0);
+        NumericTablePtr meanPtr(mean), variancePtr(variance);
+        double *meanData = mean->getArray();
+        double *varianceData = variance->getArray();
+
+        double sumOfWeights = 0.0;
+        for (size_t k = 0; k <= i; k++)
+        {
+            double weight = pow(decayFactor, (double)(i - k));
+            for (size_t r = k * nVectorsInBlock; r < (k + 1) * nVectorsInBlock; r++)
+            {
+                sumOfWeights += weight;
+                for (size_t j = 0; j < nFeatures; j++)
+                {
+                    meanData[j] += weight * data[r * nFeatures + j];
+                }
+            }
+        }
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            meanData[j] /= sumOfWeights;
+        }
+        for (size_t k = 0; k <= i; k++)
+        {
+            double weight = pow(decayFactor, (double)(i - k));
+            for (size_t r = k * nVectorsInBlock; r < (k + 1) * nVectorsInBlock; r++)
+            {
+                for (size_t j = 0; j < nFeatures; j++)
+                {
+                    double centered = data[r * nFeatures + j] - meanData[j];
+                    varianceData[j] += weight * centered * centered;
+                }
+            }
+        }
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            varianceData[j] /= (sumOfWeights - 1.0);
+        }
+
+        ostringstream blockIndex;
+        blockIndex << " with the exponential forgetting after the block " << i;
+        isCorrect = checkNumericTables(res->get(low_order_moments::mean), meanPtr, threshold, "Mean" + blockIndex.str()) && isCorrect;
+        isCorrect = checkNumericTables(res->get(low_order_moments::variance), variancePtr, threshold, "Variance" + blockIndex.str()) && isCorrect;
+    }
+
+    dataTable->releaseBlockOfRows(block);
+    return isCorrect;
+}
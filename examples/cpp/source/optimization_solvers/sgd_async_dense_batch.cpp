@@ -0,0 +1,89 @@
+/* file: sgd_async_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the Stochastic gradient descent algorithm
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-SGD_ASYNC_DENSE_BATCH"></a>
+ * \example sgd_async_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+string datasetFileName = "../data/batch/mse.csv";
+
+const size_t nIterations = 1000;
+const size_t nFeatures = 3;
+const double learningRate = 0.5;
+const size_t batchSize = 4;
+const size_t synchronizationInterval = 2;
+const double accuracyThreshold = 0.0000001;
+
+double initialPoint[nFeatures + 1] = {8, 2, 1, 4};
+
+int main(int argc, char *argv[])
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName,
+            DataSource::notAllocateNumericTable,
+            DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for data and values for dependent variable */
+    NumericTablePtr data(new HomogenNumericTable<double>(nFeatures, 0, NumericTable::notAllocate));
+    NumericTablePtr dependentVariables(new HomogenNumericTable<double>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(data, dependentVariables));
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock(mergedData.get());
+
+    size_t nVectors = data->getNumberOfRows();
+
+    services::SharedPtr<optimization_solver::mse::Batch<double> > mseObjectiveFunction(new optimization_solver::mse::Batch<double>(nVectors));
+    mseObjectiveFunction->input.set(optimization_solver::mse::data, data);
+    mseObjectiveFunction->input.set(optimization_solver::mse::dependentVariables, dependentVariables);
+
+    /* Create objects to compute the Stochastic gradient descent result using the asynchronous parallel method */
+    optimization_solver::sgd::Batch<double, optimization_solver::sgd::asyncParallel> sgdAsyncAlgorithm(mseObjectiveFunction);
+
+    /* Set input objects for the the Stochastic gradient descent algorithm */
+    sgdAsyncAlgorithm.input.set(optimization_solver::iterative_solver::inputArgument,
+                                NumericTablePtr(new HomogenNumericTable<double>(initialPoint, 1, nFeatures + 1)));
+    sgdAsyncAlgorithm.parameter.learningRateSequence =
+        NumericTablePtr(new HomogenNumericTable<double>(1, 1, NumericTable::doAllocate, learningRate));
+    sgdAsyncAlgorithm.parameter.nIterations = nIterations;
+    sgdAsyncAlgorithm.parameter.batchSize = batchSize;
+    sgdAsyncAlgorithm.parameter.synchronizationInterval = synchronizationInterval;
+    sgdAsyncAlgorithm.parameter.accuracyThreshold = accuracyThreshold;
+
+    /* Compute the Stochastic gradient descent result */
+    sgdAsyncAlgorithm.compute();
+
+    /* Print computed the Stochastic gradient descent result */
+    printNumericTable(sgdAsyncAlgorithm.getResult()->get(optimization_solver::iterative_solver::minimum), "Minimum:");
+    printNumericTable(sgdAsyncAlgorithm.getResult()->get(optimization_solver::iterative_solver::nIterations), "Number of iterations performed:");
+
+    return 0;
+}
@@ -0,0 +1,299 @@
+/* file: out_detect_mult_bacon_check_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of multivariate outlier detection using the Bacon method.
+!
+!    The program checks the weights against the weights computed by the
+!    straightforward implementation of the Bacon method with the median-based
+!    initialization and prints the execution times of the phases of the method.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-OUTLIER_DETECTION_MULTIVARIATE_BACON_CHECK_BATCH"></a>
+ * \example out_detect_mult_bacon_check_batch.cpp
+ */
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace algorithms;
+
+typedef double algorithmFPType;     /* Algorithm floating-point type */
+
+/* Input data set parameters */
+string datasetFileName = "../data/batch/outlierdetection.csv";
+
+/* Bacon method parameters, the values are the defaults of the library */
+const double alpha               = 0.05;
+const double toleranceToConverge = 0.005;
+const size_t maxIterations       = 100;
+const size_t initSubsetFactor    = 4;
+
+bool computeReferenceWeights(NumericTable *dataTable, vector<double> &weight);
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the test data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable,
+                                                 DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+    NumericTablePtr dataTable = dataSource.getNumericTable();
+
+    /* Create an algorithm to detect outliers using the Bacon method and measure the execution times of its phases */
+    multivariate_outlier_detection::Batch<algorithmFPType, multivariate_outlier_detection::baconDense> algorithm;
+    algorithm.parameter.alpha               = alpha;
+    algorithm.parameter.toleranceToConverge = toleranceToConverge;
+    algorithm.parameter.computeTimings      = true;
+
+    algorithm.input.set(multivariate_outlier_detection::data, dataTable);
+
+    /* Compute outliers */
+    algorithm.compute();
+
+    /* Get the computed results */
+    services::SharedPtr<multivariate_outlier_detection::Result> res = algorithm.getResult();
+
+    printNumericTables(dataTable.get(), res->get(multivariate_outlier_detection::weights).get(),
+                       "Input data", "Weights",
+                       "Outlier detection result (Bacon method)");
+    printNumericTable(res->get(multivariate_outlier_detection::timings),
+                      "Execution times in seconds (total, Cholesky, distances, subset update, rebuild), first rows:", 5);
+
+    /* Compute the weights with the straightforward implementation of the method */
+    size_t nVectors = dataTable->getNumberOfRows();
+    vector<double> referenceWeight(nVectors);
+    if (!computeReferenceWeights(dataTable.get(), referenceWeight))
+    {
+        cout << "ERROR: Weights: variance-covariance matrix of the reference basic subset is not positive definite" << endl;
+        return -1;
+    }
+
+    HomogenNumericTable<double> *referenceTable = new HomogenNumericTable<double>(1, nVectors, NumericTable::doAllocate);
+    double *referenceData = referenceTable->getArray();
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        referenceData[i] = referenceWeight[i];
+    }
+
+    bool isCorrect = checkNumericTables(res->get(multivariate_outlier_detection::weights), NumericTablePtr(referenceTable),
+                                        0.0, "Weights");
+
+    return (isCorrect ? 0 : -1);
+}
+
+/* Inverse of the standard normal cumulative distribution function:
+ * the rational approximation refined by one step of the Halley method */
+double normInv(double p)
+{
+    const double a[] = { -3.969683028665376e+01, 2.209460984245205e+02, -2.759285104469687e+02,
+                         1.383577518672690e+02, -3.066479806614716e+01, 2.506628277459239e+00 };
+    const double b[] = { -5.447609879822406e+01, 1.615858368580409e+02, -1.556989798598866e+02,
+                         6.680131188771972e+01, -1.328068155288572e+01 };
+    const double c[] = { -7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00,
+                         -2.549732539343734e+00, 4.374664141464968e+00, 2.938163982698783e+00 };
+    const double d[] = { 7.784695709041462e-03, 3.224671290700398e-01, 2.445134137142996e+00,
+                         3.754408661907416e+00 };
+    const double pLow = 0.02425;
+
+    double x;
+    if (p < pLow)
+    {
+        double q = sqrt(-2.0 * log(p));
+        x = (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+            ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+    }
+    else if (p <= 1.0 - pLow)
+    {
+        double q = p - 0.5;
+        double r = q * q;
+        x = (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) * q /
+            (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1.0);
+    }
+    else
+    {
+        double q = sqrt(-2.0 * log(1.0 - p));
+        x = -(((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+             ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+    }
+
+    double e = 0.5 * erfc(-x / sqrt(2.0)) - p;
+    double u = e * 2.5066282746310002 * exp(x * x / 2.0);
+    return x - u / (1.0 + x * u / 2.0);
+}
+
+/* Squared threshold of the distances for the basic subset of r observations */
+double computeThreshold(size_t nFeatures, size_t nVectors, size_t nSubsetRows)
+{
+    double p = (double)nFeatures;
+    double n = (double)nVectors;
+    double r = (double)nSubsetRows;
+    double h = (double)((nVectors + nFeatures + 1) / 2);
+
+    double cnp = 1.0;
+    if (n > p)         { cnp += (p + 1.0) / (n - p); }
+    if (n - h - p > 0) { cnp += 1.0 / (n - h - p); }
+    double chr = (h > r ? (h - r) / (h + r) : 0.0);
+
+    double z = -normInv(alpha);
+    double a = 2.0 / (9.0 * p);
+    double q = 1.0 - a + z * sqrt(a);
+    double chiSquare = p * q * q * q;
+
+    return (cnp + chr) * (cnp + chr) * chiSquare;
+}
+
+/* Computes the mean and the lower Cholesky factor of the variance-covariance matrix
+ * of the observations with the non-zero weights, returns false if the matrix is not positive definite */
+bool computeSubsetStatistics(const double *x, size_t nFeatures, size_t nVectors, const vector<double> &weight,
+                             vector<double> &mean, vector<double> &cholesky)
+{
+    size_t nSubsetRows = 0;
+    mean.assign(nFeatures, 0.0);
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        if (weight[i] == 0.0) { continue; }
+        nSubsetRows++;
+        for (size_t j = 0; j < nFeatures; j++) { mean[j] += x[i * nFeatures + j]; }
+    }
+    if (nSubsetRows < 2) { return false; }
+    for (size_t j = 0; j < nFeatures; j++) { mean[j] /= (double)nSubsetRows; }
+
+    cholesky.assign(nFeatures * nFeatures, 0.0);
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        if (weight[i] == 0.0) { continue; }
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            for (size_t k = 0; k <= j; k++)
+            {
+                cholesky[j * nFeatures + k] += (x[i * nFeatures + j] - mean[j]) * (x[i * nFeatures + k] - mean[k]);
+            }
+        }
+    }
+
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        for (size_t k = 0; k <= j; k++)
+        {
+            double s = cholesky[j * nFeatures + k] / (double)(nSubsetRows - 1);
+            for (size_t l = 0; l < k; l++) { s -= cholesky[j * nFeatures + l] * cholesky[k * nFeatures + l]; }
+            if (k == j)
+            {
+                if (s <= 0.0) { return false; }
+                cholesky[j * nFeatures + j] = sqrt(s);
+            }
+            else
+            {
+                cholesky[j * nFeatures + k] = s / cholesky[k * nFeatures + k];
+            }
+        }
+    }
+    return true;
+}
+
+/* Squared Mahalanobis distance computed by the forward substitution with the lower Cholesky factor */
+double computeDistance(const double *row, size_t nFeatures, const vector<double> &mean, const vector<double> &cholesky)
+{
+    vector<double> z(nFeatures);
+    double distance = 0.0;
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        double s = row[j] - mean[j];
+        for (size_t k = 0; k < j; k++) { s -= cholesky[j * nFeatures + k] * z[k]; }
+        z[j] = s / cholesky[j * nFeatures + j];
+        distance += z[j] * z[j];
+    }
+    return distance;
+}
+
+bool computeReferenceWeights(NumericTable *dataTable, vector<double> &weight)
+{
+    size_t nFeatures = dataTable->getNumberOfColumns();
+    size_t nVectors  = dataTable->getNumberOfRows();
+
+    BlockDescriptor<double> block;
+    dataTable->getBlockOfRows(0, nVectors, readOnly, block);
+    const double *x = block.getBlockPtr();
+
+    /* Euclidean distances to the coordinate-wise median */
+    vector<double> median(nFeatures), column(nVectors), distance(nVectors, 0.0);
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        for (size_t i = 0; i < nVectors; i++) { column[i] = x[i * nFeatures + j]; }
+        sort(column.begin(), column.end());
+        median[j] = ((nVectors % 2) ? column[nVectors / 2] : (column[nVectors / 2 - 1] + column[nVectors / 2]) * 0.5);
+    }
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            distance[i] += (x[i * nFeatures + j] - median[j]) * (x[i * nFeatures + j] - median[j]);
+        }
+    }
+
+    /* Initial basic subset of the closest observations, enlarged until its variance-covariance matrix is positive definite */
+    vector<double> sortedDistance(distance), mean, cholesky;
+    sort(sortedDistance.begin(), sortedDistance.end());
+    size_t nInitRows = min(initSubsetFactor * nFeatures, nVectors);
+    bool isPositiveDefinite = false;
+    for (;;)
+    {
+        for (size_t i = 0; i < nVectors; i++)
+        {
+            weight[i] = (distance[i] <= sortedDistance[nInitRows - 1] ? 1.0 : 0.0);
+        }
+        isPositiveDefinite = computeSubsetStatistics(x, nFeatures, nVectors, weight, mean, cholesky);
+        if (isPositiveDefinite || nInitRows == nVectors) { break; }
+        nInitRows = min(2 * nInitRows, nVectors);
+    }
+
+    /* Iterations: the observations closer to the mean of the basic subset than the threshold
+     * in the Mahalanobis distance form the next basic subset */
+    size_t nSubsetRows = 0;
+    for (size_t i = 0; i < nVectors; i++) { nSubsetRows += (weight[i] != 0.0); }
+    for (size_t iteration = 0; iteration < maxIterations && isPositiveDefinite; iteration++)
+    {
+        double threshold = computeThreshold(nFeatures, nVectors, nSubsetRows);
+        size_t nNewRows = 0;
+        for (size_t i = 0; i < nVectors; i++)
+        {
+            weight[i] = (computeDistance(x + i * nFeatures, nFeatures, mean, cholesky) < threshold ? 1.0 : 0.0);
+            nNewRows += (weight[i] != 0.0);
+        }
+
+        size_t change = (nNewRows > nSubsetRows ? nNewRows - nSubsetRows : nSubsetRows - nNewRows);
+        bool converged = (change == 0 || (double)change < toleranceToConverge * (double)nSubsetRows);
+        nSubsetRows = nNewRows;
+        if (converged) { break; }
+
+        isPositiveDefinite = computeSubsetStatistics(x, nFeatures, nVectors, weight, mean, cholesky);
+    }
+
+    dataTable->releaseBlockOfRows(block);
+    return isPositiveDefinite;
+}
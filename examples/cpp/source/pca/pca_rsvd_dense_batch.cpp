@@ -0,0 +1,157 @@
+/* file: pca_rsvd_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of principal component analysis (PCA) using the randomized
+!    singular value decomposition (SVD) method in the batch processing mode
+!
+!    The program checks the principal components against the leading principal
+!    components computed by the SVD method.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-PCA_RSVD_DENSE_BATCH"></a>
+ * \example pca_rsvd_dense_batch.cpp
+ */
+
+#include <cmath>
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+const string dataFileName = "../data/batch/pca_normalized.csv";
+const size_t nVectors = 1000;
+
+/* PCA algorithm parameters */
+const size_t nComponents = 3;
+const double threshold   = 1.0e-6;
+
+double getEigenvaluesDifference(NumericTable *rsvdEigenvalues, NumericTable *svdEigenvalues);
+double getEigenvectorsDifference(NumericTable *rsvdEigenvectors, NumericTable *svdEigenvectors);
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &dataFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(dataFileName, DataSource::doAllocateNumericTable,
+                                                 DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock(nVectors);
+
+    /* Create an algorithm for principal component analysis using the randomized SVD method.
+     * With the default number of oversamples the sketch covers all features of the data set,
+     * so the leading principal components are computed exactly */
+    pca::Batch<double, pca::randomizedSvd> algorithm;
+    algorithm.parameter.nComponents = nComponents;
+
+    /* Set the algorithm input data */
+    algorithm.input.set(pca::data, dataSource.getNumericTable());
+
+    /* Compute results of the PCA algorithm */
+    algorithm.compute();
+
+    /* Compute all principal components using the SVD method */
+    pca::Batch<double, pca::svdDense> svdAlgorithm;
+    svdAlgorithm.input.set(pca::data, dataSource.getNumericTable());
+    svdAlgorithm.compute();
+
+    /* Print the results */
+    services::SharedPtr<pca::Result> result = algorithm.getResult();
+    services::SharedPtr<pca::Result> svdResult = svdAlgorithm.getResult();
+    printNumericTable(result->get(pca::eigenvalues), "Eigenvalues:");
+    printNumericTable(result->get(pca::eigenvectors), "Eigenvectors:");
+
+    /* Compare the results with the leading principal components of the SVD method */
+    double difference = getEigenvaluesDifference(result->get(pca::eigenvalues).get(), svdResult->get(pca::eigenvalues).get());
+    bool isCorrect = checkDifference(difference, threshold, "Eigenvalues");
+
+    difference = getEigenvectorsDifference(result->get(pca::eigenvectors).get(), svdResult->get(pca::eigenvectors).get());
+    isCorrect = checkDifference(difference, threshold, "Eigenvectors") && isCorrect;
+
+    return (isCorrect ? 0 : -1);
+}
+
+/* The randomized SVD method computes the leading eigenvalues only */
+double getEigenvaluesDifference(NumericTable *rsvdEigenvalues, NumericTable *svdEigenvalues)
+{
+    size_t nValues = rsvdEigenvalues->getNumberOfColumns();
+    if (svdEigenvalues->getNumberOfColumns() < nValues) { return -1.0; }
+
+    BlockDescriptor<double> rsvdBlock, svdBlock;
+    rsvdEigenvalues->getBlockOfRows(0, 1, readOnly, rsvdBlock);
+    svdEigenvalues->getBlockOfRows(0, 1, readOnly, svdBlock);
+    double *rsvd = rsvdBlock.getBlockPtr();
+    double *svd  = svdBlock.getBlockPtr();
+
+    double difference = 0.0;
+    for (size_t i = 0; i < nValues; i++)
+    {
+        double delta = fabs(rsvd[i] - svd[i]);
+        if (delta > difference) { difference = delta; }
+    }
+
+    rsvdEigenvalues->releaseBlockOfRows(rsvdBlock);
+    svdEigenvalues->releaseBlockOfRows(svdBlock);
+    return difference;
+}
+
+/* Eigenvectors are defined up to the sign, so each eigenvector is compared with
+ * the SVD eigenvector or its opposite, whichever is closer */
+double getEigenvectorsDifference(NumericTable *rsvdEigenvectors, NumericTable *svdEigenvectors)
+{
+    size_t nFeatures = rsvdEigenvectors->getNumberOfColumns();
+    if (svdEigenvectors->getNumberOfColumns() != nFeatures ||
+        svdEigenvectors->getNumberOfRows() < rsvdEigenvectors->getNumberOfRows())
+    {
+        return -1.0;
+    }
+
+    size_t nRows = rsvdEigenvectors->getNumberOfRows();
+    BlockDescriptor<double> rsvdBlock, svdBlock;
+    rsvdEigenvectors->getBlockOfRows(0, nRows, readOnly, rsvdBlock);
+    svdEigenvectors->getBlockOfRows(0, nRows, readOnly, svdBlock);
+    double *rsvd = rsvdBlock.getBlockPtr();
+    double *svd  = svdBlock.getBlockPtr();
+
+    double difference = 0.0;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        double dot = 0.0;
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            dot += rsvd[i * nFeatures + j] * svd[i * nFeatures + j];
+        }
+        double sign = (dot < 0.0 ? -1.0 : 1.0);
+
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            double delta = fabs(rsvd[i * nFeatures + j] - sign * svd[i * nFeatures + j]);
+            if (delta > difference) { difference = delta; }
+        }
+    }
+
+    rsvdEigenvectors->releaseBlockOfRows(rsvdBlock);
+    svdEigenvectors->releaseBlockOfRows(svdBlock);
+    return difference;
+}
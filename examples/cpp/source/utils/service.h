@@ -1015,4 +1015,74 @@ daal::services::SharedPtr<Tensor> getNextSubtensor(daal::services::SharedPtr<Ten
     return subtensorPtr;
 }
 
+NumericTablePtr getNextSubtable(NumericTablePtr inputTable, size_t startRow, size_t nRows)
+{
+    size_t nCols = inputTable->getNumberOfColumns();
+
+    BlockDescriptor<double> block;
+    inputTable->getBlockOfRows(startRow, nRows, readOnly, block);
+
+    HomogenNumericTable<double> *subtable = new HomogenNumericTable<double>(nCols, nRows, NumericTable::doAllocate);
+    double *subtableData = subtable->getArray();
+    double *inputData = block.getBlockPtr();
+
+    for(size_t i = 0; i < nCols * nRows; i++)
+    {
+        subtableData[i] = inputData[i];
+    }
+
+    inputTable->releaseBlockOfRows(block);
+    return NumericTablePtr(subtable);
+}
+
+double getMaxAbsDifference(NumericTable *table1, NumericTable *table2)
+{
+    size_t nCols = table1->getNumberOfColumns();
+    size_t nRows = table1->getNumberOfRows();
+    if(table2->getNumberOfColumns() != nCols || table2->getNumberOfRows() != nRows) { return -1.0; }
+
+    BlockDescriptor<double> block1, block2;
+    table1->getBlockOfRows(0, nRows, readOnly, block1);
+    table2->getBlockOfRows(0, nRows, readOnly, block2);
+    double *data1 = block1.getBlockPtr();
+    double *data2 = block2.getBlockPtr();
+
+    double difference = 0.0;
+    for(size_t i = 0; i < nCols * nRows; i++)
+    {
+        double d = (data1[i] > data2[i] ? data1[i] - data2[i] : data2[i] - data1[i]);
+        if(d > difference) { difference = d; }
+    }
+
+    table1->releaseBlockOfRows(block1);
+    table2->releaseBlockOfRows(block2);
+    return difference;
+}
+
+bool checkDifference(double difference, double threshold, const std::string &message)
+{
+    if(difference < 0.0)
+    {
+        std::cout << "ERROR: " << message << ": sizes of the results mismatch" << std::endl;
+        return false;
+    }
+    if(difference > threshold)
+    {
+        std::cout << "ERROR: " << message << ": maximal absolute difference " << difference << " exceeds " << threshold << std::endl;
+        return false;
+    }
+    std::cout << "OK: " << message << ": maximal absolute difference " << difference << std::endl;
+    return true;
+}
+
+bool checkNumericTables(NumericTable *table1, NumericTable *table2, double threshold, const std::string &message)
+{
+    return checkDifference(getMaxAbsDifference(table1, table2), threshold, message);
+}
+
+bool checkNumericTables(const NumericTablePtr &table1, const NumericTablePtr &table2, double threshold, const std::string &message)
+{
+    return checkNumericTables(table1.get(), table2.get(), threshold, message);
+}
+
 #endif
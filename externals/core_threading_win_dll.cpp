@@ -95,6 +95,8 @@ typedef void (* _daal_del_tls_ptr_t)(void *);
 typedef void *(* _daal_get_tls_local_t)(void *);
 typedef void (* _daal_reduce_tls_t)(void *, void *, daal::tls_reduce_functype );
 typedef bool (* _daal_is_in_parallel_t)();
+typedef void *(* _daal_new_mutex_t)();
+typedef void (* _daal_mutex_func_t)(void *);
 typedef size_t (* _setNumberOfThreads_t)(const size_t, void**);
 typedef void *(*_daal_threader_env_t)();
 
@@ -107,6 +109,10 @@ static _daal_del_tls_ptr_t _daal_del_tls_ptr_ptr = NULL;
 static _daal_get_tls_local_t _daal_get_tls_local_ptr = NULL;
 static _daal_reduce_tls_t _daal_reduce_tls_ptr = NULL;
 static _daal_is_in_parallel_t _daal_is_in_parallel_ptr = NULL;
+static _daal_new_mutex_t _daal_new_mutex_ptr = NULL;
+static _daal_mutex_func_t _daal_lock_mutex_ptr = NULL;
+static _daal_mutex_func_t _daal_unlock_mutex_ptr = NULL;
+static _daal_mutex_func_t _daal_del_mutex_ptr = NULL;
 static _setNumberOfThreads_t _setNumberOfThreads_ptr = NULL;
 static _daal_threader_env_t _daal_threader_env_ptr = NULL;
 
@@ -181,6 +187,34 @@ DAAL_EXPORT bool _daal_is_in_parallel()
     return _daal_is_in_parallel_ptr();
 }
 
+DAAL_EXPORT void *_daal_new_mutex()
+{
+    load_daal_thr_dll();
+    if(_daal_new_mutex_ptr == NULL) { _daal_new_mutex_ptr = (_daal_new_mutex_t)load_daal_thr_func("_daal_new_mutex"); }
+    return _daal_new_mutex_ptr();
+}
+
+DAAL_EXPORT void _daal_lock_mutex(void *mutexPtr)
+{
+    load_daal_thr_dll();
+    if(_daal_lock_mutex_ptr == NULL) { _daal_lock_mutex_ptr = (_daal_mutex_func_t)load_daal_thr_func("_daal_lock_mutex"); }
+    _daal_lock_mutex_ptr(mutexPtr);
+}
+
+DAAL_EXPORT void _daal_unlock_mutex(void *mutexPtr)
+{
+    load_daal_thr_dll();
+    if(_daal_unlock_mutex_ptr == NULL) { _daal_unlock_mutex_ptr = (_daal_mutex_func_t)load_daal_thr_func("_daal_unlock_mutex"); }
+    _daal_unlock_mutex_ptr(mutexPtr);
+}
+
+DAAL_EXPORT void _daal_del_mutex(void *mutexPtr)
+{
+    load_daal_thr_dll();
+    if(_daal_del_mutex_ptr == NULL) { _daal_del_mutex_ptr = (_daal_mutex_func_t)load_daal_thr_func("_daal_del_mutex"); }
+    _daal_del_mutex_ptr(mutexPtr);
+}
+
 DAAL_EXPORT size_t _setNumberOfThreads(const size_t numThreads, void** init)
 {
     load_daal_thr_dll();
@@ -21,19 +21,692 @@
 //--
 */
 
+#include "tbb/atomic.h"
+#include "tbb/spin_mutex.h"
+#include "tbb/spin_rw_mutex.h"
+#include "tbb/enumerable_thread_specific.h"
+#include "tbb/tbb_thread.h"
+
 #include "service_memory.h"
 #include "service_service.h"
+#include "daal_memory_allocator.h"
 
-void *daal::services::daal_malloc(size_t size, size_t alignment)
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+
+/* State of the thread used by daal_malloc: index of the slot of the counters and the installed allocator */
+struct ThreadState
+{
+    ThreadState() : index(0), isIndexSet(false), allocator(0) {}
+
+    size_t index;
+    bool isIndexSet;
+    MemoryAllocator *allocator;
+};
+
+typedef tbb::enumerable_thread_specific<ThreadState, tbb::cache_aligned_allocator<ThreadState>, tbb::ets_key_per_instance> ThreadStates;
+
+/* The objects below are intentionally never destroyed, so that the blocks deallocated during the static destruction
+   find their allocator */
+static ThreadStates &getThreadStates()
+{
+    static ThreadStates *states = new ThreadStates();
+    return *states;
+}
+
+static size_t getThreadIndex()
+{
+    static tbb::atomic<size_t> nextThreadIndex;
+    ThreadState &state = getThreadStates().local();
+    if (!state.isIndexSet)
+    {
+        state.index = nextThreadIndex.fetch_and_increment();
+        state.isIndexSet = true;
+    }
+    return state.index;
+}
+
+/* Number of the threads in which ScopedMemoryAllocator is active. While it is 0, the thread states are not looked up */
+static tbb::atomic<size_t> nScopedAllocators;
+
+} // namespace internal
+
+namespace interface1
+{
+
+/*
+ * Counters of the allocator. The threads update separate slots, so the counters of the allocator do not become
+ * a point of contention. The slots are summed by getStatistics()
+ */
+class MemoryAllocatorCounters
+{
+public:
+    static const size_t nSlots = 64;
+
+    struct Slot
+    {
+        tbb::atomic<size_t> bytesLive;
+        tbb::atomic<size_t> peakBytesLive;
+        tbb::atomic<size_t> nAllocations;
+        tbb::atomic<size_t> nDeallocations;
+        char padding[64 - 4 * sizeof(size_t)];
+    };
+
+    MemoryAllocatorCounters()
+    {
+        for (size_t i = 0; i < nSlots; i++)
+        {
+            _slots[i].bytesLive      = 0;
+            _slots[i].peakBytesLive  = 0;
+            _slots[i].nAllocations   = 0;
+            _slots[i].nDeallocations = 0;
+        }
+    }
+
+    Slot &getSlot() { return _slots[internal::getThreadIndex() % nSlots]; }
+
+    const Slot &operator[](size_t i) const { return _slots[i]; }
+
+private:
+    Slot _slots[nSlots];
+};
+
+/*
+ * Size classes of the pool allocator: multiples of 64 bytes up to 512 bytes,
+ * then 4 classes per each power of two
+ */
+class PoolMemoryAllocatorImpl
+{
+public:
+    static const size_t blockAlignment   = 64;
+    static const size_t nSmallClasses    = 8;
+    static const size_t nClassesPerPower = 4;
+    static const size_t maxClasses       = 128;
+
+    struct FreeBlock
+    {
+        FreeBlock *next;
+    };
+
+    struct Slab
+    {
+        Slab *next;
+    };
+
+    struct Shard
+    {
+        Shard() : slabs(0), slabPos(0), slabEnd(0)
+        {
+            for (size_t i = 0; i < maxClasses; i++) { freeBlocks[i] = 0; }
+        }
+
+        tbb::spin_mutex mutex;
+        FreeBlock *freeBlocks[maxClasses];
+        Slab *slabs;
+        char *slabPos;
+        char *slabEnd;
+        char padding[64];
+    };
+
+    PoolMemoryAllocatorImpl(size_t maxBlockSize) : _maxBlockSize(maxBlockSize < 512 ? 512 : maxBlockSize), _shards(0), _nShards(0)
+    {
+        if (getClassIndex(_maxBlockSize) >= maxClasses) { _maxBlockSize = getClassSize(maxClasses - 1); }
+        _slabSize = 16 * getClassSize(getClassIndex(_maxBlockSize));
+
+        size_t nThreads = tbb::tbb_thread::hardware_concurrency();
+        _nShards = (nThreads == 0 ? 1 : (nThreads > 256 ? 256 : nThreads));
+        _shards = new Shard[_nShards];
+    }
+
+    ~PoolMemoryAllocatorImpl()
+    {
+        for (size_t i = 0; i < _nShards; i++)
+        {
+            Slab *slab = _shards[i].slabs;
+            while (slab)
+            {
+                Slab *next = slab->next;
+                daal::internal::Service<>::serv_free(slab);
+                slab = next;
+            }
+        }
+        delete[] _shards;
+    }
+
+    bool isPooled(size_t size, size_t alignment) const
+    {
+        return (size <= _maxBlockSize && alignment <= blockAlignment);
+    }
+
+    void *allocate(size_t size)
+    {
+        const size_t classIndex = getClassIndex(size);
+        Shard &shard = getShard();
+
+        tbb::spin_mutex::scoped_lock lock(shard.mutex);
+        FreeBlock *block = shard.freeBlocks[classIndex];
+        if (block)
+        {
+            shard.freeBlocks[classIndex] = block->next;
+            return block;
+        }
+
+        const size_t blockSize = getClassSize(classIndex);
+        if (shard.slabPos == 0 || (size_t)(shard.slabEnd - shard.slabPos) < blockSize)
+        {
+            Slab *slab = (Slab *)daal::internal::Service<>::serv_malloc(_slabSize, blockAlignment);
+            if (!slab) { return 0; }
+            slab->next    = shard.slabs;
+            shard.slabs   = slab;
+            shard.slabPos = (char *)slab + blockAlignment;
+            shard.slabEnd = (char *)slab + _slabSize;
+        }
+        void *ptr = shard.slabPos;
+        shard.slabPos += blockSize;
+        return ptr;
+    }
+
+    /* The block is returned to the pool of the calling thread */
+    void deallocate(void *ptr, size_t size)
+    {
+        const size_t classIndex = getClassIndex(size);
+        Shard &shard = getShard();
+
+        tbb::spin_mutex::scoped_lock lock(shard.mutex);
+        FreeBlock *block = (FreeBlock *)ptr;
+        block->next = shard.freeBlocks[classIndex];
+        shard.freeBlocks[classIndex] = block;
+    }
+
+private:
+    static size_t getClassIndex(size_t size)
+    {
+        if (size <= nSmallClasses * blockAlignment)
+        {
+            return (size == 0 ? 0 : (size - 1) / blockAlignment);
+        }
+        size_t power = 0;
+        while (((size_t)2 << power) < size) { power++; }
+        /* size is in (2^power, 2^(power+1)] */
+        const size_t base = (size_t)1 << power;
+        const size_t step = base / nClassesPerPower;
+        const size_t k = (size - base + step - 1) / step;
+        return nSmallClasses + (power - 9) * nClassesPerPower + (k - 1);
+    }
+
+    static size_t getClassSize(size_t classIndex)
+    {
+        if (classIndex < nSmallClasses)
+        {
+            return (classIndex + 1) * blockAlignment;
+        }
+        const size_t power = 9 + (classIndex - nSmallClasses) / nClassesPerPower;
+        const size_t k = (classIndex - nSmallClasses) % nClassesPerPower + 1;
+        const size_t base = (size_t)1 << power;
+        return base + k * (base / nClassesPerPower);
+    }
+
+    Shard &getShard()
+    {
+        return _shards[internal::getThreadIndex() % _nShards];
+    }
+
+    size_t _maxBlockSize;
+    size_t _slabSize;
+    Shard *_shards;
+    size_t _nShards;
+};
+
+class ArenaMemoryAllocatorImpl
+{
+public:
+    struct Chunk
+    {
+        Chunk *next;
+        size_t size;
+    };
+
+    static const size_t chunkHeaderSize = 64;
+
+    ArenaMemoryAllocatorImpl(size_t chunkSize, bool resetOnScopeExit) :
+        resetOnScopeExit(resetOnScopeExit), _chunkSize(chunkSize < 4096 ? 4096 : chunkSize), _chunks(0), _pos(0), _end(0), _nLiveBlocks(0) {}
+
+    ~ArenaMemoryAllocatorImpl()
+    {
+        freeChunks();
+    }
+
+    void *allocate(size_t size, size_t alignment)
+    {
+        tbb::spin_mutex::scoped_lock lock(_mutex);
+
+        char *ptr = alignUp(_pos, alignment);
+        if (_pos == 0 || ptr > _end || (size_t)(_end - ptr) < size)
+        {
+            size_t chunkSize = size + alignment + chunkHeaderSize;
+            if (chunkSize < _chunkSize) { chunkSize = _chunkSize; }
+            if (!addChunk(chunkSize)) { return 0; }
+            ptr = alignUp(_pos, alignment);
+        }
+        _pos = ptr + size;
+        _nLiveBlocks++;
+        return ptr;
+    }
+
+    void deallocate()
+    {
+        tbb::spin_mutex::scoped_lock lock(_mutex);
+        _nLiveBlocks--;
+    }
+
+    bool reset()
+    {
+        tbb::spin_mutex::scoped_lock lock(_mutex);
+        if (_nLiveBlocks != 0) { return false; }
+        if (_chunks == 0) { return true; }
+
+        if (_chunks->next)
+        {
+            size_t totalSize = 0;
+            for (Chunk *chunk = _chunks; chunk; chunk = chunk->next) { totalSize += chunk->size; }
+            freeChunks();
+            if (!addChunk(totalSize)) { return true; }
+        }
+        _pos = (char *)_chunks + chunkHeaderSize;
+        return true;
+    }
+
+    const bool resetOnScopeExit;
+
+private:
+    static char *alignUp(char *ptr, size_t alignment)
+    {
+        return (char *)(((size_t)ptr + alignment - 1) & ~(alignment - 1));
+    }
+
+    bool addChunk(size_t size)
+    {
+        Chunk *chunk = (Chunk *)daal::internal::Service<>::serv_malloc(size, chunkHeaderSize);
+        if (!chunk) { return false; }
+        chunk->next = _chunks;
+        chunk->size = size;
+        _chunks = chunk;
+        _pos = (char *)chunk + chunkHeaderSize;
+        _end = (char *)chunk + size;
+        return true;
+    }
+
+    void freeChunks()
+    {
+        while (_chunks)
+        {
+            Chunk *next = _chunks->next;
+            daal::internal::Service<>::serv_free(_chunks);
+            _chunks = next;
+        }
+        _pos = 0;
+        _end = 0;
+    }
+
+    tbb::spin_mutex _mutex;
+    size_t _chunkSize;
+    Chunk *_chunks;
+    char *_pos;
+    char *_end;
+    size_t _nLiveBlocks;
+};
+
+MemoryAllocator::MemoryAllocator() : _counters(new MemoryAllocatorCounters()) {}
+
+MemoryAllocator::~MemoryAllocator()
+{
+    delete _counters;
+}
+
+MemoryAllocatorStatistics MemoryAllocator::getStatistics() const
+{
+    MemoryAllocatorStatistics statistics = { 0, 0, 0, 0 };
+    for (size_t i = 0; i < MemoryAllocatorCounters::nSlots; i++)
+    {
+        const MemoryAllocatorCounters::Slot &slot = (*_counters)[i];
+        statistics.bytesLive      += slot.bytesLive;
+        statistics.peakBytesLive  += slot.peakBytesLive;
+        statistics.nAllocations   += slot.nAllocations;
+        statistics.nDeallocations += slot.nDeallocations;
+    }
+    return statistics;
+}
+
+size_t MemoryAllocator::getNumberOfLiveBlocks() const
+{
+    size_t nLiveBlocks = 0;
+    for (size_t i = 0; i < MemoryAllocatorCounters::nSlots; i++)
+    {
+        const MemoryAllocatorCounters::Slot &slot = (*_counters)[i];
+        nLiveBlocks += slot.nAllocations - slot.nDeallocations;
+    }
+    return nLiveBlocks;
+}
+
+/* The bytes of the slot may wrap around when the blocks are deallocated in another thread, the sum over the slots is exact */
+void MemoryAllocator::registerAllocation(size_t size)
+{
+    MemoryAllocatorCounters::Slot &slot = _counters->getSlot();
+    const size_t bytesLive = slot.bytesLive.fetch_and_add(size) + size;
+    if ((ptrdiff_t)bytesLive > (ptrdiff_t)slot.peakBytesLive) { slot.peakBytesLive = bytesLive; }
+    slot.nAllocations.fetch_and_increment();
+}
+
+void MemoryAllocator::registerDeallocation(size_t size)
+{
+    MemoryAllocatorCounters::Slot &slot = _counters->getSlot();
+    slot.bytesLive.fetch_and_add(-size);
+    slot.nDeallocations.fetch_and_increment();
+}
+
+void *SystemMemoryAllocator::allocate(size_t size, size_t alignment)
 {
     return daal::internal::Service<>::serv_malloc(size, alignment);
 }
 
-void daal::services::daal_free(void *ptr)
+void SystemMemoryAllocator::deallocate(void *ptr, size_t size, size_t alignment)
 {
     daal::internal::Service<>::serv_free(ptr);
 }
 
+PoolMemoryAllocator::PoolMemoryAllocator(size_t maxBlockSize) : _impl(new PoolMemoryAllocatorImpl(maxBlockSize)) {}
+
+PoolMemoryAllocator::~PoolMemoryAllocator()
+{
+    delete _impl;
+}
+
+void *PoolMemoryAllocator::allocate(size_t size, size_t alignment)
+{
+    if (!_impl->isPooled(size, alignment)) { return daal::internal::Service<>::serv_malloc(size, alignment); }
+    return _impl->allocate(size);
+}
+
+void PoolMemoryAllocator::deallocate(void *ptr, size_t size, size_t alignment)
+{
+    if (!_impl->isPooled(size, alignment)) { daal::internal::Service<>::serv_free(ptr); return; }
+    _impl->deallocate(ptr, size);
+}
+
+ArenaMemoryAllocator::ArenaMemoryAllocator(size_t chunkSize, bool resetOnScopeExit) :
+    _impl(new ArenaMemoryAllocatorImpl(chunkSize, resetOnScopeExit)) {}
+
+ArenaMemoryAllocator::~ArenaMemoryAllocator()
+{
+    delete _impl;
+}
+
+void *ArenaMemoryAllocator::allocate(size_t size, size_t alignment)
+{
+    return _impl->allocate(size, alignment);
+}
+
+void ArenaMemoryAllocator::deallocate(void *ptr, size_t size, size_t alignment)
+{
+    _impl->deallocate();
+}
+
+void ArenaMemoryAllocator::endScope()
+{
+    if (_impl->resetOnScopeExit) { reset(); }
+}
+
+bool ArenaMemoryAllocator::reset()
+{
+    return _impl->reset();
+}
+
+} // namespace interface1
+
+namespace internal
+{
+
+/* Header stored right before each block returned by daal_malloc */
+struct AllocationHeader
+{
+    MemoryAllocator *allocator;
+    size_t size;
+    size_t alignment;
+    size_t offset;
+};
+
+/* The allocator used while no allocator is installed. Its allocations are not counted */
+static MemoryAllocator *getSystemAllocator()
+{
+    static SystemMemoryAllocator *allocator = new SystemMemoryAllocator();
+    return allocator;
+}
+
+/* Singly linked list of the retired allocators kept by the library */
+struct AllocatorEntry
+{
+    const void *key;
+    MemoryAllocatorPtr allocator;
+    AllocatorEntry *next;
+};
+
+static tbb::atomic<MemoryAllocator *> defaultAllocator;
+static tbb::atomic<size_t> nRetiredAllocators;
+
+/* Protects the default allocator and the retired allocators */
+static tbb::spin_mutex &getAllocatorsMutex()
+{
+    static tbb::spin_mutex *mutex = new tbb::spin_mutex();
+    return *mutex;
+}
+
+/* Held for reading by daal_malloc from reading the default allocator until its block is counted as live,
+   and for writing while the default allocator is replaced */
+static tbb::spin_rw_mutex &getDefaultAllocatorMutex()
+{
+    static tbb::spin_rw_mutex *mutex = new tbb::spin_rw_mutex();
+    return *mutex;
+}
+
+static MemoryAllocatorPtr &getDefaultAllocatorHolder()
+{
+    static MemoryAllocatorPtr *holder = new MemoryAllocatorPtr();
+    return *holder;
+}
+
+/* Allocators that are not installed anymore but still have live blocks */
+static AllocatorEntry *retiredAllocators = 0;
+
+static AllocatorEntry **findEntry(AllocatorEntry **list, const void *key)
+{
+    while (*list && (*list)->key != key) { list = &(*list)->next; }
+    return list;
+}
+
+/*
+ * Drops the reference of the library to the allocator. If the allocator still has live blocks, the reference is kept
+ * in the list of retired allocators until the last block is deallocated. Must be called with the allocators mutex locked
+ */
+static void releaseAllocatorLocked(MemoryAllocatorPtr &allocator)
+{
+    if (allocator && allocator->getNumberOfLiveBlocks() != 0 && !*findEntry(&retiredAllocators, allocator.get()))
+    {
+        AllocatorEntry *entry = new AllocatorEntry();
+        entry->key       = allocator.get();
+        entry->allocator = allocator;
+        entry->next      = retiredAllocators;
+        retiredAllocators = entry;
+        nRetiredAllocators.fetch_and_increment();
+    }
+    allocator = MemoryAllocatorPtr();
+}
+
+void releaseMemoryAllocator(MemoryAllocatorPtr &allocator)
+{
+    if (!allocator) { return; }
+    MemoryAllocatorPtr released;
+    {
+        tbb::spin_mutex::scoped_lock lock(getAllocatorsMutex());
+        released = allocator;
+        allocator = MemoryAllocatorPtr();
+        releaseAllocatorLocked(released);
+    }
+}
+
+/* Called after the last access to the allocator from daal_free */
+static void onDeallocation(MemoryAllocator *allocator)
+{
+    if (nRetiredAllocators == 0) { return; }
+
+    MemoryAllocatorPtr released;
+    {
+        tbb::spin_mutex::scoped_lock lock(getAllocatorsMutex());
+        AllocatorEntry **entry = findEntry(&retiredAllocators, allocator);
+        if (!*entry || allocator->getNumberOfLiveBlocks() != 0) { return; }
+
+        AllocatorEntry *retired = *entry;
+        *entry = retired->next;
+        nRetiredAllocators.fetch_and_decrement();
+        released = retired->allocator;
+        delete retired;
+    }
+    /* The allocator is destroyed outside the lock if the library kept the last reference */
+}
+
+/* Returns the allocator installed in the calling thread, 0 if the default allocator is used */
+static MemoryAllocator *getScopedAllocator()
+{
+    return (nScopedAllocators != 0 ? getThreadStates().local().allocator : 0);
+}
+
+MemoryAllocator *getThreadMemoryAllocator()
+{
+    if (nScopedAllocators == 0) { return 0; }
+    return getThreadStates().local().allocator;
+}
+
+MemoryAllocator *setThreadMemoryAllocator(MemoryAllocator *allocator)
+{
+    ThreadState &state = getThreadStates().local();
+    MemoryAllocator *previous = state.allocator;
+    state.allocator = allocator;
+    return previous;
+}
+
+} // namespace internal
+
+namespace interface1
+{
+
+void setDefaultMemoryAllocator(const MemoryAllocatorPtr &allocator)
+{
+    MemoryAllocatorPtr released;
+    {
+        tbb::spin_mutex::scoped_lock lock(internal::getAllocatorsMutex());
+        released = internal::getDefaultAllocatorHolder();
+        internal::getDefaultAllocatorHolder() = allocator;
+        {
+            /* Waits for daal_malloc calls that use the previous allocator to count their blocks,
+               so that the allocator is retired instead of destroyed while they use it */
+            tbb::spin_rw_mutex::scoped_lock defaultLock(internal::getDefaultAllocatorMutex(), true);
+            internal::defaultAllocator = allocator.get();
+        }
+        if (released.get() != allocator.get()) { internal::releaseAllocatorLocked(released); }
+    }
+}
+
+MemoryAllocatorPtr getDefaultMemoryAllocator()
+{
+    tbb::spin_mutex::scoped_lock lock(internal::getAllocatorsMutex());
+    MemoryAllocatorPtr &holder = internal::getDefaultAllocatorHolder();
+    if (holder) { return holder; }
+    return MemoryAllocatorPtr(internal::getSystemAllocator(), EmptyDeleter<MemoryAllocator>());
+}
+
+ScopedMemoryAllocator::ScopedMemoryAllocator(const MemoryAllocatorPtr &allocator) : _allocator(allocator), _previous(0)
+{
+    if (_allocator)
+    {
+        internal::nScopedAllocators.fetch_and_increment();
+        _previous = internal::setThreadMemoryAllocator(_allocator.get());
+    }
+}
+
+ScopedMemoryAllocator::~ScopedMemoryAllocator()
+{
+    if (_allocator)
+    {
+        internal::setThreadMemoryAllocator(_previous);
+        internal::nScopedAllocators.fetch_and_decrement();
+        _allocator->endScope();
+        internal::releaseMemoryAllocator(_allocator);
+    }
+}
+
+} // namespace interface1
+} // namespace services
+} // namespace daal
+
+void *daal::services::daal_malloc(size_t size, size_t alignment)
+{
+    using daal::services::internal::AllocationHeader;
+
+    if (alignment < sizeof(void *)) { alignment = sizeof(void *); }
+    const size_t offset = (sizeof(AllocationHeader) + alignment - 1) & ~(alignment - 1);
+    if (size > (size_t)(-1) - offset) { return 0; }
+
+    /* The allocator installed in the thread is kept alive by its scope. The default allocator may be replaced
+       concurrently, so it is pinned until its block is counted as live */
+    MemoryAllocator *allocator = daal::services::internal::getScopedAllocator();
+    tbb::spin_rw_mutex::scoped_lock defaultLock;
+    if (!allocator && daal::services::internal::defaultAllocator != 0)
+    {
+        defaultLock.acquire(daal::services::internal::getDefaultAllocatorMutex(), false);
+        allocator = daal::services::internal::defaultAllocator;
+    }
+    if (!allocator) { allocator = daal::services::internal::getSystemAllocator(); }
+
+    char *block = (char *)allocator->allocate(size + offset, alignment);
+    char *ptr = 0;
+    if (block)
+    {
+        ptr = block + offset;
+        AllocationHeader *header = (AllocationHeader *)ptr - 1;
+        header->allocator = allocator;
+        header->size      = size;
+        header->alignment = alignment;
+        header->offset    = offset;
+
+        if (allocator != daal::services::internal::getSystemAllocator()) { allocator->registerAllocation(size); }
+    }
+    return ptr;
+}
+
+void daal::services::daal_free(void *ptr)
+{
+    using daal::services::internal::AllocationHeader;
+
+    if (!ptr) { return; }
+
+    AllocationHeader *header = (AllocationHeader *)ptr - 1;
+    MemoryAllocator *allocator = header->allocator;
+    const size_t size      = header->size;
+    const size_t offset    = header->offset;
+    const size_t alignment = header->alignment;
+
+    allocator->deallocate((char *)ptr - offset, size + offset, alignment);
+    if (allocator != daal::services::internal::getSystemAllocator())
+    {
+        /* The allocator may be destroyed by another thread right after its last block is counted as deallocated */
+        allocator->registerDeallocation(size);
+        daal::services::internal::onDeallocation(allocator);
+    }
+}
+
 void daal::services::daal_memcpy_s(void *dest, size_t destSize, const void *src, size_t srcSize)
 {
     size_t copySize = srcSize;
@@ -0,0 +1,354 @@
+/* file: service_trace.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the tracer of the library internals.
+//--
+*/
+
+#include <stdio.h>
+
+#include "tbb/atomic.h"
+#include "tbb/spin_mutex.h"
+#include "tbb/enumerable_thread_specific.h"
+#include "tbb/cache_aligned_allocator.h"
+#include "tbb/parallel_sort.h"
+#include "tbb/tick_count.h"
+
+#include "service_trace.h"
+#include "services/internal/daal_threading.h"
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+
+/* Ring buffer of the events of one thread. Only the owning thread writes to the buffer.
+   The buffer is allocated with the TBB allocator, so that the events are not counted by the memory allocators of the library */
+struct ThreadTraceBuffer
+{
+    ThreadTraceBuffer(size_t id) : threadId(id), events(0), capacity(0), nWritten(0) {}
+
+    void reset(size_t newCapacity)
+    {
+        if (events) { tbb::cache_aligned_allocator<TraceEvent>().deallocate(events, capacity); }
+        events = (newCapacity ? tbb::cache_aligned_allocator<TraceEvent>().allocate(newCapacity) : 0);
+        capacity = (events ? newCapacity : 0);
+        nWritten = 0;
+    }
+
+    void add(const TraceEvent &event)
+    {
+        if (!capacity) { return; }
+        events[nWritten % capacity] = event;
+        nWritten++;
+    }
+
+    size_t size() const { return (nWritten < capacity ? nWritten : capacity); }
+
+    size_t threadId;
+    TraceEvent *events;
+    size_t capacity;
+    size_t nWritten;
+};
+
+typedef tbb::enumerable_thread_specific<ThreadTraceBuffer *, tbb::cache_aligned_allocator<ThreadTraceBuffer *>,
+                                        tbb::ets_key_per_instance> ThreadTraceBuffers;
+
+/* The buffers are never destroyed, so that the events of the finished threads are exported too */
+class TraceRegistry
+{
+public:
+    TraceRegistry() : buffers((ThreadTraceBuffer *)0)
+    {
+        enabled = false;
+        capacity = 65536;
+        nBuffers = 0;
+    }
+
+    ThreadTraceBuffer *getThreadBuffer()
+    {
+        ThreadTraceBuffer *&buffer = buffers.local();
+        if (!buffer)
+        {
+            tbb::spin_mutex::scoped_lock lock(mutex);
+            ThreadTraceBuffer *newBuffer = new ThreadTraceBuffer(nBuffers++);
+            newBuffer->reset(capacity);
+            buffer = newBuffer;
+        }
+        return buffer;
+    }
+
+    /* Returns the number of the events kept in the buffers. The mutex must be locked */
+    size_t getNumberOfEventsLocked()
+    {
+        size_t nEvents = 0;
+        for (ThreadTraceBuffers::iterator it = buffers.begin(); it != buffers.end(); ++it)
+        {
+            if (*it) { nEvents += (*it)->size(); }
+        }
+        return nEvents;
+    }
+
+    /* Copies the events ordered by the start time to the array allocated with the TBB allocator */
+    TraceEvent *collect(size_t &nEvents)
+    {
+        tbb::spin_mutex::scoped_lock lock(mutex);
+        nEvents = getNumberOfEventsLocked();
+        if (!nEvents) { return 0; }
+
+        TraceEvent *events = tbb::cache_aligned_allocator<TraceEvent>().allocate(nEvents);
+        if (!events) { nEvents = 0; return 0; }
+
+        size_t nCopied = 0;
+        for (ThreadTraceBuffers::iterator it = buffers.begin(); it != buffers.end(); ++it)
+        {
+            const ThreadTraceBuffer *buffer = *it;
+            if (!buffer) { continue; }
+            for (size_t i = 0; i < buffer->size(); i++)
+            {
+                events[nCopied++] = buffer->events[i];
+            }
+        }
+        tbb::parallel_sort(events, events + nEvents, compareStart);
+        return events;
+    }
+
+    static void release(TraceEvent *events, size_t nEvents)
+    {
+        if (events) { tbb::cache_aligned_allocator<TraceEvent>().deallocate(events, nEvents); }
+    }
+
+    static bool compareStart(const TraceEvent &a, const TraceEvent &b) { return a.start < b.start; }
+
+    tbb::atomic<bool> enabled;
+    tbb::atomic<size_t> capacity;
+    tbb::spin_mutex mutex;
+    size_t nBuffers;
+    ThreadTraceBuffers buffers;
+};
+
+static TraceRegistry &getTraceRegistry()
+{
+    static TraceRegistry *registry = new TraceRegistry();
+    return *registry;
+}
+
+static const tbb::tick_count &getTimeOrigin()
+{
+    static const tbb::tick_count origin = tbb::tick_count::now();
+    return origin;
+}
+
+static void writeJsonString(FILE *file, const char *value)
+{
+    fputc('"', file);
+    for (const char *c = (value ? value : ""); *c; c++)
+    {
+        if (*c == '"' || *c == '\\') { fputc('\\', file); }
+        fputc((unsigned char)*c < 0x20 ? ' ' : *c, file);
+    }
+    fputc('"', file);
+}
+
+/* Loop of the threading layer whose iterations are recorded as the trace events */
+struct TracedLoop
+{
+    const void *a;
+    functype func;
+    functype2 funcBlocked;
+};
+
+static void tracedTask(int i, const void *a)
+{
+    DAAL_TRACE_SCOPE("threading", "threader_for.task");
+    const TracedLoop &loop = *static_cast<const TracedLoop *>(a);
+    loop.func(i, loop.a);
+}
+
+static void tracedTaskBlocked(int i0, int in, const void *a)
+{
+    DAAL_TRACE_SCOPE("threading", "threader_for_blocked.task");
+    const TracedLoop &loop = *static_cast<const TracedLoop *>(a);
+    loop.funcBlocked(i0, in, loop.a);
+}
+
+static void tracedTaskOptional(int i, const void *a)
+{
+    DAAL_TRACE_SCOPE("threading", "threader_for_optional.task");
+    const TracedLoop &loop = *static_cast<const TracedLoop *>(a);
+    loop.func(i, loop.a);
+}
+
+} // namespace internal
+
+namespace interface1
+{
+
+void Tracer::enable(bool flag)
+{
+    internal::getTraceRegistry().enabled = flag;
+}
+
+bool Tracer::isEnabled()
+{
+    return internal::getTraceRegistry().enabled;
+}
+
+void Tracer::setBufferCapacity(size_t nEvents)
+{
+    internal::TraceRegistry &registry = internal::getTraceRegistry();
+    tbb::spin_mutex::scoped_lock lock(registry.mutex);
+    registry.capacity = nEvents;
+    for (internal::ThreadTraceBuffers::iterator it = registry.buffers.begin(); it != registry.buffers.end(); ++it)
+    {
+        if (*it) { (*it)->reset(nEvents); }
+    }
+}
+
+void Tracer::clear()
+{
+    internal::TraceRegistry &registry = internal::getTraceRegistry();
+    tbb::spin_mutex::scoped_lock lock(registry.mutex);
+    for (internal::ThreadTraceBuffers::iterator it = registry.buffers.begin(); it != registry.buffers.end(); ++it)
+    {
+        if (*it) { (*it)->nWritten = 0; }
+    }
+}
+
+size_t Tracer::getNumberOfEvents()
+{
+    internal::TraceRegistry &registry = internal::getTraceRegistry();
+    tbb::spin_mutex::scoped_lock lock(registry.mutex);
+    return registry.getNumberOfEventsLocked();
+}
+
+size_t Tracer::getEvents(TraceEvent *events, size_t maxEvents)
+{
+    if (!events) { return 0; }
+    size_t nCollected = 0;
+    TraceEvent *collected = internal::getTraceRegistry().collect(nCollected);
+
+    const size_t nEvents = (maxEvents < nCollected ? maxEvents : nCollected);
+    for (size_t i = 0; i < nEvents; i++)
+    {
+        events[i] = collected[i];
+    }
+    internal::TraceRegistry::release(collected, nCollected);
+    return nEvents;
+}
+
+bool Tracer::exportChromeTrace(const char *fileName)
+{
+    FILE *file = 0;
+#if (defined(_MSC_VER))
+    fopen_s(&file, fileName, "w");
+#else
+    file = fopen(fileName, "w");
+#endif
+    if (!file) { return false; }
+
+    size_t nEvents = 0;
+    TraceEvent *events = internal::getTraceRegistry().collect(nEvents);
+
+    /* Timestamps are written in microseconds relative to the first event */
+    const unsigned long long origin = (nEvents ? events[0].start : 0);
+    fprintf(file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+    for (size_t i = 0; i < nEvents; i++)
+    {
+        const TraceEvent &event = events[i];
+        fprintf(file, "%s\n{\"name\":", (i ? "," : ""));
+        internal::writeJsonString(file, event.name);
+        fprintf(file, ",\"cat\":");
+        internal::writeJsonString(file, event.category);
+        fprintf(file, ",\"ph\":\"X\",\"pid\":0,\"tid\":%llu,\"ts\":%.3f,\"dur\":%.3f}",
+                (unsigned long long)event.threadId, (event.start - origin) * 1e-3, event.duration * 1e-3);
+    }
+    fprintf(file, "\n]}\n");
+    internal::TraceRegistry::release(events, nEvents);
+    return (fclose(file) == 0);
+}
+
+unsigned long long Tracer::getTime()
+{
+    /* Offset by one nanosecond, so that 0 never denotes a started event */
+    return (unsigned long long)((tbb::tick_count::now() - internal::getTimeOrigin()).seconds() * 1e9) + 1;
+}
+
+void Tracer::addEvent(const char *category, const char *name, unsigned long long start, unsigned long long end)
+{
+    internal::ThreadTraceBuffer *buffer = internal::getTraceRegistry().getThreadBuffer();
+
+    TraceEvent event;
+    event.category = category;
+    event.name     = name;
+    event.start    = start;
+    event.duration = (end > start ? end - start : 0);
+    event.threadId = buffer->threadId;
+    buffer->add(event);
+}
+
+} // namespace interface1
+} // namespace services
+} // namespace daal
+
+/* The loops of the threading layer are recorded here rather than in the inline threader functions,
+   so that the trace points are compiled only into the library */
+DAAL_EXPORT void _daal_traced_threader_for(int n, int threads_request, const void *a, daal::functype func)
+{
+#if defined(DAAL_ENABLE_TRACING)
+    DAAL_TRACE_SCOPE("threading", "threader_for");
+    if (daal::services::Tracer::isEnabled())
+    {
+        const daal::services::internal::TracedLoop loop = { a, func, 0 };
+        _daal_threader_for(n, threads_request, &loop, daal::services::internal::tracedTask);
+        return;
+    }
+#endif
+    _daal_threader_for(n, threads_request, a, func);
+}
+
+DAAL_EXPORT void _daal_traced_threader_for_blocked(int n, int threads_request, const void *a, daal::functype2 func)
+{
+#if defined(DAAL_ENABLE_TRACING)
+    DAAL_TRACE_SCOPE("threading", "threader_for_blocked");
+    if (daal::services::Tracer::isEnabled())
+    {
+        const daal::services::internal::TracedLoop loop = { a, 0, func };
+        _daal_threader_for_blocked(n, threads_request, &loop, daal::services::internal::tracedTaskBlocked);
+        return;
+    }
+#endif
+    _daal_threader_for_blocked(n, threads_request, a, func);
+}
+
+DAAL_EXPORT void _daal_traced_threader_for_optional(int n, int threads_request, const void *a, daal::functype func)
+{
+#if defined(DAAL_ENABLE_TRACING)
+    DAAL_TRACE_SCOPE("threading", "threader_for_optional");
+    if (daal::services::Tracer::isEnabled())
+    {
+        const daal::services::internal::TracedLoop loop = { a, func, 0 };
+        _daal_threader_for_optional(n, threads_request, &loop, daal::services::internal::tracedTaskOptional);
+        return;
+    }
+#endif
+    _daal_threader_for_optional(n, threads_request, a, func);
+}
@@ -0,0 +1,42 @@
+/* file: service_trace.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Trace points of the library internals.
+//--
+*/
+
+#ifndef __SERVICE_TRACE_H__
+#define __SERVICE_TRACE_H__
+
+#include "daal_trace.h"
+
+/**
+ * Records the event from the statement to the end of the enclosing scope.
+ * Expands to nothing unless the library is built with DAAL_ENABLE_TRACING defined.
+ * Must be used only in the code compiled into the library, as the user code is compiled without the definition
+ */
+#if defined(DAAL_ENABLE_TRACING)
+    #define DAAL_TRACE_CONCAT_IMPL(a, b) a##b
+    #define DAAL_TRACE_CONCAT(a, b) DAAL_TRACE_CONCAT_IMPL(a, b)
+    #define DAAL_TRACE_SCOPE(category, name) daal::services::ScopedTrace DAAL_TRACE_CONCAT(__daalTraceScope, __LINE__)(category, name)
+#else
+    #define DAAL_TRACE_SCOPE(category, name)
+#endif
+
+#endif
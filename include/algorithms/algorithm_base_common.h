@@ -28,6 +28,7 @@
 #include "services/daal_kernel_defines.h"
 #include "services/error_handling.h"
 #include "services/env_detect.h"
+#include "services/daal_memory_allocator.h"
 #include "algorithms/algorithm_types.h"
 
 namespace daal
@@ -83,7 +84,10 @@ public:
     /** Default constructor */
     AlgorithmIfaceImpl() : _enableChecks(true), _errors(new services::ErrorCollection()) {}
 
-    virtual ~AlgorithmIfaceImpl() {}
+    virtual ~AlgorithmIfaceImpl()
+    {
+        services::internal::releaseMemoryAllocator(_memoryAllocator);
+    }
 
     /**
      * Sets flag of requiring parameters checks
@@ -112,6 +116,27 @@ public:
         return _errors;
     }
 
+    /**
+     * Sets the allocator used by daal_malloc during the computations of the algorithm
+     * in the calling thread and in the worker threads of the library
+     * \param[in] allocator Allocator to use, empty pointer to use the default allocator
+     */
+    void setMemoryAllocator(const services::MemoryAllocatorPtr &allocator)
+    {
+        services::MemoryAllocatorPtr previous = _memoryAllocator;
+        _memoryAllocator = allocator;
+        if (previous.get() != allocator.get()) { services::internal::releaseMemoryAllocator(previous); }
+    }
+
+    /**
+     * Returns the allocator used during the computations of the algorithm
+     * \return Allocator set by setMemoryAllocator(), empty pointer if the default allocator is used
+     */
+    services::MemoryAllocatorPtr getMemoryAllocator() const
+    {
+        return _memoryAllocator;
+    }
+
 private:
     bool _enableChecks;
 
@@ -136,6 +161,8 @@ protected:
     daal::services::Environment::env    _env;
 
     services::SharedPtr<services::ErrorCollection> _errors;
+
+    services::MemoryAllocatorPtr _memoryAllocator;
 };
 
 /** @} */
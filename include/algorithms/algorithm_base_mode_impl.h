@@ -91,62 +91,7 @@ public:
      * Computes final results of the algorithm in the %batch mode,
      * or partial results of the algorithm in %online and %distributed modes without possibility of throwing an exception.
      */
-    void computeNoThrow()
-    {
-        CanThrowStatus noThrow(this->_errors.get());
-        this->setParameter();
-
-        this->_in->setErrorCollection(this->_errors);
-        if(this->_par)
-        {
-            this->_par->setErrorCollection(this->_errors);
-        }
-
-        this->allocateInputMemory();
-        if(this->_errors->size() != 0)
-        {
-            return;
-        }
-
-        if(this->isChecksEnabled())
-        {
-            this->checkComputeParams();
-            if(this->_errors->size() != 0)
-            {
-                return;
-            }
-        }
-
-        if(!this->allocatePartialResultMemory())
-        {
-            this->_errors->add(services::ErrorMemoryAllocationFailed);
-            return;
-        }
-
-        this->_ac->setArguments(this->_in,  this->_pres, this->_par);
-        this->_ac->setErrorCollection(this->_errors);
-        this->_pres->setErrorCollection(this->_errors);
-
-
-        if(this->isChecksEnabled())
-        {
-            this->checkResult();
-            if(this->_errors->size() != 0)
-            {
-                return;
-            }
-        }
-
-        if(!this->getInitFlag())
-        {
-            this->initPartialResult();
-            this->setInitFlag(true);
-        }
-
-        setupCompute();
-        this->_ac->compute();
-        resetCompute();
-    }
+    DAAL_EXPORT void computeNoThrow();
 
     /**
      * Computes final results of the algorithm in the %batch mode,
@@ -165,50 +110,7 @@ public:
     /**
      * Computes final results of the algorithm using partial results in %online and %distributed modes.
      */
-    void finalizeComputeNoThrow()
-    {
-        CanThrowStatus noThrow(this->_errors.get());
-        if(this->isChecksEnabled())
-        {
-            this->checkPartialResult();
-            if(this->_errors->size() != 0)
-            {
-                return;
-            }
-        }
-
-        this->allocateResultMemory();
-        if(this->_errors->size() != 0)
-        {
-            this->_errors->add(services::ErrorMemoryAllocationFailed);
-            return;
-        }
-
-        this->_ac->setPartialResult(this->_pres);
-        this->_ac->setResult(this->_res);
-        this->_ac->setErrorCollection(this->_errors);
-
-        if(this->_res)
-        {
-            this->_res->setErrorCollection(this->_errors);
-        }
-
-        if(this->isChecksEnabled())
-        {
-            this->checkFinalizeComputeParams();
-            if(this->_errors->size() != 0)
-            {
-                return;
-            }
-        }
-
-        setupFinalizeCompute();
-        this->_ac->finalizeCompute();
-        if(resetFinalizeFlag)
-        {
-            resetFinalizeCompute();
-        }
-    }
+    DAAL_EXPORT void finalizeComputeNoThrow();
 
     /**
      * Computes final results of the algorithm using partial results in %online and %distributed modes.
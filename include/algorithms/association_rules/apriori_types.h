@@ -50,6 +50,7 @@ namespace association_rules
 enum Method
 {
     apriori = 0,         /*!< Apriori method */
+    fpGrowth = 1,        /*!< FP-Growth method that mines the large itemsets from the prefix tree of the transactions */
     defaultDense = 0     /*!< Apriori default method */
 };
 
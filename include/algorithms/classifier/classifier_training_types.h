@@ -257,6 +257,13 @@ public:
     {serialImpl<data_management::OutputDataArchive, true>(arch);}
 
 protected:
+    /**
+     * Constructs the result of the training stage with the given number of elements.
+     * Used by the classification algorithms that provide results in addition to the model
+     * \param[in] nElements Number of elements in the result
+     */
+    Result(const size_t nElements);
+
     void checkImpl(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter) const;
 
     /** \private */
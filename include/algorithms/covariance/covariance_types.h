@@ -76,7 +76,11 @@ enum PartialResultId
 {
     nObservations = 0,      /*!< Number of observations processed so far */
     crossProduct  = 1,      /*!< Cross-product matrix computed so far */
-    sum           = 2       /*!< Vector of sums computed so far */
+    sum           = 2,      /*!< Vector of sums computed so far */
+    windowStatistics = 3,   /*!< Statistics of the blocks in the window of the online processing mode, one row per block:
+                                 number of observations, sums and cross-product. Allocated only if OnlineParameter::windowSize is not zero */
+    windowCounters = 4      /*!< Integer counters of the window of the online processing mode: index of the next block
+                                 and number of the blocks removed since the last recomputation. Allocated only if OnlineParameter::windowSize is not zero */
 };
 
 /**
@@ -228,6 +232,8 @@ protected:
 
     void checkImpl(size_t nFeatures) const;
 
+    void checkWindow(const daal::algorithms::Parameter *parameter, size_t nFeatures) const;
+
     /** \private */
     template<typename Archive, bool onDeserialize>
     void serialImpl(Archive *arch)
@@ -294,6 +300,15 @@ struct DAAL_EXPORT OnlineParameter : public Parameter
     OnlineParameter();
 
     services::SharedPtr<PartialResultsInitIface> initializationProcedure;         /**< Functor for partial results initialization */
+    size_t windowSize;          /*!< Number of the latest blocks of data the statistics are computed for.
+                                     The statistics of the block that leaves the window are subtracted from the partial results.
+                                     Zero to compute the statistics for all the processed blocks */
+    double decayFactor;         /*!< Factor in the interval (0, 1] the weights of the processed observations are multiplied by
+                                     before the next block of data is added. One to disable the exponential forgetting */
+    size_t recomputeInterval;   /*!< Number of the blocks removed from the window after which the partial results
+                                     are recomputed from the statistics of the blocks in the window.
+                                     The partial results are also recomputed if the subtraction loses the precision.
+                                     Zero to recompute only on the loss of the precision */
 
     /**
      * Check the correctness of the %OnlineParameter object
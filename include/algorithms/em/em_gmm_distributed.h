@@ -0,0 +1,406 @@
+/* file: em_gmm_distributed.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the EM for GMM algorithm in the distributed processing mode
+//--
+*/
+
+#ifndef __EM_GMM_DISTRIBUTED_H__
+#define __EM_GMM_DISTRIBUTED_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "em_gmm_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace em_gmm
+{
+
+namespace interface1
+{
+/**
+ * @defgroup em_gmm_distributed Distributed
+ * @ingroup em_gmm_compute
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__EM_GMM__DISTRIBUTEDCONTAINER"></a>
+ * \brief Provides methods to run implementations of the EM for GMM algorithm.
+ *        This class is associated with the daal::algorithms::em_gmm::Distributed class
+ *        and supports the method of EM for GMM computation in the distributed processing mode.
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the EM for GMM algorithm, double or float
+ * \tparam method           EM for GMM computation method, \ref daal::algorithms::em_gmm::Method
+ */
+template<ComputeStep step, typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT DistributedContainer;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__EM_GMM__DISTRIBUTEDCONTAINER_STEP1LOCAL_ALGORITHMFPTYPE_METHOD_CPU"></a>
+ * \brief Class containing computation methods for the EM for GMM algorithm in the first step of the distributed processing mode
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT DistributedContainer<step1Local, algorithmFPType, method, cpu> : public
+    daal::algorithms::AnalysisContainerIface<distributed>
+{
+public:
+    /**
+     * Constructs a container for the EM for GMM algorithm with a specified environment
+     * in the first step of the distributed processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    DistributedContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    virtual ~DistributedContainer();
+    /**
+     * Computes a partial result of the EM for GMM algorithm in the first step of the
+     * distributed processing mode
+     */
+    virtual void compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes the result of the EM for GMM algorithm in the first step of the
+     * distributed processing mode
+     */
+    virtual void finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__EM_GMM__DISTRIBUTEDCONTAINER_STEP2MASTER_ALGORITHMFPTYPE_METHOD_CPU"></a>
+ * \brief Class containing computation methods for the EM for GMM algorithm in the second step of the distributed processing mode
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT DistributedContainer<step2Master, algorithmFPType, method, cpu> : public
+    daal::algorithms::AnalysisContainerIface<distributed>
+{
+public:
+    /**
+     * Constructs a container for the EM for GMM algorithm with a specified environment
+     * in the second step of the distributed processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    DistributedContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    virtual ~DistributedContainer();
+    /**
+     * Computes a partial result of the EM for GMM algorithm in the second step of the
+     * distributed processing mode
+     */
+    virtual void compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes the result of the EM for GMM algorithm in the second step of the
+     * distributed processing mode
+     */
+    virtual void finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__EM_GMM__DISTRIBUTED"></a>
+ * \brief Computes EM for GMM in the distributed processing mode.
+ *        One iteration of the EM algorithm consists of the first step on the local nodes, which computes
+ *        the sufficient statistics of the local data for the model given in the input, and the second step
+ *        on the master node, which merges the statistics and computes the next model in the M-step
+ * \n<a href="DAAL-REF-EM_GMM-ALGORITHM">EM for GMM algorithm description and usage models</a>
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the EM for GMM algorithm, double or float
+ * \tparam method           EM for GMM computation method, \ref Method
+ *
+ * \par Enumerations
+ *      - \ref Method           Computation methods for EM for GMM
+ *      - \ref InputId          Identifiers of input objects for EM for GMM
+ *      - \ref MasterInputId    Identifiers of input objects for EM for GMM on the master node
+ *      - \ref PartialResultId  Identifiers of partial results for EM for GMM
+ *      - \ref ResultId         Result identifiers for EM for GMM
+ */
+template<ComputeStep step, typename algorithmFPType = double, Method method = defaultDense>
+class DAAL_EXPORT Distributed {};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__EM_GMM__DISTRIBUTED_STEP1LOCAL_ALGORITHMFPTYPE_METHOD"></a>
+ * \brief Computes the sufficient statistics of the local data for EM for GMM in the first step of the distributed processing mode
+ * \n<a href="DAAL-REF-EM_GMM-ALGORITHM">EM for GMM algorithm description and usage models</a>
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the EM for GMM algorithm, double or float
+ * \tparam method           EM for GMM computation method, \ref Method
+ */
+template<typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step1Local, algorithmFPType, method> : public daal::algorithms::Analysis<distributed>
+{
+public:
+    Distributed(const size_t nComponents);
+
+    /**
+     * Constructs an EM for GMM algorithm by copying input objects and parameters
+     * of another EM for GMM algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step1Local, algorithmFPType, method> &other) : parameter(other.parameter)
+    {
+        initialize();
+        input.set(data,             other.input.get(data));
+        input.set(inputWeights,     other.input.get(inputWeights));
+        input.set(inputMeans,       other.input.get(inputMeans));
+        input.set(inputCovariances, other.input.get(inputCovariances));
+    }
+
+    /**
+    * Returns the method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int) method; }
+
+    /**
+     * Returns the structure that contains results of the EM for GMM algorithm
+     * \return Structure that contains results of the EM for GMM algorithm
+     */
+    services::SharedPtr<Result> getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Sets the memory for storing results of the EM for GMM algorithm
+     * \param[in] result  Structure for storing results of the EM for GMM algorithm
+     */
+    void setResult(const services::SharedPtr<Result>& result)
+    {
+        DAAL_CHECK(result, ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+    }
+
+    /**
+     * Returns the structure that contains computed partial results
+     * \return Structure that contains computed partial results
+     */
+    services::SharedPtr<PartialResult> getPartialResult()
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Sets the structure that contains computed partial results
+     */
+    void setPartialResult(const services::SharedPtr<PartialResult>& partialRes)
+    {
+        _partialResult = partialRes;
+        _pres = _partialResult.get();
+    }
+
+    /**
+     * Validates the parameters of the finalizeCompute() method
+     */
+    void checkFinalizeComputeParams() DAAL_C11_OVERRIDE {}
+
+    /**
+     * Returns a pointer to the newly allocated EM for GMM algorithm with a copy of input objects
+     * and parameters of this EM for GMM algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step1Local, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step1Local, algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Distributed<step1Local, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step1Local, algorithmFPType, method>(*this);
+    }
+
+    virtual void allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result = services::SharedPtr<Result>(new Result());
+        _result->allocate<algorithmFPType>(_in, _par, (int) method);
+        _res = _result.get();
+    }
+
+    virtual void allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult = services::SharedPtr<PartialResult>(new PartialResult());
+        _partialResult->allocate<algorithmFPType>(&input, _par, (int) method);
+        _pres = _partialResult.get();
+    }
+
+    virtual void initializePartialResult() DAAL_C11_OVERRIDE {}
+
+    void initialize();
+
+public:
+    Input input;            /*!< %Input data structure */
+    Parameter parameter;    /*!< %Parameter data structure */
+
+private:
+    services::SharedPtr<PartialResult> _partialResult;
+    services::SharedPtr<Result> _result;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__EM_GMM__DISTRIBUTED_STEP2MASTER_ALGORITHMFPTYPE_METHOD"></a>
+ * \brief Merges the sufficient statistics computed on the local nodes and computes the model of EM for GMM
+ *        in the second step of the distributed processing mode
+ * \n<a href="DAAL-REF-EM_GMM-ALGORITHM">EM for GMM algorithm description and usage models</a>
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the EM for GMM algorithm, double or float
+ * \tparam method           EM for GMM computation method, \ref Method
+ */
+template<typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step2Master, algorithmFPType, method> : public daal::algorithms::Analysis<distributed>
+{
+public:
+    Distributed(const size_t nComponents);
+
+    /**
+     * Constructs an EM for GMM algorithm by copying input objects and parameters
+     * of another EM for GMM algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step2Master, algorithmFPType, method> &other) : parameter(other.parameter)
+    {
+        initialize();
+        input.set(partialResults, other.input.get(partialResults));
+    }
+
+    /**
+    * Returns the method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int) method; }
+
+    /**
+     * Returns the structure that contains results of the EM for GMM algorithm
+     * \return Structure that contains results of the EM for GMM algorithm
+     */
+    services::SharedPtr<Result> getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Sets the memory for storing results of the EM for GMM algorithm
+     * \param[in] result  Structure for storing results of the EM for GMM algorithm
+     */
+    void setResult(const services::SharedPtr<Result>& result)
+    {
+        DAAL_CHECK(result, ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+    }
+
+    /**
+     * Returns the structure that contains computed partial results
+     * \return Structure that contains computed partial results
+     */
+    services::SharedPtr<PartialResult> getPartialResult()
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Sets the structure that contains computed partial results
+     */
+    void setPartialResult(const services::SharedPtr<PartialResult>& partialRes)
+    {
+        _partialResult = partialRes;
+        _pres = _partialResult.get();
+    }
+
+    /**
+     * Validates the parameters of the finalizeCompute() method
+     */
+    void checkFinalizeComputeParams() DAAL_C11_OVERRIDE
+    {
+        if(_partialResult)
+        {
+            _partialResult->check(_par, method);
+            if (!_errors->isEmpty()) { return; }
+        }
+        else
+        {
+            _errors->add(services::ErrorNullResult);
+            return;
+        }
+
+        if(_result)
+        {
+            _result->check(_partialResult.get(), _par, method);
+        }
+        else
+        {
+            _errors->add(services::ErrorNullResult);
+            return;
+        }
+    }
+
+    /**
+     * Returns a pointer to the newly allocated EM for GMM algorithm with a copy of input objects
+     * and parameters of this EM for GMM algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step2Master, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step2Master, algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Distributed<step2Master, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step2Master, algorithmFPType, method>(*this);
+    }
+
+    virtual void allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result = services::SharedPtr<Result>(new Result());
+        _result->allocate<algorithmFPType>(_pres, _par, (int) method);
+        _res = _result.get();
+    }
+
+    virtual void allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult = services::SharedPtr<PartialResult>(new PartialResult());
+        _partialResult->allocate<algorithmFPType>(&input, _par, (int) method);
+        _pres = _partialResult.get();
+    }
+
+    virtual void initializePartialResult() DAAL_C11_OVERRIDE {}
+
+    void initialize();
+
+public:
+    DistributedStep2MasterInput input; /*!< %Input data structure */
+    Parameter parameter;               /*!< %Parameter data structure */
+
+private:
+    services::SharedPtr<PartialResult> _partialResult;
+    services::SharedPtr<Result> _result;
+};
+/** @} */
+} // namespace interface1
+using interface1::DistributedContainer;
+using interface1::Distributed;
+
+} // namespace em_gmm
+} // namespace algorithm
+} // namespace daal
+#endif
@@ -105,6 +105,37 @@ enum ResultCovariancesId
     covariances = 2             /*!< %Collection of covariances */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__EM_GMM__PARTIALRESULTID"></a>
+ * Available identifiers of partial results of the EM for GMM algorithm in the online and distributed processing modes
+ */
+enum PartialResultId
+{
+    nObservations       = 0,    /*!< Number of processed observations */
+    sumOfWeights        = 1,    /*!< Sums of the weights of the observations in the components */
+    partialMeans        = 2,    /*!< Weighted means of the observations in the components */
+    partialGoalFunction = 3,    /*!< Table containing the average log-likelyhood of one observation without the constant term */
+    nProcessedBlocks    = 4     /*!< Table containing the number of processed blocks of data */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__EM_GMM__PARTIALRESULTCOVARIANCESID"></a>
+ * Available identifiers of partial cross-products of the EM for GMM algorithm in the online and distributed processing modes
+ */
+enum PartialResultCovariancesId
+{
+    partialCrossProducts = 5    /*!< %Collection of weighted cross-products of the observations in the components */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__EM_GMM__MASTERINPUTID"></a>
+ * Available identifiers of input objects of the EM for GMM algorithm in the second step of the distributed processing mode
+ */
+enum MasterInputId
+{
+    partialResults = 0          /*!< %Collection of partial results computed on local nodes */
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
  */
@@ -150,14 +181,35 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     services::SharedPtr<covariance::BatchIface> covariance; /*!< Pointer to the algorithm that computes the covariance */
     double regularizationFactor;                            /*!< Factor for covariance regularization in case of ill-conditional data */
     CovarianceStorageId covarianceStorage;                  /*!< Type of covariance in the Gaussian mixture model. */
+    double learningRateOffset;                              /*!< Offset t0 of the learning rate (t + 1 + t0)^(-learningRateDecay) of the block t
+                                                                 in the online processing mode */
+    double learningRateDecay;                               /*!< Decay of the learning rate in the online processing mode, in the interval (0.5, 1] */
 };
 /* [Parameter source code] */
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__EM_GMM__INPUTIFACE"></a>
+ * \brief Interface for the input objects of the EM for GMM algorithm
+ */
+class DAAL_EXPORT InputIface : public daal::algorithms::Input
+{
+public:
+    InputIface(size_t nElements) : daal::algorithms::Input(nElements) {}
+
+    virtual ~InputIface() {}
+
+    /**
+     * Returns the number of features in the input data
+     * \return Number of features in the input data
+     */
+    virtual size_t getNumberOfFeatures() const = 0;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__EM_GMM__INPUT"></a>
  * \brief %Input objects for the EM for GMM algorithm
  */
-class DAAL_EXPORT Input : public daal::algorithms::Input
+class DAAL_EXPORT Input : public InputIface
 {
 public:
     /** Default constructor */
@@ -209,6 +261,11 @@ public:
      */
     data_management::NumericTablePtr get(InputCovariancesId id, size_t index) const;
 
+    /**
+     * Returns the number of features in the input data table
+     * \return Number of features in the input data table
+     */
+    size_t getNumberOfFeatures() const DAAL_C11_OVERRIDE;
 
     /**
      * Checks the correctness of the input result
@@ -218,6 +275,104 @@ public:
     void check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__EM_GMM__PARTIALRESULT"></a>
+ * \brief Provides methods to access partial results obtained with the compute() method of the EM for GMM algorithm
+ *        in the online and distributed processing modes. The partial results contain the sufficient statistics
+ *        of the Gaussian mixture model
+ */
+class DAAL_EXPORT PartialResult : public daal::algorithms::PartialResult
+{
+public:
+    DECLARE_SERIALIZABLE();
+    /** Default constructor */
+    PartialResult();
+
+    virtual ~PartialResult() {};
+
+    /**
+     * Allocates memory for storing partial results of the EM for GMM algorithm
+     * \param[in] input     Pointer to the input structure
+     * \param[in] parameter Pointer to the parameter structure
+     * \param[in] method    Computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Sets the partial result of the EM for GMM algorithm
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the numeric table with the partial result
+     */
+    void set(PartialResultId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Sets the collection of partial cross-products of the EM for GMM algorithm
+     * \param[in] id    Identifier of the collection of partial cross-products
+     * \param[in] ptr   Pointer to the collection of partial cross-products
+     */
+    void set(PartialResultCovariancesId id, const data_management::DataCollectionPtr &ptr);
+
+    /**
+     * Returns the partial result of the EM for GMM algorithm
+     * \param[in] id   Identifier of the partial result
+     * \return         Partial result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(PartialResultId id) const;
+
+    /**
+     * Returns the collection of partial cross-products of the EM for GMM algorithm
+     * \param[in] id   Identifier of the collection of partial cross-products
+     * \return         Collection of partial cross-products that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(PartialResultCovariancesId id) const;
+
+    /**
+     * Returns the partial cross-product with a given index from the collection of partial cross-products
+     * \param[in] id    Identifier of the collection of partial cross-products
+     * \param[in] index Index of the partial cross-product to be returned
+     * \return          Pointer to the table with the partial cross-product
+     */
+    data_management::NumericTablePtr get(PartialResultCovariancesId id, size_t index) const;
+
+    /**
+     * Returns the number of features in the data processed by the algorithm
+     * \return Number of features in the data processed by the algorithm
+     */
+    size_t getNumberOfFeatures() const;
+
+    /**
+     * Checks the partial result of the EM for GMM algorithm
+     * \param[in] input   %Input of the algorithm
+     * \param[in] par     %Parameter of the algorithm
+     * \param[in] method  Computation method
+     */
+    void check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks the partial result of the EM for GMM algorithm
+     * \param[in] par     %Parameter of the algorithm
+     * \param[in] method  Computation method
+     */
+    void check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch)
+    {
+        daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+
+    void serializeImpl(data_management::InputDataArchive  *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::InputDataArchive, false>(arch);}
+
+    void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::OutputDataArchive, true>(arch);}
+
+    void checkImpl(size_t nFeatures, const Parameter *par) const;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__EM_GMM__RESULT"></a>
  * \brief Provides methods to access final results obtained with the compute() method of the EM for GMM algorithm in the batch processing mode
@@ -240,6 +395,15 @@ public:
     template <typename algorithmFPType>
     DAAL_EXPORT void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
 
+    /**
+     * Allocates memory for storing results of the EM for GMM algorithm in the online and distributed processing modes
+     * \param[in] partialResult Pointer to the partial result structure
+     * \param[in] parameter     Pointer to the parameter structure
+     * \param[in] method        Computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT void allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method);
+
     /**
      * Sets the result of the EM for GMM algorithm
      * \param[in] id    %Result identifier
@@ -284,6 +448,14 @@ public:
     */
     void check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
 
+    /**
+    * Checks the result of the EM for GMM algorithm in the online and distributed processing modes
+    * \param[in] partialResult %Partial result of the algorithm
+    * \param[in] par           %Parameter of algorithm
+    * \param[in] method        Computation method
+    */
+    void check(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
 protected:
     /** \private */
     template<typename Archive, bool onDeserialize>
@@ -297,12 +469,65 @@ protected:
 
     void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
     {serialImpl<data_management::OutputDataArchive, true>(arch);}
+
+    void checkImpl(size_t nFeatures, const Parameter *par) const;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__EM_GMM__DISTRIBUTEDSTEP2MASTERINPUT"></a>
+ * \brief %Input objects for the EM for GMM algorithm in the second step of the distributed processing mode
+ */
+class DAAL_EXPORT DistributedStep2MasterInput : public InputIface
+{
+public:
+    /** Default constructor */
+    DistributedStep2MasterInput();
+
+    virtual ~DistributedStep2MasterInput() {}
+
+    /**
+     * Returns an input object for the EM for GMM algorithm in the second step of the distributed processing mode
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(MasterInputId id) const;
+
+    /**
+     * Sets an input object for the EM for GMM algorithm in the second step of the distributed processing mode
+     * \param[in] id    Identifier of the input object
+     * \param[in] ptr   Pointer to the object
+     */
+    void set(MasterInputId id, const data_management::DataCollectionPtr &ptr);
+
+    /**
+     * Adds partial results computed on local nodes to the input for the EM for GMM algorithm
+     * in the second step of the distributed processing mode
+     * \param[in] id    Identifier of the input object
+     * \param[in] value Pointer to the object
+     */
+    void add(MasterInputId id, const services::SharedPtr<PartialResult> &value);
+
+    /**
+     * Returns the number of features in the data processed on local nodes
+     * \return Number of features in the data processed on local nodes
+     */
+    size_t getNumberOfFeatures() const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks an input object for the EM for GMM algorithm in the second step of the distributed processing mode
+     * \param[in] par     %Parameter of the algorithm
+     * \param[in] method  Computation method
+     */
+    void check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
 };
 /** @} */
 } // namespace interface1
 using interface1::Parameter;
+using interface1::InputIface;
 using interface1::Input;
+using interface1::PartialResult;
 using interface1::Result;
+using interface1::DistributedStep2MasterInput;
 
 } // namespace em_gmm
 } // namespace algorithm
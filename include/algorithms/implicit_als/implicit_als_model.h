@@ -57,9 +57,9 @@ namespace interface1
 struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
 {
     Parameter(size_t nFactors = 10, size_t maxIterations = 5, double alpha = 40.0, double lambda = 0.01,
-              double preferenceThreshold = 0.0, size_t seed = 777777) :
+              double preferenceThreshold = 0.0, size_t seed = 777777, size_t nCGIterations = 3) :
         nFactors(nFactors), maxIterations(maxIterations), alpha(alpha), lambda(lambda),
-        preferenceThreshold(preferenceThreshold)
+        preferenceThreshold(preferenceThreshold), nCGIterations(nCGIterations)
     {}
 
     size_t nFactors;            /*!< Number of factors */
@@ -67,6 +67,8 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     double alpha;               /*!< Confidence parameter of the implicit ALS training algorithm */
     double lambda;              /*!< Regularization parameter */
     double preferenceThreshold; /*!< Threshold used to define preference values */
+    size_t nCGIterations;       /*!< Number of conjugate-gradient steps per row of factors
+                                     for the training::conjugateGradientCSR method */
 
     void check() const DAAL_C11_OVERRIDE
     {
@@ -95,6 +97,11 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
             this->_errors->add(services::Error::create(services::ErrorIncorrectParameter, services::ParameterName, preferenceThresholdStr()));
             return;
         }
+        if(nCGIterations == 0)
+        {
+            this->_errors->add(services::Error::create(services::ErrorIncorrectParameter, services::ParameterName, nCGIterationsStr()));
+            return;
+        }
     }
 };
 /* [Parameter source code] */
@@ -55,7 +55,13 @@ namespace training
 enum Method
 {
     defaultDense = 0,   /*!< Default: method proposed by Hu, Koren, Volinsky for input data stored in the dense format */
-    fastCSR = 1         /*!< Method proposed by Hu, Koren, Volinsky for input data stored in the compressed sparse row (CSR) format */
+    fastCSR = 1,        /*!< Method proposed by Hu, Koren, Volinsky for input data stored in the compressed sparse row (CSR) format */
+    conjugateGradientCSR = 2 /*!< Method that updates the factors with a fixed number of conjugate-gradient steps
+                                  warm-started from the factors computed on the previous iteration,
+                                  for input data stored in the compressed sparse row (CSR) format.
+                                  Each step touches only the nonzero ratings of the row, so the method is not provided
+                                  for dense input, where every step would scan the whole row; convert dense data
+                                  to the CSR format to use it. Available in the batch processing mode only */
 };
 
 /**
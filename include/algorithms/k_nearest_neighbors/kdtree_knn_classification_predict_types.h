@@ -58,7 +58,9 @@ namespace prediction
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default method */
+    defaultDense = 0, /*!< Default method: search of nearest neighbors in the KD-tree */
+    bruteForce   = 1  /*!< Brute-force computation of distances to all observations of the training data set,
+                           does not require the KD-tree in the model */
 };
 
 /**
@@ -58,7 +58,9 @@ namespace training
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default method */
+    defaultDense = 0, /*!< Default method: the KD-tree is built for the training data set */
+    bruteForce   = 1  /*!< The training data set and labels are stored in the model without building the KD-tree.
+                           The model can only be used with the prediction::bruteForce method */
 };
 
 /**
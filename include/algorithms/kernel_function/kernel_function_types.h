@@ -76,6 +76,103 @@ enum ResultId
  */
 namespace interface1
 {
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KERNEL_FUNCTION__PRECOMPUTEDSTATE"></a>
+ * \brief Data of a fixed set of vectors that the kernel function computes once and reuses across calls:
+ *        squared norms of the rows and, for the table in the CSR layout, numbers of non-zero values in the rows.
+ *        The state is used only for the table it is constructed for
+ */
+class DAAL_EXPORT PrecomputedState : public Base
+{
+public:
+    /**
+     * Constructs the state of the table. The data must be computed by compute() before the state is used
+     * \param[in] table    Table of the vectors. Must not be modified while the state is in use
+     */
+    PrecomputedState(const data_management::NumericTablePtr &table);
+
+    /**
+     * Constructs the state of a block of rows of the table of another state. The state shares the data of that state
+     * \param[in] state     State of the table that contains the rows
+     * \param[in] rows      Table that provides the rows of the table of \p state starting from \p firstRow
+     * \param[in] firstRow  Index of the first row of \p rows in the table of \p state
+     */
+    PrecomputedState(const services::SharedPtr<PrecomputedState> &state, const data_management::NumericTablePtr &rows,
+                     size_t firstRow);
+
+    virtual ~PrecomputedState();
+
+    /**
+     * Computes the data of the table in the given floating-point type if it is not computed yet.
+     * Kernel functions only read the state, so it must be computed before it is attached to them
+     * \tparam algorithmFPType  Data type to use in intermediate computations of the kernel function, double or float
+     * \return true if the data is computed, false otherwise. The errors are available via getErrors()
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT bool compute();
+
+    /**
+     * Returns the table of the vectors
+     * \return Table of the vectors
+     */
+    data_management::NumericTablePtr getTable() const { return _table; }
+
+    /**
+     * Returns squared norms of the rows of the table
+     * \tparam algorithmFPType  Data type of the norms, double or float
+     * \return Array of nRows squared norms, 0 if the norms are not computed in the given data type
+     */
+    template <typename algorithmFPType>
+    const algorithmFPType *getSquaredNorms() const
+    {
+        if (_state)
+        {
+            const algorithmFPType *sqrNorms = _state->getSquaredNorms<algorithmFPType>();
+            return (sqrNorms ? sqrNorms + _firstRow : 0);
+        }
+        return (const algorithmFPType *)_sqrNorms[sizeof(algorithmFPType) == sizeof(double) ? 1 : 0];
+    }
+
+    /**
+     * Returns numbers of non-zero values in the rows of the table in the CSR layout
+     * \return Array of nRows numbers of non-zero values, 0 if the table is not in the CSR layout or the data is not computed
+     */
+    const size_t *getRowNonZeros() const
+    {
+        if (_state)
+        {
+            const size_t *rowNonZeros = _state->getRowNonZeros();
+            return (rowNonZeros ? rowNonZeros + _firstRow : 0);
+        }
+        return _rowNonZeros;
+    }
+
+    /**
+     * Checks whether the state is the state of the table
+     * \param[in] table    Table to check
+     * \return true if the state is constructed for the table and its rows are within the table of the state it shares the data of
+     */
+    bool isStateOf(const data_management::NumericTable *table) const;
+
+    /**
+     * Returns errors that occurred in compute()
+     * \return Errors that occurred in compute()
+     */
+    services::SharedPtr<services::ErrorCollection> getErrors() const { return _errors; }
+
+private:
+    PrecomputedState(const PrecomputedState &);
+    PrecomputedState &operator=(const PrecomputedState &);
+
+    data_management::NumericTablePtr _table;
+    services::SharedPtr<PrecomputedState> _state;   /* State the data is shared with, empty if the state owns its data */
+    size_t _firstRow;                               /* Index of the first row of _table in the table of _state */
+    void *_sqrNorms[2];
+    size_t *_rowNonZeros;
+    services::SharedPtr<services::ErrorCollection> _errors;
+};
+typedef services::SharedPtr<PrecomputedState> PrecomputedStatePtr;
+
 /**
  * <a name="DAAL-STRUCT-ALGORITHMS__KERNEL_FUNCTION__PARAMETERBASE"></a>
  * \brief Optional %input objects for the kernel function algorithm
@@ -91,6 +188,8 @@ struct DAAL_EXPORT ParameterBase : public daal::algorithms::Parameter
     size_t rowIndexY;                   /*!< Index of the vector in the set Y */
     size_t rowIndexResult;              /*!< Index of the result of the kernel function computation */
     ComputationMode computationMode;    /*!< Mode of computing kernel functions */
+    PrecomputedStatePtr precomputedStateX;  /*!< Optional precomputed state of the table of the set X */
+    PrecomputedStatePtr precomputedStateY;  /*!< Optional precomputed state of the table of the set Y */
 };
 /* [ParameterBase source code] */
 
@@ -123,6 +222,8 @@ protected:
     void checkCSR() const;
 
     void checkDense() const;
+
+    void checkPrecomputedState(const ParameterBase *par) const;
 };
 
 /**
@@ -183,6 +284,8 @@ protected:
 };
 /** @} */
 } // namespace interface1
+using interface1::PrecomputedState;
+using interface1::PrecomputedStatePtr;
 using interface1::ParameterBase;
 using interface1::Input;
 using interface1::Result;
@@ -50,7 +50,12 @@ enum Method
 {
     lloydDense = 0,     /*!< Default: performance-oriented method, synonym of defaultDense */
     defaultDense = 0,   /*!< Default: performance-oriented method, synonym of lloydDense */
-    lloydCSR = 1        /*!< Implementation of the Lloyd algorithm for CSR numeric tables */
+    lloydCSR = 1,       /*!< Implementation of the Lloyd algorithm for CSR numeric tables */
+    hamerlyDense = 2,   /*!< Lloyd algorithm that skips the distance computations using the bounds on the distances
+                             to the centroids (Hamerly method). Available in the batch processing mode only
+                             and for the data without categorical features */
+    hamerlyCSR = 3      /*!< Hamerly method for CSR numeric tables. Available in the batch processing mode only
+                             and for the data without categorical features */
 };
 
 /**
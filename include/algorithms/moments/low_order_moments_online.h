@@ -189,7 +189,7 @@ protected:
 
     virtual void allocatePartialResult() DAAL_C11_OVERRIDE
     {
-        _partialResult->allocate<algorithmFPType>(_in, 0, 0);
+        _partialResult->allocate<algorithmFPType>(_in, &parameter, 0);
         _pres   = _partialResult.get();
     }
 
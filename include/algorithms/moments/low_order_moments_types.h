@@ -112,7 +112,13 @@ enum PartialResultId
     partialMaximum              = 2,    /*!< Partial maximum */
     partialSum                  = 3,    /*!< Partial sum */
     partialSumSquares           = 4,    /*!< Partial sum of squares */
-    partialSumSquaresCentered   = 5     /*!< Partial sum of squared difference from the means */
+    partialSumSquaresCentered   = 5,    /*!< Partial sum of squared difference from the means */
+    partialWindowStatistics     = 6,    /*!< Partial results of the blocks in the window of the online processing mode, one row per block:
+                                             number of observations and partial results in the order of PartialResultId.
+                                             Allocated only if Parameter::windowSize is not zero */
+    partialWindowCounters       = 7     /*!< Integer counters of the window of the online processing mode: index of the next block
+                                             and number of the blocks removed since the last recomputation.
+                                             Allocated only if Parameter::windowSize is not zero */
 };
 
 /**
@@ -252,6 +258,8 @@ protected:
     {serialImpl<data_management::OutputDataArchive, true>(arch);}
 
     void checkImpl(size_t nFeatures) const;
+
+    void checkWindow(const daal::algorithms::Parameter *parameter, size_t nFeatures) const;
 };
 
 typedef services::SharedPtr<PartialResult> PartialResultPtr;
@@ -297,6 +305,17 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
 
     services::SharedPtr<PartialResultsInitIface> initializationProcedure;     /**< Functor for partial results initialization */
 
+    size_t windowSize;          /*!< Number of the latest blocks of data the moments are computed for in the online processing mode.
+                                     The partial results of the block that leaves the window are subtracted from the partial results.
+                                     Zero to compute the moments for all the processed blocks */
+    double decayFactor;         /*!< Factor in the interval (0, 1] the weights of the processed observations are multiplied by
+                                     before the next block of data is added in the online processing mode.
+                                     One to disable the exponential forgetting. Minimum and maximum are not weighted */
+    size_t recomputeInterval;   /*!< Number of the blocks removed from the window after which the partial results
+                                     are recomputed from the partial results of the blocks in the window.
+                                     The partial results are also recomputed if the subtraction loses the precision.
+                                     Zero to recompute only on the loss of the precision */
+
     void check() const DAAL_C11_OVERRIDE;
 };
 
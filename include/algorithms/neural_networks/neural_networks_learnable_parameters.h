@@ -93,11 +93,23 @@ public:
         return _weightsAndBiases->copyToTable();
     }
 
+    /**
+     * Returns the peak size of the memory planned for the values of the forward layers.
+     * For the prediction stage the value of a layer is counted while it is used by the next layers,
+     * for the training stage the values needed by the backward layers are counted until these layers are computed.
+     * The size is computed when the buffers of the model are allocated
+     * \return Size of the memory in bytes
+     */
+    size_t getPlannedMemorySize() const
+    {
+        return _plannedMemorySize;
+    }
+
 protected:
     ModelImpl() :
         _forwardLayers(new neural_networks::ForwardLayers),
         _nextLayers(new services::Collection<layers::NextLayers>),
-        _weightsAndBiasesCreated(false), _storeWeightsInTable(false)
+        _weightsAndBiasesCreated(false), _storeWeightsInTable(false), _plannedMemorySize(0)
     {}
 
     /**
@@ -111,13 +123,14 @@ protected:
               const services::SharedPtr<services::Collection<layers::NextLayers> > &nextLayers,
               bool storeWeightsInTable = false) :
         _forwardLayers(forwardLayers), _nextLayers(nextLayers),
-        _weightsAndBiasesCreated(false), _storeWeightsInTable(storeWeightsInTable) {}
+        _weightsAndBiasesCreated(false), _storeWeightsInTable(storeWeightsInTable), _plannedMemorySize(0) {}
 
     /** Copy constructor */
     ModelImpl(const ModelImpl &model) :
         _forwardLayers(model._forwardLayers), _nextLayers(model._nextLayers),
         _storeWeightsInTable(model._storeWeightsInTable),
-        _weightsAndBiasesCreated(model._weightsAndBiasesCreated)/*,
+        _weightsAndBiasesCreated(model._weightsAndBiasesCreated),
+        _plannedMemorySize(model._plannedMemorySize)/*,
          _weightsAndBiases(model._weightsAndBiases->clone()) */   {}
 
     void checkWeightsAndBiasesAllocation()
@@ -157,8 +170,26 @@ protected:
     template<typename modelFPType>
     DAAL_EXPORT void createWeightsAndBiases(bool checkAllocation);
 
+    /**
+     * Plans the value of the forward layer before its result is allocated.
+     * The value of an element-wise layer is set to its input if no other layer needs the input after this layer
+     * and to a separate tensor if the layer would otherwise overwrite the input needed by other layers.
+     * On the prediction stage the value of a layer reuses the value of a previous layer
+     * of the same dimensions that is not used by this and the next layers
+     * \param[in] layerId  Index of the layer in the network
+     */
+    template<typename modelFPType>
+    DAAL_EXPORT void planForwardLayerResult(size_t layerId);
+
+    /**
+     * Computes the peak size of the memory used by the values of the allocated forward layers
+     */
+    template<typename modelFPType>
+    DAAL_EXPORT void computePlannedMemorySize();
+
     bool _weightsAndBiasesCreated;
     bool _storeWeightsInTable;              /*!< Flag. True if weights and biases of all the layers are stored in one numeric table */
+    size_t _plannedMemorySize;              /*!< Peak size in bytes of the memory planned for the values of the forward layers */
 
     services::SharedPtr<neural_networks::ForwardLayers> _forwardLayers; /*!< List of forward layers of the network */
     services::SharedPtr<services::Collection<layers::NextLayers> > _nextLayers; /*!< List of edges connecting the layers in the network */
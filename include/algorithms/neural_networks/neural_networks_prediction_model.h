@@ -173,8 +173,10 @@ public:
 
         for (size_t i = 0; i < nLayers; i++)
         {
+            planForwardLayerResult<modelFPType>(i);
             connectForwardLayers(i);
         }
+        computePlannedMemorySize<modelFPType>();
 
         bool checkWeightsAndBiasesAlloc = true;
         createWeightsAndBiases<modelFPType>(checkWeightsAndBiasesAlloc);
@@ -65,15 +65,20 @@ public:
      * Constructs the parameters of neural network algorithm
      * \param[in] batchSize_                  Size of the batch to be processed by the neural network
      * \param[in] optimizationSolver_         Optimization solver used in the neural network
+     * \param[in] prefetchDepth_              Number of batches read from the input tensors ahead of the batch being processed
      */
     Parameter(size_t batchSize_ = 128,
               services::SharedPtr<optimization_solver::iterative_solver::Batch > optimizationSolver_ =
-                  services::SharedPtr<optimization_solver::iterative_solver::Batch>(new optimization_solver::sgd::Batch<float>())) :
-        batchSize(batchSize_), optimizationSolver(optimizationSolver_) {};
+                  services::SharedPtr<optimization_solver::iterative_solver::Batch>(new optimization_solver::sgd::Batch<float>()),
+              size_t prefetchDepth_ = 1) :
+        batchSize(batchSize_), optimizationSolver(optimizationSolver_), prefetchDepth(prefetchDepth_) {};
 
     size_t batchSize; /*!< Size of the batch to be processed by the neural network. */
 
     services::SharedPtr<optimization_solver::iterative_solver::Batch>  optimizationSolver; /*!< Optimization solver used in the neural network*/
+
+    size_t prefetchDepth; /*!< Number of batches read from the input tensors in the background while the current batch is processed.
+                               0 to read each batch synchronously before it is processed */
 };
 
 /**
@@ -296,8 +301,10 @@ public:
         size_t nLayers = _forwardLayers->size();
         for (size_t i = 0; i < nLayers; i++)
         {
+            planForwardLayerResult<modelFPType>(i);
             connectForwardLayers(i);
         }
+        computePlannedMemorySize<modelFPType>();
 
         bool checkWeightsAndBiasesAlloc = true;
         createWeightsAndBiases<modelFPType>(checkWeightsAndBiasesAlloc);
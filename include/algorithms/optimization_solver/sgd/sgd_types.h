@@ -56,7 +56,9 @@ enum Method
 {
     defaultDense = 0, /*!< Default: Required gradient is computed using only one term of objective function */
     miniBatch = 1,    /*!< Required gradient is computed using batchSize terms of objective function  */
-    momentum = 2      /*!< Required gradient is computed using batchSize terms of objective function, perform momentum update rule  */
+    momentum = 2,     /*!< Required gradient is computed using batchSize terms of objective function, perform momentum update rule  */
+    asyncParallel = 3 /*!< Several threads compute the gradients using batchSize terms of objective function and update
+                           the shared argument asynchronously without locking */
 };
 
 /**
@@ -283,6 +285,63 @@ struct DAAL_EXPORT Parameter<momentum> : public BaseParameter
 /* [ParameterMomentum source code] */
 /** @} */
 
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__OPTIMIZATION_SOLVER__SGD__PARAMETER_ASYNCPARALLEL"></a>
+ * \brief %Parameter for the asynchronous parallel Stochastic gradient descent algorithm.
+ *        The iterations are distributed among the threads of the library. Each thread computes the stochastic gradient
+ *        at its own copy of the argument and applies the update to the shared argument without locking.
+ *        The copy of the thread is refreshed from the shared argument every synchronizationInterval iterations of the thread
+ *
+ * \snippet optimization_solver/sgd/sgd_types.h ParameterAsyncParallel source code
+ */
+/* [ParameterAsyncParallel source code] */
+template<>
+struct DAAL_EXPORT Parameter<asyncParallel> : public BaseParameter
+{
+    /**
+     * Constructs the parameter class of the asynchronous parallel Stochastic gradient descent algorithm
+     * \param[in] function                Objective function represented as sum of functions
+     * \param[in] nIterations             Maximal number of iterations of the algorithm, summed over all threads
+     * \param[in] accuracyThreshold       Accuracy of the algorithm. The algorithm terminates when this accuracy is achieved
+     * \param[in] batchIndices            Numeric table that represents 32 bit integer indices of terms in the objective function. If no indices
+                                          are provided, the implementation will generate random indices.
+     * \param[in] batchSize               Number of batch indices to compute the stochastic gradient. If batchSize is equal to the number of terms
+                                          in objective function then no random sampling is performed, and all terms are used to calculate the gradient.
+                                          This parameter is ignored if batchIndices is provided.
+     * \param[in] synchronizationInterval Number of iterations of a thread after which the thread reads the shared argument again
+     * \param[in] learningRateSequence    Numeric table that contains values of the learning rate sequence
+     * \param[in] seed                    Seed for random generation of 32 bit integer indices of terms in the objective function.
+     */
+    Parameter(
+        const sum_of_functions::BatchPtr &function,
+        size_t nIterations = 100,
+        double accuracyThreshold = 1.0e-05,
+        data_management::NumericTablePtr batchIndices = data_management::NumericTablePtr(),
+        size_t batchSize = 128,
+        size_t synchronizationInterval = 1,
+        data_management::NumericTablePtr learningRateSequence = data_management::NumericTablePtr(
+                    new data_management::HomogenNumericTable<double>(
+                        1, 1, data_management::NumericTableIface::doAllocate, 1.0)),
+        size_t seed = 777 );
+
+    /**
+     * Checks the correctness of the parameter
+     */
+    virtual void check() const;
+
+    virtual ~Parameter() {}
+
+    size_t batchSize;               /*!< Number of batch indices to compute the stochastic gradient.
+                                         If batchSize is equal to the number of terms in objective
+                                         function then no random sampling is performed, and all terms are
+                                         used to calculate the gradient. This parameter is ignored
+                                         if batchIndices is provided. */
+    size_t synchronizationInterval; /*!< Number of iterations of a thread after which the thread reads the shared argument again.
+                                         Larger values reduce the memory traffic at the cost of staler gradients */
+};
+/* [ParameterAsyncParallel source code] */
+/** @} */
+
 /**
 * <a name="DAAL-STRUCT-ALGORITHMS__OPTIMIZATION_SOLVER__SGD__INPUT"></a>
 * \brief %Input for the Stochastic gradient descent algorithm
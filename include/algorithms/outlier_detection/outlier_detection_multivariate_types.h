@@ -77,7 +77,25 @@ enum InputId
  */
 enum ResultId
 {
-    weights = 0             /*!< Outlier detection results */
+    weights = 0,            /*!< Outlier detection results */
+    timings = 1             /*!< Optional table of the execution times of the BACON method in seconds, computed
+                                 if Parameter<baconDense>::computeTimings is true. Row 0 contains the times of the
+                                 initialization, row i > 0 the times of the i-th iteration or zeros if the algorithm
+                                 converged earlier. The table has 101 rows, the columns are defined by \ref BaconTimingId */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__MULTIVARIATE_OUTLIER_DETECTION__BACONTIMINGID"></a>
+ * Available identifiers of the columns of the table of the execution times of the BACON method
+ */
+enum BaconTimingId
+{
+    baconTotalTime         = 0,     /*!< Time of the initialization or of the iteration */
+    baconCholeskyTime      = 1,     /*!< Time of the Cholesky decompositions of the variance-covariance matrix */
+    baconDistancesTime     = 2,     /*!< Time of the distance computations, summed over the threads */
+    baconSubsetUpdateTime  = 3,     /*!< Time of the updates of the basic subset statistics, summed over the threads */
+    baconRebuildTime       = 4,     /*!< Time of the recomputation of the basic subset statistics from scratch */
+    baconNumberOfTimings   = 5      /*!< Number of the columns of the table */
 };
 
 /**
@@ -154,7 +172,7 @@ template <> struct DAAL_EXPORT Parameter<defaultDense> : public daal::algorithms
 template <> struct DAAL_EXPORT Parameter<baconDense> : public daal::algorithms::Parameter
 {
     Parameter(BaconInitializationMethod initMethod = baconMedian,
-              double alpha = 0.05, double toleranceToConverge = 0.005);
+              double alpha = 0.05, double toleranceToConverge = 0.005, bool computeTimings = false);
 
     BaconInitializationMethod initMethod;   /*!< Initialization method, \ref BaconInitializationMethod */
     double alpha;                           /*!< One-tailed probability that defines the \f$(1 - \alpha)\f$ quantile
@@ -162,6 +180,8 @@ template <> struct DAAL_EXPORT Parameter<baconDense> : public daal::algorithms::
                                                  Recommended value: \f$\alpha / n\f$, where n is the number of observations. */
     double toleranceToConverge;             /*!< Stopping criterion: the algorithm is terminated if the size of the basic subset
                                                  is changed by less than the threshold */
+    bool computeTimings;                    /*!< Flag that specifies whether the execution times of the phases of
+                                                 the algorithm are returned in the \ref timings result */
     virtual void check() const DAAL_C11_OVERRIDE;
 };
 /* [ParameterBacon source code] */
@@ -93,6 +93,27 @@ public:
     void compute() DAAL_C11_OVERRIDE;
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PCA__BATCHCONTAINER_ALGORITHMFPTYPE_RANDOMIZEDSVD_CPU"></a>
+ * \brief Class containing methods to compute the results of the PCA algorithm */
+template<typename algorithmFPType, CpuType cpu>
+class DAAL_EXPORT BatchContainer<algorithmFPType, randomizedSvd, cpu> : public AnalysisContainerIface<batch>
+{
+public:
+    /**
+     * Constructs a container for the PCA algorithm with a specified environment
+     * in the batch processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    BatchContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    ~BatchContainer();
+    /**
+     * Computes the result of the PCA algorithm in the batch processing mode
+     */
+    void compute() DAAL_C11_OVERRIDE;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__PCA__BATCH"></a>
  * \brief Computes the results of the PCA algorithm
@@ -140,6 +140,48 @@ public:
     void finalizeCompute() DAAL_C11_OVERRIDE;
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PCA__DISTRIBUTEDCONTAINER_STEP1LOCAL_ALGORITHMFPTYPE_RANDOMIZEDSVD_CPU"></a>
+ * \brief Class containing methods to compute the results of the PCA algorithm on the local node
+ */
+template<typename algorithmFPType, CpuType cpu>
+class DAAL_EXPORT DistributedContainer<step1Local, algorithmFPType, randomizedSvd, cpu> : public OnlineContainer<algorithmFPType, randomizedSvd, cpu>
+{
+public:
+    /** \brief Constructor */
+    DistributedContainer(daal::services::Environment::env *daalEnv) : OnlineContainer<algorithmFPType, randomizedSvd, cpu>(daalEnv) {};
+    virtual ~DistributedContainer() {}
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PCA__DISTRIBUTEDCONTAINER_STEP2MASTER_ALGORITHMFPTYPE_RANDOMIZEDSVD_CPU"></a>
+ * \brief Class containing methods to compute the results of the PCA algorithm on the master node
+ */
+template<typename algorithmFPType, CpuType cpu>
+class DAAL_EXPORT DistributedContainer<step2Master, algorithmFPType, randomizedSvd, cpu> : public AnalysisContainerIface<distributed>
+{
+public:
+    /**
+     * Constructs a container for the PCA algorithm with a specified environment
+     * in the second step of the distributed processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    DistributedContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    ~DistributedContainer();
+
+    /**
+     * Computes a partial result of the PCA algorithm in the second step
+     * of the distributed processing mode
+     */
+    void compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes thel result of the PCA algorithm in the second step
+     * of the distributed processing mode
+     */
+    void finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__PCA__DISTRIBUTED"></a>
  * \brief Computes the result of the PCA algorithm
@@ -451,6 +493,128 @@ protected:
         _result = services::SharedPtr<Result>(new Result());
     }
 };
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PCA__DISTRIBUTED_STEP2MASTER_ALGORITHMFPTYPE_RANDOMIZEDSVD"></a>
+ * \brief Computes the result of the PCA randomized SVD algorithm on local nodes
+ * \n<a href="DAAL-REF-PCA-ALGORITHM">PCA algorithm description and usage models</a>
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the PCA algorithm, double or float
+ */
+template<typename algorithmFPType>
+class DAAL_EXPORT Distributed<step2Master, algorithmFPType, randomizedSvd> : public Analysis<distributed>
+{
+public:
+    /** Default constructor */
+    Distributed()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs a PCA algorithm by copying input objects and parameters of another PCA algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step2Master, algorithmFPType, randomizedSvd> &other)
+    {
+        initialize();
+        input.set(partialResults, other.input.get(partialResults));
+        parameter = other.parameter;
+    }
+
+    ~Distributed() {}
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)randomizedSvd; }
+
+    /**
+     * Registers user-allocated memory to store  partial results of the PCA algorithm
+     * \param[in] partialResult    Structure for storing partial results of the PCA algorithm
+     */
+    void setPartialResult(const services::SharedPtr<PartialResultImpl<algorithmFPType, randomizedSvd> >& partialResult)
+    {
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+    }
+
+    /**
+     * Returns structure that contains computed partial results of the PCA algorithm
+     * \return Structure that contains partial results of the PCA algorithm
+     */
+    services::SharedPtr<PartialResultImpl<algorithmFPType, randomizedSvd> > getPartialResult()
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Registers user-allocated memory to store the results of the PCA algorithm
+     * \param[in] res    Structure to store the results of the PCA algorithm
+     */
+    void setResult(const services::SharedPtr<Result>& res)
+    {
+        DAAL_CHECK(res, ErrorNullResult)
+        _result = res;
+        _res = _result.get();
+    }
+
+    /**
+     * Returns the structure that contains the results of the PCA algorithm
+     * \return Structure that contains the results of the PCA algorithm
+     */
+    services::SharedPtr<Result> getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Returns a pointer to the newly allocated PCA algorithm
+     * with a copy of input objects and parameters of this PCA algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step2Master, algorithmFPType, randomizedSvd> > clone() const
+    {
+        return services::SharedPtr<Distributed<step2Master, algorithmFPType, randomizedSvd> >(cloneImpl());
+    }
+
+    DistributedInput<randomizedSvd> input; /*!< Input object */
+    DistributedParameter<step2Master, algorithmFPType, randomizedSvd> parameter; /*!< Parameters */
+
+protected:
+    services::SharedPtr<PartialResultImpl<algorithmFPType, randomizedSvd> > _partialResult;
+    services::SharedPtr<Result> _result;
+
+    virtual Distributed<step2Master, algorithmFPType, randomizedSvd> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step2Master, algorithmFPType, randomizedSvd>(*this);
+    }
+
+    void allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result->allocate<algorithmFPType>(_pres, &parameter, randomizedSvd);
+        _res = _result.get();
+    }
+
+    void allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->allocate(&input, &parameter, randomizedSvd);
+        _pres = _partialResult.get();
+    }
+    void initializePartialResult() DAAL_C11_OVERRIDE {}
+
+    void initialize()
+    {
+        _ac = new __DAAL_ALGORITHM_CONTAINER(distributed, DistributedContainer, step2Master, algorithmFPType, randomizedSvd)(&_env);
+        _in = &input;
+        _par = &parameter;
+        _partialResult = services::SharedPtr<PartialResultImpl<algorithmFPType, randomizedSvd> >(
+                new PartialResultImpl<algorithmFPType, randomizedSvd>());
+        _result = services::SharedPtr<Result>(new Result());
+    }
+};
 /** @} */
 } // namespace interface1
 using interface1::DistributedContainer;
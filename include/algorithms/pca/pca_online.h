@@ -105,6 +105,33 @@ public:
     void finalizeCompute() DAAL_C11_OVERRIDE;
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PCA__ONLINECONTAINER_ALGORITHMFPTYPE_RANDOMIZEDSVD_CPU"></a>
+ * \brief Class containing methods to compute the results of the PCA algorithm
+ */
+template<typename algorithmFPType, CpuType cpu>
+class DAAL_EXPORT OnlineContainer<algorithmFPType, randomizedSvd, cpu> : public AnalysisContainerIface<online>
+{
+public:
+    /**
+     * Constructs a container for the PCA algorithm with a specified environment
+     * in the online processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    OnlineContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    ~OnlineContainer();
+
+    /**
+     * Computes a partial result of the PCA algorithm in the online processing mode
+     */
+    void compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes the result of the PCA algorithm in the online processing mode
+     */
+    void finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__PCA__ONLINE"></a>
  * \brief Computes the results of the PCA algorithm
@@ -370,6 +397,134 @@ protected:
         _result = services::SharedPtr<Result>(new Result());
     }
 };
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PCA__ONLINE_ALGORITHMFPTYPE_RANDOMIZEDSVD"></a>
+ * \brief Computes the results of the PCA randomized SVD algorithm
+ * \n<a href="DAAL-REF-PCA-ALGORITHM">PCA algorithm description and usage models</a>
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the PCA algorithm, double or float
+ */
+template<typename algorithmFPType>
+class DAAL_EXPORT Online<algorithmFPType, randomizedSvd> : public Analysis<online>
+{
+public:
+    /** Default constructor */
+    Online()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs a PCA algorithm by copying input objects and parameters of another PCA algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Online(const Online<algorithmFPType, randomizedSvd> &other)
+    {
+        initialize();
+        input.set(data, other.input.get(data));
+        parameter = other.parameter;
+    }
+
+    ~Online() {}
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    int getMethod() const DAAL_C11_OVERRIDE { return(int)randomizedSvd; }
+
+    /**
+     * Registers user-allocated  memory to store the results of the PCA algorithm
+     * \param[in] partialResult    Structure for storing partial result of the PCA algorithm
+     */
+    void setPartialResult(const services::SharedPtr<PartialResultImpl<algorithmFPType, randomizedSvd> >& partialResult)
+    {
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+    }
+
+    /**
+     * Registers user-allocated memory to store the results of the PCA algorithm
+     * \param[in] res    Structure to store the results of the PCA algorithm
+     */
+    void setResult(const services::SharedPtr<Result>& res)
+    {
+        DAAL_CHECK(res, ErrorNullResult)
+        _result = res;
+        _res = _result.get();
+    }
+
+    /**
+     * Returns the structure that contains partial results of the PCA algorithm
+     * \return Structure that contains partial results of the PCA algorithm
+     */
+    services::SharedPtr<PartialResultImpl<algorithmFPType, randomizedSvd> > getPartialResult()
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Returns structure that contains the results of the PCA algorithm
+     * \return Structure that contains the results of the PCA algorithm
+     */
+    services::SharedPtr<Result> getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Returns a pointer to the newly allocated PCA algorithm
+     * with a copy of input objects and parameters of this PCA algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Online<algorithmFPType, randomizedSvd> > clone() const
+    {
+        return services::SharedPtr<Online<algorithmFPType, randomizedSvd> >(cloneImpl());
+    }
+
+    Input input; /*!< Input data structure */
+    OnlineParameter<algorithmFPType, randomizedSvd> parameter; /*!< Parameters */
+
+protected:
+    services::SharedPtr<PartialResultImpl<algorithmFPType, randomizedSvd> > _partialResult;
+    services::SharedPtr<Result> _result;
+
+    virtual Online<algorithmFPType, randomizedSvd> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Online<algorithmFPType, randomizedSvd>(*this);
+    }
+
+    void allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result->allocate<algorithmFPType>(_pres, &parameter, randomizedSvd);
+        _res = _result.get();
+    }
+
+    void allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->allocate(&input, &parameter, randomizedSvd);
+        _pres = _partialResult.get();
+    }
+
+    void initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::SharedPtr<PartialResult<randomizedSvd> > pres
+        = services::staticPointerCast<PartialResult<randomizedSvd>, PartialResultImpl<algorithmFPType, randomizedSvd> >(_partialResult);
+        (*parameter.initializationProcedure)(input, pres);
+    }
+
+    void initialize()
+    {
+        _ac  = new __DAAL_ALGORITHM_CONTAINER(online, OnlineContainer, algorithmFPType, randomizedSvd)(&_env);
+        _in = &input;
+        _par = &parameter;
+        _partialResult = services::SharedPtr<PartialResultImpl<algorithmFPType, randomizedSvd> >(
+                new PartialResultImpl<algorithmFPType, randomizedSvd>());
+        _result = services::SharedPtr<Result>(new Result());
+    }
+};
 /** @} */
 } // namespace interface1
 using interface1::OnlineContainer;
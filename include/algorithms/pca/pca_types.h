@@ -55,7 +55,9 @@ enum Method
 {
     correlationDense = 0, /*!< PCA Correlation method */
     defaultDense = 0, /*!< PCA Default method */
-    svdDense = 1 /*!< PCA SVD method */
+    svdDense = 1, /*!< PCA SVD method */
+    randomizedSvd = 2 /*!< PCA randomized SVD method that computes nComponents principal components
+                           using the Gaussian sketch of the range of the normalized data set */
 };
 
 /**
@@ -410,6 +412,21 @@ public:
     void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
 };
 
+/**
+ * <a name="DAAL-CLASS-PCA__PARTIALRESULT_RANDOMIZEDSVD"></a>
+ * \brief Provides methods to access partial results obtained with the compute() method of PCA randomized SVD algorithm
+ *         in the online or distributed processing mode. The auxiliary data collection contains the random sketches
+ *         of the processed blocks of the data set
+ */
+template<> class DAAL_EXPORT PartialResult<randomizedSvd> : public PartialResult<svdDense>
+{
+public:
+    DECLARE_SERIALIZABLE();
+    PartialResult();
+
+    virtual ~PartialResult() {};
+};
+
 /**
  * <a name="DAAL-CLASS-PCA__PARTIALRESULTIMPL"></a>
  * \brief Provides methods to allocate partial results obtained with the compute() method of the PCA SVD algorithm
@@ -429,6 +446,25 @@ public:
     void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
 };
 
+/**
+ * <a name="DAAL-CLASS-PCA__PARTIALRESULTIMPL_RANDOMIZEDSVD"></a>
+ * \brief Provides methods to allocate partial results obtained with the compute() method of the PCA randomized SVD algorithm
+ *         in the online or distributed processing mode
+ */
+template<typename algorithmFPType> class DAAL_EXPORT PartialResultImpl<algorithmFPType, randomizedSvd> : public PartialResult<randomizedSvd>
+{
+public:
+    PartialResultImpl<algorithmFPType, randomizedSvd>() {};
+
+    /**
+     * Allocates memory for storing partial results of the PCA randomized SVD algorithm
+     * \param[in] input     Pointer to an object containing input data
+     * \param[in] parameter Pointer to the structure of algorithm parameters
+     * \param[in] method    Computation method
+     */
+    void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+};
+
 /**
  * <a name="DAAL-STRUCT-ALGORITHMS__PCA__PARTIALRESULTSINITIFACE"></a>
  * \brief Abstract interface class for partial results initialization
@@ -507,6 +543,23 @@ template<> struct DAAL_EXPORT DefaultPartialResultsInit<svdDense> : public Parti
     void operator()(const Input &input, services::SharedPtr<PartialResult<svdDense> > &pres);
 };
 
+/**
+ * <a name="DAAL-CLASS-CLASS-PCA__DEFAULTPARTIALRESULTSINIT_RANDOMIZEDSVD"></a>
+ * \brief Class that specifies the default method for partial results initialization of the PCA randomized SVD algorithm
+ */
+template<> struct DAAL_EXPORT DefaultPartialResultsInit<randomizedSvd> : public PartialResultsInitIface<randomizedSvd>
+{
+    virtual ~DefaultPartialResultsInit() {}
+
+    /**
+     * Initialize partial results
+     * \param[in]       input     Input objects for the PCA algorithm
+     * \param[in,out]   pres      Partial results of the PCA algorithm
+     * \return                    Initialized partial results
+     */
+    void operator()(const Input &input, services::SharedPtr<PartialResult<randomizedSvd> > &pres);
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__PCA__BASEPARAMETER"></a>
  * \brief Class that specifies the common parameters of the PCA algorithm
@@ -521,6 +574,52 @@ public:
     services::SharedPtr<PartialResultsInitIface<method> > initializationProcedure; /**< Functor for partial results initialization */
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PCA__RANDOMIZEDSVDPARAMETER"></a>
+ * \brief Class that specifies the parameters of the randomized SVD method of the PCA algorithm
+ */
+class DAAL_EXPORT RandomizedSvdParameter : public daal::algorithms::Parameter
+{
+public:
+    /**
+     * Constructs parameters of the randomized SVD method
+     * \param[in] nComponents       Number of principal components to compute
+     * \param[in] nOversamples      Number of additional columns of the random sketch
+     * \param[in] nPowerIterations  Number of power iterations that refine the sketch
+     * \param[in] seed              Seed for the generation of the random sketch
+     */
+    RandomizedSvdParameter(size_t nComponents = 10, size_t nOversamples = 10, size_t nPowerIterations = 2, size_t seed = 777);
+
+    size_t nComponents;         /*!< Number of principal components to compute */
+    size_t nOversamples;        /*!< Number of additional columns of the random sketch */
+    size_t nPowerIterations;    /*!< Number of power iterations that refine the sketch */
+    size_t seed;                /*!< Seed for the generation of the random sketch */
+
+    /**
+    * Checks parameters of the randomized SVD method
+    */
+    void check() const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PCA__BASEPARAMETER_ALGORITHMFPTYPE_RANDOMIZEDSVD"></a>
+ * \brief Class that specifies the common parameters of the PCA randomized SVD algorithm
+ */
+template<typename algorithmFPType>
+class DAAL_EXPORT BaseParameter<algorithmFPType, randomizedSvd> : public RandomizedSvdParameter
+{
+public:
+    /** Constructs PCA parameters */
+    BaseParameter();
+
+    services::SharedPtr<PartialResultsInitIface<randomizedSvd> > initializationProcedure; /**< Functor for partial results initialization */
+
+    /**
+    * Checks parameters of the PCA randomized SVD algorithm
+    */
+    void check() const DAAL_C11_OVERRIDE;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__PCA__BATCHPARAMETER"></a>
  * \brief Class that specifies the parameters of the PCA algorithm in the batch computing mode
@@ -739,6 +838,23 @@ public:
     size_t getNFeatures() const DAAL_C11_OVERRIDE;
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PCA__DISTRIBUTEDINPUT_RANDOMIZEDSVD"></a>
+ * \brief Input objects of the PCA randomized SVD algorithm in the distributed processing mode
+ */
+template<> class DAAL_EXPORT DistributedInput<randomizedSvd> : public DistributedInput<svdDense>
+{
+public:
+    DistributedInput();
+
+    /**
+    * Checks the input of the PCA algorithm
+    * \param[in] parameter Algorithm %parameter
+    * \param[in] method    Computation  method
+    */
+    void check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__PCA__RESULT"></a>
  * \brief Provides methods to access results obtained with the PCA algorithm
@@ -800,7 +916,7 @@ public:
 
 protected:
 
-    void checkImpl(size_t nFeatures) const;
+    void checkImpl(size_t nFeatures, size_t nComponents = 0) const;
     /** \private */
     template<typename Archive, bool onDeserialize>
     void serialImpl(Archive *arch)
@@ -823,6 +939,7 @@ using interface1::PartialResult;
 using interface1::PartialResultImpl;
 using interface1::PartialResultsInitIface;
 using interface1::DefaultPartialResultsInit;
+using interface1::RandomizedSvdParameter;
 using interface1::BatchParameter;
 using interface1::OnlineParameter;
 using interface1::DistributedParameter;
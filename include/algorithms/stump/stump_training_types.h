@@ -55,7 +55,12 @@ namespace training
  */
 enum Method
 {
-    defaultDense = 0        /*!< Default method */
+    defaultDense = 0,       /*!< Default method */
+    binned       = 1        /*!< Method that quantizes the features into at most 256 bins and searches for the split
+                                 over the histograms of the bins. The bins are computed once for the input data table
+                                 and reused by the next calls of compute() of the same algorithm object with the same
+                                 table. Boosting algorithms train a copy of the weak learner in each training call,
+                                 so the bins are not shared between the boosting training calls */
 };
 
 /**
@@ -48,7 +48,10 @@ namespace svd
  */
 enum Method
 {
-    defaultDense    = 0 /*!< Default method */
+    defaultDense    = 0, /*!< Default method */
+    randomizedDense = 1  /*!< Randomized method that computes nComponents largest singular values and vectors
+                              using the Gaussian sketch of the range of the input data set.
+                              Supported in the batch processing mode only */
 };
 
 /**
@@ -158,13 +161,23 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
      *  Default constructor
      *  \param[in] _leftSingularMatrix  Format of the matrix of left singular vectors
      *  \param[in] _rightSingularMatrix Format of the matrix of right singular vectors
+     *  \param[in] _nComponents         Number of singular values and vectors computed by the randomized method
+     *  \param[in] _nOversamples        Number of additional columns of the random sketch of the randomized method
+     *  \param[in] _nPowerIterations    Number of power iterations of the randomized method
+     *  \param[in] _seed                Seed for the generation of the random sketch of the randomized method
      */
     Parameter(SVDResultFormat _leftSingularMatrix  = requiredInPackedForm,
-              SVDResultFormat _rightSingularMatrix = requiredInPackedForm) :
-        leftSingularMatrix(_leftSingularMatrix), rightSingularMatrix(_rightSingularMatrix) {}
+              SVDResultFormat _rightSingularMatrix = requiredInPackedForm,
+              size_t _nComponents = 10, size_t _nOversamples = 10, size_t _nPowerIterations = 2, size_t _seed = 777) :
+        leftSingularMatrix(_leftSingularMatrix), rightSingularMatrix(_rightSingularMatrix),
+        nComponents(_nComponents), nOversamples(_nOversamples), nPowerIterations(_nPowerIterations), seed(_seed) {}
 
     SVDResultFormat leftSingularMatrix;  /*!< Format of the matrix of left singular vectors  >*/
     SVDResultFormat rightSingularMatrix; /*!< Format of the matrix of right singular vectors >*/
+    size_t nComponents;                  /*!< Number of singular values and vectors computed by the randomized method */
+    size_t nOversamples;                 /*!< Number of additional columns of the random sketch of the randomized method */
+    size_t nPowerIterations;             /*!< Number of power iterations of the randomized method */
+    size_t seed;                         /*!< Seed for the generation of the random sketch of the randomized method */
 };
 
 /**
@@ -56,6 +56,27 @@ enum Method
     defaultDense = 0    /*!< Default method */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__SVM__TRAINING__RESULTNUMERICTABLEID"></a>
+ * Available identifiers of the numeric table results of the SVM training algorithm
+ */
+enum ResultNumericTableId
+{
+    cacheStatistics = classifier::training::model + 1 /*!< Numeric table of size 1 x 2 that contains the number of hits and
+                                                           the number of misses of the cache of kernel function values,
+                                                           both measured in kernel function values */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__SVM__TRAINING__CACHESTATISTICSID"></a>
+ * Identifiers of the columns of the cacheStatistics numeric table
+ */
+enum CacheStatisticsId
+{
+    cacheHits   = 0,    /*!< Number of requested kernel function values that were read from the cache */
+    cacheMisses = 1     /*!< Number of kernel function values that were computed to serve the requests */
+};
+
 /**
  * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
  */
@@ -81,6 +102,22 @@ public:
      */
     services::SharedPtr<daal::algorithms::svm::Model> get(classifier::training::ResultId id) const;
 
+    /**
+     * Returns the numeric table result of the SVM training algorithm
+     * \param[in] id    Identifier of the result, \ref ResultNumericTableId
+     * \return          Numeric table that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(ResultNumericTableId id) const;
+
+    /**
+     * Sets the numeric table result of the SVM training algorithm
+     * \param[in] id    Identifier of the result, \ref ResultNumericTableId
+     * \param[in] value Pointer to the numeric table
+     */
+    void set(ResultNumericTableId id, const data_management::NumericTablePtr &value);
+
+    using classifier::training::Result::set;
+
     /**
      * Allocates memory for storing SVM training results
      * \param[in] input     Pointer to input structure
@@ -98,6 +135,11 @@ protected:
     void serialImpl(Archive *arch)
     {
         daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+        /* Archives written before cacheStatistics was added contain the model only */
+        if (onDeserialize)
+        {
+            while (size() < cacheStatistics + 1) { *this << data_management::SerializationIfacePtr(); }
+        }
     }
 
     void serializeImpl(data_management::InputDataArchive  *arch) DAAL_C11_OVERRIDE
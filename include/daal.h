@@ -19,6 +19,8 @@
 
 #include "services/daal_defines.h"
 #include "services/daal_memory.h"
+#include "services/daal_memory_allocator.h"
+#include "services/daal_trace.h"
 #include "services/base.h"
 #include "services/env_detect.h"
 #include "services/library_version_info.h"
@@ -51,6 +53,7 @@
 #include "data_management/data/matrix.h"
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/soa_numeric_table.h"
+#include "data_management/data/mapped_numeric_table.h"
 #include "data_management/data/symmetric_matrix.h"
 #include "algorithms/classifier/classifier_training_types.h"
 #include "algorithms/classifier/classifier_training_batch.h"
@@ -128,6 +131,8 @@
 #include "algorithms/svm/svm_quality_metric_set_types.h"
 #include "algorithms/em/em_gmm.h"
 #include "algorithms/em/em_gmm_types.h"
+#include "algorithms/em/em_gmm_online.h"
+#include "algorithms/em/em_gmm_distributed.h"
 #include "algorithms/em/em_gmm_init_batch.h"
 #include "algorithms/em/em_gmm_init_types.h"
 #include "algorithms/outlier_detection/outlier_detection_multivariate_types.h"
@@ -35,6 +35,8 @@
 
 #include "services/daal_defines.h"
 #include "services/daal_memory.h"
+#include "services/daal_memory_allocator.h"
+#include "services/daal_trace.h"
 #include "services/base.h"
 #include "services/env_detect.h"
 #include "services/library_version_info.h"
@@ -67,6 +69,7 @@
 #include "data_management/data/matrix.h"
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/soa_numeric_table.h"
+#include "data_management/data/mapped_numeric_table.h"
 #include "data_management/data/symmetric_matrix.h"
 #include "algorithms/classifier/classifier_training_types.h"
 #include "algorithms/classifier/classifier_training_batch.h"
@@ -219,9 +219,225 @@ private:
 
     services::SharedPtr<services::ErrorCollection> _errors;
 };
+
+/**
+ * <a name="DAAL-CLASS-DATA_MANAGEMENT__FRAMEDCOMPRESSIONSTREAM"></a>
+ * \brief %FramedCompressionStream class splits input raw data into frames of a fixed size and compresses the frames
+ *        independently and in parallel. The compressed data starts with a versioned header and an index of the frames,
+ *        so that the frames can be decompressed in parallel or one by one with %FramedDecompressionStream.
+ *        The compressed data is produced when it is read for the first time, after that no more data can be added
+ * \n<a href="DAAL-REF-COMPRESSION">Data compression usage model</a>
+ *
+ * \par References
+ *      - \ref services::ErrorCompressionNullInputStream "Data compression error codes"
+ *      - \ref FramedDecompressionStream class
+ */
+class DAAL_EXPORT FramedCompressionStream : public Base
+{
+public:
+    /**
+     * %FramedCompressionStream constructor
+     * \param method    Compression method used for the frames
+     * \param level     Optional parameter, compression level of the zlib and bzip2 methods
+     * \param frameSize Optional parameter, size of the raw data in one frame
+     */
+    FramedCompressionStream(CompressionMethod method, CompressionLevel level = defaultLevel, size_t frameSize = 1024 * 1024);
+    virtual ~FramedCompressionStream();
+
+    /**
+     * Writes the next DataBlock to %FramedCompressionStream. Completed frames are compressed in parallel
+     * \param[in] inBlock  Pointer to the next DataBlock to be compressed
+     */
+    virtual void push_back(DataBlock *inBlock);
+
+    /**
+     * Writes the next DataBlock to %FramedCompressionStream
+     * \param[in] inBlock  Pointer to the next DataBlock to be compressed
+     */
+    virtual void operator << (DataBlock *inBlock)
+    {
+        push_back(inBlock);
+    }
+
+    /**
+     * Writes the next DataBlock to %FramedCompressionStream
+     * \param[in] inBlock  Next DataBlock to be compressed
+     */
+    virtual void operator << (DataBlock inBlock)
+    {
+        push_back(&inBlock);
+    }
+
+    /**
+     * Returns the size of the compressed data including the header and the index of the frames
+     * \return Size in bytes
+     */
+    virtual size_t getCompressedDataSize();
+
+    /**
+     * Copies the next part of the compressed data to an external array
+     * \param[out] outPtr Pointer to the array where compressed data is stored
+     * \param[in] outSize Number of bytes available in external memory
+     * \return Size of copied data in bytes
+     */
+    virtual size_t copyCompressedArray(byte *outPtr, size_t outSize);
+
+    /**
+     * Copies the next part of the compressed data to an external DataBlock
+     * \param[out] outBlock Reference to the DataBlock where compressed data is stored
+     * \return Size of copied data in bytes
+     */
+    virtual size_t copyCompressedArray(DataBlock &outBlock)
+    {
+        return copyCompressedArray(outBlock.getPtr(), outBlock.getSize());
+    }
+
+    /**
+     * Returns the number of the frames in the compressed data
+     * \return Number of the frames
+     */
+    virtual size_t getNumberOfFrames();
+
+    services::SharedPtr<services::ErrorCollection> getErrors()
+    {
+        return _errors;
+    }
+
+private:
+    void *_frames;
+
+    CompressionMethod _method;
+    CompressionLevel _level;
+    size_t _frameSize;
+    size_t _nCompressedFrames;
+    size_t _readOffset;
+    bool _isFinalized;
+    byte *_header;
+    size_t _headerSize;
+
+    void compressFrames();
+    void finalize();
+
+    services::SharedPtr<services::ErrorCollection> _errors;
+};
+
+/**
+ * <a name="DAAL-CLASS-DATA_MANAGEMENT__FRAMEDDECOMPRESSIONSTREAM"></a>
+ * \brief %FramedDecompressionStream class decompresses data produced by %FramedCompressionStream.
+ *        The frames are decompressed in parallel directly to the output array, a single frame can be decompressed
+ *        without decompressing the others. Compressed data without the framed stream header, such as data produced
+ *        by %CompressionStream, is decompressed serially with the optional decompressor passed to the constructor
+ * \n<a href="DAAL-REF-COMPRESSION">Data compression usage model</a>
+ *
+ * \par References
+ *      - \ref services::ErrorCompressionNullInputStream "Data compression error codes"
+ *      - \ref FramedCompressionStream class
+ */
+class DAAL_EXPORT FramedDecompressionStream : public Base
+{
+public:
+    /**
+     * %FramedDecompressionStream constructor
+     * \param legacyDecompr Optional parameter, pointer to the Decompressor used for the data without the framed stream header
+     * \param minSize       Optional parameter, minimal size of internal data blocks used for the data without the framed stream header
+     */
+    FramedDecompressionStream(DecompressorImpl *legacyDecompr = NULL, size_t minSize = 1024 * 64);
+    virtual ~FramedDecompressionStream();
+
+    /**
+     * Writes the next part of the compressed data to %FramedDecompressionStream
+     * \param[in] inBlock  Pointer to the next DataBlock to be decompressed
+     */
+    virtual void push_back(DataBlock *inBlock);
+
+    /**
+     * Writes the next part of the compressed data to %FramedDecompressionStream
+     * \param[in] inBlock  Pointer to the next DataBlock to be decompressed
+     */
+    virtual void operator << (DataBlock *inBlock)
+    {
+        push_back(inBlock);
+    }
+
+    /**
+     * Writes the next part of the compressed data to %FramedDecompressionStream
+     * \param[in] inBlock  Next DataBlock to be decompressed
+     */
+    virtual void operator << (DataBlock inBlock)
+    {
+        push_back(&inBlock);
+    }
+
+    /**
+     * Returns the size of the decompressed data
+     * \return Size in bytes
+     */
+    virtual size_t getDecompressedDataSize();
+
+    /**
+     * Decompresses the next part of the data to an external array
+     * \param[out] outPtr Pointer to the array where decompressed data is stored
+     * \param[in] outSize Number of bytes available in external memory
+     * \return Size of copied data in bytes
+     */
+    virtual size_t copyDecompressedArray(byte *outPtr, size_t outSize);
+
+    /**
+     * Decompresses the next part of the data to an external DataBlock
+     * \param[out] outBlock Reference to the DataBlock where decompressed data is stored
+     * \return Size of copied data in bytes
+     */
+    virtual size_t copyDecompressedArray(DataBlock &outBlock)
+    {
+        return copyDecompressedArray(outBlock.getPtr(), outBlock.getSize());
+    }
+
+    /**
+     * Returns the number of the frames in the compressed data, 0 for the data without the framed stream header
+     * \return Number of the frames
+     */
+    virtual size_t getNumberOfFrames();
+
+    /**
+     * Returns the size of the decompressed frame
+     * \param[in] frame Index of the frame
+     * \return Size in bytes
+     */
+    virtual size_t getFrameSize(size_t frame);
+
+    /**
+     * Decompresses one frame to an external array. Does not change the position of copyDecompressedArray
+     * \param[in]  frame   Index of the frame
+     * \param[out] outPtr  Pointer to the array where decompressed frame is stored
+     * \param[in]  outSize Number of bytes available in external memory, at least getFrameSize(frame)
+     * \return Size of the decompressed frame in bytes
+     */
+    virtual size_t decompressFrame(size_t frame, byte *outPtr, size_t outSize);
+
+    services::SharedPtr<services::ErrorCollection> getErrors()
+    {
+        return _errors;
+    }
+
+private:
+    void *_data;
+
+    DecompressorImpl *_legacyDecompressor;
+    DecompressionStream *_legacyStream;
+    size_t _minBlockSize;
+    size_t _readOffset;
+    bool _isParsed;
+
+    bool parse();
+    void decompressFrames(size_t firstFrame, size_t lastFrame, size_t offset, byte *outPtr, size_t outSize);
+
+    services::SharedPtr<services::ErrorCollection> _errors;
+};
 } // namespace interface1
 using interface1::CompressionStream;
 using interface1::DecompressionStream;
+using interface1::FramedCompressionStream;
+using interface1::FramedDecompressionStream;
 /** @} */
 
 } //namespace data_management
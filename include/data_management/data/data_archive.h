@@ -230,6 +230,29 @@ public:
         blockOffset[currentWriteBlock] += size;
     }
 
+    /**
+     *  Constructor of a data archive from the serialized data of another archive
+     */
+    DataArchive( const DataArchiveIface &arch ) : _errors(new services::ErrorCollection()), minBlocksNum(16), minBlockSize(1024 * 16)
+    {
+        blockPtr           = 0;
+        blockAllocatedSize = 0;
+        blockOffset        = 0;
+        arraysSize         = 0;
+        currentWriteBlock  = -1;
+
+        currentReadBlock   = 0;
+        currentReadBlockOffset = 0;
+
+        serializedBuffer   = 0;
+
+        size_t size = arch.getSizeOfArchive();
+        addBlock( size );
+        arch.copyArchiveToArray( blockPtr[currentWriteBlock], size );
+
+        blockOffset[currentWriteBlock] += size;
+    }
+
     /**
      *  Constructor of a data archive from data in a byte array
      *  \param[in]  ptr  Pointer to the array that represents the data
@@ -634,6 +657,124 @@ private:
     services::SharedPtr<services::ErrorCollection> _errors;
 };
 
+/**
+ *  <a name="DAAL-ENUM-DATA_MANAGEMENT__DATAARCHIVEMODE"></a>
+ *  \brief Modes of storing the serialized data in a data archive
+ */
+enum DataArchiveMode
+{
+    copyArchiveData      = 0,   /*!< The data is copied into the memory of the archive */
+    referenceArchiveData = 1    /*!< Large arrays are referenced by the archive without copying */
+};
+
+/**
+ *  <a name="DAAL-STRUCT-DATA_MANAGEMENT__DATAARCHIVESEGMENT"></a>
+ *  \brief Contiguous part of the serialized data. The layout matches the layout of struct iovec
+ */
+struct DataArchiveSegment
+{
+    byte  *ptr;     /*!< Pointer to the data of the segment */
+    size_t size;    /*!< Size of the segment in bytes */
+};
+
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__SCATTERGATHERDATAARCHIVE"></a>
+ *  \brief Implements the abstract DataArchiveIface interface as a sequence of segments.
+ *  Arrays of size not less than the threshold are stored as references to the memory of the serialized objects,
+ *  the other data is copied into the blocks owned by the archive.
+ *  The referenced memory must stay valid and unchanged until the archive is exported or destroyed
+ */
+class DAAL_EXPORT ScatterGatherDataArchive : public DataArchiveImpl
+{
+public:
+    /**
+     *  Constructor of an empty data archive
+     *  \param[in]  minReferenceSize  Minimal size in bytes of the array stored as a reference
+     */
+    ScatterGatherDataArchive(size_t minReferenceSize = 1024 * 4);
+
+    /**
+     *  Constructor of a data archive that reads the data from a byte array without copying.
+     *  The array must stay valid and unchanged until the data is read
+     *  \param[in]  ptr  Pointer to the array that represents the data
+     *  \param[in]  size Size of the data array
+     */
+    ScatterGatherDataArchive(byte *ptr, size_t size);
+
+    ~ScatterGatherDataArchive();
+
+    void write(byte *ptr, size_t size) DAAL_C11_OVERRIDE;
+
+    void read(byte *ptr, size_t size) DAAL_C11_OVERRIDE;
+
+    size_t getSizeOfArchive() const DAAL_C11_OVERRIDE;
+
+    byte *getArchiveAsArray() DAAL_C11_OVERRIDE;
+
+    std::string getArchiveAsString() DAAL_C11_OVERRIDE
+    {
+        size_t length =        getSizeOfArchive();
+        char  *buffer = (char *)getArchiveAsArray();
+
+        return std::string( buffer, length );
+    }
+
+    size_t copyArchiveToArray( byte *ptr, size_t maxLength ) const DAAL_C11_OVERRIDE;
+
+    /**
+     *  Returns the number of segments of the archive
+     *  \return Number of segments
+     */
+    size_t getNumberOfSegments() const;
+
+    /**
+     *  Returns the segments of the archive in the order of the serialized data
+     *  \return Pointer to the array of getNumberOfSegments() segments
+     */
+    const DataArchiveSegment *getSegments() const;
+
+    /**
+     *  Writes the segments to the file descriptor with the gathering output of the operating system
+     *  \param[in]  fd          File descriptor
+     *  \param[in]  segments    Pointer to the array of segments
+     *  \param[in]  nSegments   Number of segments
+     *  \return Number of bytes written, less than the total size of the segments if an error occurred
+     */
+    static size_t writeSegments(int fd, const DataArchiveSegment *segments, size_t nSegments);
+
+    /**
+     * Returns errors during the computation
+     * \return Errors during the computation
+     */
+    services::SharedPtr<services::ErrorCollection> getErrors()
+    {
+        return _errors;
+    }
+
+private:
+    ScatterGatherDataArchive(const ScatterGatherDataArchive &);
+    ScatterGatherDataArchive &operator=(const ScatterGatherDataArchive &);
+
+    void addSegment(byte *ptr, size_t size);
+    void copyData(const byte *ptr, size_t size);
+    size_t alignValueUp(size_t value) const;
+
+    services::Collection<DataArchiveSegment> _segments;
+    services::Collection<byte *> _blocks;
+    size_t _blockAllocatedSize;     /* Size of the last block owned by the archive */
+    size_t _blockOffset;            /* Size of the data in the last block owned by the archive */
+    size_t _minBlockSize;
+    size_t _minReferenceSize;
+    size_t _size;
+
+    size_t _currentReadSegment;         /* Index of the segment that contains the next byte to read */
+    size_t _currentReadSegmentOffset;   /* Offset of the next byte to read in the segment */
+    size_t _readOffset;                 /* Offset of the next byte to read in the archive */
+
+    byte  *_serializedBuffer;
+    services::SharedPtr<services::ErrorCollection> _errors;
+};
+
 /**
  *  <a name="DAAL-CLASS-DATA_MANAGEMENT__INPUTDATAARCHIVE"></a>
  *  \brief Provides methods to create an archive data object (serialized) and access this object
@@ -644,7 +785,7 @@ public:
     /**
      *  Default constructor
      */
-    InputDataArchive() : _finalized(false), _errors(new services::ErrorCollection())
+    InputDataArchive() : _finalized(false), _errors(new services::ErrorCollection()), _flatArch(0)
     {
         _arch = new DataArchive;
         archiveHeader();
@@ -654,14 +795,34 @@ public:
      *  Constructor of an input data archive to a byte array of compressed data
      */
     InputDataArchive(daal::data_management::CompressorImpl *compressor) : _finalized(false),
-        _errors(new services::ErrorCollection())
+        _errors(new services::ErrorCollection()), _flatArch(0)
     {
         _arch = new CompressedDataArchive(compressor);
         archiveHeader();
     }
 
+    /**
+     *  Constructor of an input data archive with the specified mode of storing the data
+     *  \param[in]  mode              Mode of storing the serialized data
+     *  \param[in]  minReferenceSize  Minimal size in bytes of the array referenced by the archive in the referenceArchiveData mode
+     */
+    InputDataArchive(DataArchiveMode mode, size_t minReferenceSize = 1024 * 4) : _finalized(false),
+        _errors(new services::ErrorCollection()), _flatArch(0)
+    {
+        if(mode == referenceArchiveData)
+        {
+            _arch = new ScatterGatherDataArchive(minReferenceSize);
+        }
+        else
+        {
+            _arch = new DataArchive;
+        }
+        archiveHeader();
+    }
+
     ~InputDataArchive()
     {
+        delete _flatArch;
         delete _arch;
     }
 
@@ -840,12 +1001,93 @@ public:
     }
 
     /**
-     *  Returns a data archive object of the InputDataArchive type
+     *  Returns the number of contiguous segments of the serialized data.
+     *  The data of the archive created in the copyArchiveData mode is one segment
+     *  \return Number of segments
+     */
+    size_t getNumberOfSegments()
+    {
+        if(!_finalized) { archiveFooter(); }
+
+        ScatterGatherDataArchive *sgArch = dynamic_cast<ScatterGatherDataArchive *>(_arch);
+        if(sgArch) { return sgArch->getNumberOfSegments(); }
+        return (_arch->getSizeOfArchive() ? 1 : 0);
+    }
+
+    /**
+     *  Returns the contiguous segments of the serialized data without copying the data referenced by the archive
+     *  \param[out]  segments   Pointer to the array of segments. The array is valid until the archive is modified or destroyed
+     *  \param[out]  nSegments  Number of segments
+     */
+    void getSegments( const DataArchiveSegment **segments, size_t *nSegments )
+    {
+        if(!_finalized) { archiveFooter(); }
+
+        ScatterGatherDataArchive *sgArch = dynamic_cast<ScatterGatherDataArchive *>(_arch);
+        if(sgArch)
+        {
+            *segments  = sgArch->getSegments();
+            *nSegments = sgArch->getNumberOfSegments();
+            return;
+        }
+        _segment.size = _arch->getSizeOfArchive();
+        _segment.ptr  = _arch->getArchiveAsArray();
+        *segments  = &_segment;
+        *nSegments = (_segment.ptr ? 1 : 0);
+    }
+
+    /**
+     *  Writes the serialized data to the file descriptor, such as a file or a socket,
+     *  with the gathering output of the operating system and without copying the data referenced by the archive
+     *  \param[in]  fd  File descriptor
+     *  \return Number of bytes written
+     */
+    size_t writeToFileDescriptor( int fd )
+    {
+        const DataArchiveSegment *segments = 0;
+        size_t nSegments = 0;
+        getSegments(&segments, &nSegments);
+
+        size_t size = ScatterGatherDataArchive::writeSegments(fd, segments, nSegments);
+        if(size != _arch->getSizeOfArchive())
+        {
+            this->_errors->add(services::ErrorOnFileWrite);
+        }
+        return size;
+    }
+
+    /**
+     *  Returns a data archive object of the InputDataArchive type.
+     *  If the data is not stored in a DataArchive, for example in the referenceArchiveData mode,
+     *  the returned archive is a contiguous copy of the data. The copy is made again
+     *  if the data was added after the previous call, which invalidates the previously returned archive
      *  \return Data archive object
      */
     const DataArchive &getDataArchive()
     {
-        return *static_cast<DataArchive *>(_arch);
+        DataArchive *arch = dynamic_cast<DataArchive *>(_arch);
+        if(arch)
+        {
+            return *arch;
+        }
+        if(!_flatArch || _flatArch->getSizeOfArchive() != _arch->getSizeOfArchive())
+        {
+            delete _flatArch;
+            _flatArch = new DataArchive(*_arch);
+            _flatArch->setMajorVersion (_arch->getMajorVersion());
+            _flatArch->setMinorVersion (_arch->getMinorVersion());
+            _flatArch->setUpdateVersion(_arch->getUpdateVersion());
+        }
+        return *_flatArch;
+    }
+
+    /**
+     *  Returns the data archive of the InputDataArchive object regardless of its mode
+     *  \return Data archive object
+     */
+    const DataArchiveIface &getArchive()
+    {
+        return *_arch;
     }
 
     /**
@@ -861,6 +1103,8 @@ protected:
     DataArchiveIface *_arch;
     bool        _finalized;
     services::SharedPtr<services::ErrorCollection> _errors;
+    DataArchiveSegment _segment;
+    DataArchive *_flatArch;
 };
 
 /**
@@ -875,7 +1119,7 @@ public:
      */
     OutputDataArchive( InputDataArchive &arch ) : _errors(new services::ErrorCollection())
     {
-        _arch = new DataArchive(arch.getDataArchive());
+        _arch = new DataArchive(arch.getArchive());
         archiveHeader();
     }
 
@@ -888,6 +1132,24 @@ public:
         archiveHeader();
     }
 
+    /**
+     *  Constructor of an output data archive from a byte array with the specified mode of storing the data.
+     *  In the referenceArchiveData mode the data is read from the array without copying it into the archive,
+     *  so the array must stay valid and unchanged until the deserialization is completed
+     */
+    OutputDataArchive( byte *ptr, size_t size, DataArchiveMode mode ) : _errors(new services::ErrorCollection())
+    {
+        if(mode == referenceArchiveData)
+        {
+            _arch = new ScatterGatherDataArchive(ptr, size);
+        }
+        else
+        {
+            _arch = new DataArchive(ptr, size);
+        }
+        archiveHeader();
+    }
+
     /**
      *  Constructor of an output data archive from a byte array of compressed data
      */
@@ -1116,6 +1378,11 @@ using interface1::DataArchiveIface;
 using interface1::DataArchive;
 using interface1::CompressedDataArchive;
 using interface1::DecompressedDataArchive;
+using interface1::DataArchiveMode;
+using interface1::copyArchiveData;
+using interface1::referenceArchiveData;
+using interface1::DataArchiveSegment;
+using interface1::ScatterGatherDataArchive;
 using interface1::InputDataArchive;
 using interface1::OutputDataArchive;
 
@@ -0,0 +1,688 @@
+/* file: mapped_numeric_table.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of numeric tables stored in the binary file format
+//  and accessed through the memory mapping of the file.
+//--
+*/
+
+#ifndef __MAPPED_NUMERIC_TABLE_H__
+#define __MAPPED_NUMERIC_TABLE_H__
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "services/daal_defines.h"
+#include "services/daal_memory.h"
+#include "services/error_handling.h"
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/soa_numeric_table.h"
+#include "data_management/data/csr_numeric_table.h"
+
+namespace daal
+{
+namespace data_management
+{
+
+namespace interface1
+{
+/**
+ * @ingroup numeric_tables
+ * @{
+ */
+/**
+ * <a name="DAAL-ENUM-DATA_MANAGEMENT__BINARYNUMERICTABLELAYOUT"></a>
+ * \brief Layouts of the data of a numeric table stored in the binary file
+ */
+enum BinaryNumericTableLayout
+{
+    binaryRowMajor = 0,     /*!< Feature vectors are stored contiguously, row after row */
+    binarySOA      = 1,     /*!< Values of each feature are stored in a separate contiguous array */
+    binaryCSR      = 2      /*!< Values are stored in the CSR format with one-based indices */
+};
+
+/**
+ * <a name="DAAL-STRUCT-DATA_MANAGEMENT__BINARYNUMERICTABLEHEADER"></a>
+ * \brief Header of the binary file that stores a numeric table.
+ *        The header is followed by nColumns descriptions of features (BinaryNumericTableFeature)
+ *        and by the data sections. Each data section starts at the offset aligned to
+ *        BinaryNumericTableHeader::alignment bytes. All the fields are stored in the native byte order
+ */
+struct BinaryNumericTableHeader
+{
+    static const size_t alignment = 64;     /*!< Alignment of the data sections in the file, in bytes */
+    static const DAAL_UINT64 currentVersion = 1;
+
+    char        magic[8];                   /*!< Signature of the file, "DAALNTB" */
+    DAAL_UINT64 version;                    /*!< Version of the file format */
+    DAAL_UINT64 layout;                     /*!< Layout of the data, BinaryNumericTableLayout */
+    DAAL_UINT64 nRows;                      /*!< Number of rows in the table */
+    DAAL_UINT64 nColumns;                   /*!< Number of columns in the table */
+    DAAL_UINT64 nNonZeros;                  /*!< Number of non-zero values in the CSR layout */
+    DAAL_UINT64 indexSize;                  /*!< Size of the CSR column indices and row offsets, in bytes */
+    DAAL_UINT64 valuesOffset;               /*!< Offset of the values in the row-major and CSR layouts */
+    DAAL_UINT64 columnIndicesOffset;        /*!< Offset of the column indices in the CSR layout */
+    DAAL_UINT64 rowOffsetsOffset;           /*!< Offset of the row offsets in the CSR layout */
+
+    /** \private */
+    static const char *signature() { return "DAALNTB"; }
+};
+
+/**
+ * <a name="DAAL-STRUCT-DATA_MANAGEMENT__BINARYNUMERICTABLEFEATURE"></a>
+ * \brief Description of a feature of the numeric table stored in the binary file
+ */
+struct BinaryNumericTableFeature
+{
+    DAAL_UINT64 indexType;                  /*!< Type of the stored values, data_feature_utils::IndexNumType */
+    DAAL_UINT64 featureType;                /*!< Type of the feature, data_feature_utils::FeatureType */
+    DAAL_UINT64 categoryNumber;             /*!< Number of categories of the categorical feature */
+    DAAL_UINT64 offset;                     /*!< Offset of the feature values in the SOA layout */
+};
+
+/**
+ * <a name="DAAL-CLASS-DATA_MANAGEMENT__MAPPEDFILE"></a>
+ * \brief Read-only file mapped into the memory. The mapping is private:
+ *        modifications of the mapped memory are not written back to the file
+ */
+class DAAL_EXPORT MappedFile
+{
+public:
+    /**
+     * Maps the file into the memory
+     * \param[in] fileName  Name of the file
+     */
+    MappedFile(const std::string &fileName);
+
+    ~MappedFile();
+
+    /**
+     * Returns the pointer to the beginning of the mapped file
+     * \return Pointer to the mapped memory, 0 if the file is not mapped
+     */
+    char *getPtr() const { return _ptr; }
+
+    /**
+     * Returns the size of the mapped file
+     * \return Size of the mapped file in bytes
+     */
+    size_t getSize() const { return _size; }
+
+private:
+    MappedFile(const MappedFile &);
+    MappedFile &operator=(const MappedFile &);
+
+    char  *_ptr;
+    size_t _size;
+    void  *_file;       /*!< Handle of the file, used on Windows* only */
+    void  *_mapping;    /*!< Handle of the file mapping, used on Windows* only */
+};
+
+/**
+ * <a name="DAAL-CLASS-DATA_MANAGEMENT__MAPPEDHOMOGENNUMERICTABLE"></a>
+ * \brief Homogeneous numeric table that refers to the row-major data of the mapped binary file.
+ *        Blocks of rows requested in DataType are returned as pointers into the mapping
+ *  \tparam DataType Type of the values stored in the file
+ */
+template<typename DataType>
+class MappedHomogenNumericTable : public HomogenNumericTable<DataType>
+{
+public:
+    /**
+     * Constructs the numeric table over the mapped file
+     * \param[in] file      Mapped file that stores the data
+     * \param[in] ptr       Pointer to the values inside the mapped file
+     * \param[in] nColumns  Number of columns in the table
+     * \param[in] nRows     Number of rows in the table
+     */
+    MappedHomogenNumericTable(const services::SharedPtr<MappedFile> &file, DataType *ptr, size_t nColumns, size_t nRows) :
+        HomogenNumericTable<DataType>(ptr, nColumns, nRows), _file(file) {}
+
+protected:
+    services::SharedPtr<MappedFile> _file;
+};
+
+/**
+ * <a name="DAAL-CLASS-DATA_MANAGEMENT__MAPPEDSOANUMERICTABLE"></a>
+ * \brief Structure-of-arrays numeric table that refers to the feature arrays of the mapped binary file.
+ *        Column values requested in the stored type are returned as pointers into the mapping
+ */
+class MappedSOANumericTable : public SOANumericTable
+{
+public:
+    /**
+     * Constructs the numeric table over the mapped file
+     * \param[in] file      Mapped file that stores the data
+     * \param[in] features  Descriptions of the features stored in the file
+     * \param[in] nColumns  Number of columns in the table
+     * \param[in] nRows     Number of rows in the table
+     */
+    MappedSOANumericTable(const services::SharedPtr<MappedFile> &file, const BinaryNumericTableFeature *features,
+                          size_t nColumns, size_t nRows) :
+        SOANumericTable(nColumns, nRows), _file(file)
+    {
+        if (this->_errors->size() != 0) { return; }
+
+        char *base = file->getPtr();
+        for (size_t j = 0; j < nColumns; j++)
+        {
+            NumericTableFeature &f = (*_ddict)[j];
+            f.indexType      = (data_feature_utils::IndexNumType)features[j].indexType;
+            f.typeSize       = (f.indexType == data_feature_utils::DAAL_FLOAT64 ? sizeof(double) :
+                                f.indexType == data_feature_utils::DAAL_FLOAT32 ? sizeof(float) : sizeof(int));
+            f.featureType    = (data_feature_utils::FeatureType)features[j].featureType;
+            f.categoryNumber = (size_t)features[j].categoryNumber;
+
+            _arrays[j] = (void *)(base + features[j].offset);
+        }
+        _memStatus = userAllocated;
+    }
+
+protected:
+    services::SharedPtr<MappedFile> _file;
+};
+
+/**
+ * <a name="DAAL-CLASS-DATA_MANAGEMENT__MAPPEDCSRNUMERICTABLE"></a>
+ * \brief CSR numeric table that refers to the values and indices of the mapped binary file
+ */
+class MappedCSRNumericTable : public CSRNumericTable
+{
+public:
+    /**
+     * Constructs the numeric table over the mapped file
+     * \tparam DataType         Type of the values stored in the file
+     * \param[in] file          Mapped file that stores the data
+     * \param[in] ptr           Pointer to the values inside the mapped file
+     * \param[in] colIndices    Pointer to the one-based column indices inside the mapped file
+     * \param[in] rowOffsets    Pointer to the one-based row offsets inside the mapped file
+     * \param[in] nColumns      Number of columns in the corresponding dense table
+     * \param[in] nRows         Number of rows in the corresponding dense table
+     */
+    template<typename DataType>
+    MappedCSRNumericTable(const services::SharedPtr<MappedFile> &file, DataType *ptr, size_t *colIndices, size_t *rowOffsets,
+                          size_t nColumns, size_t nRows) :
+        CSRNumericTable(ptr, colIndices, rowOffsets, nColumns, nRows), _file(file) {}
+
+protected:
+    services::SharedPtr<MappedFile> _file;
+};
+
+/**
+ * <a name="DAAL-CLASS-DATA_MANAGEMENT__BINARYNUMERICTABLEREADER"></a>
+ * \brief Maps the binary file written by BinaryNumericTableWriter into the memory
+ *        and creates the numeric table that accesses the data without copying
+ */
+class BinaryNumericTableReader
+{
+public:
+    /**
+     * Constructs the reader
+     * \param[in] fileName  Name of the binary file
+     */
+    BinaryNumericTableReader(const std::string &fileName) : _fileName(fileName), _errors(new services::ErrorCollection()) {}
+
+    /**
+     * Maps the file and creates the numeric table over the mapping.
+     * The returned table keeps the file mapped for its lifetime
+     * \return Numeric table that refers to the data of the file, empty pointer on error
+     */
+    NumericTablePtr getNumericTable()
+    {
+        services::SharedPtr<MappedFile> file(new MappedFile(_fileName));
+        if (file->getPtr() == 0)
+        {
+            _errors->add(services::ErrorOnFileOpen);
+            return NumericTablePtr();
+        }
+
+        const size_t fileSize = file->getSize();
+        char *base = file->getPtr();
+
+        if (fileSize < sizeof(BinaryNumericTableHeader)) { return formatError(); }
+
+        const BinaryNumericTableHeader *header = (const BinaryNumericTableHeader *)base;
+        if (strncmp(header->magic, BinaryNumericTableHeader::signature(), sizeof(header->magic)) != 0 ||
+            header->version != BinaryNumericTableHeader::currentVersion)
+        {
+            return formatError();
+        }
+
+        const size_t nRows    = (size_t)header->nRows;
+        const size_t nColumns = (size_t)header->nColumns;
+        if (header->nColumns > (fileSize - sizeof(BinaryNumericTableHeader)) / sizeof(BinaryNumericTableFeature))
+        {
+            return formatError();
+        }
+
+        const BinaryNumericTableFeature *features = (const BinaryNumericTableFeature *)(base + sizeof(BinaryNumericTableHeader));
+        for (size_t j = 0; j < nColumns; j++)
+        {
+            if (!isStoredType(features[j].indexType)) { return formatError(); }
+        }
+
+        if (header->layout == binaryRowMajor)
+        {
+            DAAL_UINT64 nValues;
+            if (nColumns == 0 || !haveSameType(features, nColumns) || !multiply(header->nRows, header->nColumns, nValues) ||
+                !fits(header->valuesOffset, nValues, typeSize(features[0].indexType), fileSize))
+            {
+                return formatError();
+            }
+            char *values = base + header->valuesOffset;
+            switch (features[0].indexType)
+            {
+            case data_feature_utils::DAAL_FLOAT64: return createHomogen<double>(file, features, values, nColumns, nRows);
+            case data_feature_utils::DAAL_FLOAT32: return createHomogen<float>(file, features, values, nColumns, nRows);
+            default:                               return createHomogen<int>(file, features, values, nColumns, nRows);
+            }
+        }
+        else if (header->layout == binarySOA)
+        {
+            for (size_t j = 0; j < nColumns; j++)
+            {
+                if (!fits(features[j].offset, header->nRows, typeSize(features[j].indexType), fileSize)) { return formatError(); }
+            }
+            return NumericTablePtr(new MappedSOANumericTable(file, features, nColumns, nRows));
+        }
+        else if (header->layout == binaryCSR)
+        {
+            if (nColumns == 0 || !haveSameType(features, nColumns) || header->indexSize != sizeof(size_t) || header->nRows == maxUInt64 ||
+                header->columnIndicesOffset % sizeof(size_t) != 0 || header->rowOffsetsOffset % sizeof(size_t) != 0 ||
+                !fits(header->valuesOffset, header->nNonZeros, typeSize(features[0].indexType), fileSize) ||
+                !fits(header->columnIndicesOffset, header->nNonZeros, sizeof(size_t), fileSize) ||
+                !fits(header->rowOffsetsOffset, header->nRows + 1, sizeof(size_t), fileSize))
+            {
+                return formatError();
+            }
+            char *values = base + header->valuesOffset;
+            size_t *colIndices = (size_t *)(base + header->columnIndicesOffset);
+            size_t *rowOffsets = (size_t *)(base + header->rowOffsetsOffset);
+            if (!isValidCSR(colIndices, rowOffsets, nColumns, nRows, header->nNonZeros)) { return formatError(); }
+            switch (features[0].indexType)
+            {
+            case data_feature_utils::DAAL_FLOAT64:
+                return NumericTablePtr(new MappedCSRNumericTable(file, (double *)values, colIndices, rowOffsets, nColumns, nRows));
+            case data_feature_utils::DAAL_FLOAT32:
+                return NumericTablePtr(new MappedCSRNumericTable(file, (float *)values, colIndices, rowOffsets, nColumns, nRows));
+            default:
+                return NumericTablePtr(new MappedCSRNumericTable(file, (int *)values, colIndices, rowOffsets, nColumns, nRows));
+            }
+        }
+        return formatError();
+    }
+
+    /**
+     * Returns errors that occurred while reading the file
+     * \return Collection of errors
+     */
+    services::SharedPtr<services::ErrorCollection> getErrors() { return _errors; }
+
+    /** \private */
+    static bool isStoredType(DAAL_UINT64 indexType)
+    {
+        return indexType == data_feature_utils::DAAL_FLOAT64 || indexType == data_feature_utils::DAAL_FLOAT32 ||
+               indexType == data_feature_utils::DAAL_INT32_S;
+    }
+
+    /** \private */
+    static size_t typeSize(DAAL_UINT64 indexType)
+    {
+        return (indexType == data_feature_utils::DAAL_FLOAT64 ? sizeof(double) :
+                indexType == data_feature_utils::DAAL_FLOAT32 ? sizeof(float) : sizeof(int));
+    }
+
+protected:
+    NumericTablePtr formatError()
+    {
+        _errors->add(services::ErrorIncorrectFileFormat);
+        return NumericTablePtr();
+    }
+
+    static const DAAL_UINT64 maxUInt64 = ~(DAAL_UINT64)0;
+
+    /* Computes the product of the sizes read from the file, returns false on overflow */
+    static bool multiply(DAAL_UINT64 a, DAAL_UINT64 b, DAAL_UINT64 &product)
+    {
+        if (a != 0 && b > maxUInt64 / a) { return false; }
+        product = a * b;
+        return true;
+    }
+
+    /* Checks that the array of nElements elements of elementSize bytes at the offset lies inside the file */
+    static bool fits(DAAL_UINT64 offset, DAAL_UINT64 nElements, DAAL_UINT64 elementSize, size_t fileSize)
+    {
+        DAAL_UINT64 size;
+        return multiply(nElements, elementSize, size) && offset <= fileSize && size <= fileSize - offset;
+    }
+
+    /* Checks that all features are stored with the same type, as in the row-major and CSR layouts */
+    static bool haveSameType(const BinaryNumericTableFeature *features, size_t nColumns)
+    {
+        for (size_t j = 1; j < nColumns; j++)
+        {
+            if (features[j].indexType != features[0].indexType) { return false; }
+        }
+        return true;
+    }
+
+    /* Checks that the one-based row offsets start at 1, do not decrease, and end after the last non-zero value,
+       and that the one-based column indices are in the range [1, nColumns] */
+    static bool isValidCSR(const size_t *colIndices, const size_t *rowOffsets, size_t nColumns, size_t nRows, DAAL_UINT64 nNonZeros)
+    {
+        if (rowOffsets[0] != 1 || (DAAL_UINT64)rowOffsets[nRows] != nNonZeros + 1) { return false; }
+        for (size_t i = 0; i < nRows; i++)
+        {
+            if (rowOffsets[i + 1] < rowOffsets[i]) { return false; }
+        }
+        for (size_t k = 0; k < (size_t)nNonZeros; k++)
+        {
+            if (colIndices[k] < 1 || colIndices[k] > nColumns) { return false; }
+        }
+        return true;
+    }
+
+    template<typename DataType>
+    NumericTablePtr createHomogen(const services::SharedPtr<MappedFile> &file, const BinaryNumericTableFeature *features,
+                                  char *values, size_t nColumns, size_t nRows)
+    {
+        MappedHomogenNumericTable<DataType> *table =
+            new MappedHomogenNumericTable<DataType>(file, (DataType *)values, nColumns, nRows);
+        NumericTableDictionary *ddict = table->getDictionary();
+        for (size_t j = 0; j < nColumns; j++)
+        {
+            NumericTableFeature &f = (*ddict)[j];
+            f.featureType    = (data_feature_utils::FeatureType)features[j].featureType;
+            f.categoryNumber = (size_t)features[j].categoryNumber;
+        }
+        return NumericTablePtr(table);
+    }
+
+    std::string _fileName;
+    services::SharedPtr<services::ErrorCollection> _errors;
+};
+
+/**
+ * <a name="DAAL-CLASS-DATA_MANAGEMENT__BINARYNUMERICTABLEWRITER"></a>
+ * \brief Writes a numeric table into the binary file that can be mapped by BinaryNumericTableReader.
+ *        CSR tables are stored in the CSR layout, tables with the SOA layout or with features
+ *        of different types are stored in the SOA layout, other tables are stored row-major.
+ *        Values of the types other than float, double, and int are stored as double
+ */
+class BinaryNumericTableWriter
+{
+public:
+    BinaryNumericTableWriter() : _errors(new services::ErrorCollection()) {}
+
+    /**
+     * Writes the numeric table into the file
+     * \param[in] table     Numeric table to write
+     * \param[in] fileName  Name of the file
+     */
+    void write(NumericTable &table, const std::string &fileName)
+    {
+        const size_t nColumns = table.getNumberOfColumns();
+        const size_t nRows    = table.getNumberOfRows();
+        NumericTableDictionary *ddict = table.getDictionary();
+        if (ddict == 0 || ddict->getNumberOfFeatures() != nColumns)
+        {
+            _errors->add(services::ErrorIncorrectNumberOfFeatures);
+            return;
+        }
+
+        CSRNumericTableIface *csrTable = NULL;
+        if (table.getDataLayout() & NumericTableIface::csrArray)
+        {
+            csrTable = dynamic_cast<CSRNumericTableIface *>(&table);
+        }
+
+        BinaryNumericTableHeader header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, BinaryNumericTableHeader::signature(), strlen(BinaryNumericTableHeader::signature()) + 1);
+        header.version   = BinaryNumericTableHeader::currentVersion;
+        header.nRows     = nRows;
+        header.nColumns  = nColumns;
+        header.indexSize = sizeof(size_t);
+
+        BinaryNumericTableFeature *features =
+            (BinaryNumericTableFeature *)daal::services::daal_malloc(sizeof(BinaryNumericTableFeature) * (nColumns ? nColumns : 1));
+        if (!features) { _errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+        bool equalTypes = true;
+        for (size_t j = 0; j < nColumns; j++)
+        {
+            NumericTableFeature &f = (*ddict)[j];
+            features[j].indexType      = storedType(f.indexType);
+            features[j].featureType    = f.featureType;
+            features[j].categoryNumber = f.categoryNumber;
+            features[j].offset         = 0;
+            equalTypes = equalTypes && (features[j].indexType == features[0].indexType);
+        }
+
+        DAAL_UINT64 offset = alignOffset(sizeof(BinaryNumericTableHeader) + sizeof(BinaryNumericTableFeature) * nColumns);
+        if (csrTable)
+        {
+            /* All the features of the CSR table share the same type */
+            for (size_t j = 1; j < nColumns; j++) { features[j].indexType = features[0].indexType; }
+            header.layout    = binaryCSR;
+            header.nNonZeros = csrTable->getDataSize();
+            header.valuesOffset        = offset;
+            header.columnIndicesOffset = alignOffset(header.valuesOffset + header.nNonZeros * valueSize(features));
+            header.rowOffsetsOffset    = alignOffset(header.columnIndicesOffset + header.nNonZeros * sizeof(size_t));
+        }
+        else if (equalTypes && nColumns > 0 && !(table.getDataLayout() & NumericTableIface::soa))
+        {
+            header.layout       = binaryRowMajor;
+            header.valuesOffset = offset;
+        }
+        else
+        {
+            header.layout = binarySOA;
+            for (size_t j = 0; j < nColumns; j++)
+            {
+                features[j].offset = offset;
+                offset = alignOffset(offset + nRows * BinaryNumericTableReader::typeSize(features[j].indexType));
+            }
+        }
+
+        FILE *file = NULL;
+#if defined(_MSC_VER)
+        fopen_s(&file, fileName.c_str(), "wb");
+#else
+        file = fopen(fileName.c_str(), "wb");
+#endif
+        if (!file)
+        {
+            daal::services::daal_free(features);
+            _errors->add(services::ErrorOnFileOpen);
+            return;
+        }
+
+        _position = 0;
+        bool ok = writeBytes(file, &header, sizeof(header)) &&
+                  writeBytes(file, features, sizeof(BinaryNumericTableFeature) * nColumns);
+
+        if (ok)
+        {
+            if (header.layout == binaryCSR)
+            {
+                switch (features[0].indexType)
+                {
+                case data_feature_utils::DAAL_FLOAT64: ok = writeCSR<double>(file, *csrTable, header); break;
+                case data_feature_utils::DAAL_FLOAT32: ok = writeCSR<float>(file, *csrTable, header); break;
+                default:                               ok = writeCSR<int>(file, *csrTable, header); break;
+                }
+            }
+            else if (header.layout == binaryRowMajor)
+            {
+                switch (features[0].indexType)
+                {
+                case data_feature_utils::DAAL_FLOAT64: ok = writeRows<double>(file, table, header); break;
+                case data_feature_utils::DAAL_FLOAT32: ok = writeRows<float>(file, table, header); break;
+                default:                               ok = writeRows<int>(file, table, header); break;
+                }
+            }
+            else
+            {
+                for (size_t j = 0; j < nColumns && ok; j++)
+                {
+                    switch (features[j].indexType)
+                    {
+                    case data_feature_utils::DAAL_FLOAT64: ok = writeColumn<double>(file, table, j, features[j].offset); break;
+                    case data_feature_utils::DAAL_FLOAT32: ok = writeColumn<float>(file, table, j, features[j].offset); break;
+                    default:                               ok = writeColumn<int>(file, table, j, features[j].offset); break;
+                    }
+                }
+            }
+        }
+
+        if (fclose(file) != 0) { ok = false; }
+        daal::services::daal_free(features);
+
+        if (!ok) { _errors->add(services::ErrorOnFileWrite); }
+    }
+
+    /**
+     * Returns errors that occurred while writing the file
+     * \return Collection of errors
+     */
+    services::SharedPtr<services::ErrorCollection> getErrors() { return _errors; }
+
+protected:
+    static const size_t rowsInBlock = 1024;
+
+    static DAAL_UINT64 alignOffset(DAAL_UINT64 offset)
+    {
+        const DAAL_UINT64 alignment = BinaryNumericTableHeader::alignment;
+        return (offset + alignment - 1) / alignment * alignment;
+    }
+
+    static DAAL_UINT64 storedType(data_feature_utils::IndexNumType indexType)
+    {
+        return BinaryNumericTableReader::isStoredType(indexType) ? (DAAL_UINT64)indexType : (DAAL_UINT64)data_feature_utils::DAAL_FLOAT64;
+    }
+
+    static size_t valueSize(const BinaryNumericTableFeature *features)
+    {
+        return BinaryNumericTableReader::typeSize(features[0].indexType);
+    }
+
+    bool writeBytes(FILE *file, const void *ptr, size_t size)
+    {
+        if (size == 0) { return true; }
+        if (fwrite(ptr, 1, size, file) != size) { return false; }
+        _position += size;
+        return true;
+    }
+
+    /* Pads the file with zeros up to the given offset */
+    bool padTo(FILE *file, DAAL_UINT64 offset)
+    {
+        static const char zeros[BinaryNumericTableHeader::alignment] = { 0 };
+        while (_position < offset)
+        {
+            size_t size = (size_t)(offset - _position < sizeof(zeros) ? offset - _position : sizeof(zeros));
+            if (!writeBytes(file, zeros, size)) { return false; }
+        }
+        return true;
+    }
+
+    template<typename DataType>
+    bool writeRows(FILE *file, NumericTable &table, const BinaryNumericTableHeader &header)
+    {
+        if (!padTo(file, header.valuesOffset)) { return false; }
+
+        const size_t nRows    = (size_t)header.nRows;
+        const size_t nColumns = (size_t)header.nColumns;
+        for (size_t startRow = 0; startRow < nRows; startRow += rowsInBlock)
+        {
+            const size_t nRowsInBlock = (startRow + rowsInBlock < nRows ? rowsInBlock : nRows - startRow);
+            BlockDescriptor<DataType> block;
+            table.getBlockOfRows(startRow, nRowsInBlock, readOnly, block);
+            bool ok = (block.getNumberOfRows() == nRowsInBlock) &&
+                      writeBytes(file, block.getBlockPtr(), sizeof(DataType) * nColumns * nRowsInBlock);
+            table.releaseBlockOfRows(block);
+            if (!ok) { return false; }
+        }
+        return true;
+    }
+
+    template<typename DataType>
+    bool writeColumn(FILE *file, NumericTable &table, size_t feature, DAAL_UINT64 offset)
+    {
+        if (!padTo(file, offset)) { return false; }
+
+        const size_t nRows = table.getNumberOfRows();
+        if (nRows == 0) { return true; }
+
+        BlockDescriptor<DataType> block;
+        table.getBlockOfColumnValues(feature, 0, nRows, readOnly, block);
+        bool ok = (block.getNumberOfRows() == nRows) && writeBytes(file, block.getBlockPtr(), sizeof(DataType) * nRows);
+        table.releaseBlockOfColumnValues(block);
+        return ok;
+    }
+
+    template<typename DataType>
+    bool writeCSR(FILE *file, CSRNumericTableIface &table, const BinaryNumericTableHeader &header)
+    {
+        const size_t nRows     = (size_t)header.nRows;
+        const size_t nNonZeros = (size_t)header.nNonZeros;
+
+        if (nRows == 0)
+        {
+            const size_t emptyRowOffsets = 1;
+            return padTo(file, header.rowOffsetsOffset) && writeBytes(file, &emptyRowOffsets, sizeof(size_t));
+        }
+
+        CSRBlockDescriptor<DataType> block;
+        table.getSparseBlock(0, nRows, readOnly, block);
+        bool ok = (block.getNumberOfRows() == nRows) &&
+                  padTo(file, header.valuesOffset) &&
+                  writeBytes(file, block.getBlockValuesPtr(), sizeof(DataType) * nNonZeros) &&
+                  padTo(file, header.columnIndicesOffset) &&
+                  writeBytes(file, block.getBlockColumnIndicesPtr(), sizeof(size_t) * nNonZeros) &&
+                  padTo(file, header.rowOffsetsOffset) &&
+                  writeBytes(file, block.getBlockRowIndicesPtr(), sizeof(size_t) * (nRows + 1));
+        table.releaseSparseBlock(block);
+        return ok;
+    }
+
+    DAAL_UINT64 _position;
+    services::SharedPtr<services::ErrorCollection> _errors;
+};
+/** @} */
+} // namespace interface1
+using interface1::BinaryNumericTableLayout;
+using interface1::binaryRowMajor;
+using interface1::binarySOA;
+using interface1::binaryCSR;
+using interface1::BinaryNumericTableHeader;
+using interface1::BinaryNumericTableFeature;
+using interface1::MappedFile;
+using interface1::MappedHomogenNumericTable;
+using interface1::MappedSOANumericTable;
+using interface1::MappedCSRNumericTable;
+using interface1::BinaryNumericTableReader;
+using interface1::BinaryNumericTableWriter;
+
+}
+}
+#endif
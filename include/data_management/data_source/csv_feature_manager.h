@@ -187,22 +187,7 @@ public:
             }
             else
             {
-                std::string sWord(word);
-
-                CategoricalFeatureDictionary *catDict = dsFeat.getCategoricalDictionary();
-                CategoricalFeatureDictionary::iterator it = catDict->find( sWord );
-
-                if( it != catDict->end() )
-                {
-                    row[ i ] = it->second.first;
-                    it->second.second++;
-                }
-                else
-                {
-                    int index = (int)(catDict->size());
-                    catDict->insert( std::pair<std::string, std::pair<int, int> >( sWord, std::pair<int, int>(index, 1) ) );
-                    row[ i ] = index;
-                }
+                row[ i ] = getCategoryIndex( word, len, dsFeat );
             }
         }
 
@@ -211,6 +196,46 @@ public:
         nt->releaseBlockOfRows( block );
     }
 
+    virtual bool parseContinuousRowIn( const char *rawRowData, size_t rawDataSize, DataSourceDictionary *dict,
+                                       double *row ) DAAL_C11_OVERRIDE
+    {
+        size_t nFeatures = dict->getNumberOfFeatures();
+
+        size_t pos = 0;
+        for( size_t i = 0; i < nFeatures && pos < rawDataSize && rawRowData[pos] != '\0'; i++ )
+        {
+            size_t len = getFieldLength( rawRowData + pos, rawDataSize - pos );
+
+            if( (*dict)[i].ntFeature.featureType == data_feature_utils::DAAL_CONTINUOUS )
+            {
+                row[ i ] = parseNumeric( rawRowData + pos, len );
+            }
+
+            pos += len + 1;
+        }
+        return true;
+    }
+
+    virtual void parseCategoricalRowIn( const char *rawRowData, size_t rawDataSize, DataSourceDictionary *dict,
+                                        double *row ) DAAL_C11_OVERRIDE
+    {
+        size_t nFeatures = dict->getNumberOfFeatures();
+
+        size_t pos = 0;
+        for( size_t i = 0; i < nFeatures && pos < rawDataSize && rawRowData[pos] != '\0'; i++ )
+        {
+            size_t len = getFieldLength( rawRowData + pos, rawDataSize - pos );
+
+            DataSourceFeature &dsFeat = (*dict)[i];
+            if( dsFeat.ntFeature.featureType != data_feature_utils::DAAL_CONTINUOUS )
+            {
+                row[ i ] = getCategoryIndex( rawRowData + pos, len, dsFeat );
+            }
+
+            pos += len + 1;
+        }
+    }
+
 protected:
     template<class T>
     bool readNumeric(char *text, T &f)
@@ -219,6 +244,140 @@ protected:
         return true;
     }
 
+    size_t getFieldLength( const char *text, size_t size ) const
+    {
+        size_t len = 0;
+        while( len < size && text[len] != _delimiter && text[len] != '\0' ) { len++; }
+        return len;
+    }
+
+    /* Returns the index of the category and registers new categories in the order of their appearance */
+    static double getCategoryIndex( const char *word, size_t len, DataSourceFeature &dsFeat )
+    {
+        std::string sWord(word, len);
+
+        CategoricalFeatureDictionary *catDict = dsFeat.getCategoricalDictionary();
+        CategoricalFeatureDictionary::iterator it = catDict->find( sWord );
+
+        if( it != catDict->end() )
+        {
+            it->second.second++;
+            return it->second.first;
+        }
+
+        int index = (int)(catDict->size());
+        catDict->insert( std::pair<std::string, std::pair<int, int> >( sWord, std::pair<int, int>(index, 1) ) );
+        return index;
+    }
+
+    /*
+     * Converts the number at the beginning of the text of the given length. Numbers with up to 19 significant digits
+     * and decimal exponents in [-22, 22] are converted exactly without a call to strtod, other texts are passed to
+     * daal_string_to_double
+     */
+    static double parseNumeric( const char *text, size_t len )
+    {
+        static const double powersOf10[] =
+        {
+            1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+        const int maxExactPower = 22;
+        const int maxDigits = 19;
+        const DAAL_UINT64 maxExactMantissa = ((DAAL_UINT64)1) << 53;
+
+        const char *ptr = text;
+        const char *end = text + len;
+
+        while( ptr < end && (*ptr == ' ' || *ptr == '\t') ) { ptr++; }
+
+        bool isNegative = false;
+        if( ptr < end && (*ptr == '-' || *ptr == '+') )
+        {
+            isNegative = (*ptr == '-');
+            ptr++;
+        }
+
+        DAAL_UINT64 mantissa = 0;
+        int nDigits   = 0;
+        int exponent  = 0;
+        bool hasDigits = false;
+
+        for( ; ptr < end && *ptr >= '0' && *ptr <= '9'; ptr++ )
+        {
+            hasDigits = true;
+            if( mantissa == 0 && *ptr == '0' ) { continue; }
+            if( nDigits == maxDigits ) { return parseNumericSlow( text, len ); }
+            mantissa = mantissa * 10 + (*ptr - '0');
+            nDigits++;
+        }
+
+        if( ptr < end && *ptr == '.' )
+        {
+            for( ptr++; ptr < end && *ptr >= '0' && *ptr <= '9'; ptr++ )
+            {
+                hasDigits = true;
+                if( mantissa == 0 && *ptr == '0' ) { exponent--; continue; }
+                if( nDigits == maxDigits ) { return parseNumericSlow( text, len ); }
+                mantissa = mantissa * 10 + (*ptr - '0');
+                nDigits++;
+                exponent--;
+            }
+        }
+
+        if( !hasDigits ) { return parseNumericSlow( text, len ); }
+
+        if( ptr < end && (*ptr == 'e' || *ptr == 'E') )
+        {
+            const char *expPtr = ptr + 1;
+            bool isExpNegative = false;
+            if( expPtr < end && (*expPtr == '-' || *expPtr == '+') )
+            {
+                isExpNegative = (*expPtr == '-');
+                expPtr++;
+            }
+            if( expPtr < end && *expPtr >= '0' && *expPtr <= '9' )
+            {
+                int exp = 0;
+                for( ; expPtr < end && *expPtr >= '0' && *expPtr <= '9'; expPtr++ )
+                {
+                    if( exp < 100000 ) { exp = exp * 10 + (*expPtr - '0'); }
+                }
+                exponent += (isExpNegative ? -exp : exp);
+                ptr = expPtr;
+            }
+        }
+
+        /* Hexadecimal numbers are handled by strtod */
+        if( ptr < end && (*ptr == 'x' || *ptr == 'X') ) { return parseNumericSlow( text, len ); }
+
+        double value = (double)mantissa;
+        if( mantissa != 0 )
+        {
+            if( mantissa > maxExactMantissa || exponent < -maxExactPower || exponent > maxExactPower )
+            {
+                return parseNumericSlow( text, len );
+            }
+            value = (exponent < 0 ? value / powersOf10[-exponent] : value * powersOf10[exponent]);
+        }
+        return (isNegative ? -value : value);
+    }
+
+    static double parseNumericSlow( const char *text, size_t len )
+    {
+        const size_t localBufferSize = 128;
+        char localBuffer[localBufferSize];
+        char *word = (len < localBufferSize ? localBuffer : new char[len + 1]);
+
+        for( size_t i = 0; i < len; i++ ) { word[i] = text[i]; }
+        word[len] = '\0';
+
+        double value = daal::services::daal_string_to_double(word, 0);
+
+        if( word != localBuffer ) { delete[] word; }
+        return value;
+    }
+
 };
 /** @} */
 } // namespace interface1
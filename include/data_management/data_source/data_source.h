@@ -511,8 +511,14 @@ public:
     }
 
     void updateStatistics( size_t ntRowIndex, NumericTable *nt)
+    {
+        updateStatistics( ntRowIndex, 1, nt );
+    }
+
+    void updateStatistics( size_t ntRowIndex, size_t nRows, NumericTable *nt)
     {
         if( nt == NULL ) { this->_errors->add(services::ErrorNullInputNumericTable); return; }
+        if( nRows == 0 ) { return; }
 
         NumericTablePtr ntMin   = nt->basicStatistics.get(NumericTable::minimum   );
         NumericTablePtr ntMax   = nt->basicStatistics.get(NumericTable::maximum   );
@@ -543,27 +549,31 @@ public:
         size_t nCols = nt->getNumberOfColumns();
 
         BlockDescriptor<_summaryStatisticsType> block;
-        nt->getBlockOfRows( ntRowIndex, 1, readOnly, block );
+        nt->getBlockOfRows( ntRowIndex, nRows, readOnly, block );
         _summaryStatisticsType *row = block.getBlockPtr();
 
-        if( ntRowIndex != 0 )
+        size_t iStart = 0;
+        if( ntRowIndex == 0 )
         {
             for( size_t i = 0; i < nCols; i++ )
             {
-                if( minimum[i] > row[i] ) { minimum[i] = row[i]; }
-                if( maximum[i] < row[i] ) { maximum[i] = row[i]; }
-                sum[i]   += row[i];
-                sumSquares[i] += row[i] * row[i];
+                minimum[i]    = row[i];
+                maximum[i]    = row[i];
+                sum[i]        = row[i];
+                sumSquares[i] = row[i] * row[i];
             }
+            iStart = 1;
         }
-        else
+
+        for( size_t j = iStart; j < nRows; j++ )
         {
+            const _summaryStatisticsType *rowj = row + j * nCols;
             for( size_t i = 0; i < nCols; i++ )
             {
-                minimum[i]    = row[i];
-                maximum[i]    = row[i];
-                sum[i]        = row[i];
-                sumSquares[i] = row[i] * row[i];
+                if( minimum[i] > rowj[i] ) { minimum[i] = rowj[i]; }
+                if( maximum[i] < rowj[i] ) { maximum[i] = rowj[i]; }
+                sum[i]   += rowj[i];
+                sumSquares[i] += rowj[i] * rowj[i];
             }
         }
 
@@ -64,6 +64,30 @@ public:
      */
     virtual void parseRowIn ( char *rawRowData, size_t rawDataSize, DataSourceDictionary *dict, NumericTable *nt,
                               size_t  ntRowIndex  ) = 0;
+
+    /**
+     *  Parses values of continuous features from a string that represents a feature vector.
+     *  The method does not modify the dictionary, so it can be called concurrently for different strings
+     *  \param[in]  rawRowData   Array of characters with a string that represents the feature vector
+     *  \param[in]  rawDataSize  Size of the rawRowData array
+     *  \param[in]  dict         Pointer to the dictionary
+     *  \param[out] row          Array to store the values of features
+     *  \return false if the feature manager does not support parsing of continuous features separately
+     */
+    virtual bool parseContinuousRowIn( const char *rawRowData, size_t rawDataSize, DataSourceDictionary *dict, double *row )
+    {
+        return false;
+    }
+
+    /**
+     *  Parses values of categorical features from a string that represents a feature vector.
+     *  The method updates categorical dictionaries, so the strings must be parsed in the order of rows
+     *  \param[in]  rawRowData   Array of characters with a string that represents the feature vector
+     *  \param[in]  rawDataSize  Size of the rawRowData array
+     *  \param[in]  dict         Pointer to the dictionary
+     *  \param[out] row          Array to store the values of features
+     */
+    virtual void parseCategoricalRowIn( const char *rawRowData, size_t rawDataSize, DataSourceDictionary *dict, double *row ) {}
 };
 /** @} */
 } // namespace interface1
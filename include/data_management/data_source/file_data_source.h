@@ -27,6 +27,7 @@
 #include <cstdio>
 #include <cstring>
 #include "services/daal_memory.h"
+#include "services/internal/daal_threading.h"
 #include "data_management/data_source/data_source.h"
 #include "data_management/data/data_dictionary.h"
 #include "data_management/data/numeric_table.h"
@@ -116,6 +117,11 @@ public:
         _contextDictFlag      = false;
 
         _initialMaxRows = initialMaxRows;
+
+        _parallelParsing  = false;
+        _parallelChunkSize = 16 * 1024 * 1024;
+        _rowBounds         = 0;
+        _rowBoundsCapacity = 0;
     }
 
     ~FileDataSource()
@@ -126,6 +132,7 @@ public:
         }
         daal::services::daal_free( _rawLineBuffer );
         daal::services::daal_free( _fileBuffer );
+        daal::services::daal_free( _rowBounds );
         DataSourceTemplate<DefaultNumericTableType, _summaryStatisticsType>::freeNumericTable();
         if( _contextDictFlag )
         {
@@ -142,6 +149,21 @@ public:
         return featureManager;
     }
 
+    /**
+     *  Enables or disables parallel parsing of the file. In the parallel mode the file is read by large chunks,
+     *  and the rows found in a chunk are parsed concurrently directly into the rows of the Numeric Table.
+     *  Categorical features are parsed in the order of rows, so the categorical dictionaries are the same
+     *  as in the sequential mode. The feature manager must implement parseContinuousRowIn() and
+     *  parseCategoricalRowIn() methods, otherwise the rows are parsed sequentially
+     *  \param[in]  enable      Flag that specifies whether the parallel parsing is enabled
+     *  \param[in]  chunkSize   Size of the chunks of the file read at once, in bytes
+     */
+    void setParallelParsing( bool enable, size_t chunkSize = 16 * 1024 * 1024 )
+    {
+        _parallelParsing   = enable;
+        _parallelChunkSize = (chunkSize > 1024 ? chunkSize : 1024);
+    }
+
 public:
     size_t loadDataBlock(size_t maxRows) DAAL_C11_OVERRIDE
     {
@@ -167,14 +189,21 @@ public:
 
         nt->setNormalizationFlag(NumericTable::nonNormalized);
 
-        for( j = 0; j < maxRows; j++ )
+        if( _parallelParsing )
+        {
+            j = loadRowsInParallel( maxRows, nt );
+        }
+        else
         {
-            readLine();
-            if (_rawLineLength == 0) { break; }
-            if(this->_errors->size() != 0) { break; }
-            featureManager.parseRowIn( _rawLineBuffer, _rawLineLength, _dict, nt, j );
+            for( j = 0; j < maxRows; j++ )
+            {
+                readLine();
+                if (_rawLineLength == 0) { break; }
+                if(this->_errors->size() != 0) { break; }
+                featureManager.parseRowIn( _rawLineBuffer, _rawLineLength, _dict, nt, j );
 
-            DataSourceTemplate<DefaultNumericTableType, _summaryStatisticsType>::updateStatistics( j, nt );
+                DataSourceTemplate<DefaultNumericTableType, _summaryStatisticsType>::updateStatistics( j, nt );
+            }
         }
 
         nt->setNumberOfRows( j );
@@ -310,6 +339,240 @@ public:
     }
 
 protected:
+    static const size_t rowsInParsingTask = 256;
+
+    /* Parses a range of rows found in the file buffer into the block of rows of a Numeric Table */
+    struct ParseRowsTask
+    {
+        FeatureManager       *featureManager;
+        DataSourceDictionary *dict;
+        const char           *buffer;
+        const size_t         *rowBounds;
+        size_t                nRows;
+        size_t                nCols;
+        double               *rows;
+
+        void operator()( int iTask ) const
+        {
+            size_t iStart = (size_t)iTask * rowsInParsingTask;
+            size_t iEnd   = iStart + rowsInParsingTask;
+            if( iEnd > nRows ) { iEnd = nRows; }
+
+            for( size_t i = iStart; i < iEnd; i++ )
+            {
+                featureManager->parseContinuousRowIn( buffer + rowBounds[2 * i], rowBounds[2 * i + 1], dict, rows + i * nCols );
+            }
+        }
+    };
+
+    /*
+     * Reads up to maxRows rows in three stages: reads a large chunk of the file into the file buffer,
+     * finds the boundaries of the complete rows in the chunk, and parses the rows concurrently.
+     * Like the sequential reading, stops after an empty line
+     */
+    size_t loadRowsInParallel( size_t maxRows, NumericTable *nt )
+    {
+        if( !_file ) { return 0; }
+
+        size_t dataEnd = getFileBufferDataEnd();
+
+        size_t nRows = 0;
+        bool isEmptyLineFound = false;
+        while( nRows < maxRows && !isEmptyLineFound )
+        {
+            char *buffer = _fileBuffer;
+            size_t pos = _fileBufferPos;
+            size_t nBatchRows = 0;
+
+            while( nRows + nBatchRows < maxRows )
+            {
+                size_t rowEnd, nextPos;
+                char *newLine = (char *)memchr( buffer + pos, '\n', dataEnd - pos );
+                if( newLine )
+                {
+                    rowEnd  = (size_t)(newLine - buffer);
+                    nextPos = rowEnd + 1;
+                }
+                else if( pos < dataEnd && feof(_file) )
+                {
+                    rowEnd  = dataEnd;
+                    nextPos = dataEnd;
+                }
+                else
+                {
+                    break;
+                }
+
+                size_t rowBegin = pos;
+                pos = nextPos;
+
+                while( rowEnd > rowBegin && buffer[rowEnd - 1] == '\r' ) { rowEnd--; }
+                if( rowEnd == rowBegin )
+                {
+                    isEmptyLineFound = true;
+                    break;
+                }
+                buffer[rowEnd] = '\0';
+
+                if( !addRowBounds( nBatchRows, rowBegin, rowEnd - rowBegin ) ) { return nRows; }
+                nBatchRows++;
+            }
+            _fileBufferPos = pos;
+
+            if( nBatchRows > 0 )
+            {
+                parseRows( nt, nRows, nBatchRows );
+                if( this->_errors->size() != 0 ) { break; }
+                nRows += nBatchRows;
+            }
+
+            if( isEmptyLineFound || nRows == maxRows ) { break; }
+
+            if( !readChunk( dataEnd ) && _fileBufferPos == dataEnd ) { break; }
+            if( this->_errors->size() != 0 ) { break; }
+        }
+
+        return nRows;
+    }
+
+    void parseRows( NumericTable *nt, size_t startRow, size_t nRows )
+    {
+        size_t nCols = nt->getNumberOfColumns();
+
+        BlockDescriptor<double> block;
+        nt->getBlockOfRows( startRow, nRows, writeOnly, block );
+        double *rows = block.getBlockPtr();
+        if( rows == 0 || block.getNumberOfRows() < nRows )
+        {
+            nt->releaseBlockOfRows( block );
+            this->_errors->add(services::ErrorIncorrectNumberOfObservations);
+            return;
+        }
+
+        if( !featureManager.parseContinuousRowIn( _fileBuffer + _rowBounds[0], _rowBounds[1], _dict, rows ) )
+        {
+            nt->releaseBlockOfRows( block );
+            for( size_t i = 0; i < nRows; i++ )
+            {
+                featureManager.parseRowIn( _fileBuffer + _rowBounds[2 * i], _rowBounds[2 * i + 1], _dict, nt, startRow + i );
+            }
+            DataSourceTemplate<DefaultNumericTableType, _summaryStatisticsType>::updateStatistics( startRow, nRows, nt );
+            return;
+        }
+
+        ParseRowsTask task;
+        task.featureManager = &featureManager;
+        task.dict           = _dict;
+        task.buffer         = _fileBuffer;
+        task.rowBounds      = _rowBounds + 2;
+        task.nRows          = nRows - 1;
+        task.nCols          = nCols;
+        task.rows           = rows + nCols;
+
+        size_t nTasks = (task.nRows + rowsInParsingTask - 1) / rowsInParsingTask;
+        if( nTasks > 0 )
+        {
+            daal::threader_for( (int)nTasks, (int)nTasks, task );
+        }
+
+        bool hasCategoricalFeatures = false;
+        size_t nFeatures = _dict->getNumberOfFeatures();
+        for( size_t i = 0; i < nFeatures; i++ )
+        {
+            if( (*_dict)[i].ntFeature.featureType != data_feature_utils::DAAL_CONTINUOUS ) { hasCategoricalFeatures = true; }
+        }
+
+        if( hasCategoricalFeatures )
+        {
+            for( size_t i = 0; i < nRows; i++ )
+            {
+                featureManager.parseCategoricalRowIn( _fileBuffer + _rowBounds[2 * i], _rowBounds[2 * i + 1], _dict, rows + i * nCols );
+            }
+        }
+
+        nt->releaseBlockOfRows( block );
+
+        DataSourceTemplate<DefaultNumericTableType, _summaryStatisticsType>::updateStatistics( startRow, nRows, nt );
+    }
+
+    bool addRowBounds( size_t idx, size_t rowBegin, size_t rowLength )
+    {
+        if( idx == _rowBoundsCapacity )
+        {
+            size_t newCapacity = (_rowBoundsCapacity ? 2 * _rowBoundsCapacity : 1024);
+            size_t *newRowBounds = (size_t *)daal::services::daal_malloc( 2 * newCapacity * sizeof(size_t) );
+            if( newRowBounds == 0 )
+            {
+                this->_errors->add(services::ErrorMemoryAllocationFailed);
+                return false;
+            }
+            if( _rowBounds )
+            {
+                daal::services::daal_memcpy_s( newRowBounds, 2 * newCapacity * sizeof(size_t), _rowBounds, 2 * _rowBoundsCapacity * sizeof(size_t) );
+                daal::services::daal_free( _rowBounds );
+            }
+            _rowBounds = newRowBounds;
+            _rowBoundsCapacity = newCapacity;
+        }
+        _rowBounds[2 * idx]     = rowBegin;
+        _rowBounds[2 * idx + 1] = rowLength;
+        return true;
+    }
+
+    /* Returns the end of the data that is read into the file buffer and is not parsed yet */
+    size_t getFileBufferDataEnd()
+    {
+        if( _fileBufferPos >= _fileBufferLen ) { return _fileBufferPos; }
+        char *dataEnd = (char *)memchr( _fileBuffer + _fileBufferPos, '\0', _fileBufferLen - _fileBufferPos );
+        return (dataEnd ? (size_t)(dataEnd - _fileBuffer) : _fileBufferLen);
+    }
+
+    /*
+     * Moves the data that is not parsed yet to the beginning of the file buffer and appends the next chunk of the file.
+     * The buffer is enlarged up to the chunk size, and twice when the unparsed row occupies more than a half of it
+     */
+    bool readChunk( size_t &dataEnd )
+    {
+        size_t nLeft = dataEnd - _fileBufferPos;
+
+        size_t bufferLen = _fileBufferLen;
+        if( bufferLen < _parallelChunkSize ) { bufferLen = _parallelChunkSize; }
+        while( 2 * nLeft >= bufferLen ) { bufferLen *= 2; }
+
+        if( bufferLen != _fileBufferLen )
+        {
+            char *newFileBuffer = (char *)daal::services::daal_malloc( bufferLen );
+            if( newFileBuffer == 0 )
+            {
+                this->_errors->add(services::ErrorMemoryAllocationFailed);
+                return false;
+            }
+            if( nLeft > 0 )
+            {
+                daal::services::daal_memcpy_s( newFileBuffer, bufferLen, _fileBuffer + _fileBufferPos, nLeft );
+            }
+            daal::services::daal_free( _fileBuffer );
+            _fileBuffer    = newFileBuffer;
+            _fileBufferLen = bufferLen;
+        }
+        else if( nLeft > 0 )
+        {
+            memmove( _fileBuffer, _fileBuffer + _fileBufferPos, nLeft );
+        }
+        _fileBufferPos = 0;
+
+        size_t readLen = fread( _fileBuffer + nLeft, 1, bufferLen - nLeft - 1, _file );
+        if( ferror(_file) )
+        {
+            this->_errors->add(services::ErrorOnFileRead);
+            readLen = 0;
+        }
+        dataEnd = nLeft + readLen;
+        _fileBuffer[dataEnd] = '\0';
+
+        return readLen > 0;
+    }
+
     void enlargeBuffer()
     {
         int newRawLineBufferLen = _rawLineBufferLen * 2;
@@ -353,8 +616,8 @@ protected:
             {
                 if (iseof ()) break;
                 _fileBufferPos = 0;
-                int readLen;
-                readLen = (int)fread(_fileBuffer, 1, _fileBufferLen, _file);
+                size_t readLen;
+                readLen = fread(_fileBuffer, 1, _fileBufferLen, _file);
                 if (readLen < _fileBufferLen)
                 {
                     _fileBuffer[readLen] = '\0';
@@ -406,10 +669,15 @@ protected:
     int   _rawLineLength;
 
     char *_fileBuffer;
-    int   _fileBufferLen;
-    int   _fileBufferPos;
+    size_t _fileBufferLen;
+    size_t _fileBufferPos;
 
     bool _contextDictFlag;
+
+    bool    _parallelParsing;
+    size_t  _parallelChunkSize;
+    size_t *_rowBounds;
+    size_t  _rowBoundsCapacity;
 };
 /** @} */
 } // namespace interface1
@@ -154,6 +154,7 @@ const int SERIALIZATION_LINEAR_REGRESSION_GROUP_OF_BETAS_RESULT_ID
 const int SERIALIZATION_PCA_RESULT_ID                                                          = 100200;
 const int SERIALIZATION_PCA_PARTIAL_RESULT_CORRELATION_ID                                      = 100210;
 const int SERIALIZATION_PCA_PARTIAL_RESULT_SVD_ID                                              = 100220;
+const int SERIALIZATION_PCA_PARTIAL_RESULT_RANDOMIZED_SVD_ID                                   = 100230;
 
 const int SERIALIZATION_STUMP_MODEL_ID                                                         = 100300;
 const int SERIALIZATION_STUMP_TRAINING_RESULT_ID                                               = 100310;
@@ -220,6 +221,7 @@ const int SERIALIZATION_COSINE_DISTANCE_RESULT_ID
 
 const int SERIALIZATION_EM_GMM_INIT_RESULT_ID                                                  = 102000;
 const int SERIALIZATION_EM_GMM_RESULT_ID                                                       = 102010;
+const int SERIALIZATION_EM_GMM_PARTIAL_RESULT_ID                                               = 102020;
 
 const int SERIALIZATION_KERNEL_FUNCTION_RESULT_ID                                              = 102100;
 
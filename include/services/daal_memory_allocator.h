@@ -0,0 +1,274 @@
+/* file: daal_memory_allocator.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the memory allocators used by daal_malloc and daal_free.
+//--
+*/
+
+#ifndef __DAAL_MEMORY_ALLOCATOR_H__
+#define __DAAL_MEMORY_ALLOCATOR_H__
+
+#include "services/daal_defines.h"
+#include "services/daal_memory.h"
+#include "services/daal_shared_ptr.h"
+
+namespace daal
+{
+namespace services
+{
+
+namespace interface1
+{
+/**
+ * @ingroup memory
+ * @{
+ */
+/**
+ * <a name="DAAL-STRUCT-SERVICES__MEMORYALLOCATORSTATISTICS"></a>
+ * \brief Statistics of the memory allocations made with daal_malloc through the allocator
+ */
+struct MemoryAllocatorStatistics
+{
+    size_t bytesLive;               /*!< Number of bytes in the blocks that are allocated and not deallocated yet */
+    size_t peakBytesLive;           /*!< Estimate of the maximal number of bytes in the live blocks: the counters are kept
+                                         per thread, and the peaks reached in different threads are summed */
+    size_t nAllocations;            /*!< Number of allocations */
+    size_t nDeallocations;          /*!< Number of deallocations */
+};
+
+/** \private */
+class MemoryAllocatorCounters;
+
+/**
+ * <a name="DAAL-CLASS-SERVICES__MEMORYALLOCATOR"></a>
+ * \brief Base class for the memory allocators used by daal_malloc and daal_free.
+ *        The block is always deallocated by the allocator that allocated it.
+ *        The library keeps a reference to the allocator installed by setDefaultMemoryAllocator(),
+ *        Algorithm::setMemoryAllocator(), or ScopedMemoryAllocator until all its blocks are deallocated,
+ *        even if the allocator is replaced before that
+ */
+class DAAL_EXPORT MemoryAllocator
+{
+public:
+    MemoryAllocator();
+
+    virtual ~MemoryAllocator();
+
+    /**
+     * Allocates an aligned block of memory
+     * \param[in] size      Size of the block of memory in bytes
+     * \param[in] alignment Alignment constraint. Must be a power of two
+     * \return Pointer to the beginning of a newly allocated block of memory, 0 if allocation failed
+     */
+    virtual void *allocate(size_t size, size_t alignment) = 0;
+
+    /**
+     * Deallocates the block previously allocated by this allocator
+     * \param[in] ptr       Pointer to the beginning of the block
+     * \param[in] size      Size of the block passed to allocate()
+     * \param[in] alignment Alignment of the block passed to allocate()
+     */
+    virtual void deallocate(void *ptr, size_t size, size_t alignment) = 0;
+
+    /**
+     * Called on exit from the scope in which the allocator is installed by ScopedMemoryAllocator
+     */
+    virtual void endScope() {}
+
+    /**
+     * Returns statistics of the allocations made through the allocator.
+     * Allocations made while no allocator is installed are not counted
+     * \return Statistics of the allocations
+     */
+    MemoryAllocatorStatistics getStatistics() const;
+
+    /** \private */
+    void registerAllocation(size_t size);
+
+    /** \private */
+    void registerDeallocation(size_t size);
+
+    /** \private */
+    size_t getNumberOfLiveBlocks() const;
+
+private:
+    MemoryAllocator(const MemoryAllocator &);
+    MemoryAllocator &operator=(const MemoryAllocator &);
+
+    MemoryAllocatorCounters *_counters;
+};
+typedef SharedPtr<MemoryAllocator> MemoryAllocatorPtr;
+
+/**
+ * <a name="DAAL-CLASS-SERVICES__SYSTEMMEMORYALLOCATOR"></a>
+ * \brief Allocator that requests every block from the system. Used by default
+ */
+class DAAL_EXPORT SystemMemoryAllocator : public MemoryAllocator
+{
+public:
+    virtual void *allocate(size_t size, size_t alignment) DAAL_C11_OVERRIDE;
+
+    virtual void deallocate(void *ptr, size_t size, size_t alignment) DAAL_C11_OVERRIDE;
+};
+
+/** \private */
+class PoolMemoryAllocatorImpl;
+
+/**
+ * <a name="DAAL-CLASS-SERVICES__POOLMEMORYALLOCATOR"></a>
+ * \brief Allocator that keeps the deallocated blocks in per-thread pools of size classes and reuses them.
+ *        Blocks larger than maxBlockSize or aligned to more than 64 bytes are requested from the system.
+ *        The cached memory is returned to the system when the allocator is destroyed
+ */
+class DAAL_EXPORT PoolMemoryAllocator : public MemoryAllocator
+{
+public:
+    /**
+     * Constructs the pool allocator
+     * \param[in] maxBlockSize  Maximal size of the blocks served from the pools, in bytes
+     */
+    PoolMemoryAllocator(size_t maxBlockSize = 262144);
+
+    virtual ~PoolMemoryAllocator();
+
+    virtual void *allocate(size_t size, size_t alignment) DAAL_C11_OVERRIDE;
+
+    virtual void deallocate(void *ptr, size_t size, size_t alignment) DAAL_C11_OVERRIDE;
+
+private:
+    PoolMemoryAllocatorImpl *_impl;
+};
+
+/** \private */
+class ArenaMemoryAllocatorImpl;
+
+/**
+ * <a name="DAAL-CLASS-SERVICES__ARENAMEMORYALLOCATOR"></a>
+ * \brief Allocator that serves blocks from large chunks of memory by advancing a pointer.
+ *        Deallocation of a block does not make its memory available, all the memory is reused after reset()
+ */
+class DAAL_EXPORT ArenaMemoryAllocator : public MemoryAllocator
+{
+public:
+    /**
+     * Constructs the arena allocator
+     * \param[in] chunkSize         Size of the chunks of memory requested from the system, in bytes
+     * \param[in] resetOnScopeExit  Flag that specifies whether reset() is called on exit from the scope
+     *                              in which the allocator is installed by ScopedMemoryAllocator
+     */
+    ArenaMemoryAllocator(size_t chunkSize = 4194304, bool resetOnScopeExit = true);
+
+    virtual ~ArenaMemoryAllocator();
+
+    virtual void *allocate(size_t size, size_t alignment) DAAL_C11_OVERRIDE;
+
+    virtual void deallocate(void *ptr, size_t size, size_t alignment) DAAL_C11_OVERRIDE;
+
+    virtual void endScope() DAAL_C11_OVERRIDE;
+
+    /**
+     * Makes all the memory of the arena available for new allocations if all the blocks are deallocated.
+     * If the arena grew beyond one chunk, the chunks are replaced by one chunk of their total size
+     * \return true if the arena is reset, false if some blocks are still in use
+     */
+    bool reset();
+
+private:
+    ArenaMemoryAllocatorImpl *_impl;
+};
+
+/**
+ * Installs the allocator used by daal_malloc in all threads that have no allocator installed by ScopedMemoryAllocator
+ * \param[in] allocator Allocator to install, empty pointer to restore the system allocator
+ */
+DAAL_EXPORT void setDefaultMemoryAllocator(const MemoryAllocatorPtr &allocator);
+
+/**
+ * Returns the allocator used by daal_malloc in the threads that have no allocator installed by ScopedMemoryAllocator
+ * \return Allocator installed by setDefaultMemoryAllocator(), or the system allocator
+ */
+DAAL_EXPORT MemoryAllocatorPtr getDefaultMemoryAllocator();
+
+/**
+ * <a name="DAAL-CLASS-SERVICES__SCOPEDMEMORYALLOCATOR"></a>
+ * \brief Installs the allocator used by daal_malloc in the calling thread for the lifetime of the object.
+ *        The worker threads of the library use the allocator while they run the parallel loops started
+ *        by the calling thread. Allocations made in other threads are not affected
+ */
+class DAAL_EXPORT ScopedMemoryAllocator
+{
+public:
+    /**
+     * Installs the allocator in the calling thread
+     * \param[in] allocator Allocator to install. If empty, the installed allocator is not changed
+     */
+    ScopedMemoryAllocator(const MemoryAllocatorPtr &allocator);
+
+    /**
+     * Restores the previously installed allocator and calls MemoryAllocator::endScope()
+     */
+    ~ScopedMemoryAllocator();
+
+private:
+    ScopedMemoryAllocator(const ScopedMemoryAllocator &);
+    ScopedMemoryAllocator &operator=(const ScopedMemoryAllocator &);
+
+    MemoryAllocatorPtr _allocator;
+    MemoryAllocator *_previous;
+};
+/** @} */
+} // namespace interface1
+using interface1::MemoryAllocatorStatistics;
+using interface1::MemoryAllocator;
+using interface1::MemoryAllocatorPtr;
+using interface1::SystemMemoryAllocator;
+using interface1::PoolMemoryAllocator;
+using interface1::ArenaMemoryAllocator;
+using interface1::ScopedMemoryAllocator;
+using interface1::setDefaultMemoryAllocator;
+using interface1::getDefaultMemoryAllocator;
+
+namespace internal
+{
+/**
+ * Returns the allocator installed in the calling thread by ScopedMemoryAllocator
+ * \return Allocator installed in the calling thread, 0 if no allocator is installed
+ */
+DAAL_EXPORT MemoryAllocator *getThreadMemoryAllocator();
+
+/**
+ * Installs the allocator in the calling thread without taking ownership of it.
+ * Used by the threading layer to run the parallel loops with the allocator of the thread that started them
+ * \param[in] allocator Allocator to install, 0 to restore the default allocator
+ * \return Previously installed allocator
+ */
+DAAL_EXPORT MemoryAllocator *setThreadMemoryAllocator(MemoryAllocator *allocator);
+
+/**
+ * Drops the reference to the allocator held by the algorithm or another object of the library.
+ * If the allocator still has live blocks, the library keeps it until the last block is deallocated
+ * \param[in,out] allocator Reference to drop, empty on exit
+ */
+DAAL_EXPORT void releaseMemoryAllocator(MemoryAllocatorPtr &allocator);
+} // namespace internal
+
+}
+} // namespace daal
+
+#endif
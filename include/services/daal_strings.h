@@ -107,6 +107,8 @@
     DECLARE_DAAL_STRING_CONST(rowIndexX                          ) \
     DECLARE_DAAL_STRING_CONST(rowIndexY                          ) \
     DECLARE_DAAL_STRING_CONST(rowIndexResult                     ) \
+    DECLARE_DAAL_STRING_CONST(precomputedStateX                  ) \
+    DECLARE_DAAL_STRING_CONST(precomputedStateY                  ) \
     DECLARE_DAAL_STRING_CONST(minSupport                         ) \
     DECLARE_DAAL_STRING_CONST(minConfidence                      ) \
     DECLARE_DAAL_STRING_CONST(nUniqueItems                       ) \
@@ -257,7 +259,23 @@
     DECLARE_DAAL_STRING_CONST(a                                  ) \
     DECLARE_DAAL_STRING_CONST(sigma                              ) \
     DECLARE_DAAL_STRING_CONST(conservativeSequence               ) \
-    DECLARE_DAAL_STRING_CONST(pastUpdateVector                   )
+    DECLARE_DAAL_STRING_CONST(pastUpdateVector                   ) \
+    DECLARE_DAAL_STRING_CONST(cacheStatistics                    ) \
+    DECLARE_DAAL_STRING_CONST(nCGIterations                      ) \
+    DECLARE_DAAL_STRING_CONST(nOversamples                       ) \
+    DECLARE_DAAL_STRING_CONST(nPowerIterations                   ) \
+    DECLARE_DAAL_STRING_CONST(windowSize                         ) \
+    DECLARE_DAAL_STRING_CONST(decayFactor                        ) \
+    DECLARE_DAAL_STRING_CONST(recomputeInterval                  ) \
+    DECLARE_DAAL_STRING_CONST(windowStatistics                   ) \
+    DECLARE_DAAL_STRING_CONST(windowCounters                     ) \
+    DECLARE_DAAL_STRING_CONST(learningRateOffset                 ) \
+    DECLARE_DAAL_STRING_CONST(learningRateDecay                  ) \
+    DECLARE_DAAL_STRING_CONST(sumOfWeights                       ) \
+    DECLARE_DAAL_STRING_CONST(partialMeans                       ) \
+    DECLARE_DAAL_STRING_CONST(partialCrossProducts               ) \
+    DECLARE_DAAL_STRING_CONST(nProcessedBlocks                   ) \
+    DECLARE_DAAL_STRING_CONST(timings                            )
 
 
 /**
@@ -0,0 +1,165 @@
+/* file: daal_trace.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the tracing of the library internals.
+//--
+*/
+
+#ifndef __DAAL_TRACE_H__
+#define __DAAL_TRACE_H__
+
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace services
+{
+
+namespace interface1
+{
+/**
+ * @ingroup services
+ * @{
+ */
+/**
+ * <a name="DAAL-STRUCT-SERVICES__TRACEEVENT"></a>
+ * \brief Event recorded by the tracer: a named interval of time spent by a thread
+ */
+struct TraceEvent
+{
+    const char *category;           /*!< Category of the event: algorithm, data_management, threading */
+    const char *name;               /*!< Name of the event */
+    unsigned long long start;       /*!< Start of the interval in nanoseconds, see Tracer::getTime() */
+    unsigned long long duration;    /*!< Duration of the interval in nanoseconds */
+    size_t threadId;                /*!< Index of the thread that recorded the event */
+};
+
+/**
+ * <a name="DAAL-CLASS-SERVICES__TRACER"></a>
+ * \brief Collects the trace events of the library in per-thread ring buffers.
+ *        The events are recorded only if the library is built with DAAL_ENABLE_TRACING defined and the tracer is enabled.
+ *        When a ring buffer is full, the oldest events of the thread are overwritten.
+ *        The methods that read or reset the buffers must not be called while the library computes in other threads
+ */
+class DAAL_EXPORT Tracer
+{
+public:
+    /**
+     * Enables or disables recording of the events
+     * \param[in] flag  Flag that specifies whether the events are recorded
+     */
+    static void enable(bool flag = true);
+
+    /**
+     * Returns the flag that specifies whether the events are recorded
+     * \return true if the events are recorded
+     */
+    static bool isEnabled();
+
+    /**
+     * Sets the capacity of the ring buffer of each thread and removes the recorded events
+     * \param[in] nEvents   Maximal number of the events kept for each thread
+     */
+    static void setBufferCapacity(size_t nEvents);
+
+    /**
+     * Removes the recorded events
+     */
+    static void clear();
+
+    /**
+     * Returns the number of the recorded events kept in the buffers of all threads
+     * \return Number of the recorded events
+     */
+    static size_t getNumberOfEvents();
+
+    /**
+     * Copies the recorded events ordered by the start time
+     * \param[out] events       Array to store the events
+     * \param[in]  maxEvents    Size of the array
+     * \return Number of the copied events
+     */
+    static size_t getEvents(TraceEvent *events, size_t maxEvents);
+
+    /**
+     * Writes the recorded events to the file in the Chrome trace event format,
+     * which is viewed with chrome://tracing or Perfetto
+     * \param[in] fileName  Name of the file
+     * \return true if the file is written
+     */
+    static bool exportChromeTrace(const char *fileName);
+
+    /**
+     * Returns the time of the monotonic clock used for the events, in nanoseconds
+     * \return Current time
+     */
+    static unsigned long long getTime();
+
+    /**
+     * Records the event in the ring buffer of the calling thread
+     * \param[in] category  Category of the event. The string must exist until the events are exported
+     * \param[in] name      Name of the event. The string must exist until the events are exported
+     * \param[in] start     Start of the interval returned by getTime()
+     * \param[in] end       End of the interval returned by getTime()
+     */
+    static void addEvent(const char *category, const char *name, unsigned long long start, unsigned long long end);
+};
+
+/**
+ * <a name="DAAL-CLASS-SERVICES__SCOPEDTRACE"></a>
+ * \brief Records the event for the lifetime of the object if the tracer is enabled on construction
+ */
+class ScopedTrace
+{
+public:
+    /**
+     * Starts the event
+     * \param[in] category  Category of the event, string literal
+     * \param[in] name      Name of the event, string literal
+     */
+    ScopedTrace(const char *category, const char *name) :
+        _category(category), _name(name), _start(Tracer::isEnabled() ? Tracer::getTime() : 0) {}
+
+    /** Records the event */
+    ~ScopedTrace()
+    {
+        if(_start)
+        {
+            Tracer::addEvent(_category, _name, _start, Tracer::getTime());
+        }
+    }
+
+private:
+    ScopedTrace(const ScopedTrace &);
+    ScopedTrace &operator=(const ScopedTrace &);
+
+    const char *_category;
+    const char *_name;
+    unsigned long long _start;
+};
+/** @} */
+} // namespace interface1
+using interface1::TraceEvent;
+using interface1::Tracer;
+using interface1::ScopedTrace;
+
+}
+} // namespace daal
+
+#endif
@@ -107,6 +107,15 @@ public:
     */
     int getCpuId(int enable = cpu_default);
 
+    /**
+    *  Overrides the processor type the computational kernels are dispatched to.
+    *  The processor type is applied to the algorithms created after the call.
+    *  Only the detected processor type and the types up to avx2 supported by the detected processor are accepted
+    *  \param[in] cpuid  The CPU ID, one of the CpuType values
+    *  \return The CPU ID used after the call
+    */
+    int setCpuId(int cpuid);
+
     /**
      * <a name="DAAL-ENUM-SERVICES__LIBRARYTHREADINGTYPE"></a>
      * The threading mode of the library
@@ -244,6 +244,7 @@ enum ErrorID
                                                                          *   in cross-product numeric table is not equal */
     ErrorInputCorrelationNotSupportedInOnlineAndDistributed = -7804,    /*!< Input correlation matrix is not supported in online and distributed
                                                                              computation modes */
+    ErrorFailedToComputeRandomizedDecomposition = -7805,                /*!< Failed to compute the randomized singular value decomposition */
 
     // QR errors: -8000..-8199
 
@@ -297,6 +298,11 @@ enum ErrorID
                                                                          *   compressed block header size */
     ErrorRleDataFormatNotFullBlock = -9022,                             /*!< Input compressed stream contains not a whole
                                                                          *   number of compressed blocks */
+    ErrorCompressionFramedDataFormat = -9023,                           /*!< Input compressed stream is not a framed stream of a supported
+                                                                         *   version or is corrupted */
+    ErrorCompressionFrameIndexOutOfRange = -9024,                       /*!< Index of the frame is out of range */
+    ErrorCompressionFramedStreamIsFinalized = -9025,                    /*!< Data cannot be added to the framed compression stream
+                                                                         *   after the compressed data was read */
     // Min-max normalization errors: -9400..-9499
     ErrorLowerBoundGreaterThanOrEqualToUpperBound = -9400,              /*!< Lower bound parameter greater than or equal to upper bound */
 
@@ -340,6 +346,8 @@ enum ErrorID
     ErrorSQLstmtHandle = -90044,                                        /*!< ErrorSQLstmtHandle */
     ErrorOnFileOpen = -90045,                                           /*!< Error on file open */
     ErrorOnFileRead = -90046,                                           /*!< Error on file read */
+    ErrorOnFileWrite = -90047,                                          /*!< Error on file write */
+    ErrorIncorrectFileFormat = -90048,                                  /*!< File format is incorrect */
 
     ErrorKDBNoConnection = -90051,                                      /*!< ErrorKDBNoConnection */
     ErrorKDBWrongCredentials = -90052,                                  /*!< ErrorKDBWrongCredentials */
@@ -0,0 +1,120 @@
+/* file: daal_threading.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the threading layer functions used in the header-only parts of the library.
+//--
+*/
+
+#ifndef __DAAL_THREADING_H__
+#define __DAAL_THREADING_H__
+
+#include "services/daal_defines.h"
+#include "services/daal_memory_allocator.h"
+
+namespace daal
+{
+
+typedef void (*functype)(int i, const void *a);
+typedef void (*functype2)(int i, int n, const void *a);
+typedef void *(*tls_functype)(const void *a);
+typedef void (*tls_reduce_functype)(void *p, const void *a);
+
+}
+
+extern "C" {
+
+    DAAL_EXPORT int   _daal_threader_get_max_threads();
+    DAAL_EXPORT void  _daal_threader_for(int n, int threads_request, const void *a, daal::functype func);
+    DAAL_EXPORT void  _daal_threader_for_blocked(int n, int threads_request, const void *a, daal::functype2 func);
+    DAAL_EXPORT void  _daal_threader_for_optional(int n, int threads_request, const void *a, daal::functype func);
+    DAAL_EXPORT void  _daal_traced_threader_for(int n, int threads_request, const void *a, daal::functype func);
+    DAAL_EXPORT void  _daal_traced_threader_for_blocked(int n, int threads_request, const void *a, daal::functype2 func);
+    DAAL_EXPORT void  _daal_traced_threader_for_optional(int n, int threads_request, const void *a, daal::functype func);
+    DAAL_EXPORT void *_daal_get_tls_ptr( void *a, daal::tls_functype func );
+    DAAL_EXPORT void *_daal_get_tls_local( void *tlsPtr );
+    DAAL_EXPORT void  _daal_reduce_tls( void *tlsPtr, void *a, daal::tls_reduce_functype func );
+    DAAL_EXPORT void  _daal_del_tls_ptr( void *tlsPtr );
+    DAAL_EXPORT bool  _daal_is_in_parallel();
+    DAAL_EXPORT void *_daal_new_mutex();
+    DAAL_EXPORT void  _daal_lock_mutex( void *mutexPtr );
+    DAAL_EXPORT void  _daal_unlock_mutex( void *mutexPtr );
+    DAAL_EXPORT void  _daal_del_mutex( void *mutexPtr );
+
+    DAAL_EXPORT size_t _setNumberOfThreads(const size_t numThreads, void **init);
+
+    DAAL_EXPORT void * _daal_threader_env();
+}
+
+namespace daal
+{
+
+inline int threader_get_max_threads_number()
+{
+    return _daal_threader_get_max_threads();
+}
+
+/* Body of the parallel loop and the allocator installed in the thread that started the loop */
+template<typename F>
+struct threader_task
+{
+    threader_task(const F &lambda) : lambda(lambda), allocator(services::internal::getThreadMemoryAllocator()) {}
+
+    const F &lambda;
+    services::MemoryAllocator *allocator;
+};
+
+/* Installs the allocator of the thread that started the parallel loop in the thread that runs the iterations */
+class threader_allocator_scope
+{
+public:
+    threader_allocator_scope(services::MemoryAllocator *allocator) : _allocator(allocator), _previous(0)
+    {
+        if (_allocator) { _previous = services::internal::setThreadMemoryAllocator(_allocator); }
+    }
+
+    ~threader_allocator_scope()
+    {
+        if (_allocator) { services::internal::setThreadMemoryAllocator(_previous); }
+    }
+
+private:
+    services::MemoryAllocator *_allocator;
+    services::MemoryAllocator *_previous;
+};
+
+template<typename F>
+inline void threader_func(int i, const void *a)
+{
+    const threader_task<F> &task = *static_cast<const threader_task<F> *>(a);
+    threader_allocator_scope allocatorScope(task.allocator);
+    task.lambda(i);
+}
+
+template<typename F>
+inline void threader_for(int n, int threads_request, const F &lambda)
+{
+    const threader_task<F> task(lambda);
+    const void *a = static_cast<const void *>(&task);
+
+    _daal_traced_threader_for(n, threads_request, a, threader_func<F>);
+}
+
+}
+
+#endif
@@ -93,7 +93,7 @@ public class Batch extends AnalysisBatch {
             throw new IllegalArgumentException("type unsupported");
         }
 
-        if (this.method != Method.apriori) {
+        if (this.method != Method.apriori && this.method != Method.fpGrowth) {
             throw new IllegalArgumentException("method unsupported");
         }
 
@@ -122,6 +122,24 @@ public class Parameter extends com.intel.daal.algorithms.Parameter {
         return cGetPreferenceThreshold(this.cObject);
     }
 
+    /**
+     * Sets the number of conjugate-gradient steps per row of factors
+     * for the TrainingMethod.conjugateGradientCSR training method
+     * @param nCGIterations Number of conjugate-gradient steps per row of factors
+     */
+    public void setNCGIterations(long nCGIterations) {
+        cSetNCGIterations(this.cObject, nCGIterations);
+    }
+
+    /**
+     * Gets the number of conjugate-gradient steps per row of factors
+     * for the TrainingMethod.conjugateGradientCSR training method
+     * @return Number of conjugate-gradient steps per row of factors
+     */
+    public long getNCGIterations() {
+        return cGetNCGIterations(this.cObject);
+    }
+
     private native void cSetNFactors(long algAddr, long nFactors);
 
     private native long cGetNFactors(long algAddr);
@@ -141,5 +159,9 @@ public class Parameter extends com.intel.daal.algorithms.Parameter {
     private native void cSetPreferenceThreshold(long algAddr, double preferenceThreshold);
 
     private native double cGetPreferenceThreshold(long algAddr);
+
+    private native void cSetNCGIterations(long algAddr, long nCGIterations);
+
+    private native long cGetNCGIterations(long algAddr);
 }
 /** @} */
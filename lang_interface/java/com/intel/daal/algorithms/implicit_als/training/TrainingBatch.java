@@ -75,7 +75,8 @@ public class TrainingBatch extends com.intel.daal.algorithms.TrainingBatch {
         super(context);
 
         this.method = method;
-        if (this.method != TrainingMethod.fastCSR && this.method != TrainingMethod.defaultDense) {
+        if (this.method != TrainingMethod.fastCSR && this.method != TrainingMethod.defaultDense &&
+            this.method != TrainingMethod.conjugateGradientCSR) {
             throw new IllegalArgumentException("method unsupported");
         }
 
@@ -51,6 +51,7 @@ public final class TrainingMethod {
 
     private static final int defaultDenseId = 0;
     private static final int fastCSRId      = 1;
+    private static final int conjugateGradientCSRId = 2;
 
     /**
     * Method for training the implicit ALS model
@@ -64,5 +65,12 @@ public final class TrainingMethod {
     public static final TrainingMethod fastCSR      = new TrainingMethod(
             fastCSRId);         /*!< Method proposed by Hu, Koren,
                                     Volinsky for input data stored in the compressed sparse row (CSR) format */
+    /**
+    * Method for training the implicit ALS model
+    */
+    public static final TrainingMethod conjugateGradientCSR = new TrainingMethod(
+            conjugateGradientCSRId); /*!< Method that updates the factors with a fixed number of conjugate-gradient steps
+                                          warm-started from the factors computed on the previous iteration,
+                                          for input data stored in the compressed sparse row (CSR) format */
 }
 /** @} */
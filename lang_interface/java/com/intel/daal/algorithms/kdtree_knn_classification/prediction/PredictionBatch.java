@@ -86,7 +86,7 @@ public class PredictionBatch extends com.intel.daal.algorithms.classifier.predic
             throw new IllegalArgumentException("type unsupported");
         }
 
-        if (this.method != PredictionMethod.defaultDense) {
+        if (this.method != PredictionMethod.defaultDense && this.method != PredictionMethod.bruteForce) {
             throw new IllegalArgumentException("method unsupported");
         }
 
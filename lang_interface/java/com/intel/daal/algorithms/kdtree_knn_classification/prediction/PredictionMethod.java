@@ -38,7 +38,12 @@ public final class PredictionMethod {
     }
 
     private static final int defaultDenseValue = 0;
+    private static final int bruteForceValue   = 1;
 
-    public static final PredictionMethod defaultDense = new PredictionMethod(defaultDenseValue); /*!< Default method */
+    public static final PredictionMethod defaultDense = new PredictionMethod(defaultDenseValue); /*!< Default method: search of nearest
+                                                                                                      neighbors in the KD-tree */
+    public static final PredictionMethod bruteForce   = new PredictionMethod(bruteForceValue);   /*!< Brute-force computation of distances
+                                                                                                      to all observations of the training
+                                                                                                      data set */
 }
 /** @} */
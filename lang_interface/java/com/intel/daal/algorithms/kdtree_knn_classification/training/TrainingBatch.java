@@ -72,7 +72,7 @@ public class TrainingBatch extends com.intel.daal.algorithms.classifier.training
         super(context);
 
         this.method = method;
-        if (this.method != TrainingMethod.defaultDense) {
+        if (this.method != TrainingMethod.defaultDense && this.method != TrainingMethod.bruteForce) {
             throw new IllegalArgumentException("method unsupported");
         }
 
@@ -51,7 +51,13 @@ public final class TrainingMethod {
     }
 
     private static final int defaultDenseValue = 0;
-
-    public static final TrainingMethod defaultDense = new TrainingMethod(defaultDenseValue);   /*!< Default method */
+    private static final int bruteForceValue   = 1;
+
+    public static final TrainingMethod defaultDense = new TrainingMethod(defaultDenseValue);   /*!< Default method: the KD-tree is built
+                                                                                                     for the training data set */
+    public static final TrainingMethod bruteForce   = new TrainingMethod(bruteForceValue);     /*!< The training data set and labels are stored
+                                                                                                     in the model without building the KD-tree.
+                                                                                                     The model can only be used with
+                                                                                                     the PredictionMethod.bruteForce method */
 }
 /** @} */
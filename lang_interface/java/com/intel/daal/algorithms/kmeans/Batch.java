@@ -92,7 +92,8 @@ public class Batch extends AnalysisBatch {
             throw new IllegalArgumentException("type unsupported");
         }
 
-        if (this.method != Method.lloydDense && this.method != Method.lloydCSR) {
+        if (this.method != Method.lloydDense && this.method != Method.lloydCSR &&
+            this.method != Method.hamerlyDense && this.method != Method.hamerlyCSR) {
             throw new IllegalArgumentException("method unsupported");
         }
 
@@ -47,9 +47,14 @@ public final class Method {
 
     private static final int lloydDenseValue = 0;
     private static final int lloydCSRValue   = 1;
+    private static final int hamerlyDenseValue = 2;
+    private static final int hamerlyCSRValue   = 3;
 
     public static final Method defaultDense = new Method(lloydDenseValue); /*!< Default: performance-oriented method, synonym of lloydDense */
     public static final Method lloydDense   = new Method(lloydDenseValue); /*!< Default: performance-oriented method, synonym of defaultDense */
     public static final Method lloydCSR     = new Method(lloydCSRValue);   /*!< Method for sparse data in the CSR format */
+    public static final Method hamerlyDense = new Method(hamerlyDenseValue); /*!< Lloyd algorithm accelerated with the bounds on the distances,
+                                                                                   available in the batch processing mode only */
+    public static final Method hamerlyCSR   = new Method(hamerlyCSRValue);   /*!< Hamerly method for sparse data in the CSR format */
 }
 /** @} */
@@ -37,8 +37,11 @@ public final class ResultId {
     }
 
     private static final int weightsValue = 0;
+    private static final int timingsValue = 1;
 
     /** Outlier detection results */
     public static final ResultId weights = new ResultId(weightsValue);
+    /** Execution times of the BACON method in seconds, computed if the computeTimings parameter is true */
+    public static final ResultId timings = new ResultId(timingsValue);
 }
 /** @} */
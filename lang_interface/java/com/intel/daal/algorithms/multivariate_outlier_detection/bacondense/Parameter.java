@@ -92,6 +92,23 @@ public class Parameter extends com.intel.daal.algorithms.Parameter {
         return cGetToleranceToConverge(this.cObject);
     }
 
+    /**
+     * Sets the flag that specifies whether the execution times of the phases of the algorithm
+     * are returned in the ResultId.timings result
+     * @param flag  Flag that specifies whether the execution times are computed
+     */
+    public void setComputeTimings(boolean flag) {
+        cSetComputeTimings(this.cObject, flag);
+    }
+
+    /**
+     * Returns the flag that specifies whether the execution times of the phases of the algorithm are computed
+     * @return Flag that specifies whether the execution times are computed
+     */
+    public boolean getComputeTimings() {
+        return cGetComputeTimings(this.cObject);
+    }
+
     private native void cSetInitializationMethod(long parAddr, int method);
 
     private native int cGetInitializationMethod(long parAddr);
@@ -103,5 +120,9 @@ public class Parameter extends com.intel.daal.algorithms.Parameter {
     private native void cSetToleranceToConverge(long parAddr, double threshold);
 
     private native double cGetToleranceToConverge(long parAddr);
+
+    private native void cSetComputeTimings(long parAddr, boolean flag);
+
+    private native boolean cGetComputeTimings(long parAddr);
 }
 /** @} */
@@ -75,10 +75,27 @@ public class TrainingParameter extends com.intel.daal.algorithms.Parameter {
        cSetOptimizationSolver(cObject, optimizationSolver.cObject);
     }
 
+    /**
+     *  Gets the number of batches read from the input tensors in the background while the current batch is processed
+     */
+    public long getPrefetchDepth() {
+        return cGetPrefetchDepth(cObject);
+    }
+
+    /**
+     *  Sets the number of batches read from the input tensors in the background while the current batch is processed
+     *  @param prefetchDepth Number of batches read ahead, 0 to read each batch synchronously before it is processed
+     */
+    public void setPrefetchDepth(long prefetchDepth) {
+        cSetPrefetchDepth(cObject, prefetchDepth);
+    }
+
     private native long cInit();
     private native long cGetBatchSize(long cParameter);
     private native void cSetBatchSize(long cParameter, long batchSize);
     private native long cGetOptimizationSolver(long cParameter);
     private native void cSetOptimizationSolver(long cParameter, long optAddr);
+    private native long cGetPrefetchDepth(long cParameter);
+    private native void cSetPrefetchDepth(long cParameter, long prefetchDepth);
 }
 /** @} */
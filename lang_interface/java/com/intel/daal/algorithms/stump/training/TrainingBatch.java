@@ -67,7 +67,7 @@ public class TrainingBatch extends com.intel.daal.algorithms.weak_learner.traini
 
         this.method = method;
 
-        if (this.method != TrainingMethod.defaultDense) {
+        if (this.method != TrainingMethod.defaultDense && this.method != TrainingMethod.binned) {
             throw new IllegalArgumentException("method unsupported");
         }
 
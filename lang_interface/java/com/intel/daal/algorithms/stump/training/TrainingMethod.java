@@ -49,9 +49,12 @@ public final class TrainingMethod {
     }
 
     private static final int DefaultDense = 0;
+    private static final int Binned       = 1;
 
     /** The default decision stump training method */
     public static final TrainingMethod defaultDense = new TrainingMethod(DefaultDense);
+    /** The method that searches for the split over the histograms of the features quantized into at most 256 bins */
+    public static final TrainingMethod binned       = new TrainingMethod(Binned);
 }
 /** @} */
 /** @} */
@@ -29,7 +29,8 @@ using namespace daal::algorithms;
 
 #define jBatch   com_intel_daal_algorithms_ComputeMode_batchValue
 
-#define Apriori com_intel_daal_algorithms_association_rules_Method_Apriori
+#define Apriori  com_intel_daal_algorithms_association_rules_Method_Apriori
+#define FpGrowth com_intel_daal_algorithms_association_rules_Method_FpGrowth
 
 #define ItemsetsUnsorted        com_intel_daal_algorithms_association_rules_ItemsetsOrderId_ItemsetsUnsorted
 #define ItemsetsSortedBySupport com_intel_daal_algorithms_association_rules_ItemsetsOrderId_ItemsetsSortedBySupport
@@ -47,3 +48,7 @@ typedef association_rules::Batch<float, association_rules::apriori>     ar_of_s_
 typedef association_rules::Batch<double, association_rules::apriori>    ar_of_d_ap;
 typedef services::SharedPtr<association_rules::Batch<float, association_rules::apriori> >    sp_ar_of_s_ap;
 typedef services::SharedPtr<association_rules::Batch<double, association_rules::apriori> >   sp_ar_of_d_ap;
+typedef association_rules::Batch<float, association_rules::fpGrowth>    ar_of_s_fp;
+typedef association_rules::Batch<double, association_rules::fpGrowth>   ar_of_d_fp;
+typedef services::SharedPtr<association_rules::Batch<float, association_rules::fpGrowth> >   sp_ar_of_s_fp;
+typedef services::SharedPtr<association_rules::Batch<double, association_rules::fpGrowth> >  sp_ar_of_d_fp;
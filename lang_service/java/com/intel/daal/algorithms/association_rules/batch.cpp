@@ -34,19 +34,19 @@ using namespace daal::algorithms::association_rules;
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_association_1rules_Batch_cInit
 (JNIEnv *env, jobject thisObj, jint prec, jint method)
 {
-    return jniBatch<association_rules::Method, Batch, apriori>::newObj(prec, method);
+    return jniBatch<association_rules::Method, Batch, apriori, fpGrowth>::newObj(prec, method);
 }
 
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_association_1rules_Batch_cInitParameter
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method, jint cmode)
 {
-    return jniBatch<association_rules::Method, Batch, apriori>::getParameter(prec, method, algAddr);
+    return jniBatch<association_rules::Method, Batch, apriori, fpGrowth>::getParameter(prec, method, algAddr);
 }
 
 JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_association_1rules_Batch_cSetResult
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method, jlong resultAddr)
 {
-    jniBatch<association_rules::Method, Batch, apriori>::setResult<association_rules::Result>(prec, method, algAddr, resultAddr);
+    jniBatch<association_rules::Method, Batch, apriori, fpGrowth>::setResult<association_rules::Result>(prec, method, algAddr, resultAddr);
 }
 
 /*
@@ -57,5 +57,5 @@ JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_association_1rules_Batch_c
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_association_1rules_Batch_cClone
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<association_rules::Method, Batch, apriori>::getClone(prec, method, algAddr);
+    return jniBatch<association_rules::Method, Batch, apriori, fpGrowth>::getClone(prec, method, algAddr);
 }
@@ -38,7 +38,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_association_1rules_Result
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_association_1rules_Result_cGetResult
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method, jint cmode)
 {
-    return jniBatch<association_rules::Method, association_rules::Batch, association_rules::apriori>::getResult(prec, method, algAddr);
+    return jniBatch<association_rules::Method, association_rules::Batch, association_rules::apriori, association_rules::fpGrowth>::getResult(prec, method, algAddr);
 }
 
 /*
@@ -46,6 +46,7 @@
 
 #define FastCSR             com_intel_daal_algorithms_implicit_als_training_TrainingMethod_fastCSRId
 #define DefaultDense        com_intel_daal_algorithms_implicit_als_training_TrainingMethod_defaultDenseId
+#define ConjugateGradientCSR com_intel_daal_algorithms_implicit_als_training_TrainingMethod_conjugateGradientCSRId
 
 #define inputOfStep2FromStep1Id     com_intel_daal_algorithms_implicit_als_training_MasterInputId_inputOfStep2FromStep1Id
 
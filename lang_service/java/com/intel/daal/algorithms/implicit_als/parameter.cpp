@@ -133,3 +133,25 @@ JNIEXPORT jdouble JNICALL Java_com_intel_daal_algorithms_implicit_1als_Parameter
 {
     return ((Parameter *)parAddr)->preferenceThreshold;
 }
+
+/*
+ * Class:     com_intel_daal_algorithms_implicit_als_Parameter
+ * Method:    cSetNCGIterations
+ * Signature: (JJ)V
+ */
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_implicit_1als_Parameter_cSetNCGIterations
+(JNIEnv *, jobject, jlong parAddr, jlong nCGIterations)
+{
+    ((Parameter *)parAddr)->nCGIterations = nCGIterations;
+}
+
+/*
+ * Class:     com_intel_daal_algorithms_implicit_als_Parameter
+ * Method:    cGetNCGIterations
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_implicit_1als_Parameter_cGetNCGIterations
+(JNIEnv *, jobject, jlong parAddr)
+{
+    return ((Parameter *)parAddr)->nCGIterations;
+}
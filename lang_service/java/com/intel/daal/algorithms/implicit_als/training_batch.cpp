@@ -36,7 +36,7 @@ using namespace daal::algorithms::implicit_als::training;
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_implicit_1als_training_TrainingBatch_cInit
 (JNIEnv *env, jobject thisObj, jint prec, jint method)
 {
-    return jniBatch<implicit_als::training::Method, Batch, fastCSR, defaultDense>::newObj(prec, method);
+    return jniBatch<implicit_als::training::Method, Batch, fastCSR, defaultDense, conjugateGradientCSR>::newObj(prec, method);
 }
 
 /*
@@ -47,7 +47,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_implicit_1als_training_Tr
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_implicit_1als_training_TrainingBatch_cInitParameter
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<implicit_als::training::Method, Batch, fastCSR, defaultDense>::getParameter(prec, method, algAddr);
+    return jniBatch<implicit_als::training::Method, Batch, fastCSR, defaultDense, conjugateGradientCSR>::getParameter(prec, method, algAddr);
 }
 
 /*
@@ -58,7 +58,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_implicit_1als_training_Tr
 JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_implicit_1als_training_TrainingBatch_cSetResult
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method, jlong resultAddr)
 {
-    jniBatch<implicit_als::training::Method, Batch, fastCSR, defaultDense>::
+    jniBatch<implicit_als::training::Method, Batch, fastCSR, defaultDense, conjugateGradientCSR>::
         setResult<implicit_als::training::Result>(prec, method, algAddr, resultAddr);
 }
 
@@ -70,5 +70,5 @@ JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_implicit_1als_training_Tra
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_implicit_1als_training_TrainingBatch_cClone
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<implicit_als::training::Method, Batch, fastCSR, defaultDense>::getClone(prec, method, algAddr);
+    return jniBatch<implicit_als::training::Method, Batch, fastCSR, defaultDense, conjugateGradientCSR>::getClone(prec, method, algAddr);
 }
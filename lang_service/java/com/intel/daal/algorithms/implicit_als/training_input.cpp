@@ -36,7 +36,7 @@ using namespace daal::algorithms::implicit_als::training;
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_implicit_1als_training_TrainingInput_cInit
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<implicit_als::training::Method, Batch, fastCSR, defaultDense>::getInput(prec, method, algAddr);
+    return jniBatch<implicit_als::training::Method, Batch, fastCSR, defaultDense, conjugateGradientCSR>::getInput(prec, method, algAddr);
 }
 
 /*
@@ -46,7 +46,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_implicit_1als_training_Tr
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_implicit_1als_training_TrainingResult_cGetResult
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<implicit_als::training::Method, Batch, fastCSR, defaultDense>::getResult(prec, method, algAddr);
+    return jniBatch<implicit_als::training::Method, Batch, fastCSR, defaultDense, conjugateGradientCSR>::getResult(prec, method, algAddr);
 }
 
 /*
@@ -23,6 +23,7 @@
 #include "common_helpers.h"
 
 #define defaultDense com_intel_daal_algorithms_kdtree_knn_classification_training_TrainingMethod_defaultDenseValue
+#define bruteForce   com_intel_daal_algorithms_kdtree_knn_classification_training_TrainingMethod_bruteForceValue
 
 USING_COMMON_NAMESPACES();
 using namespace daal::algorithms::kdtree_knn_classification::training;
@@ -35,7 +36,7 @@ using namespace daal::algorithms::kdtree_knn_classification::training;
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classification_training_TrainingBatch_cInit
 (JNIEnv *env, jobject thisObj, jint prec, jint method)
 {
-    return jniBatch<kdtree_knn_classification::training::Method, Batch, defaultDense>::newObj(prec, method);
+    return jniBatch<kdtree_knn_classification::training::Method, Batch, defaultDense, bruteForce>::newObj(prec, method);
 }
 
 /*
@@ -46,7 +47,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classificati
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classification_training_TrainingBatch_cInitParameter
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<kdtree_knn_classification::training::Method, Batch, defaultDense>::getParameter(prec, method, algAddr);
+    return jniBatch<kdtree_knn_classification::training::Method, Batch, defaultDense, bruteForce>::getParameter(prec, method, algAddr);
 }
 
 /*
@@ -57,7 +58,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classificati
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classification_training_TrainingBatch_cGetInput
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<kdtree_knn_classification::training::Method, Batch, defaultDense>::getInput(prec, method, algAddr);
+    return jniBatch<kdtree_knn_classification::training::Method, Batch, defaultDense, bruteForce>::getInput(prec, method, algAddr);
 }
 
 /*
@@ -68,7 +69,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classificati
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classification_training_TrainingBatch_cGetResult
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<kdtree_knn_classification::training::Method, Batch, defaultDense>::getResult(prec, method, algAddr);
+    return jniBatch<kdtree_knn_classification::training::Method, Batch, defaultDense, bruteForce>::getResult(prec, method, algAddr);
 }
 
 /*
@@ -79,5 +80,5 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classificati
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classification_training_TrainingBatch_cClone
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<kdtree_knn_classification::training::Method, Batch, defaultDense>::getClone(prec, method, algAddr);
+    return jniBatch<kdtree_knn_classification::training::Method, Batch, defaultDense, bruteForce>::getClone(prec, method, algAddr);
 }
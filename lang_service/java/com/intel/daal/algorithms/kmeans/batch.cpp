@@ -27,35 +27,35 @@ using namespace daal::algorithms::kmeans;
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kmeans_Batch_cInit
 (JNIEnv *, jobject, jint prec, jint method, jlong nClusters, jlong maxIterations)
 {
-    return jniBatch<kmeans::Method,Batch,lloydDense,lloydCSR>::newObj(prec,method,nClusters,maxIterations);
+    return jniBatch<kmeans::Method,Batch,lloydDense,lloydCSR,hamerlyDense,hamerlyCSR>::newObj(prec,method,nClusters,maxIterations);
 }
 
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kmeans_Batch_cInitParameter
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<kmeans::Method,Batch,lloydDense,lloydCSR>::getParameter(prec,method,algAddr);
+    return jniBatch<kmeans::Method,Batch,lloydDense,lloydCSR,hamerlyDense,hamerlyCSR>::getParameter(prec,method,algAddr);
 }
 
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kmeans_Batch_cGetInput
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<kmeans::Method,Batch,lloydDense,lloydCSR>::getInput(prec,method,algAddr);
+    return jniBatch<kmeans::Method,Batch,lloydDense,lloydCSR,hamerlyDense,hamerlyCSR>::getInput(prec,method,algAddr);
 }
 
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kmeans_Batch_cGetResult
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<kmeans::Method,Batch,lloydDense,lloydCSR>::getResult(prec,method,algAddr);
+    return jniBatch<kmeans::Method,Batch,lloydDense,lloydCSR,hamerlyDense,hamerlyCSR>::getResult(prec,method,algAddr);
 }
 
 JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_kmeans_Batch_cSetResult
 (JNIEnv *, jobject, jlong algAddr, jint prec, jint method, jlong resultAddr)
 {
-    jniBatch<kmeans::Method,Batch,lloydDense,lloydCSR>::setResult<kmeans::Result>(prec,method,algAddr,resultAddr);
+    jniBatch<kmeans::Method,Batch,lloydDense,lloydCSR,hamerlyDense,hamerlyCSR>::setResult<kmeans::Result>(prec,method,algAddr,resultAddr);
 }
 
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kmeans_Batch_cClone
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<kmeans::Method,Batch,lloydDense,lloydCSR>::getClone(prec,method,algAddr);
+    return jniBatch<kmeans::Method,Batch,lloydDense,lloydCSR,hamerlyDense,hamerlyCSR>::getClone(prec,method,algAddr);
 }
@@ -105,3 +105,31 @@ Java_com_intel_daal_algorithms_multivariate_1outlier_1detection_bacondense_Param
     using namespace daal::algorithms::multivariate_outlier_detection;
     return((Parameter<baconDense> *)parAddr)->toleranceToConverge;
 }
+
+/*
+ * Class:     com_intel_daal_algorithms_multivariate_outlier_detection_bacondense_Parameter
+ * Method:    cSetComputeTimings
+ * Signature:(JZ)V
+ */
+JNIEXPORT void JNICALL
+Java_com_intel_daal_algorithms_multivariate_1outlier_1detection_bacondense_Parameter_cSetComputeTimings
+(JNIEnv *env, jobject thisObj, jlong parAddr, jboolean flag)
+{
+    using namespace daal;
+    using namespace daal::algorithms::multivariate_outlier_detection;
+    ((Parameter<baconDense> *)parAddr)->computeTimings = (flag != 0);
+}
+
+/*
+ * Class:     com_intel_daal_algorithms_multivariate_outlier_detection_bacondense_Parameter
+ * Method:    cGetComputeTimings
+ * Signature:(J)Z
+ */
+JNIEXPORT jboolean JNICALL
+Java_com_intel_daal_algorithms_multivariate_1outlier_1detection_bacondense_Parameter_cGetComputeTimings
+(JNIEnv *env, jobject thisObj, jlong parAddr)
+{
+    using namespace daal;
+    using namespace daal::algorithms::multivariate_outlier_detection;
+    return(jboolean)(((Parameter<baconDense> *)parAddr)->computeTimings);
+}
@@ -83,3 +83,25 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_training
         new SharedPtr<optimization_solver::iterative_solver::Batch >((((training::Parameter *)cParameter))->optimizationSolver);
     return (jlong)opt;
 }
+
+/*
+ * Class:     com_intel_daal_algorithms_neural_networks_training_TrainingParameter
+ * Method:    cGetPrefetchDepth
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_training_TrainingParameter_cGetPrefetchDepth
+(JNIEnv *env, jobject thisObj, jlong cParameter)
+{
+    return (((training::Parameter *)cParameter))->prefetchDepth;
+}
+
+/*
+ * Class:     com_intel_daal_algorithms_neural_networks_training_TrainingParameter
+ * Method:    cSetPrefetchDepth
+ * Signature: (JJ)V
+ */
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_neural_1networks_training_TrainingParameter_cSetPrefetchDepth
+(JNIEnv *env, jobject thisObj, jlong cParameter, jlong prefetchDepth)
+{
+    (((training::Parameter *)cParameter))->prefetchDepth = prefetchDepth;
+}
@@ -34,7 +34,7 @@ using namespace daal::algorithms::stump::training;
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_stump_training_TrainingBatch_cInit
 (JNIEnv *env, jobject thisObj, jint prec, jint method)
 {
-    return jniBatch<stump::training::Method, Batch, defaultDense>::newObj(prec, method);
+    return jniBatch<stump::training::Method, Batch, defaultDense, binned>::newObj(prec, method);
 }
 
 /*
@@ -45,5 +45,5 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_stump_training_TrainingBa
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_stump_training_TrainingBatch_cClone
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<stump::training::Method, Batch, defaultDense>::getClone(prec, method, algAddr);
+    return jniBatch<stump::training::Method, Batch, defaultDense, binned>::getClone(prec, method, algAddr);
 }
@@ -29,6 +29,9 @@ using namespace daal::algorithms;
 #define jMaster  com_intel_daal_algorithms_ComputeMode_distributedMasterValue
 
 #define DefaultDense com_intel_daal_algorithms_stump_training_TrainingMethod_DefaultDense
+#define Binned       com_intel_daal_algorithms_stump_training_TrainingMethod_Binned
 
 typedef stump::training::Batch<float, stump::training::defaultDense>     st_tr_of_s_dd;
 typedef stump::training::Batch<double, stump::training::defaultDense>    st_tr_of_d_dd;
+typedef stump::training::Batch<float, stump::training::binned>           st_tr_of_s_bin;
+typedef stump::training::Batch<double, stump::training::binned>          st_tr_of_d_bin;
@@ -22,6 +22,11 @@
 */
 
 #include "compression_stream.h"
+#include "zlibcompression.h"
+#include "bzip2compression.h"
+#include "lzocompression.h"
+#include "rlecompression.h"
+#include "threading.h"
 
 namespace daal
 {
@@ -553,5 +558,739 @@ size_t DecompressionStream::getDecompressedDataSize()
     return _decompressedDataSize;
 }
 
+/*
+ * Framed stream format, version 1. All the integers are 64-bit little-endian unless noted otherwise:
+ *   magic "DAFS" (4 bytes), version (32-bit), compression method (32-bit), reserved (32-bit), frame size (64-bit),
+ *   number of frames N, then N pairs (compressed size, raw size), then the compressed frames one after another.
+ * Each frame is a complete stream of the compression method, independent of the other frames.
+ */
+static const byte framedStreamMagic[4] = { 'D', 'A', 'F', 'S' };
+static const unsigned int framedStreamVersion = 1;
+static const size_t framedStreamHeaderSize = 4 + 3 * sizeof(unsigned int) + 2 * sizeof(DAAL_UINT64);
+static const size_t framedStreamIndexEntrySize = 2 * sizeof(DAAL_UINT64);
+
+/* The integers of the framed stream header are stored byte by byte, so the format does not depend on the byte order of the host */
+static byte *storeLittleEndian(byte *ptr, DAAL_UINT64 value, size_t nBytes)
+{
+    for(size_t i = 0; i < nBytes; i++)
+    {
+        ptr[i] = (byte)(value >> (8 * i));
+    }
+    return ptr + nBytes;
+}
+
+static DAAL_UINT64 loadLittleEndian(const byte *ptr, size_t nBytes)
+{
+    DAAL_UINT64 value = 0;
+    for(size_t i = 0; i < nBytes; i++)
+    {
+        value |= (DAAL_UINT64)ptr[i] << (8 * i);
+    }
+    return value;
+}
+
+static CompressorImpl *createCompressor(CompressionMethod method, CompressionLevel level)
+{
+    switch(method)
+    {
+    case zlib:
+    {
+        Compressor<zlib> *compressor = new Compressor<zlib>();
+        compressor->parameter.level = level;
+        return compressor;
+    }
+    case bzip2:
+    {
+        Compressor<bzip2> *compressor = new Compressor<bzip2>();
+        compressor->parameter.level = level;
+        return compressor;
+    }
+    case lzo: return new Compressor<lzo>();
+    case rle: return new Compressor<rle>();
+    }
+    return NULL;
+}
+
+static DecompressorImpl *createDecompressor(CompressionMethod method)
+{
+    switch(method)
+    {
+    case zlib:  return new Decompressor<zlib>();
+    case bzip2: return new Decompressor<bzip2>();
+    case lzo:   return new Decompressor<lzo>();
+    case rle:   return new Decompressor<rle>();
+    }
+    return NULL;
+}
+
+class CompressionFrame
+{
+public:
+    CompressionFrame(size_t capacity) : rawSize(0), compressed(NULL), compressedSize(0), errors(new services::ErrorCollection())
+    {
+        errors->setCanThrow(false);
+        raw = (byte *)daal::services::daal_malloc(capacity);
+    }
+
+    ~CompressionFrame()
+    {
+        if(raw) { daal::services::daal_free(raw); }
+        if(compressed) { daal::services::daal_free(compressed); }
+    }
+
+    /* Compresses the raw data of the frame with a compressor of the frame and releases the raw data */
+    void compress(CompressionMethod method, CompressionLevel level)
+    {
+        CompressorImpl *compressor = createCompressor(method, level);
+        if(!compressor) { errors->add(services::ErrorIncorrectParameter); return; }
+
+        size_t capacity = rawSize + rawSize / 16 + 64;
+        compressed = (byte *)daal::services::daal_malloc(capacity);
+        compressor->setInputDataBlock(raw, rawSize, 0);
+        do
+        {
+            if(compressed && compressedSize == capacity)
+            {
+                byte *extended = (byte *)daal::services::daal_malloc(2 * capacity);
+                if(extended) { daal::services::daal_memcpy_s(extended, 2 * capacity, compressed, compressedSize); }
+                daal::services::daal_free(compressed);
+                compressed = extended;
+                capacity *= 2;
+            }
+            if(!compressed) { errors->add(services::ErrorMemoryAllocationFailed); break; }
+
+            compressor->run(compressed + compressedSize, capacity - compressedSize, 0);
+            compressedSize += compressor->getUsedOutputDataBlockSize();
+            if(compressor->isOutputDataBlockFull()) { compressedSize = capacity; }
+        }
+        while(compressor->isOutputDataBlockFull() && compressor->getErrors()->size() == 0);
+
+        if(compressor->getErrors()->size() != 0) { errors->add(*(compressor->getErrors())); }
+        delete compressor;
+
+        daal::services::daal_free(raw);
+        raw = NULL;
+    }
+
+    byte *raw;
+    size_t rawSize;
+    byte *compressed;
+    size_t compressedSize;
+    services::SharedPtr<services::ErrorCollection> errors;
+
+private:
+    CompressionFrame(const CompressionFrame &);
+    CompressionFrame &operator=(const CompressionFrame &);
+};
+
+typedef services::Collection<services::SharedPtr<CompressionFrame> > CFC;
+
+//framed compression stream realization
+FramedCompressionStream::FramedCompressionStream(CompressionMethod method, CompressionLevel level, size_t frameSize) :
+    _frames(NULL), _method(method), _level(level), _frameSize(frameSize), _nCompressedFrames(0), _readOffset(0),
+    _isFinalized(false), _header(NULL), _headerSize(0), _errors(new services::ErrorCollection())
+{
+    this->_errors->setCanThrow(false);
+    if(frameSize == 0 || method < zlib || method > bzip2)
+    {
+        this->_errors->add(services::ErrorIncorrectParameter);
+        return;
+    }
+    _frames = (void *) new CFC;
+}
+
+FramedCompressionStream::~FramedCompressionStream()
+{
+    if(_frames) { delete (CFC *)_frames; }
+    if(_header) { daal::services::daal_free(_header); }
+}
+
+void FramedCompressionStream::compressFrames()
+{
+    CFC &frames = *(CFC *)_frames;
+    size_t nFrames = frames.size();
+    if(!_isFinalized && nFrames > 0 && frames[nFrames - 1]->rawSize < _frameSize)
+    {
+        nFrames--;
+    }
+    if(nFrames <= _nCompressedFrames)
+    {
+        return;
+    }
+
+    const size_t first = _nCompressedFrames;
+    const size_t nTasks = nFrames - first;
+    const CompressionMethod method = _method;
+    const CompressionLevel level = _level;
+    services::SharedPtr<CompressionFrame> *framesPtr = &frames[0];
+    daal::threader_for((int)nTasks, (int)nTasks, [ = ](int i)
+    {
+        framesPtr[first + i]->compress(method, level);
+    });
+
+    for(size_t i = first; i < nFrames; i++)
+    {
+        if(frames[i]->errors->size() != 0) { this->_errors->add(*(frames[i]->errors)); }
+    }
+    _nCompressedFrames = nFrames;
+}
+
+void FramedCompressionStream::push_back(DataBlock *block)
+{
+    if(this->_errors->size() != 0)
+    {
+        return;
+    }
+
+    //checkParams;
+    if ( block == NULL || block->getPtr() == NULL )
+    {
+        this->_errors->add(services::ErrorCompressionNullInputStream);
+        return;
+    }
+    if ( block->getSize() == 0 )
+    {
+        this->_errors->add(services::ErrorCompressionEmptyInputStream);
+        return;
+    }
+    if ( _isFinalized )
+    {
+        this->_errors->add(services::ErrorCompressionFramedStreamIsFinalized);
+        return;
+    }
+    //end checkParams;
+
+    CFC &frames = *(CFC *)_frames;
+    const byte *inPtr = block->getPtr();
+    size_t leftSize = block->getSize();
+    while(leftSize > 0)
+    {
+        if(frames.size() == 0 || frames[frames.size() - 1]->rawSize == _frameSize)
+        {
+            services::SharedPtr<CompressionFrame> frame(new CompressionFrame(_frameSize));
+            if(!frame->raw)
+            {
+                this->_errors->add(services::ErrorMemoryAllocationFailed);
+                return;
+            }
+            frames.push_back(frame);
+        }
+        CompressionFrame *frame = frames[frames.size() - 1].get();
+        size_t copySize = _frameSize - frame->rawSize;
+        copySize = (copySize < leftSize ? copySize : leftSize);
+        daal::services::daal_memcpy_s(frame->raw + frame->rawSize, _frameSize - frame->rawSize, inPtr, copySize);
+        frame->rawSize += copySize;
+        inPtr += copySize;
+        leftSize -= copySize;
+    }
+
+    /* Compress the completed frames once there is enough of them to load all the threads */
+    if(frames.size() - _nCompressedFrames > (size_t)threader_get_max_threads_number())
+    {
+        compressFrames();
+    }
+}
+
+void FramedCompressionStream::finalize()
+{
+    if(_isFinalized || this->_errors->size() != 0)
+    {
+        return;
+    }
+    _isFinalized = true;
+    compressFrames();
+    if(this->_errors->size() != 0)
+    {
+        return;
+    }
+
+    CFC &frames = *(CFC *)_frames;
+    const size_t nFrames = frames.size();
+    _headerSize = framedStreamHeaderSize + nFrames * framedStreamIndexEntrySize;
+    _header = (byte *)daal::services::daal_malloc(_headerSize);
+    if(!_header)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    byte *ptr = _header;
+    daal::services::daal_memcpy_s(ptr, 4, framedStreamMagic, 4);
+    ptr += 4;
+    ptr = storeLittleEndian(ptr, framedStreamVersion, sizeof(unsigned int));
+    ptr = storeLittleEndian(ptr, (DAAL_UINT64)_method, sizeof(unsigned int));
+    ptr = storeLittleEndian(ptr, 0, sizeof(unsigned int));
+    ptr = storeLittleEndian(ptr, (DAAL_UINT64)_frameSize, sizeof(DAAL_UINT64));
+    ptr = storeLittleEndian(ptr, (DAAL_UINT64)nFrames, sizeof(DAAL_UINT64));
+    for(size_t i = 0; i < nFrames; i++)
+    {
+        ptr = storeLittleEndian(ptr, (DAAL_UINT64)frames[i]->compressedSize, sizeof(DAAL_UINT64));
+        ptr = storeLittleEndian(ptr, (DAAL_UINT64)frames[i]->rawSize, sizeof(DAAL_UINT64));
+    }
+}
+
+size_t FramedCompressionStream::getNumberOfFrames()
+{
+    if(this->_errors->size() != 0)
+    {
+        return 0;
+    }
+    return (*(CFC *)_frames).size();
+}
+
+size_t FramedCompressionStream::getCompressedDataSize()
+{
+    finalize();
+    if(this->_errors->size() != 0)
+    {
+        return 0;
+    }
+
+    CFC &frames = *(CFC *)_frames;
+    size_t size = _headerSize;
+    for(size_t i = 0; i < frames.size(); i++)
+    {
+        size += frames[i]->compressedSize;
+    }
+    return size - _readOffset;
+}
+
+size_t FramedCompressionStream::copyCompressedArray(byte *ptr, size_t size)
+{
+    finalize();
+    if(this->_errors->size() != 0)
+    {
+        return 0;
+    }
+    //checkParams;
+    if ( ptr == NULL )
+    {
+        this->_errors->add(services::ErrorCompressionNullOutputStream);
+        return 0;
+    }
+    if ( size == 0 )
+    {
+        this->_errors->add(services::ErrorCompressionEmptyOutputStream);
+        return 0;
+    }
+    //end checkParams;
+
+    /* The compressed data is the header followed by the frames, _readOffset is the position in this sequence */
+    CFC &frames = *(CFC *)_frames;
+    size_t readSize = 0;
+    size_t partOffset = 0;
+    for(size_t i = 0; i <= frames.size() && readSize < size; i++)
+    {
+        const byte *partPtr = (i == 0 ? _header : frames[i - 1]->compressed);
+        const size_t partSize = (i == 0 ? _headerSize : frames[i - 1]->compressedSize);
+        if(_readOffset < partOffset + partSize)
+        {
+            const size_t start = _readOffset - partOffset;
+            size_t rs = partSize - start;
+            rs = (rs < size - readSize ? rs : size - readSize);
+            daal::services::daal_memcpy_s(ptr + readSize, size - readSize, partPtr + start, rs);
+            readSize += rs;
+            _readOffset += rs;
+        }
+        partOffset += partSize;
+    }
+    return readSize;
+}
+
+/* Decompresses a complete frame of the framed stream to the array of the size of the raw frame */
+static void decompressFrameData(CompressionMethod method, byte *inPtr, size_t inSize, byte *outPtr, size_t rawSize,
+                                services::ErrorCollection &errors)
+{
+    DecompressorImpl *decompressor = createDecompressor(method);
+    if(!decompressor) { errors.add(services::ErrorCompressionFramedDataFormat); return; }
+
+    decompressor->setInputDataBlock(inPtr, inSize, 0);
+    size_t usedSize = 0;
+    while(decompressor->getErrors()->size() == 0 && usedSize < rawSize)
+    {
+        decompressor->run(outPtr + usedSize, rawSize - usedSize, 0);
+        usedSize += decompressor->getUsedOutputDataBlockSize();
+        if(!decompressor->isOutputDataBlockFull()) { break; }
+    }
+
+    if(decompressor->getErrors()->size() != 0)
+    {
+        errors.add(*(decompressor->getErrors()));
+    }
+    else if(usedSize != rawSize)
+    {
+        errors.add(services::ErrorCompressionFramedDataFormat);
+    }
+    delete decompressor;
+}
+
+struct FramedDecompressionData
+{
+    FramedDecompressionData() : buffer(NULL), size(0), capacity(0), method(zlib), nFrames(0),
+        compressedOffsets(NULL), rawOffsets(NULL) {}
+
+    ~FramedDecompressionData()
+    {
+        clearIndex();
+        if(buffer) { daal::services::daal_free(buffer); }
+    }
+
+    void clearIndex()
+    {
+        if(compressedOffsets) { daal::services::daal_free(compressedOffsets); compressedOffsets = NULL; }
+        if(rawOffsets) { daal::services::daal_free(rawOffsets); rawOffsets = NULL; }
+        nFrames = 0;
+    }
+
+    bool append(const byte *ptr, size_t n)
+    {
+        if(size + n > capacity)
+        {
+            size_t newCapacity = (2 * capacity > size + n ? 2 * capacity : size + n);
+            byte *newBuffer = (byte *)daal::services::daal_malloc(newCapacity);
+            if(!newBuffer) { return false; }
+            if(buffer)
+            {
+                daal::services::daal_memcpy_s(newBuffer, newCapacity, buffer, size);
+                daal::services::daal_free(buffer);
+            }
+            buffer = newBuffer;
+            capacity = newCapacity;
+        }
+        daal::services::daal_memcpy_s(buffer + size, capacity - size, ptr, n);
+        size += n;
+        return true;
+    }
+
+    byte *buffer;
+    size_t size;
+    size_t capacity;
+
+    CompressionMethod method;
+    size_t nFrames;
+    size_t *compressedOffsets;  /* nFrames + 1 offsets of the frames in the buffer */
+    size_t *rawOffsets;         /* nFrames + 1 offsets of the frames in the decompressed data */
+};
+
+//framed decompression stream realization
+FramedDecompressionStream::FramedDecompressionStream(DecompressorImpl *legacyDecompr, size_t minSize) :
+    _data(NULL), _legacyDecompressor(legacyDecompr), _legacyStream(NULL), _minBlockSize(minSize), _readOffset(0), _isParsed(false),
+    _errors(new services::ErrorCollection())
+{
+    this->_errors->setCanThrow(false);
+    if(minSize == 0)
+    {
+        this->_errors->add(services::ErrorIncorrectParameter);
+        return;
+    }
+    _data = (void *) new FramedDecompressionData;
+}
+
+FramedDecompressionStream::~FramedDecompressionStream()
+{
+    if(_data) { delete (FramedDecompressionData *)_data; }
+    if(_legacyStream) { delete _legacyStream; }
+}
+
+void FramedDecompressionStream::push_back(DataBlock *block)
+{
+    if(this->_errors->size() != 0)
+    {
+        return;
+    }
+    //checkParams;
+    if ( block == NULL || block->getPtr() == NULL )
+    {
+        this->_errors->add(services::ErrorCompressionNullInputStream);
+        return;
+    }
+    if ( block->getSize() == 0 )
+    {
+        this->_errors->add(services::ErrorCompressionEmptyInputStream);
+        return;
+    }
+    //end checkParams;
+
+    if(_legacyStream)
+    {
+        _legacyStream->push_back(block);
+        if(_legacyStream->getErrors()->size() != 0) { this->_errors->add(*(_legacyStream->getErrors())); }
+        return;
+    }
+
+    if(!((FramedDecompressionData *)_data)->append(block->getPtr(), block->getSize()))
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+    _isParsed = false;
+}
+
+bool FramedDecompressionStream::parse()
+{
+    if(this->_errors->size() != 0 || _legacyStream)
+    {
+        return false;
+    }
+    if(_isParsed)
+    {
+        return true;
+    }
+
+    FramedDecompressionData &data = *(FramedDecompressionData *)_data;
+    data.clearIndex();
+
+    bool isFramed = (data.size >= 4);
+    for(size_t i = 0; i < 4 && isFramed; i++)
+    {
+        isFramed = (data.buffer[i] == framedStreamMagic[i]);
+    }
+
+    if(!isFramed)
+    {
+        /* Data of the single-stream format is decompressed serially */
+        if(!_legacyDecompressor)
+        {
+            this->_errors->add(services::ErrorCompressionFramedDataFormat);
+            return false;
+        }
+        _legacyStream = new DecompressionStream(_legacyDecompressor, _minBlockSize);
+        if(data.size > 0)
+        {
+            DataBlock block(data.buffer, data.size);
+            _legacyStream->push_back(&block);
+        }
+        if(_legacyStream->getErrors()->size() != 0) { this->_errors->add(*(_legacyStream->getErrors())); }
+        daal::services::daal_free(data.buffer);
+        data.buffer = NULL;
+        data.size = data.capacity = 0;
+        return false;
+    }
+
+    DAAL_UINT64 fields[3] = { 0, 0, 0 };
+    DAAL_UINT64 sizes[2] = { 0, 0 };
+    if(data.size >= framedStreamHeaderSize)
+    {
+        const byte *ptr = data.buffer + 4;
+        for(size_t i = 0; i < 3; i++, ptr += sizeof(unsigned int)) { fields[i] = loadLittleEndian(ptr, sizeof(unsigned int)); }
+        for(size_t i = 0; i < 2; i++, ptr += sizeof(DAAL_UINT64)) { sizes[i] = loadLittleEndian(ptr, sizeof(DAAL_UINT64)); }
+    }
+    const DAAL_UINT64 frameSize = sizes[0];
+    const size_t nFrames = (size_t)sizes[1];
+    if(data.size < framedStreamHeaderSize || fields[0] == 0 || fields[0] > framedStreamVersion || fields[1] > (DAAL_UINT64)bzip2 ||
+       frameSize == 0 || sizes[1] > (DAAL_UINT64)((data.size - framedStreamHeaderSize) / framedStreamIndexEntrySize))
+    {
+        this->_errors->add(services::ErrorCompressionFramedDataFormat);
+        return false;
+    }
+
+    data.compressedOffsets = (size_t *)daal::services::daal_malloc((nFrames + 1) * sizeof(size_t));
+    data.rawOffsets = (size_t *)daal::services::daal_malloc((nFrames + 1) * sizeof(size_t));
+    if(!data.compressedOffsets || !data.rawOffsets)
+    {
+        data.clearIndex();
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return false;
+    }
+
+    data.method = (CompressionMethod)fields[1];
+    data.nFrames = nFrames;
+    data.compressedOffsets[0] = framedStreamHeaderSize + nFrames * framedStreamIndexEntrySize;
+    data.rawOffsets[0] = 0;
+    const byte *entryPtr = data.buffer + framedStreamHeaderSize;
+    bool isValid = true;
+    for(size_t i = 0; i < nFrames && isValid; i++, entryPtr += framedStreamIndexEntrySize)
+    {
+        const DAAL_UINT64 compressedSize = loadLittleEndian(entryPtr, sizeof(DAAL_UINT64));
+        const DAAL_UINT64 rawSize = loadLittleEndian(entryPtr + sizeof(DAAL_UINT64), sizeof(DAAL_UINT64));
+
+        /* Frames must lie within the data, and a frame cannot hold more raw data than the frame size */
+        isValid = (compressedSize <= (DAAL_UINT64)(data.size - data.compressedOffsets[i]) && rawSize <= frameSize &&
+                   rawSize <= (DAAL_UINT64)((size_t)-1 - data.rawOffsets[i]));
+        if(isValid)
+        {
+            data.compressedOffsets[i + 1] = data.compressedOffsets[i] + (size_t)compressedSize;
+            data.rawOffsets[i + 1] = data.rawOffsets[i] + (size_t)rawSize;
+        }
+    }
+    if(!isValid || data.compressedOffsets[nFrames] != data.size)
+    {
+        data.clearIndex();
+        this->_errors->add(services::ErrorCompressionFramedDataFormat);
+        return false;
+    }
+
+    _isParsed = true;
+    return true;
+}
+
+void FramedDecompressionStream::decompressFrames(size_t firstFrame, size_t lastFrame, size_t offset, byte *outPtr, size_t outSize)
+{
+    FramedDecompressionData &data = *(FramedDecompressionData *)_data;
+    const size_t nTasks = lastFrame - firstFrame;
+    services::Collection<services::SharedPtr<services::ErrorCollection> > frameErrors(nTasks);
+    for(size_t i = 0; i < nTasks; i++)
+    {
+        frameErrors[i] = services::SharedPtr<services::ErrorCollection>(new services::ErrorCollection());
+        frameErrors[i]->setCanThrow(false);
+    }
+
+    const FramedDecompressionData *dataPtr = &data;
+    services::SharedPtr<services::ErrorCollection> *errorsPtr = &frameErrors[0];
+    daal::threader_for((int)nTasks, (int)nTasks, [ = ](int i)
+    {
+        const size_t frame = firstFrame + i;
+        const size_t rawStart = dataPtr->rawOffsets[frame];
+        const size_t rawSize = dataPtr->rawOffsets[frame + 1] - rawStart;
+        byte *inPtr = dataPtr->buffer + dataPtr->compressedOffsets[frame];
+        const size_t inSize = dataPtr->compressedOffsets[frame + 1] - dataPtr->compressedOffsets[frame];
+
+        /* Frames that lie within the output array are decompressed in place, the boundary frames via a buffer */
+        if(rawStart >= offset && rawStart + rawSize <= offset + outSize)
+        {
+            decompressFrameData(dataPtr->method, inPtr, inSize, outPtr + (rawStart - offset), rawSize, *errorsPtr[i]);
+            return;
+        }
+
+        byte *frameBuffer = (byte *)daal::services::daal_malloc(rawSize);
+        if(!frameBuffer) { errorsPtr[i]->add(services::ErrorMemoryAllocationFailed); return; }
+        decompressFrameData(dataPtr->method, inPtr, inSize, frameBuffer, rawSize, *errorsPtr[i]);
+        if(errorsPtr[i]->size() == 0)
+        {
+            const size_t copyStart = (rawStart > offset ? rawStart : offset);
+            const size_t copyEnd = (rawStart + rawSize < offset + outSize ? rawStart + rawSize : offset + outSize);
+            daal::services::daal_memcpy_s(outPtr + (copyStart - offset), outSize - (copyStart - offset),
+                                          frameBuffer + (copyStart - rawStart), copyEnd - copyStart);
+        }
+        daal::services::daal_free(frameBuffer);
+    });
+
+    for(size_t i = 0; i < nTasks; i++)
+    {
+        if(frameErrors[i]->size() != 0) { this->_errors->add(*frameErrors[i]); }
+    }
+}
+
+size_t FramedDecompressionStream::getNumberOfFrames()
+{
+    if(!parse())
+    {
+        return 0;
+    }
+    return ((FramedDecompressionData *)_data)->nFrames;
+}
+
+size_t FramedDecompressionStream::getFrameSize(size_t frame)
+{
+    if(!parse())
+    {
+        return 0;
+    }
+    FramedDecompressionData &data = *(FramedDecompressionData *)_data;
+    if(frame >= data.nFrames)
+    {
+        this->_errors->add(services::ErrorCompressionFrameIndexOutOfRange);
+        return 0;
+    }
+    return data.rawOffsets[frame + 1] - data.rawOffsets[frame];
+}
+
+size_t FramedDecompressionStream::decompressFrame(size_t frame, byte *ptr, size_t size)
+{
+    const size_t frameSize = getFrameSize(frame);
+    if(this->_errors->size() != 0)
+    {
+        return 0;
+    }
+    if(_legacyStream)
+    {
+        this->_errors->add(services::ErrorCompressionFrameIndexOutOfRange);
+        return 0;
+    }
+    if ( ptr == NULL )
+    {
+        this->_errors->add(services::ErrorCompressionNullOutputStream);
+        return 0;
+    }
+    if ( size < frameSize )
+    {
+        this->_errors->add(services::ErrorCompressionEmptyOutputStream);
+        return 0;
+    }
+
+    FramedDecompressionData &data = *(FramedDecompressionData *)_data;
+    decompressFrameData(data.method, data.buffer + data.compressedOffsets[frame],
+                        data.compressedOffsets[frame + 1] - data.compressedOffsets[frame], ptr, frameSize, *(this->_errors));
+    return (this->_errors->size() == 0 ? frameSize : 0);
+}
+
+size_t FramedDecompressionStream::getDecompressedDataSize()
+{
+    if(!parse())
+    {
+        if(!_legacyStream || this->_errors->size() != 0)
+        {
+            return 0;
+        }
+        size_t size = _legacyStream->getDecompressedDataSize();
+        if(_legacyStream->getErrors()->size() != 0) { this->_errors->add(*(_legacyStream->getErrors())); }
+        return size;
+    }
+    FramedDecompressionData &data = *(FramedDecompressionData *)_data;
+    return data.rawOffsets[data.nFrames] - _readOffset;
+}
+
+size_t FramedDecompressionStream::copyDecompressedArray(byte *ptr, size_t size)
+{
+    if(this->_errors->size() != 0)
+    {
+        return 0;
+    }
+    //checkParams;
+    if ( ptr == NULL )
+    {
+        this->_errors->add(services::ErrorCompressionNullOutputStream);
+        return 0;
+    }
+    if ( size == 0 )
+    {
+        this->_errors->add(services::ErrorCompressionEmptyOutputStream);
+        return 0;
+    }
+    //end checkParams;
+
+    if(!parse())
+    {
+        if(!_legacyStream || this->_errors->size() != 0)
+        {
+            return 0;
+        }
+        size_t readSize = _legacyStream->copyDecompressedArray(ptr, size);
+        if(_legacyStream->getErrors()->size() != 0) { this->_errors->add(*(_legacyStream->getErrors())); }
+        return readSize;
+    }
+
+    FramedDecompressionData &data = *(FramedDecompressionData *)_data;
+    const size_t totalSize = data.rawOffsets[data.nFrames];
+    const size_t readSize = (totalSize - _readOffset < size ? totalSize - _readOffset : size);
+    if(readSize == 0)
+    {
+        return 0;
+    }
+
+    size_t firstFrame = 0;
+    while(data.rawOffsets[firstFrame + 1] <= _readOffset) { firstFrame++; }
+    size_t lastFrame = firstFrame;
+    while(lastFrame < data.nFrames && data.rawOffsets[lastFrame] < _readOffset + readSize) { lastFrame++; }
+
+    decompressFrames(firstFrame, lastFrame, _readOffset, ptr, readSize);
+    if(this->_errors->size() != 0)
+    {
+        return 0;
+    }
+    _readOffset += readSize;
+    return readSize;
+}
+
 } //namespace data_management
 } //namespace daal